@@ -0,0 +1,93 @@
+// Fixture generator for the end-to-end perf scenario (`make perf`).
+// Writes the seeded synthetic ING DE ledger as twelve statement files -
+// the way a year of real exports arrives, one download per month - so
+// scripts/perf_scenario.py can drive the actual import pipeline twelve
+// times against a cold database. The rows come from the same
+// SyntheticLedger the envelope tests and micro-benchmarks use, so every
+// perf gate measures the same ledger.
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <fmt/format.h>
+#include "support/SyntheticLedger.hpp"
+
+namespace {
+
+constexpr int kStatements = 12;
+
+// Split the single CSV the fixture produces into the metadata/column
+// header and its data rows. The header block ends at the column header
+// line (the one starting with "Buchung;").
+auto headerEnd(std::string_view csv) -> std::size_t {
+    std::size_t pos = 0;
+    while (pos < csv.size()) {
+        auto lineEnd = csv.find('\n', pos);
+        if (lineEnd == std::string_view::npos) {
+            return csv.size();
+        }
+        if (csv.compare(pos, 8, "Buchung;") == 0) {
+            return lineEnd + 1;
+        }
+        pos = lineEnd + 1;
+    }
+    return csv.size();
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 2 || argc > 4) {
+        fmt::print(stderr, "usage: ares_perf_fixture <out-dir> [rows] [seed]\n");
+        return 1;
+    }
+
+    ares::test::SyntheticLedgerOptions options;
+    if (argc > 2) {
+        options.rows = static_cast<std::size_t>(std::strtoull(argv[2], nullptr, 10));
+    }
+    if (argc > 3) {
+        options.seed = static_cast<std::uint32_t>(std::strtoul(argv[3], nullptr, 10));
+    }
+
+    std::filesystem::path outDir{argv[1]};
+    std::error_code ec;
+    std::filesystem::create_directories(outDir, ec);
+    if (ec) {
+        fmt::print(stderr, "error: cannot create {}: {}\n", outDir.string(), ec.message());
+        return 1;
+    }
+
+    auto csv = ares::test::syntheticIngDeCsv(options);
+    std::string_view header{csv.data(), headerEnd(csv)};
+    std::string_view body{csv.data() + header.size(), csv.size() - header.size()};
+
+    // Rows are date-ordered, so twelve contiguous slices are twelve
+    // consecutive statement periods. Slice on line boundaries.
+    std::size_t pos = 0;
+    for (int statement = 1; statement <= kStatements; ++statement) {
+        auto targetEnd = body.size() * static_cast<std::size_t>(statement) / kStatements;
+        auto sliceEnd = statement == kStatements ? body.size() : body.find('\n', targetEnd);
+        if (sliceEnd == std::string_view::npos) {
+            sliceEnd = body.size();
+        } else if (sliceEnd < body.size()) {
+            ++sliceEnd;  // keep the newline with its row
+        }
+
+        auto path = outDir / fmt::format("statement-{:02}.csv", statement);
+        std::ofstream file{path, std::ios::binary | std::ios::trunc};
+        if (!file) {
+            fmt::print(stderr, "error: cannot write {}\n", path.string());
+            return 1;
+        }
+        file.write(header.data(), static_cast<std::streamsize>(header.size()));
+        file.write(body.data() + pos, static_cast<std::streamsize>(sliceEnd - pos));
+        pos = sliceEnd;
+    }
+
+    fmt::print("Wrote {} statements ({} rows, seed {}) to {}\n",
+               kStatements, options.rows, options.seed, outDir.string());
+    return 0;
+}
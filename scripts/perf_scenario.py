@@ -0,0 +1,186 @@
+#!/usr/bin/env python3
+"""End-to-end performance regression harness (`make perf`).
+
+Runs a fixed scenario against a fresh database built from the synthetic
+100k-row ledger: import twelve monthly ING statements, re-categorize,
+scan for duplicates, render the overview, the yearly report, and a CSV
+export. Each command runs in its own `ares` process - cold start
+included, which is what a CLI user actually pays - with `--timings-json`
+capturing the per-phase breakdown (and allocation counts when the binary
+was built with ARES_ALLOC_ACCOUNTING).
+
+The results land in a JSON report and are diffed against a stored
+baseline; a command that slowed down by more than the threshold (and by
+more than a noise floor in absolute terms) fails the run. Record a
+baseline on a quiet machine with --write-baseline (`make perf-baseline`).
+"""
+
+import argparse
+import json
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+from pathlib import Path
+
+
+def parse_args():
+    repo = Path(__file__).resolve().parent.parent
+    p = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    p.add_argument("--binary", default=str(repo / "build-bench" / "ares"),
+                   help="ares binary to measure")
+    p.add_argument("--fixture-bin", default=str(repo / "build-bench" / "ares_perf_fixture"),
+                   help="statement generator built alongside the benchmarks")
+    p.add_argument("--rows", type=int, default=100_000,
+                   help="ledger size (default matches the perf envelopes)")
+    p.add_argument("--seed", type=int, default=42)
+    p.add_argument("--baseline", default=str(repo / "benchmarks" / "perf-baseline.json"))
+    p.add_argument("--report", default=str(repo / "build-bench" / "perf-report.json"))
+    p.add_argument("--threshold", type=float, default=0.20,
+                   help="relative wall-time regression that fails a command (default 0.20)")
+    p.add_argument("--alloc-threshold", type=float, default=0.25,
+                   help="relative allocated-bytes regression that fails a command")
+    p.add_argument("--noise-floor-ms", type=float, default=20.0,
+                   help="absolute slowdown below which a command never fails")
+    p.add_argument("--write-baseline", action="store_true",
+                   help="store this run as the new baseline instead of diffing")
+    return p.parse_args()
+
+
+class Scenario:
+    """Runs ares commands in a scratch HOME so the real ~/.ares and
+    ~/.cache/ares are never touched and every run starts cold."""
+
+    def __init__(self, binary, scratch):
+        self.binary = binary
+        self.scratch = scratch
+        self.timings_file = scratch / "timings.json"
+        self.env = dict(os.environ,
+                        HOME=str(scratch),
+                        XDG_CACHE_HOME=str(scratch / "cache"))
+        self.commands = {}  # name -> {"wallMs", "phases", "allocBytes"}
+
+    def run(self, name, args):
+        self.timings_file.unlink(missing_ok=True)
+        argv = [self.binary, "--timings-json", str(self.timings_file)] + args
+        start = time.monotonic()
+        result = subprocess.run(argv, env=self.env,
+                                stdout=subprocess.DEVNULL, stderr=subprocess.PIPE)
+        wall_ms = (time.monotonic() - start) * 1000.0
+        if result.returncode != 0:
+            sys.stderr.write(result.stderr.decode(errors="replace"))
+            sys.exit(f"error: `ares {' '.join(args)}` exited {result.returncode}")
+
+        phases, alloc_bytes = {}, None
+        if self.timings_file.exists():
+            timings = json.loads(self.timings_file.read_text())
+            for phase in timings.get("phases", []):
+                phases[phase["name"]] = phases.get(phase["name"], 0.0) + phase["ms"]
+            if "alloc" in timings:
+                alloc_bytes = timings["alloc"]["bytes"]
+
+        entry = self.commands.setdefault(name, {"wallMs": 0.0, "phases": {}, "allocBytes": None})
+        entry["wallMs"] += wall_ms
+        for phase, ms in phases.items():
+            entry["phases"][phase] = entry["phases"].get(phase, 0.0) + ms
+        if alloc_bytes is not None:
+            entry["allocBytes"] = (entry["allocBytes"] or 0) + alloc_bytes
+        print(f"  {name:<16} {' '.join(args):<44} {wall_ms:8.1f} ms")
+
+
+def generate_statements(fixture_bin, out_dir, rows, seed):
+    result = subprocess.run([fixture_bin, str(out_dir), str(rows), str(seed)])
+    if result.returncode != 0:
+        sys.exit(f"error: {fixture_bin} exited {result.returncode}")
+    statements = sorted(out_dir.glob("statement-*.csv"))
+    if len(statements) != 12:
+        sys.exit(f"error: expected 12 statements in {out_dir}, found {len(statements)}")
+    return statements
+
+
+def diff(baseline, report, args):
+    failures = []
+    print(f"\n{'Command':<16} {'Baseline':>10} {'Current':>10} {'Delta':>8}")
+    print("-" * 48)
+    for name, current in report["commands"].items():
+        old = baseline["commands"].get(name)
+        if old is None:
+            print(f"{name:<16} {'-':>10} {current['wallMs']:>8.1f}ms    (new)")
+            continue
+        delta = current["wallMs"] - old["wallMs"]
+        ratio = delta / old["wallMs"] if old["wallMs"] > 0 else 0.0
+        flag = ""
+        if delta > args.noise_floor_ms and ratio > args.threshold:
+            flag = "  FAIL"
+            failures.append(f"{name}: {old['wallMs']:.1f} ms -> {current['wallMs']:.1f} ms "
+                            f"(+{ratio:.0%}, threshold {args.threshold:.0%})")
+        print(f"{name:<16} {old['wallMs']:>8.1f}ms {current['wallMs']:>8.1f}ms "
+              f"{ratio:>+7.1%}{flag}")
+
+        old_alloc, new_alloc = old.get("allocBytes"), current.get("allocBytes")
+        if old_alloc and new_alloc:
+            growth = (new_alloc - old_alloc) / old_alloc
+            if growth > args.alloc_threshold:
+                failures.append(f"{name}: allocated {old_alloc} -> {new_alloc} bytes "
+                                f"(+{growth:.0%}, threshold {args.alloc_threshold:.0%})")
+    return failures
+
+
+def main():
+    args = parse_args()
+    for required in (args.binary, args.fixture_bin):
+        if not Path(required).exists():
+            sys.exit(f"error: {required} not found (run via `make perf`)")
+
+    scratch = Path(tempfile.mkdtemp(prefix="ares-perf-"))
+    try:
+        print(f"Scenario scratch: {scratch}")
+        statements = generate_statements(Path(args.fixture_bin), scratch / "statements",
+                                         args.rows, args.seed)
+
+        scenario = Scenario(args.binary, scratch)
+        for statement in statements:
+            scenario.run("import", ["import", str(statement)])
+        scenario.run("categorize", ["categorize"])
+        scenario.run("duplicates", ["duplicates"])
+        scenario.run("overview", ["overview"])
+        scenario.run("report-yearly", ["report", "yearly", "--year", "2025"])
+        scenario.run("export-csv", ["export", "csv", "--output", str(scratch / "export.csv")])
+    finally:
+        shutil.rmtree(scratch, ignore_errors=True)
+
+    report = {
+        "meta": {"rows": args.rows, "seed": args.seed, "binary": args.binary,
+                 "recordedAt": time.strftime("%Y-%m-%dT%H:%M:%S%z")},
+        "commands": scenario.commands,
+    }
+    report_path = Path(args.report)
+    report_path.parent.mkdir(parents=True, exist_ok=True)
+    report_path.write_text(json.dumps(report, indent=2) + "\n")
+    print(f"\nReport: {report_path}")
+
+    baseline_path = Path(args.baseline)
+    if args.write_baseline:
+        baseline_path.parent.mkdir(parents=True, exist_ok=True)
+        baseline_path.write_text(json.dumps(report, indent=2) + "\n")
+        print(f"Baseline recorded: {baseline_path}")
+        return 0
+    if not baseline_path.exists():
+        print(f"No baseline at {baseline_path} - record one with `make perf-baseline`.")
+        return 0
+
+    baseline = json.loads(baseline_path.read_text())
+    failures = diff(baseline, report, args)
+    if failures:
+        print("\nPerformance regressions:")
+        for failure in failures:
+            print(f"  {failure}")
+        return 1
+    print("\nNo regressions against baseline.")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
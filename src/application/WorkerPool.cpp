@@ -0,0 +1,106 @@
+#include "application/WorkerPool.hpp"
+#include <algorithm>
+#include <latch>
+
+namespace ares::application {
+
+WorkerPool::WorkerPool(unsigned workerCount)
+    : workerCount_{workerCount != 0
+                       ? workerCount
+                       : std::max(1u, std::thread::hardware_concurrency())}
+{
+    workers_.reserve(workerCount_);
+    for (unsigned w = 0; w < workerCount_; ++w) {
+        workers_.emplace_back([this](std::stop_token stop) { runWorker(stop); });
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    for (auto& worker : workers_) {
+        worker.request_stop();
+    }
+    cv_.notify_all();
+    // jthread destructors join; stopped workers finish their current task
+    // but leave the rest of the queue behind
+}
+
+auto WorkerPool::shared() -> WorkerPool& {
+    static WorkerPool pool;
+    return pool;
+}
+
+auto WorkerPool::workerCount() const noexcept -> unsigned {
+    return workerCount_;
+}
+
+auto WorkerPool::submit(std::function<void()> task) -> void {
+    {
+        std::lock_guard lock{mutex_};
+        tasks_.push_back(std::move(task));
+    }
+    cv_.notify_one();
+}
+
+auto WorkerPool::parallelFor(std::size_t count, std::size_t shardCount, const ShardBody& body)
+    -> void
+{
+    if (count == 0) {
+        return;
+    }
+    shardCount = std::clamp<std::size_t>(shardCount, 1, count);
+    auto shardSize = (count + shardCount - 1) / shardCount;
+
+    if (shardCount == 1) {
+        body(0, 0, count);
+        return;
+    }
+
+    std::latch remaining{static_cast<std::ptrdiff_t>(shardCount - 1)};
+    for (std::size_t s = 1; s < shardCount; ++s) {
+        submit([&body, &remaining, s, shardSize, count] {
+            auto begin = std::min(count, s * shardSize);
+            auto end = std::min(count, begin + shardSize);
+            body(s, begin, end);
+            remaining.count_down();
+        });
+    }
+
+    body(0, 0, shardSize);
+
+    // Help drain the queue instead of blocking outright: with every
+    // caller working, a pool saturated by concurrent parallelFor calls
+    // still progresses, and the stolen tasks count their own latches
+    while (!remaining.try_wait()) {
+        if (!runOneTask()) {
+            remaining.wait();
+            break;
+        }
+    }
+}
+
+auto WorkerPool::runWorker(const std::stop_token& stop) -> void {
+    std::unique_lock lock{mutex_};
+    while (cv_.wait(lock, stop, [this] { return !tasks_.empty(); })) {
+        auto task = std::move(tasks_.front());
+        tasks_.pop_front();
+        lock.unlock();
+        task();
+        lock.lock();
+    }
+}
+
+auto WorkerPool::runOneTask() -> bool {
+    std::function<void()> task;
+    {
+        std::lock_guard lock{mutex_};
+        if (tasks_.empty()) {
+            return false;
+        }
+        task = std::move(tasks_.front());
+        tasks_.pop_front();
+    }
+    task();
+    return true;
+}
+
+} // namespace ares::application
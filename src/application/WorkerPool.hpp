@@ -0,0 +1,64 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ares::application {
+
+// Shared worker pool for the application layer. Import, recategorization,
+// duplicate scanning and report binning all want the machine's cores; if
+// each spawned its own threads, concurrent features would oversubscribe.
+// Instead they share one pool, sized to hardware concurrency and started
+// lazily on first use.
+//
+// parallelFor partitions a range into contiguous shards: shard 0 runs on
+// the calling thread and the rest go through the task queue. While
+// waiting, the caller helps drain the queue, so a saturated pool still
+// makes progress and nested calls cannot deadlock it.
+class WorkerPool {
+public:
+    // 0 = one worker per hardware thread
+    explicit WorkerPool(unsigned workerCount = 0);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    auto operator=(const WorkerPool&) -> WorkerPool& = delete;
+
+    // The process-wide pool, constructed on first use
+    [[nodiscard]] static auto shared() -> WorkerPool&;
+
+    [[nodiscard]] auto workerCount() const noexcept -> unsigned;
+
+    // Fire-and-forget task submission
+    auto submit(std::function<void()> task) -> void;
+
+    // Invoked once per shard with the shard index and its [begin, end)
+    // slice of the range
+    using ShardBody = std::function<void(std::size_t shard, std::size_t begin, std::size_t end)>;
+
+    // Runs `body` over [0, count) in `shardCount` contiguous shards and
+    // blocks until all of them finish. Shard counts are clamped to the
+    // range size; a single shard runs inline with no queue traffic.
+    // Callers keep their own shard-count heuristics (rows per worker,
+    // bucket counts, ...) and size per-shard accumulators accordingly.
+    auto parallelFor(std::size_t count, std::size_t shardCount, const ShardBody& body) -> void;
+
+private:
+    unsigned workerCount_;
+    std::mutex mutex_;
+    std::condition_variable_any cv_;
+    std::deque<std::function<void()>> tasks_;
+    std::vector<std::jthread> workers_;
+
+    auto runWorker(const std::stop_token& stop) -> void;
+
+    // Pops one queued task and runs it; false if the queue was empty
+    auto runOneTask() -> bool;
+};
+
+} // namespace ares::application
@@ -0,0 +1,113 @@
+#include "application/services/AmortizationEngine.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace ares::application::services {
+
+namespace {
+
+// Projection horizon guard: a century of months. Anything longer is
+// treated as unreachable rather than looping unbounded on degenerate
+// rate/payment combinations.
+constexpr int kMaxMonths = 1200;
+
+auto addMonths(core::Date date, int months) -> core::Date {
+    int ym = static_cast<int>(date.year()) * 12 +
+             static_cast<int>(static_cast<unsigned>(date.month())) - 1 + months;
+    return core::Date{std::chrono::year{ym / 12},
+                      std::chrono::month{static_cast<unsigned>(ym % 12) + 1},
+                      std::chrono::day{1}};
+}
+
+// Closed-form annuity month count: n = -ln(1 - r*B/P) / ln(1+r).
+// Only used to size the loop and reject unreachable payoffs early; the
+// exact count can differ by one month from the integer recurrence
+// because of cent rounding, so the loop still decides when to stop.
+auto closedFormMonths(int64_t balanceCents, int64_t paymentCents, double monthlyRate) -> int {
+    if (monthlyRate <= 0.0) {
+        return static_cast<int>((balanceCents + paymentCents - 1) / paymentCents);
+    }
+    double ratio = monthlyRate * static_cast<double>(balanceCents)
+                   / static_cast<double>(paymentCents);
+    if (ratio >= 1.0) {
+        return kMaxMonths + 1;  // payment never outruns the interest
+    }
+    return static_cast<int>(std::ceil(-std::log1p(-ratio) / std::log1p(monthlyRate)));
+}
+
+} // namespace
+
+auto AmortizationEngine::shared() -> AmortizationEngine& {
+    static AmortizationEngine engine;
+    return engine;
+}
+
+auto AmortizationEngine::computeSchedule(const core::Credit& credit, core::Date asOf)
+    -> AmortizationSchedule
+{
+    AmortizationSchedule schedule;
+    schedule.payoffDate = addMonths(asOf, 0);
+
+    int64_t balance = credit.currentBalance().cents();
+    int64_t payment = credit.minimumPayment().cents();
+    if (balance <= 0) {
+        return schedule;
+    }
+    if (payment <= 0) {
+        schedule.payoffReachable = false;
+        return schedule;
+    }
+
+    double monthlyRate = credit.interestRate() / 12.0;
+    auto estimate = closedFormMonths(balance, payment, monthlyRate);
+    if (estimate > kMaxMonths) {
+        schedule.payoffReachable = false;
+        return schedule;
+    }
+    schedule.balanceTrajectoryCents.reserve(static_cast<std::size_t>(estimate) + 1);
+
+    // Integer recurrence in cents: interest accrues on the running
+    // balance, the rest of the payment retires principal, and the final
+    // payment shrinks to whatever is left
+    while (balance > 0 && schedule.monthsToPayoff <= kMaxMonths) {
+        auto interest = static_cast<int64_t>(std::llround(
+            static_cast<double>(balance) * monthlyRate));
+        if (payment <= interest) {
+            schedule.payoffReachable = false;
+            schedule.balanceTrajectoryCents.clear();
+            return schedule;
+        }
+        schedule.totalInterestCents += interest;
+        balance = std::max<int64_t>(0, balance - (payment - interest));
+        schedule.balanceTrajectoryCents.push_back(balance);
+        ++schedule.monthsToPayoff;
+    }
+
+    schedule.payoffDate = addMonths(asOf, schedule.monthsToPayoff);
+    return schedule;
+}
+
+auto AmortizationEngine::scheduleFor(const core::Credit& credit, core::Date asOf)
+    -> AmortizationSchedule
+{
+    CacheKey key{
+        .balanceCents = credit.currentBalance().cents(),
+        .paymentCents = credit.minimumPayment().cents(),
+        .interestRate = credit.interestRate(),
+        .asOfMonth = static_cast<int64_t>(static_cast<int>(asOf.year())) * 100 +
+                     static_cast<unsigned>(asOf.month())
+    };
+
+    std::lock_guard lock{mutex_};
+    auto it = cache_.find(credit.id().value);
+    if (it != cache_.end() && it->second.key == key) {
+        return it->second.schedule;
+    }
+
+    auto schedule = computeSchedule(credit, asOf);
+    cache_[credit.id().value] = CacheEntry{.key = key, .schedule = schedule};
+    return schedule;
+}
+
+} // namespace ares::application::services
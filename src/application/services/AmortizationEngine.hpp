@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "core/common/Types.hpp"
+#include "core/credit/Credit.hpp"
+
+namespace ares::application::services {
+
+struct AmortizationSchedule {
+    // Whole payment months until the balance reaches zero; 0 when the
+    // credit is already paid off
+    int monthsToPayoff{0};
+    int64_t totalInterestCents{0};
+    core::Date payoffDate;
+    // False when the minimum payment does not even cover the monthly
+    // interest - the balance grows forever and the fields above are
+    // meaningless
+    bool payoffReachable{true};
+    // End-of-month balances in cents, one entry per payment month
+    std::vector<int64_t> balanceTrajectoryCents;
+};
+
+// Payoff projections from Credit::interestRate and minimumPayment. The
+// month count comes from the closed-form annuity formula (O(1), and it
+// sizes the trajectory up front); the cent-exact interest total and
+// balance trajectory come from the integer recurrence, which cannot
+// drift the way repeated floating-point compounding would. Schedules
+// are memoized per credit and recomputed only when balance, payment,
+// rate or the projection month changes, so a daemon re-rendering
+// `credits list --projection` pays the month loop once per change.
+class AmortizationEngine {
+public:
+    AmortizationEngine() = default;
+
+    // Process-wide engine so the memo survives across daemon renders
+    [[nodiscard]] static auto shared() -> AmortizationEngine&;
+
+    // Projected schedule as of the first payment month after asOf.
+    // Served from the memo when the credit's inputs are unchanged.
+    [[nodiscard]] auto scheduleFor(const core::Credit& credit, core::Date asOf)
+        -> AmortizationSchedule;
+
+    // Pure computation, no memo - what scheduleFor fills its cache with
+    [[nodiscard]] static auto computeSchedule(const core::Credit& credit, core::Date asOf)
+        -> AmortizationSchedule;
+
+private:
+    // The inputs a schedule depends on; comparing them is the
+    // invalidation, so balance updates and recorded payments take effect
+    // on the next render with no explicit hooks
+    struct CacheKey {
+        int64_t balanceCents{0};
+        int64_t paymentCents{0};
+        double interestRate{0.0};
+        int64_t asOfMonth{0};
+
+        auto operator==(const CacheKey&) const -> bool = default;
+    };
+
+    struct CacheEntry {
+        CacheKey key;
+        AmortizationSchedule schedule;
+    };
+
+    std::mutex mutex_;
+    std::unordered_map<std::string, CacheEntry> cache_;
+};
+
+} // namespace ares::application::services
@@ -0,0 +1,235 @@
+#include "application/services/ArchiveService.hpp"
+#include <chrono>
+#include <string>
+#include <fmt/format.h>
+#include <sqlite3.h>
+#include "core/common/CivilDate.hpp"
+
+namespace ares::application::services {
+
+namespace {
+
+// First day of the calendar month keepMonths whole months before asOf's
+// month. Month-aligned on purpose: the rollup rebuild preserves archived
+// months by month key, so the boundary must never split a month.
+auto horizonCutoff(core::Date asOf, int keepMonths) -> core::Date {
+    int ym = static_cast<int>(asOf.year()) * 12 +
+             static_cast<int>(static_cast<unsigned>(asOf.month())) - 1 - keepMonths;
+    return core::Date{std::chrono::year{ym / 12},
+                      std::chrono::month{static_cast<unsigned>(ym % 12) + 1},
+                      std::chrono::day{1}};
+}
+
+// Paths go into ATTACH as SQL string literals; doubling quotes is the
+// only escaping SQLite needs
+auto escapeSqlLiteral(std::string text) -> std::string {
+    std::string escaped;
+    escaped.reserve(text.size());
+    for (char c : text) {
+        escaped += c;
+        if (c == '\'') {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+auto attachArchive(infrastructure::persistence::DatabaseConnection& db,
+                   const std::filesystem::path& archivePath)
+    -> std::expected<void, core::Error>
+{
+    return db.execute(fmt::format("ATTACH DATABASE '{}' AS archive",
+                                  escapeSqlLiteral(archivePath.string())));
+}
+
+auto countRows(infrastructure::persistence::DatabaseConnection& db, const std::string& sql)
+    -> std::expected<int, core::Error>
+{
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v2(db.handle(), sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
+        return std::unexpected(core::DatabaseError{
+            .operation = "prepare archive count",
+            .message = sqlite3_errmsg(db.handle())
+        });
+    }
+
+    int count = 0;
+    if (sqlite3_step(stmt) == SQLITE_ROW) {
+        count = sqlite3_column_int(stmt, 0);
+    }
+    sqlite3_finalize(stmt);
+    return count;
+}
+
+// The archive table mirrors the hot transactions table column for column
+// (sans the accounts foreign key - accounts stay hot), so the move and
+// the union view are both plain SELECTs. The date indexes cover the
+// range scans full-history reads issue against the cold side.
+constexpr const char* kArchiveSchema = R"(
+    CREATE TABLE IF NOT EXISTS archive.transactions (
+        id TEXT PRIMARY KEY,
+        account_id TEXT NOT NULL,
+        date INTEGER NOT NULL,
+        amount_cents INTEGER NOT NULL,
+        currency INTEGER DEFAULT 0,
+        type INTEGER NOT NULL,
+        category INTEGER DEFAULT 0,
+        description TEXT,
+        counterparty_name TEXT,
+        counterparty_iban TEXT,
+        raw_description TEXT,
+        mutation_code TEXT,
+        is_recurring INTEGER DEFAULT 0,
+        frequency TEXT,
+        is_active INTEGER DEFAULT 1,
+        user_category_override INTEGER,
+        created_at TEXT DEFAULT CURRENT_TIMESTAMP,
+        matched_rule TEXT,
+        content_hash TEXT,
+        merchant TEXT
+    );
+
+    CREATE INDEX IF NOT EXISTS archive.idx_archive_transactions_date
+        ON transactions(date);
+    CREATE INDEX IF NOT EXISTS archive.idx_archive_transactions_account_date
+        ON transactions(account_id, date);
+)";
+
+// Archives written before the hot table gained the merchant column (v13)
+// need it appended, or the union view's sides disagree on column count.
+// The duplicate-column error on up-to-date archives is the expected case
+// and is swallowed.
+auto ensureArchiveMerchantColumn(infrastructure::persistence::DatabaseConnection& db) -> void {
+    (void)db.execute("ALTER TABLE archive.transactions ADD COLUMN merchant TEXT");
+}
+
+} // namespace
+
+auto ArchiveService::archiveOlderThan(infrastructure::persistence::DatabaseConnection& db,
+                                      const std::filesystem::path& archivePath,
+                                      int keepMonths,
+                                      core::Date asOf)
+    -> std::expected<ArchiveRunResult, core::Error>
+{
+    auto cutoff = horizonCutoff(asOf, keepMonths);
+    auto cutoffDay = core::civil::toEpochDay(cutoff);
+
+    if (auto attached = attachArchive(db, archivePath); !attached) {
+        return std::unexpected(attached.error());
+    }
+    if (auto schema = db.execute(kArchiveSchema); !schema) {
+        (void)db.execute("DETACH DATABASE archive");
+        return std::unexpected(schema.error());
+    }
+    ensureArchiveMerchantColumn(db);
+
+    auto moveCount = countRows(
+        db, fmt::format("SELECT COUNT(*) FROM main.transactions WHERE date < {}", cutoffDay));
+    if (!moveCount) {
+        (void)db.execute("DETACH DATABASE archive");
+        return std::unexpected(moveCount.error());
+    }
+
+    // Move and horizon update are one transaction; the delete fires the
+    // FTS triggers, so the hot search index shrinks with the table. The
+    // rollups are deliberately untouched - archived months keep their
+    // rows, and the rebuild only regenerates months past the cutoff.
+    auto moveSql = fmt::format(R"(
+        BEGIN TRANSACTION;
+        INSERT OR REPLACE INTO archive.transactions
+        SELECT id, account_id, date, amount_cents, currency, type, category,
+               description, counterparty_name, counterparty_iban, raw_description,
+               mutation_code, is_recurring, frequency, is_active,
+               user_category_override, created_at, matched_rule, content_hash,
+               merchant
+        FROM main.transactions WHERE date < {0};
+        DELETE FROM main.transactions WHERE date < {0};
+        UPDATE archive_state SET cutoff_epoch_day = MAX(cutoff_epoch_day, {0});
+        COMMIT;
+    )", cutoffDay);
+
+    if (auto moved = db.execute(moveSql); !moved) {
+        (void)db.execute("ROLLBACK");
+        (void)db.execute("DETACH DATABASE archive");
+        return std::unexpected(moved.error());
+    }
+
+    if (auto detached = db.execute("DETACH DATABASE archive"); !detached) {
+        return std::unexpected(detached.error());
+    }
+
+    // Reclaim the moved rows' pages so the hot file - and every backup of
+    // it - actually shrinks. Outside the transaction; VACUUM cannot nest.
+    if (*moveCount > 0) {
+        if (auto vacuumed = db.execute("VACUUM"); !vacuumed) {
+            return std::unexpected(vacuumed.error());
+        }
+    }
+
+    return ArchiveRunResult{.archivedRows = *moveCount, .cutoff = cutoff};
+}
+
+auto ArchiveService::status(infrastructure::persistence::DatabaseConnection& db,
+                            const std::filesystem::path& archivePath)
+    -> std::expected<ArchiveStatus, core::Error>
+{
+    ArchiveStatus result;
+
+    auto hot = countRows(db, "SELECT COUNT(*) FROM main.transactions");
+    if (!hot) {
+        return std::unexpected(hot.error());
+    }
+    result.hotRows = *hot;
+
+    auto cutoffDay = countRows(db, "SELECT cutoff_epoch_day FROM archive_state");
+    if (!cutoffDay) {
+        return std::unexpected(cutoffDay.error());
+    }
+    if (*cutoffDay > 0) {
+        result.cutoff = core::civil::fromEpochDay(*cutoffDay);
+    }
+
+    if (std::filesystem::exists(archivePath)) {
+        // A separate read-only connection: the caller's connection may
+        // already have the archive attached under the full-history view
+        auto archiveDb = infrastructure::persistence::DatabaseConnection::openReadOnly(archivePath);
+        if (!archiveDb) {
+            return std::unexpected(archiveDb.error());
+        }
+        auto archived = countRows(**archiveDb, "SELECT COUNT(*) FROM transactions");
+        if (!archived) {
+            return std::unexpected(archived.error());
+        }
+        result.archivedRows = *archived;
+    }
+
+    return result;
+}
+
+auto ArchiveService::attachFullHistory(infrastructure::persistence::DatabaseConnection& db,
+                                       const std::filesystem::path& archivePath)
+    -> std::expected<bool, core::Error>
+{
+    if (!std::filesystem::exists(archivePath)) {
+        return false;
+    }
+
+    if (auto attached = attachArchive(db, archivePath); !attached) {
+        return std::unexpected(attached.error());
+    }
+    ensureArchiveMerchantColumn(db);
+
+    // Temp objects shadow main in unqualified name lookup, so every read
+    // query on this connection now spans both databases unchanged
+    auto view = db.execute(
+        "CREATE TEMP VIEW IF NOT EXISTS transactions AS "
+        "SELECT * FROM main.transactions "
+        "UNION ALL SELECT * FROM archive.transactions");
+    if (!view) {
+        return std::unexpected(view.error());
+    }
+
+    return true;
+}
+
+} // namespace ares::application::services
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <expected>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include "core/common/Error.hpp"
+#include "core/common/Types.hpp"
+#include "infrastructure/persistence/DatabaseConnection.hpp"
+
+namespace ares::application::services {
+
+struct ArchiveRunResult {
+    int archivedRows{0};
+    core::Date cutoff;  // first day still held in the hot database
+};
+
+struct ArchiveStatus {
+    int hotRows{0};
+    int archivedRows{0};
+    std::optional<core::Date> cutoff;  // empty until the first archive run
+};
+
+// Hot/cold partitioning of the transaction history. Rows older than a
+// month-aligned horizon move into a separate archive database, so scans,
+// duplicate probes and backups of the hot database stay proportional to
+// recent data. The monthly rollups keep their archived months (the
+// rebuild only touches months past the cutoff), so month-aligned
+// aggregates remain full-history without the archive attached; raw-row
+// reads over the full history go through attachFullHistory, which
+// shadows `transactions` with a temp view unioning both databases.
+class ArchiveService {
+public:
+    ArchiveService() = default;
+
+    // Moves every transaction older than keepMonths whole calendar months
+    // (counted back from asOf's month) into the archive database, creating
+    // it on first use. Move and horizon update are one transaction; the
+    // hot database is vacuumed afterwards so its file - and every backup
+    // of it - actually shrinks. Re-running with a longer horizon is a
+    // no-op: the cutoff never moves backwards.
+    [[nodiscard]] auto archiveOlderThan(infrastructure::persistence::DatabaseConnection& db,
+                                        const std::filesystem::path& archivePath,
+                                        int keepMonths,
+                                        core::Date asOf)
+        -> std::expected<ArchiveRunResult, core::Error>;
+
+    // Row counts on both sides of the horizon, for `archive status`
+    [[nodiscard]] auto status(infrastructure::persistence::DatabaseConnection& db,
+                              const std::filesystem::path& archivePath)
+        -> std::expected<ArchiveStatus, core::Error>;
+
+    // Attaches the archive and shadows `transactions` with a temp view
+    // over main plus archive. Temp objects win unqualified name lookup,
+    // so every existing read query transparently becomes full-history on
+    // this connection; writes fail loudly (the view is not updatable), so
+    // this is strictly for reporting connections. Returns false when no
+    // archive database exists and leaves the connection untouched.
+    [[nodiscard]] static auto attachFullHistory(infrastructure::persistence::DatabaseConnection& db,
+                                                const std::filesystem::path& archivePath)
+        -> std::expected<bool, core::Error>;
+};
+
+} // namespace ares::application::services
@@ -1,12 +1,108 @@
 #include "application/services/BackupService.hpp"
 #include <algorithm>
+#include <array>
 #include <chrono>
+#include <cstdint>
 #include <ctime>
 #include <fstream>
+#include <optional>
 #include <fmt/format.h>
+#include <sqlite3.h>
+#include <zlib.h>
+#include "infrastructure/compression/Gzip.hpp"
 
 namespace ares::application::services {
 
+namespace {
+
+// Pages copied per backup_step call. Small enough that a concurrent writer
+// is never locked out for the whole copy, large enough to finish quickly.
+constexpr int kPagesPerStep = 64;
+
+// FNV-1a over the database content; same dependency-free fingerprint the
+// import ledger uses for change detection. Reads through gzread, which
+// handles gzipped and plain files alike, so fingerprints stay comparable
+// between compressed and uncompressed backups.
+auto fileFingerprint(const std::filesystem::path& path) -> std::optional<std::uint64_t> {
+    gzFile file = gzopen(path.c_str(), "rb");
+    if (!file) {
+        return std::nullopt;
+    }
+
+    constexpr std::uint64_t kOffsetBasis = 14695981039346656037ULL;
+    constexpr std::uint64_t kPrime = 1099511628211ULL;
+
+    std::uint64_t hash = kOffsetBasis;
+    std::array<char, 65536> buffer{};
+    int bytesRead = 0;
+    while ((bytesRead = gzread(file, buffer.data(), static_cast<unsigned>(buffer.size()))) > 0) {
+        for (int i = 0; i < bytesRead; ++i) {
+            hash ^= static_cast<unsigned char>(buffer[static_cast<std::size_t>(i)]);
+            hash *= kPrime;
+        }
+    }
+    bool failed = bytesRead < 0;
+    gzclose(file);
+    if (failed) {
+        return std::nullopt;
+    }
+    return hash;
+}
+
+// Copy the live database into destPath with the SQLite online backup API,
+// stepping a few pages at a time. Unlike a filesystem copy this is safe
+// against concurrent writers and picks up WAL content that has not been
+// checkpointed into the main file yet.
+auto onlineCopy(const std::filesystem::path& dbPath, const std::filesystem::path& destPath)
+    -> std::expected<void, core::Error>
+{
+    sqlite3* source = nullptr;
+    if (sqlite3_open_v2(dbPath.c_str(), &source, SQLITE_OPEN_READONLY, nullptr) != SQLITE_OK) {
+        std::string message = source ? sqlite3_errmsg(source) : "cannot open database";
+        sqlite3_close(source);
+        return std::unexpected(core::DatabaseError{"backup", message});
+    }
+
+    sqlite3* dest = nullptr;
+    if (sqlite3_open(destPath.c_str(), &dest) != SQLITE_OK) {
+        std::string message = dest ? sqlite3_errmsg(dest) : "cannot open backup file";
+        sqlite3_close(dest);
+        sqlite3_close(source);
+        return std::unexpected(core::DatabaseError{"backup", message});
+    }
+
+    auto* backup = sqlite3_backup_init(dest, "main", source, "main");
+    if (!backup) {
+        std::string message = sqlite3_errmsg(dest);
+        sqlite3_close(dest);
+        sqlite3_close(source);
+        return std::unexpected(core::DatabaseError{"backup", message});
+    }
+
+    int rc = SQLITE_OK;
+    do {
+        rc = sqlite3_backup_step(backup, kPagesPerStep);
+        if (rc == SQLITE_BUSY || rc == SQLITE_LOCKED) {
+            sqlite3_sleep(25);
+            rc = SQLITE_OK;
+        }
+    } while (rc == SQLITE_OK);
+
+    sqlite3_backup_finish(backup);
+    if (rc != SQLITE_DONE) {
+        std::string message = sqlite3_errmsg(dest);
+        sqlite3_close(dest);
+        sqlite3_close(source);
+        return std::unexpected(core::DatabaseError{"backup", message});
+    }
+
+    sqlite3_close(dest);
+    sqlite3_close(source);
+    return {};
+}
+
+} // namespace
+
 auto BackupService::getHomeDir() const
     -> std::expected<std::filesystem::path, core::Error>
 {
@@ -33,7 +129,7 @@ auto BackupService::getBackupDir() const -> std::filesystem::path {
     return *homeResult / ".ares" / "backups";
 }
 
-auto BackupService::createBackup()
+auto BackupService::createBackup(bool compress)
     -> std::expected<BackupInfo, core::Error>
 {
     auto homeResult = getHomeDir();
@@ -61,14 +157,55 @@ auto BackupService::createBackup()
     auto filename = fmt::format("ares-{:04d}-{:02d}-{:02d}-{:02d}{:02d}{:02d}.db",
         tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday,
         tm.tm_hour, tm.tm_min, tm.tm_sec);
+    if (compress) {
+        filename += ".gz";
+    }
 
     auto backupPath = backupDir / filename;
 
-    std::filesystem::copy_file(dbPath, backupPath,
-        std::filesystem::copy_options::overwrite_existing, ec);
+    // Copy into a temp file first so a failed or skipped backup never
+    // leaves a partial ares-*.db behind for listBackups to pick up
+    auto copyPath = backupDir / (filename + ".copy.tmp");
+    if (auto copied = onlineCopy(dbPath, copyPath); !copied) {
+        std::filesystem::remove(copyPath, ec);
+        return std::unexpected(copied.error());
+    }
+
+    auto stagingPath = copyPath;
+    if (compress) {
+        stagingPath = backupDir / (filename + ".tmp");
+        auto compressed = infrastructure::compression::compressFile(copyPath, stagingPath);
+        std::filesystem::remove(copyPath, ec);
+        if (!compressed) {
+            std::filesystem::remove(stagingPath, ec);
+            return std::unexpected(compressed.error());
+        }
+    }
+
+    // Skip if nothing changed since the newest existing backup. The online
+    // copy output is canonical (no WAL/journal noise), so comparing against
+    // the previous backup is an exact change check; fingerprints hash the
+    // decompressed content, so the check also holds across a switch between
+    // plain and gzipped backups.
+    auto existing = listBackups();
+    if (existing && !existing->empty()) {
+        const auto& newest = existing->front();
+        auto newestHash = fileFingerprint(newest.path);
+        auto stagedHash = fileFingerprint(stagingPath);
+        if (newestHash && stagedHash && *newestHash == *stagedHash) {
+            std::filesystem::remove(stagingPath, ec);
+            auto info = newest;
+            info.unchanged = true;
+            return info;
+        }
+    }
+
+    std::filesystem::rename(stagingPath, backupPath, ec);
     if (ec) {
+        std::error_code cleanupEc;
+        std::filesystem::remove(stagingPath, cleanupEc);
         return std::unexpected(core::IoError{backupPath.string(),
-            fmt::format("failed to copy database: {}", ec.message())});
+            fmt::format("failed to finalize backup: {}", ec.message())});
     }
 
     auto fileSize = std::filesystem::file_size(backupPath, ec);
@@ -95,10 +232,33 @@ auto BackupService::restore(const std::filesystem::path& backupFile)
         return std::unexpected(core::IoError{backupFile.string(), "backup file does not exist"});
     }
 
+    // Gzipped backups are decompressed into a staging file first, then go
+    // through the same validation as plain ones
+    auto sourceFile = backupFile;
+    std::filesystem::path decompressedPath;
+    std::error_code cleanupEc;
+    if (infrastructure::compression::isGzipFile(backupFile)) {
+        decompressedPath = backupFile;
+        decompressedPath += ".restore.tmp";
+        auto decompressed =
+            infrastructure::compression::decompressFile(backupFile, decompressedPath);
+        if (!decompressed) {
+            std::filesystem::remove(decompressedPath, cleanupEc);
+            return std::unexpected(decompressed.error());
+        }
+        sourceFile = decompressedPath;
+    }
+    auto removeStaging = [&] {
+        if (!decompressedPath.empty()) {
+            std::filesystem::remove(decompressedPath, cleanupEc);
+        }
+    };
+
     // Verify the file looks like a valid SQLite database
-    std::ifstream file(backupFile, std::ios::binary);
+    std::ifstream file(sourceFile, std::ios::binary);
     if (!file.is_open()) {
-        return std::unexpected(core::IoError{backupFile.string(), "cannot open backup file"});
+        removeStaging();
+        return std::unexpected(core::IoError{sourceFile.string(), "cannot open backup file"});
     }
 
     // SQLite files start with "SQLite format 3\000"
@@ -108,12 +268,14 @@ auto BackupService::restore(const std::filesystem::path& backupFile)
     file.close();
 
     if (header != sqliteHeader) {
+        removeStaging();
         return std::unexpected(core::ValidationError{"backup file",
             "file does not appear to be a valid SQLite database"});
     }
 
     auto homeResult = getHomeDir();
     if (!homeResult) {
+        removeStaging();
         return std::unexpected(homeResult.error());
     }
 
@@ -123,12 +285,14 @@ auto BackupService::restore(const std::filesystem::path& backupFile)
     std::error_code ec;
     std::filesystem::create_directories(dbPath.parent_path(), ec);
     if (ec) {
+        removeStaging();
         return std::unexpected(core::IoError{dbPath.parent_path().string(),
             fmt::format("failed to create data directory: {}", ec.message())});
     }
 
-    std::filesystem::copy_file(backupFile, dbPath,
+    std::filesystem::copy_file(sourceFile, dbPath,
         std::filesystem::copy_options::overwrite_existing, ec);
+    removeStaging();
     if (ec) {
         return std::unexpected(core::IoError{dbPath.string(),
             fmt::format("failed to restore database: {}", ec.message())});
@@ -160,8 +324,9 @@ auto BackupService::listBackups()
         }
 
         auto filename = entry.path().filename().string();
-        // Only include files matching the ares-*.db pattern
-        if (filename.starts_with("ares-") && filename.ends_with(".db")) {
+        // Only include files matching the ares-*.db / ares-*.db.gz pattern
+        if (filename.starts_with("ares-")
+            && (filename.ends_with(".db") || filename.ends_with(".db.gz"))) {
             auto fileSize = entry.file_size(ec);
             if (ec) {
                 fileSize = 0;
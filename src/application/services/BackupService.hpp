@@ -13,15 +13,22 @@ struct BackupInfo {
     std::string filename;
     std::uintmax_t sizeBytes;
     std::string createdAt;  // formatted timestamp
+    bool unchanged{false};  // true when createBackup skipped because the
+                            // content matches the newest existing backup
 };
 
 class BackupService {
 public:
     BackupService() = default;
 
-    [[nodiscard]] auto createBackup()
+    // compress gzips the copy as a streaming stage; worthwhile for slow
+    // (network-mounted) backup directories, where the smaller write wins
+    // back far more than the compression costs
+    [[nodiscard]] auto createBackup(bool compress = false)
         -> std::expected<BackupInfo, core::Error>;
 
+    // Accepts plain and gzipped backups; compressed ones are decompressed
+    // transparently before validation
     [[nodiscard]] auto restore(const std::filesystem::path& backupFile)
         -> std::expected<void, core::Error>;
 
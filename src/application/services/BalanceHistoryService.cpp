@@ -0,0 +1,160 @@
+#include "application/services/BalanceHistoryService.hpp"
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include "application/WorkerPool.hpp"
+#include "core/common/CivilDate.hpp"
+
+namespace ares::application::services {
+
+namespace {
+
+using infrastructure::persistence::MonthlyNetFlow;
+
+// Sum of net flows in months strictly after `month`. The flows are
+// ascending, so this is one binary search plus a suffix walk.
+auto flowAfterMonth(const std::vector<MonthlyNetFlow>& flows, int64_t month)
+    -> int64_t
+{
+    auto it = std::upper_bound(
+        flows.begin(), flows.end(), month,
+        [](int64_t m, const MonthlyNetFlow& flow) { return m < flow.month; });
+    int64_t sum = 0;
+    for (; it != flows.end(); ++it) {
+        sum += it->netCents;
+    }
+    return sum;
+}
+
+auto previousMonth(int64_t month) -> int64_t {
+    return month % 100 == 1 ? month - 89 : month - 1;  // yyyy01 -> (yyyy-1)12
+}
+
+} // namespace
+
+auto BalanceHistoryService::monthEndBalances(
+    infrastructure::persistence::SqliteTransactionRepository& txnRepo,
+    const core::Account& account, int months, core::Date asOf)
+    -> std::expected<std::vector<MonthEndBalance>, core::Error>
+{
+    auto flows = txnRepo.monthlyNetFlow(account.id());
+    if (!flows) {
+        return std::unexpected(flows.error());
+    }
+
+    // The anchor is the balance after every recorded transaction, so the
+    // end-of-month balance is the anchor minus everything that flowed in
+    // later months
+    auto anchorCents = account.balance().cents();
+    auto currency = account.balance().currency();
+
+    std::vector<int64_t> wanted;
+    wanted.reserve(static_cast<std::size_t>(std::max(months, 0)));
+    for (auto month = core::civil::monthKey(asOf);
+         static_cast<int>(wanted.size()) < months;
+         month = previousMonth(month)) {
+        wanted.push_back(month);
+    }
+
+    std::vector<MonthEndBalance> series;
+    series.reserve(wanted.size());
+    for (auto it = wanted.rbegin(); it != wanted.rend(); ++it) {
+        series.push_back(MonthEndBalance{
+            .month = *it,
+            .balance = core::Money{anchorCents - flowAfterMonth(*flows, *it),
+                                   currency}
+        });
+    }
+    return series;
+}
+
+auto BalanceHistoryService::monthEndBalancesForAccounts(
+    infrastructure::persistence::SqliteTransactionRepository& writableRepo,
+    infrastructure::persistence::ReadConnectionPool& pool,
+    const std::vector<core::Account>& accounts, int months, core::Date asOf)
+    -> std::expected<std::vector<AccountBalanceHistory>, core::Error>
+{
+    std::vector<AccountBalanceHistory> results;
+    if (accounts.empty()) {
+        return results;
+    }
+
+    // Rollups must be fresh before read-only connections serve from them
+    if (auto fresh = writableRepo.ensureRollupsFresh(); !fresh) {
+        return std::unexpected(fresh.error());
+    }
+
+    results.reserve(accounts.size());
+    for (const auto& account : accounts) {
+        results.push_back(AccountBalanceHistory{.account = account, .series = {}});
+    }
+
+    // One shard per account up to the pool size: each shard holds one
+    // connection lease for its whole slice, so leases never outnumber
+    // connections and acquire() cannot block the pool against itself
+    auto shardCount = std::min(accounts.size(), pool.size());
+    std::vector<std::optional<core::Error>> shardErrors(shardCount);
+
+    WorkerPool::shared().parallelFor(
+        accounts.size(), shardCount,
+        [&](std::size_t shard, std::size_t begin, std::size_t end) {
+            auto lease = pool.acquire();
+            if (!lease) {
+                shardErrors[shard] = lease.error();
+                return;
+            }
+            // Non-owning handle: the lease keeps the connection alive for
+            // the duration of the shard
+            auto connection = std::shared_ptr<infrastructure::persistence::DatabaseConnection>(
+                &lease->connection(), [](auto*) {});
+            infrastructure::persistence::SqliteTransactionRepository repo{connection};
+
+            for (auto i = begin; i != end; ++i) {
+                auto series = monthEndBalances(repo, accounts[i], months, asOf);
+                if (!series) {
+                    shardErrors[shard] = series.error();
+                    return;
+                }
+                results[i].series = std::move(*series);
+            }
+        });
+
+    for (const auto& error : shardErrors) {
+        if (error) {
+            return std::unexpected(*error);
+        }
+    }
+    return results;
+}
+
+auto BalanceHistoryService::balanceAt(
+    infrastructure::persistence::SqliteTransactionRepository& txnRepo,
+    const core::Account& account, core::Date date)
+    -> std::expected<core::Money, core::Error>
+{
+    auto flows = txnRepo.monthlyNetFlow(account.id());
+    if (!flows) {
+        return std::unexpected(flows.error());
+    }
+
+    // Checkpoint part: whole months after the query date
+    auto afterMonths = flowAfterMonth(*flows, core::civil::monthKey(date));
+
+    // Replay part: the rest of the query date's own month
+    auto monthEnd = core::Date{std::chrono::year_month_day_last{
+        date.year(), std::chrono::month_day_last{date.month()}}};
+    int64_t partial = 0;
+    if (date < monthEnd) {
+        auto nextDay = core::civil::fromEpochDay(core::civil::toEpochDay(date) + 1);
+        auto replayed = txnRepo.netFlowBetween(account.id(), nextDay, monthEnd);
+        if (!replayed) {
+            return std::unexpected(replayed.error());
+        }
+        partial = *replayed;
+    }
+
+    return core::Money{account.balance().cents() - afterMonths - partial,
+                       account.balance().currency()};
+}
+
+} // namespace ares::application::services
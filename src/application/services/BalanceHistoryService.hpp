@@ -0,0 +1,61 @@
+#pragma once
+
+#include <expected>
+#include <vector>
+#include "core/account/Account.hpp"
+#include "core/common/Error.hpp"
+#include "core/common/Money.hpp"
+#include "core/common/Types.hpp"
+#include "infrastructure/persistence/ReadConnectionPool.hpp"
+#include "infrastructure/persistence/SqliteTransactionRepository.hpp"
+
+namespace ares::application::services {
+
+struct MonthEndBalance {
+    int64_t month;        // yyyymm
+    core::Money balance;  // balance at the end of that month
+};
+
+struct AccountBalanceHistory {
+    core::Account account;
+    std::vector<MonthEndBalance> series;
+};
+
+// Balance-over-time queries, anchored at the account's live balance (the
+// importer keeps it at the bank's reported Saldo). Month-end balances come
+// straight from the monthly rollup checkpoints - walking the per-month net
+// flows backwards from the anchor - so a series costs O(months of
+// history); a balance at an arbitrary date additionally replays at most
+// the remainder of one month through the (account, date) index.
+class BalanceHistoryService {
+public:
+    BalanceHistoryService() = default;
+
+    // The last `months` month-end balances up to and including the month
+    // of `asOf`, ascending. Months without transactions carry the previous
+    // balance forward.
+    [[nodiscard]] auto monthEndBalances(
+        infrastructure::persistence::SqliteTransactionRepository& txnRepo,
+        const core::Account& account, int months, core::Date asOf)
+        -> std::expected<std::vector<MonthEndBalance>, core::Error>;
+
+    // Month-end series for several accounts at once, in input order. The
+    // per-account queries are independent reads, so they fan out across
+    // pooled read-only connections on the shared worker pool and the total
+    // latency approaches the slowest single account instead of the sum.
+    // `writableRepo` is only used to rebuild the rollups up front when a
+    // bulk mutation left them dirty - read-only connections cannot.
+    [[nodiscard]] auto monthEndBalancesForAccounts(
+        infrastructure::persistence::SqliteTransactionRepository& writableRepo,
+        infrastructure::persistence::ReadConnectionPool& pool,
+        const std::vector<core::Account>& accounts, int months, core::Date asOf)
+        -> std::expected<std::vector<AccountBalanceHistory>, core::Error>;
+
+    // Balance at the end of an arbitrary day
+    [[nodiscard]] auto balanceAt(
+        infrastructure::persistence::SqliteTransactionRepository& txnRepo,
+        const core::Account& account, core::Date date)
+        -> std::expected<core::Money, core::Error>;
+};
+
+} // namespace ares::application::services
@@ -1,5 +1,6 @@
 #include "application/services/BudgetService.hpp"
 #include <algorithm>
+#include <array>
 #include <cmath>
 
 namespace ares::application::services {
@@ -13,59 +14,49 @@ auto BudgetService::calculateCurrentMonth(
     MonthlyBudget budget;
     budget.month = firstDayOfMonth(currentDate);
 
-    // Aggregate transactions for current month
-    std::map<core::TransactionCategory, core::Money> incomeMap;
-    std::map<core::TransactionCategory, core::Money> expenseMap;
-    std::map<core::TransactionCategory, int> incomeCount;
-    std::map<core::TransactionCategory, int> expenseCount;
+    // Aggregate transactions for current month. Sums stay in raw cents via
+    // MoneyAccumulator - the per-addition expected branch of Money::operator+
+    // is pure overhead in this loop - and are validated once at the end.
+    // Per-category bins index fixed arrays by the dense category enum, so
+    // the per-row path never allocates or walks a tree.
+    std::array<int64_t, core::kTransactionCategoryCount> incomeCents{};
+    std::array<int64_t, core::kTransactionCategoryCount> expenseCents{};
+    std::array<int, core::kTransactionCategoryCount> incomeCount{};
+    std::array<int, core::kTransactionCategoryCount> expenseCount{};
 
-    core::Money totalIncome{0, core::Currency::EUR};
-    core::Money totalExpenses{0, core::Currency::EUR};
+    core::MoneyAccumulator totalIncome;
+    core::MoneyAccumulator totalExpenses;
 
     for (const auto& txn : transactions) {
         if (!isInMonth(txn.date(), budget.month)) {
             continue;
         }
 
-        auto cat = txn.category();
+        auto cat = static_cast<std::size_t>(txn.category());
         if (txn.amount().isPositive()) {
-            auto it = incomeMap.find(cat);
-            if (it == incomeMap.end()) {
-                incomeMap[cat] = txn.amount();
-                incomeCount[cat] = 1;
-            } else {
-                if (auto sum = it->second + txn.amount()) {
-                    it->second = *sum;
-                }
-                incomeCount[cat]++;
-            }
-            if (auto sum = totalIncome + txn.amount()) {
-                totalIncome = *sum;
-            }
+            incomeCents[cat] += txn.amount().cents();
+            incomeCount[cat]++;
+            totalIncome.add(txn.amount());
         } else {
             auto absAmount = txn.amount().abs();
-            auto it = expenseMap.find(cat);
-            if (it == expenseMap.end()) {
-                expenseMap[cat] = absAmount;
-                expenseCount[cat] = 1;
-            } else {
-                if (auto sum = it->second + absAmount) {
-                    it->second = *sum;
-                }
-                expenseCount[cat]++;
-            }
-            if (auto sum = totalExpenses + absAmount) {
-                totalExpenses = *sum;
-            }
+            expenseCents[cat] += absAmount.cents();
+            expenseCount[cat]++;
+            totalExpenses.add(absAmount);
         }
     }
 
-    // Convert maps to vectors
-    for (const auto& [cat, amount] : incomeMap) {
-        budget.incomeByCategory.push_back({cat, amount, incomeCount[cat]});
-    }
-    for (const auto& [cat, amount] : expenseMap) {
-        budget.expensesByCategory.push_back({cat, amount, expenseCount[cat]});
+    // Convert touched bins to vectors
+    for (std::size_t cat = 0; cat < core::kTransactionCategoryCount; ++cat) {
+        if (incomeCount[cat] > 0) {
+            budget.incomeByCategory.push_back({static_cast<core::TransactionCategory>(cat),
+                                               core::Money{incomeCents[cat], core::Currency::EUR},
+                                               incomeCount[cat]});
+        }
+        if (expenseCount[cat] > 0) {
+            budget.expensesByCategory.push_back({static_cast<core::TransactionCategory>(cat),
+                                                 core::Money{expenseCents[cat], core::Currency::EUR},
+                                                 expenseCount[cat]});
+        }
     }
 
     // Sort by amount descending
@@ -74,6 +65,20 @@ auto BudgetService::calculateCurrentMonth(
     std::sort(budget.expensesByCategory.begin(), budget.expensesByCategory.end(),
               [](const auto& a, const auto& b) { return a.amount.cents() > b.amount.cents(); });
 
+    applyPatternsAndCredits(budget, patterns, credits,
+                            totalIncome.total().value_or(core::Money{0, core::Currency::EUR}),
+                            totalExpenses.total().value_or(core::Money{0, core::Currency::EUR}));
+
+    return budget;
+}
+
+auto BudgetService::applyPatternsAndCredits(
+    MonthlyBudget& budget,
+    const std::vector<core::RecurringPattern>& patterns,
+    const std::vector<core::Credit>& credits,
+    core::Money totalIncome,
+    core::Money totalExpenses) -> void
+{
     // Calculate fixed income/expenses from patterns (always shown)
     core::Money fixedIncome{0, core::Currency::EUR};
     core::Money fixedExpenses{0, core::Currency::EUR};
@@ -125,8 +130,6 @@ auto BudgetService::calculateCurrentMonth(
 
     auto afterDebt = budget.netCashFlow - totalDebt;
     budget.availableForSavings = afterDebt.value_or(core::Money{0, core::Currency::EUR});
-
-    return budget;
 }
 
 auto BudgetService::projectFutureMonths(
@@ -232,6 +235,72 @@ auto BudgetService::getBudgetProjection(
     return projection;
 }
 
+auto BudgetService::calculateCurrentMonth(
+    core::TransactionRepository& repository,
+    const std::vector<core::RecurringPattern>& patterns,
+    const std::vector<core::Credit>& credits,
+    core::Date currentDate) -> std::expected<MonthlyBudget, core::Error>
+{
+    // The per-category totals for the current month are computed inside the
+    // database; no transaction objects are hydrated
+    auto first = firstDayOfMonth(currentDate);
+    core::Date last{std::chrono::year_month_day_last{first.year(),
+                                                     std::chrono::month_day_last{first.month()}}};
+
+    auto aggregates = repository.aggregateByCategory(first, last);
+    if (!aggregates) {
+        return std::unexpected(aggregates.error());
+    }
+
+    MonthlyBudget budget;
+    budget.month = first;
+
+    core::Money totalIncome{0, core::Currency::EUR};
+    core::Money totalExpenses{0, core::Currency::EUR};
+
+    for (const auto& aggregate : *aggregates) {
+        if (aggregate.incomeCount > 0) {
+            budget.incomeByCategory.push_back({aggregate.category,
+                core::Money{aggregate.incomeCents, core::Currency::EUR}, aggregate.incomeCount});
+            totalIncome = core::Money{totalIncome.cents() + aggregate.incomeCents,
+                                      core::Currency::EUR};
+        }
+        if (aggregate.expenseCount > 0) {
+            budget.expensesByCategory.push_back({aggregate.category,
+                core::Money{aggregate.expenseCents, core::Currency::EUR}, aggregate.expenseCount});
+            totalExpenses = core::Money{totalExpenses.cents() + aggregate.expenseCents,
+                                        core::Currency::EUR};
+        }
+    }
+
+    // Sort by amount descending
+    std::sort(budget.incomeByCategory.begin(), budget.incomeByCategory.end(),
+              [](const auto& a, const auto& b) { return a.amount.cents() > b.amount.cents(); });
+    std::sort(budget.expensesByCategory.begin(), budget.expensesByCategory.end(),
+              [](const auto& a, const auto& b) { return a.amount.cents() > b.amount.cents(); });
+
+    applyPatternsAndCredits(budget, patterns, credits, totalIncome, totalExpenses);
+
+    return budget;
+}
+
+auto BudgetService::getBudgetProjection(
+    core::TransactionRepository& repository,
+    const std::vector<core::RecurringPattern>& patterns,
+    const std::vector<core::Credit>& credits,
+    core::Date currentDate) -> std::expected<BudgetProjection, core::Error>
+{
+    auto currentMonth = calculateCurrentMonth(repository, patterns, credits, currentDate);
+    if (!currentMonth) {
+        return std::unexpected(currentMonth.error());
+    }
+
+    BudgetProjection projection;
+    projection.currentMonth = std::move(*currentMonth);
+    projection.futureMonths = projectFutureMonths(patterns, credits, firstDayOfMonth(currentDate), 3);
+    return projection;
+}
+
 auto BudgetService::firstDayOfMonth(core::Date date) -> core::Date {
     return core::Date{date.year(), date.month(), std::chrono::day{1}};
 }
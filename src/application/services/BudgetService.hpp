@@ -111,6 +111,20 @@ public:
         const std::vector<core::Credit>& credits,
         core::Date currentDate) -> BudgetProjection;
 
+    // Repository variants: the per-category totals are computed inside the
+    // database instead of requiring the caller to load any transactions
+    [[nodiscard]] auto calculateCurrentMonth(
+        core::TransactionRepository& repository,
+        const std::vector<core::RecurringPattern>& patterns,
+        const std::vector<core::Credit>& credits,
+        core::Date currentDate) -> std::expected<MonthlyBudget, core::Error>;
+
+    [[nodiscard]] auto getBudgetProjection(
+        core::TransactionRepository& repository,
+        const std::vector<core::RecurringPattern>& patterns,
+        const std::vector<core::Credit>& credits,
+        core::Date currentDate) -> std::expected<BudgetProjection, core::Error>;
+
     // Calculate debt payoff and savings recommendations
     [[nodiscard]] auto calculateRecommendation(
         const MonthlyBudget& budget,
@@ -125,6 +139,14 @@ public:
     [[nodiscard]] auto addMonths(core::Date date, int months) -> core::Date;
 
 private:
+    // Shared tail of calculateCurrentMonth: pattern/credit totals and the
+    // cash-flow figures, applied once the transaction side is aggregated
+    auto applyPatternsAndCredits(MonthlyBudget& budget,
+                                 const std::vector<core::RecurringPattern>& patterns,
+                                 const std::vector<core::Credit>& credits,
+                                 core::Money totalIncome,
+                                 core::Money totalExpenses) -> void;
+
     [[nodiscard]] auto firstDayOfMonth(core::Date date) -> core::Date;
     [[nodiscard]] auto isInMonth(core::Date txnDate, core::Date month) -> bool;
 
@@ -0,0 +1,153 @@
+#include "application/services/BudgetSimulator.hpp"
+#include <algorithm>
+#include <utility>
+#include <fmt/format.h>
+#include "application/services/AmortizationEngine.hpp"
+#include "core/common/TextNormalize.hpp"
+
+namespace ares::application::services {
+
+namespace {
+
+// Same matching semantics as categorization rules: the target is a
+// space-normalized, case-insensitive substring of the candidate
+auto matches(const std::string& candidate, const std::string& normalizedTarget) -> bool {
+    std::string normalized;
+    core::text::lowercaseCollapseSpacesInto(candidate, normalized);
+    return normalized.find(normalizedTarget) != std::string::npos;
+}
+
+} // namespace
+
+BudgetSimulator::BudgetSimulator(MonthlyBudget baseline,
+                                 std::vector<core::RecurringPattern> patterns,
+                                 std::vector<core::Credit> credits,
+                                 core::Date asOf)
+    : baseline_{std::move(baseline)}
+    , patterns_{std::move(patterns)}
+    , credits_{std::move(credits)}
+    , asOf_{asOf}
+{}
+
+auto BudgetSimulator::prime(core::TransactionRepository& repository,
+                            std::vector<core::RecurringPattern> patterns,
+                            std::vector<core::Credit> credits,
+                            core::Date asOf)
+    -> std::expected<BudgetSimulator, core::Error>
+{
+    BudgetService budgetService;
+    auto baseline = budgetService.calculateCurrentMonth(repository, patterns, credits, asOf);
+    if (!baseline) {
+        return std::unexpected(baseline.error());
+    }
+    return BudgetSimulator{std::move(*baseline), std::move(patterns), std::move(credits), asOf};
+}
+
+auto BudgetSimulator::evaluate(const Scenario& scenario) const -> ScenarioResult {
+    ScenarioResult result;
+
+    int64_t fixedIncomeCents = baseline_.totalFixedIncome.cents();
+    int64_t fixedExpenseCents = baseline_.totalFixedExpenses.cents();
+
+    // Per-credit payments the scenario can raise, parallel to credits_
+    std::vector<int64_t> paymentCents;
+    paymentCents.reserve(credits_.size());
+    for (const auto& credit : credits_) {
+        paymentCents.push_back(credit.minimumPayment().cents());
+    }
+
+    std::string normalizedTarget;
+    for (const auto& change : scenario.changes) {
+        core::text::lowercaseCollapseSpacesInto(change.target, normalizedTarget);
+
+        switch (change.kind) {
+            case ScenarioChange::Kind::CancelPattern: {
+                bool found = false;
+                for (const auto& pattern : patterns_) {
+                    if (!pattern.isActive() ||
+                        !matches(pattern.counterpartyName(), normalizedTarget)) {
+                        continue;
+                    }
+                    found = true;
+                    auto monthly = pattern.monthlyCost().cents();
+                    if (monthly > 0) {
+                        fixedIncomeCents -= monthly;
+                    } else {
+                        fixedExpenseCents += monthly;  // monthly is negative
+                    }
+                }
+                if (!found) {
+                    result.warnings.push_back(
+                        fmt::format("no active recurring pattern matches '{}'", change.target));
+                }
+                break;
+            }
+            case ScenarioChange::Kind::ExtraDebtPayment: {
+                bool found = false;
+                for (std::size_t i = 0; i < credits_.size(); ++i) {
+                    if (credits_[i].currentBalance().cents() <= 0 ||
+                        !matches(credits_[i].name(), normalizedTarget)) {
+                        continue;
+                    }
+                    found = true;
+                    paymentCents[i] += change.amount.abs().cents();
+                }
+                if (!found) {
+                    result.warnings.push_back(
+                        fmt::format("no active credit matches '{}'", change.target));
+                }
+                break;
+            }
+            case ScenarioChange::Kind::AddMonthlyExpense:
+                fixedExpenseCents += change.amount.abs().cents();
+                break;
+            case ScenarioChange::Kind::AddMonthlyIncome:
+                fixedIncomeCents += change.amount.abs().cents();
+                break;
+        }
+    }
+
+    // Payoff outcomes for every credit whose payment the scenario raised;
+    // the baseline schedule comes from the shared memo, the scenario
+    // schedule is computed on a copy with the raised payment
+    int64_t totalDebtCents = 0;
+    auto& engine = AmortizationEngine::shared();
+    for (std::size_t i = 0; i < credits_.size(); ++i) {
+        const auto& credit = credits_[i];
+        if (credit.currentBalance().cents() <= 0) {
+            continue;
+        }
+        totalDebtCents += paymentCents[i];
+
+        if (paymentCents[i] == credit.minimumPayment().cents()) {
+            continue;
+        }
+        auto baselineSchedule = engine.scheduleFor(credit, asOf_);
+
+        auto modified = credit;
+        modified.setMinimumPayment(core::Money{paymentCents[i], core::Currency::EUR});
+        auto schedule = AmortizationEngine::computeSchedule(modified, asOf_);
+
+        result.creditOutcomes.push_back({
+            .creditName = credit.name(),
+            .monthlyPayment = core::Money{paymentCents[i], core::Currency::EUR},
+            .baselineMonths = baselineSchedule.monthsToPayoff,
+            .monthsToPayoff = schedule.monthsToPayoff,
+            .interestSavedCents = baselineSchedule.payoffReachable
+                ? baselineSchedule.totalInterestCents - schedule.totalInterestCents
+                : 0,
+            .payoffDate = schedule.payoffDate,
+            .payoffReachable = schedule.payoffReachable
+        });
+    }
+
+    result.netCashFlow = core::Money{fixedIncomeCents - fixedExpenseCents, core::Currency::EUR};
+    result.availableForSavings =
+        core::Money{result.netCashFlow.cents() - totalDebtCents, core::Currency::EUR};
+    result.savingsDelta = core::Money{
+        result.availableForSavings.cents() - baseline_.availableForSavings.cents(),
+        core::Currency::EUR};
+    return result;
+}
+
+} // namespace ares::application::services
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdint>
+#include <expected>
+#include <string>
+#include <vector>
+#include "application/services/BudgetService.hpp"
+#include "core/common/Error.hpp"
+#include "core/common/Money.hpp"
+#include "core/common/Types.hpp"
+#include "core/credit/Credit.hpp"
+#include "core/transaction/RecurringPattern.hpp"
+#include "core/transaction/Transaction.hpp"
+
+namespace ares::application::services {
+
+// One edit to the baseline budget. Targets are matched the same way
+// categorization rules match: space-normalized, case-insensitive
+// substring of the pattern counterparty or credit name.
+struct ScenarioChange {
+    enum class Kind {
+        ExtraDebtPayment,   // target = credit name, amount = extra per month
+        CancelPattern,      // target = recurring pattern counterparty
+        AddMonthlyExpense,  // target = label, amount = cost per month
+        AddMonthlyIncome    // target = label, amount = income per month
+    };
+
+    Kind kind;
+    std::string target;
+    core::Money amount{0, core::Currency::EUR};
+};
+
+struct Scenario {
+    std::string name;
+    std::vector<ScenarioChange> changes;
+};
+
+// Payoff outcome for a credit whose payment the scenario changed
+struct ScenarioCreditOutcome {
+    std::string creditName;
+    core::Money monthlyPayment;
+    int baselineMonths{0};
+    int monthsToPayoff{0};
+    int64_t interestSavedCents{0};
+    core::Date payoffDate;
+    bool payoffReachable{true};
+};
+
+struct ScenarioResult {
+    core::Money netCashFlow{0, core::Currency::EUR};
+    core::Money availableForSavings{0, core::Currency::EUR};
+    // Scenario availableForSavings minus the baseline's
+    core::Money savingsDelta{0, core::Currency::EUR};
+    std::vector<ScenarioCreditOutcome> creditOutcomes;
+    // Changes whose target matched nothing - reported, never fatal
+    std::vector<std::string> warnings;
+};
+
+// What-if evaluation over the precomputed budget. prime() pays the
+// database cost once (the current-month budget comes from the rollup-backed
+// aggregate, no transactions are hydrated); evaluate() then applies a
+// scenario's deltas to the cached pattern and credit totals entirely in
+// memory - O(patterns + credits) per scenario - so an interactive session
+// can evaluate dozens of scenarios without touching history again.
+class BudgetSimulator {
+public:
+    [[nodiscard]] static auto prime(core::TransactionRepository& repository,
+                                    std::vector<core::RecurringPattern> patterns,
+                                    std::vector<core::Credit> credits,
+                                    core::Date asOf)
+        -> std::expected<BudgetSimulator, core::Error>;
+
+    [[nodiscard]] auto baseline() const -> const MonthlyBudget& { return baseline_; }
+
+    [[nodiscard]] auto evaluate(const Scenario& scenario) const -> ScenarioResult;
+
+private:
+    BudgetSimulator(MonthlyBudget baseline,
+                    std::vector<core::RecurringPattern> patterns,
+                    std::vector<core::Credit> credits,
+                    core::Date asOf);
+
+    MonthlyBudget baseline_;
+    std::vector<core::RecurringPattern> patterns_;
+    std::vector<core::Credit> credits_;
+    core::Date asOf_;
+};
+
+} // namespace ares::application::services
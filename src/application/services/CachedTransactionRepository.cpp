@@ -0,0 +1,206 @@
+#include "application/services/CachedTransactionRepository.hpp"
+#include <chrono>
+
+namespace ares::application::services {
+
+CachedTransactionRepository::CachedTransactionRepository(core::TransactionRepository& inner)
+    : inner_{inner}
+{}
+
+auto CachedTransactionRepository::monthIndex(core::Date date) -> MonthIndex {
+    return static_cast<int>(date.year()) * 12
+        + static_cast<int>(static_cast<unsigned>(date.month())) - 1;
+}
+
+auto CachedTransactionRepository::monthSlice(const core::AccountId& accountId, MonthIndex month)
+    -> std::expected<const std::vector<core::Transaction>*, core::Error>
+{
+    MonthKey key{accountId.value, month};
+    if (auto it = monthCache_.find(key); it != monthCache_.end()) {
+        return &it->second;
+    }
+
+    auto year = std::chrono::year{month / 12};
+    auto m = std::chrono::month{static_cast<unsigned>(month % 12 + 1)};
+    core::Date first{year, m, std::chrono::day{1}};
+    core::Date last{std::chrono::year_month_day_last{year, std::chrono::month_day_last{m}}};
+
+    auto rows = inner_.findByDateRange(accountId, first, last);
+    if (!rows) {
+        return std::unexpected(rows.error());
+    }
+
+    auto [it, inserted] = monthCache_.emplace(std::move(key), std::move(*rows));
+    return &it->second;
+}
+
+auto CachedTransactionRepository::findByDateRange(
+    const core::AccountId& accountId, core::Date from, core::Date to)
+    -> std::expected<std::vector<core::Transaction>, core::Error>
+{
+    std::vector<core::Transaction> results;
+    for (MonthIndex month = monthIndex(from); month <= monthIndex(to); ++month) {
+        auto slice = monthSlice(accountId, month);
+        if (!slice) {
+            return std::unexpected(slice.error());
+        }
+        for (const auto& txn : **slice) {
+            if (txn.date() >= from && txn.date() <= to) {
+                results.push_back(txn);
+            }
+        }
+    }
+    return results;
+}
+
+auto CachedTransactionRepository::findAll()
+    -> std::expected<std::vector<core::Transaction>, core::Error>
+{
+    if (allCache_) {
+        return *allCache_;
+    }
+    auto rows = inner_.findAll();
+    if (!rows) {
+        return std::unexpected(rows.error());
+    }
+    allCache_ = *rows;
+    return rows;
+}
+
+auto CachedTransactionRepository::save(const core::Transaction& transaction)
+    -> std::expected<void, core::Error>
+{
+    auto result = inner_.save(transaction);
+    if (result) {
+        invalidateMonth(transaction.accountId(), transaction.date());
+    }
+    return result;
+}
+
+auto CachedTransactionRepository::saveBatch(const std::vector<core::Transaction>& transactions)
+    -> std::expected<void, core::Error>
+{
+    auto result = inner_.saveBatch(transactions);
+    if (result) {
+        for (const auto& txn : transactions) {
+            invalidateMonth(txn.accountId(), txn.date());
+        }
+    }
+    return result;
+}
+
+auto CachedTransactionRepository::update(const core::Transaction& transaction)
+    -> std::expected<void, core::Error>
+{
+    auto result = inner_.update(transaction);
+    if (result) {
+        // The stored row may have moved from a different month
+        invalidateAll();
+    }
+    return result;
+}
+
+auto CachedTransactionRepository::remove(const core::TransactionId& id)
+    -> std::expected<void, core::Error>
+{
+    auto result = inner_.remove(id);
+    if (result) {
+        // Only the id is known, not the month it lived in
+        invalidateAll();
+    }
+    return result;
+}
+
+auto CachedTransactionRepository::findById(const core::TransactionId& id)
+    -> std::expected<std::optional<core::Transaction>, core::Error>
+{
+    return inner_.findById(id);
+}
+
+auto CachedTransactionRepository::findByAccount(const core::AccountId& accountId)
+    -> std::expected<std::vector<core::Transaction>, core::Error>
+{
+    return inner_.findByAccount(accountId);
+}
+
+auto CachedTransactionRepository::findByCategory(core::TransactionCategory category)
+    -> std::expected<std::vector<core::Transaction>, core::Error>
+{
+    return inner_.findByCategory(category);
+}
+
+auto CachedTransactionRepository::findPage(
+    int limit,
+    const std::optional<core::TransactionRepository::PageCursor>& before,
+    const std::optional<core::TransactionRepository::PageCursor>& after)
+    -> std::expected<std::vector<core::Transaction>, core::Error>
+{
+    return inner_.findPage(limit, before, after);
+}
+
+auto CachedTransactionRepository::search(const std::string& query, int limit)
+    -> std::expected<std::vector<core::Transaction>, core::Error>
+{
+    return inner_.search(query, limit);
+}
+
+auto CachedTransactionRepository::forEach(
+    const core::TransactionRepository::TransactionVisitor& visitor)
+    -> std::expected<void, core::Error>
+{
+    return inner_.forEach(visitor);
+}
+
+auto CachedTransactionRepository::forEachFiltered(
+    const core::TransactionRepository::Filter& filter,
+    const core::TransactionRepository::TransactionVisitor& visitor)
+    -> std::expected<void, core::Error>
+{
+    return inner_.forEachFiltered(filter, visitor);
+}
+
+auto CachedTransactionRepository::forEachInDateRange(
+    core::Date from, core::Date to,
+    const core::TransactionRepository::TransactionVisitor& visitor)
+    -> std::expected<void, core::Error>
+{
+    return inner_.forEachInDateRange(from, to, visitor);
+}
+
+auto CachedTransactionRepository::findAmountsByDateRange(core::Date from, core::Date to)
+    -> std::expected<std::vector<core::TransactionAmount>, core::Error>
+{
+    return inner_.findAmountsByDateRange(from, to);
+}
+
+auto CachedTransactionRepository::findColumnsByDateRange(core::Date from, core::Date to)
+    -> std::expected<core::TransactionColumns, core::Error>
+{
+    return inner_.findColumnsByDateRange(from, to);
+}
+
+auto CachedTransactionRepository::aggregateByCategory(core::Date from, core::Date to)
+    -> std::expected<std::vector<core::CategoryAggregate>, core::Error>
+{
+    return inner_.aggregateByCategory(from, to);
+}
+
+auto CachedTransactionRepository::aggregateByMonthAndCategory(int year)
+    -> std::expected<std::vector<core::MonthlyCategoryAggregate>, core::Error>
+{
+    return inner_.aggregateByMonthAndCategory(year);
+}
+
+auto CachedTransactionRepository::invalidateMonth(const core::AccountId& accountId, core::Date date)
+    -> void
+{
+    monthCache_.erase(MonthKey{accountId.value, monthIndex(date)});
+    allCache_.reset();
+}
+
+auto CachedTransactionRepository::invalidateAll() -> void {
+    monthCache_.clear();
+    allCache_.reset();
+}
+
+} // namespace ares::application::services
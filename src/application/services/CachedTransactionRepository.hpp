@@ -0,0 +1,88 @@
+#pragma once
+
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+#include "core/transaction/Transaction.hpp"
+
+namespace ares::application::services {
+
+// In-process cache decorating a transaction repository. Date-range queries
+// are served from month-aligned slices keyed by (account, month), so the
+// overview, report and budget flows - which re-read the same months within
+// one run - hydrate each row once. Writes through the decorator invalidate
+// the touched months (removes, which only carry an id, clear everything);
+// bulk writers that bypass the interface (saveBatchSkipDuplicates) should
+// call invalidateAll() themselves.
+//
+// All other queries pass straight through: aggregates are already computed
+// in SQL and caching them would just duplicate rows the database keeps hot.
+class CachedTransactionRepository : public core::TransactionRepository {
+public:
+    explicit CachedTransactionRepository(core::TransactionRepository& inner);
+
+    // Cached reads
+    auto findByDateRange(const core::AccountId& accountId, core::Date from, core::Date to)
+        -> std::expected<std::vector<core::Transaction>, core::Error> override;
+    auto findAll() -> std::expected<std::vector<core::Transaction>, core::Error> override;
+
+    // Pages are cheap in SQL and invalidation-sensitive, so they bypass the cache
+    auto findPage(int limit, const std::optional<core::TransactionRepository::PageCursor>& before,
+                  const std::optional<core::TransactionRepository::PageCursor>& after)
+        -> std::expected<std::vector<core::Transaction>, core::Error> override;
+    auto search(const std::string& query, int limit)
+        -> std::expected<std::vector<core::Transaction>, core::Error> override;
+
+    // Writes: delegate, then invalidate the affected months
+    auto save(const core::Transaction& transaction) -> std::expected<void, core::Error> override;
+    auto saveBatch(const std::vector<core::Transaction>& transactions) -> std::expected<void, core::Error> override;
+    auto update(const core::Transaction& transaction) -> std::expected<void, core::Error> override;
+    auto remove(const core::TransactionId& id) -> std::expected<void, core::Error> override;
+
+    // Pass-through reads
+    auto findById(const core::TransactionId& id) -> std::expected<std::optional<core::Transaction>, core::Error> override;
+    auto findByAccount(const core::AccountId& accountId) -> std::expected<std::vector<core::Transaction>, core::Error> override;
+    auto findByCategory(core::TransactionCategory category)
+        -> std::expected<std::vector<core::Transaction>, core::Error> override;
+    auto forEach(const core::TransactionRepository::TransactionVisitor& visitor)
+        -> std::expected<void, core::Error> override;
+    auto forEachFiltered(const core::TransactionRepository::Filter& filter,
+                         const core::TransactionRepository::TransactionVisitor& visitor)
+        -> std::expected<void, core::Error> override;
+    auto forEachInDateRange(core::Date from, core::Date to,
+                            const core::TransactionRepository::TransactionVisitor& visitor)
+        -> std::expected<void, core::Error> override;
+    auto findAmountsByDateRange(core::Date from, core::Date to)
+        -> std::expected<std::vector<core::TransactionAmount>, core::Error> override;
+    auto findColumnsByDateRange(core::Date from, core::Date to)
+        -> std::expected<core::TransactionColumns, core::Error> override;
+    auto aggregateByCategory(core::Date from, core::Date to)
+        -> std::expected<std::vector<core::CategoryAggregate>, core::Error> override;
+    auto aggregateByMonthAndCategory(int year)
+        -> std::expected<std::vector<core::MonthlyCategoryAggregate>, core::Error> override;
+
+    auto invalidateMonth(const core::AccountId& accountId, core::Date date) -> void;
+    auto invalidateAll() -> void;
+
+    // Writes delegate to the wrapped repository, so its counter is the
+    // authoritative one
+    [[nodiscard]] auto generation() const -> uint64_t override { return inner_.generation(); }
+
+private:
+    // Months since year 0, so ranges iterate with ++
+    using MonthIndex = int;
+    using MonthKey = std::pair<std::string, MonthIndex>;
+
+    [[nodiscard]] static auto monthIndex(core::Date date) -> MonthIndex;
+
+    // Returns the cached slice for one month, fetching it on a miss
+    [[nodiscard]] auto monthSlice(const core::AccountId& accountId, MonthIndex month)
+        -> std::expected<const std::vector<core::Transaction>*, core::Error>;
+
+    core::TransactionRepository& inner_;
+    std::map<MonthKey, std::vector<core::Transaction>> monthCache_;
+    std::optional<std::vector<core::Transaction>> allCache_;
+};
+
+} // namespace ares::application::services
@@ -1,56 +1,288 @@
 #include "application/services/CategoryMatcher.hpp"
+#include "core/common/PerfCounters.hpp"
 #include <algorithm>
+#include <array>
 #include <string>
+#include "core/common/AhoCorasick.hpp"
+#include "core/common/TextNormalize.hpp"
 
 namespace ares::application::services {
 
+namespace {
+
+// Which normalized input a built-in pattern applies to
+enum class Field { Counterparty, Description };
+
+struct BuiltInRule {
+    std::string_view pattern;
+    Field field;
+    core::TransactionCategory category;
+};
+
+using Cat = core::TransactionCategory;
+
+// Ordered keyword table for the built-in rules. Entries are grouped by
+// category and the first (lowest-index) hit wins, which preserves the
+// priority of the old if/else cascade - e.g. Housing before Healthcare,
+// Restaurants before Subscriptions. All patterns are matched against the
+// lowercased, space-stripped counterparty or description.
+//
+// Two entries need extra context and are special-cased in
+// matchBuiltInRules: the Utilities "gas" pattern is vetoed when the
+// description also contains "agip" (a fuel brand), and the trailing Fee
+// pair is a conjunction - counterparty "ing" AND description "entgelt".
+constexpr auto kBuiltInRules = std::to_array<BuiltInRule>({
+    // Salary / Income
+    {"gehalt", Field::Counterparty, Cat::Salary},
+    {"lohn", Field::Counterparty, Cat::Salary},
+    {"gehalt", Field::Description, Cat::Salary},
+    {"salary", Field::Description, Cat::Salary},
+    {"ovh", Field::Counterparty, Cat::Salary},
+    // Loan payments (KfW, student loans)
+    {"kfw", Field::Counterparty, Cat::LoanPayment},
+    {"kfw", Field::Description, Cat::LoanPayment},
+    {"studienkredit", Field::Counterparty, Cat::LoanPayment},
+    {"studienkredit", Field::Description, Cat::LoanPayment},
+    {"studiendarlehen", Field::Description, Cat::LoanPayment},
+    // Line of credit (Rahmenkredit)
+    {"rahmenkredit", Field::Description, Cat::LineOfCredit},
+    {"kreditlinie", Field::Description, Cat::LineOfCredit},
+    {"rahmenkredit", Field::Counterparty, Cat::LineOfCredit},
+    // Internal transfers
+    {"umbuchung", Field::Description, Cat::InternalTransfer},
+    {"ownaccount", Field::Description, Cat::InternalTransfer},
+    {"eigeneskonto", Field::Description, Cat::InternalTransfer},
+    // ATM withdrawals
+    {"geldautomat", Field::Description, Cat::ATMWithdrawal},
+    {"bargeld", Field::Description, Cat::ATMWithdrawal},
+    {"atm", Field::Description, Cat::ATMWithdrawal},
+    {"geldautomat", Field::Counterparty, Cat::ATMWithdrawal},
+    {"barabhebung", Field::Description, Cat::ATMWithdrawal},
+    {"auszahlung", Field::Description, Cat::ATMWithdrawal},
+    // Housing (rent) - before Healthcare
+    {"miete", Field::Description, Cat::Housing},
+    {"rent", Field::Description, Cat::Housing},
+    {"hausverwaltung", Field::Counterparty, Cat::Housing},
+    // Healthcare
+    {"chiropraktik", Field::Counterparty, Cat::Healthcare},
+    {"arzt", Field::Counterparty, Cat::Healthcare},
+    {"apotheke", Field::Counterparty, Cat::Healthcare},
+    {"klinik", Field::Counterparty, Cat::Healthcare},
+    {"praxis", Field::Counterparty, Cat::Healthcare},
+    {"physio", Field::Counterparty, Cat::Healthcare},
+    {"chiropraktik", Field::Description, Cat::Healthcare},
+    {"behandlung", Field::Description, Cat::Healthcare},
+    {"fitstar", Field::Counterparty, Cat::Healthcare},
+    {"fitness", Field::Counterparty, Cat::Healthcare},
+    {"gym", Field::Counterparty, Cat::Healthcare},
+    {"mitgliedsbeitrag", Field::Description, Cat::Healthcare},
+    // Restaurants & food delivery - before Subscriptions
+    {"wolt", Field::Counterparty, Cat::Restaurants},
+    {"lieferando", Field::Counterparty, Cat::Restaurants},
+    {"ubereats", Field::Counterparty, Cat::Restaurants},
+    {"deliveroo", Field::Counterparty, Cat::Restaurants},
+    {"restaurant", Field::Counterparty, Cat::Restaurants},
+    {"cafe", Field::Counterparty, Cat::Restaurants},
+    {"bistro", Field::Counterparty, Cat::Restaurants},
+    {"imbiss", Field::Counterparty, Cat::Restaurants},
+    {"sushi", Field::Description, Cat::Restaurants},
+    {"pizza", Field::Description, Cat::Restaurants},
+    {"burger", Field::Description, Cat::Restaurants},
+    {"cafe", Field::Description, Cat::Restaurants},
+    {"restaurant", Field::Description, Cat::Restaurants},
+    {"amari", Field::Description, Cat::Restaurants},
+    {"kantine", Field::Description, Cat::Restaurants},
+    {"ciaoamore", Field::Description, Cat::Restaurants},
+    // Cinema
+    {"cinemaxx", Field::Counterparty, Cat::Cinema},
+    {"cinestar", Field::Counterparty, Cat::Cinema},
+    {"kino", Field::Counterparty, Cat::Cinema},
+    {"kino", Field::Description, Cat::Cinema},
+    {"cinema", Field::Counterparty, Cat::Cinema},
+    {"uci", Field::Counterparty, Cat::Cinema},
+    {"cinemaxx", Field::Description, Cat::Cinema},
+    {"cinestar", Field::Description, Cat::Cinema},
+    // Entertainment (games)
+    {"steam", Field::Description, Cat::Entertainment},
+    {"humble", Field::Description, Cat::Entertainment},
+    {"gog.com", Field::Description, Cat::Entertainment},
+    {"epicgames", Field::Description, Cat::Entertainment},
+    {"nintendo", Field::Description, Cat::Entertainment},
+    {"xbox", Field::Description, Cat::Entertainment},
+    {"steam", Field::Counterparty, Cat::Entertainment},
+    {"valve", Field::Counterparty, Cat::Entertainment},
+    // Subscriptions - digital services
+    {"netflix", Field::Counterparty, Cat::Subscriptions},
+    {"netflix", Field::Description, Cat::Subscriptions},
+    {"spotify", Field::Counterparty, Cat::Subscriptions},
+    {"spotify", Field::Description, Cat::Subscriptions},
+    {"disney", Field::Counterparty, Cat::Subscriptions},
+    {"disney", Field::Description, Cat::Subscriptions},
+    {"primevideo", Field::Description, Cat::Subscriptions},
+    {"amznprime", Field::Description, Cat::Subscriptions},
+    {"apple.com", Field::Counterparty, Cat::Subscriptions},
+    {"itunes", Field::Description, Cat::Subscriptions},
+    {"appleservices", Field::Description, Cat::Subscriptions},
+    {"applese", Field::Description, Cat::Subscriptions},
+    {"ytpremium", Field::Description, Cat::Subscriptions},
+    {"youtube", Field::Description, Cat::Subscriptions},
+    {"googlepayment", Field::Description, Cat::Subscriptions},
+    {"google,", Field::Description, Cat::Subscriptions},
+    {"proton", Field::Description, Cat::Subscriptions},
+    {"sonyinteractive", Field::Description, Cat::Subscriptions},
+    {"playstation", Field::Description, Cat::Subscriptions},
+    {"adfree", Field::Description, Cat::Subscriptions},
+    // Groceries
+    {"rewe", Field::Counterparty, Cat::Groceries},
+    {"edeka", Field::Counterparty, Cat::Groceries},
+    {"aldi", Field::Counterparty, Cat::Groceries},
+    {"lidl", Field::Counterparty, Cat::Groceries},
+    {"penny", Field::Counterparty, Cat::Groceries},
+    {"netto", Field::Counterparty, Cat::Groceries},
+    {"kaufland", Field::Counterparty, Cat::Groceries},
+    {"norma", Field::Counterparty, Cat::Groceries},
+    {"rewe", Field::Description, Cat::Groceries},
+    {"edeka", Field::Description, Cat::Groceries},
+    {"aldi", Field::Description, Cat::Groceries},
+    {"lidl", Field::Description, Cat::Groceries},
+    // Utilities
+    {"eprimo", Field::Counterparty, Cat::Utilities},
+    {"stadtwerke", Field::Counterparty, Cat::Utilities},
+    {"m-net", Field::Counterparty, Cat::Utilities},
+    {"telekom", Field::Counterparty, Cat::Utilities},
+    {"vodafone", Field::Counterparty, Cat::Utilities},
+    {"o2", Field::Counterparty, Cat::Utilities},
+    {"congstar", Field::Counterparty, Cat::Utilities},
+    {"telefonie", Field::Description, Cat::Utilities},
+    {"strom", Field::Description, Cat::Utilities},
+    {"gas", Field::Description, Cat::Utilities},  // vetoed by "agip"
+    // Transportation
+    {"miles", Field::Counterparty, Cat::Transportation},
+    {"milesmo", Field::Description, Cat::Transportation},
+    {"db", Field::Counterparty, Cat::Transportation},
+    {"deutschebahn", Field::Counterparty, Cat::Transportation},
+    {"tankstelle", Field::Counterparty, Cat::Transportation},
+    {"shell", Field::Counterparty, Cat::Transportation},
+    {"aral", Field::Counterparty, Cat::Transportation},
+    {"agip", Field::Counterparty, Cat::Transportation},
+    {"agip", Field::Description, Cat::Transportation},
+    {"parkster", Field::Description, Cat::Transportation},
+    {"parking", Field::Description, Cat::Transportation},
+    {"sixt", Field::Counterparty, Cat::Transportation},
+    {"sharenow", Field::Counterparty, Cat::Transportation},
+    {"tanken", Field::Description, Cat::Transportation},
+    {"service-station", Field::Description, Cat::Transportation},
+    // Insurance
+    {"versicher", Field::Counterparty, Cat::Insurance},
+    {"vers.", Field::Counterparty, Cat::Insurance},
+    {"hanse", Field::Counterparty, Cat::Insurance},
+    {"allianz", Field::Counterparty, Cat::Insurance},
+    {"axa", Field::Counterparty, Cat::Insurance},
+    {"roland", Field::Counterparty, Cat::Insurance},
+    {"versicherung", Field::Description, Cat::Insurance},
+    {"rechtsschutz", Field::Description, Cat::Insurance},
+    {"haftpflicht", Field::Description, Cat::Insurance},
+    {"sachversicherung", Field::Description, Cat::Insurance},
+    // Shopping
+    {"amznmktp", Field::Description, Cat::Shopping},
+    {"amazonmktp", Field::Description, Cat::Shopping},
+    {"amazonmonatsabrech", Field::Description, Cat::Shopping},
+    {"amazonpayments", Field::Counterparty, Cat::Shopping},
+    {"zalando", Field::Counterparty, Cat::Shopping},
+    {"zalando", Field::Description, Cat::Shopping},
+    {"riverty", Field::Counterparty, Cat::Shopping},
+    {"klarna", Field::Counterparty, Cat::Shopping},
+    {"klarna", Field::Description, Cat::Shopping},
+    // Bank fees - conjunction, must stay the last two entries
+    {"ing", Field::Counterparty, Cat::Fee},
+    {"entgelt", Field::Description, Cat::Fee},
+});
+
+constexpr std::size_t kFeeIngRule = kBuiltInRules.size() - 2;
+constexpr std::size_t kFeeEntgeltRule = kBuiltInRules.size() - 1;
+
+// The table is constexpr, so its invariants are checked at compile time:
+// every pattern must already be in the normalized form the matcher produces
+// (lowercase, no spaces), since normalizeInto() is only applied to the
+// inputs, never to the patterns.
+constexpr auto allPatternsNormalized() -> bool {
+    for (const auto& rule : kBuiltInRules) {
+        if (rule.pattern.empty()) {
+            return false;
+        }
+        for (char c : rule.pattern) {
+            if (c == ' ' || (c >= 'A' && c <= 'Z')) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static_assert(allPatternsNormalized(),
+              "built-in patterns must be lowercase and space-free");
+static_assert(kBuiltInRules[kFeeIngRule].pattern == "ing" &&
+              kBuiltInRules[kFeeEntgeltRule].pattern == "entgelt",
+              "the Fee conjunction must stay the last two entries");
+
+// Compiled once; every categorize() call is then a single pass over each
+// input instead of ~150 substring scans
+auto builtInAutomaton() -> const core::AhoCorasick& {
+    static const core::AhoCorasick automaton = [] {
+        core::AhoCorasick ac;
+        for (std::size_t i = 0; i < kBuiltInRules.size(); ++i) {
+            ac.addPattern(kBuiltInRules[i].pattern, static_cast<int>(i));
+        }
+        ac.build();
+        return ac;
+    }();
+    return automaton;
+}
+
+} // namespace
+
 auto CategoryMatcher::setCustomRules(std::vector<infrastructure::config::CategorizationRule> rules) -> void {
-    customRules_ = std::move(rules);
+    customRules_ = infrastructure::config::ConfigParser::compileRules(std::move(rules));
+    sharedRules_.reset();
+}
+
+auto CategoryMatcher::setCompiledRules(
+    std::shared_ptr<const infrastructure::config::CompiledRuleSet> rules) -> void {
+    sharedRules_ = std::move(rules);
 }
 
 auto CategoryMatcher::categorize(
     std::string_view counterparty,
     std::string_view description,
-    std::optional<int64_t> amountCents)
+    std::optional<int64_t> amountCents,
+    std::string_view merchant)
     -> CategorizationResult
 {
-    // Check custom rules first
-    if (!customRules_.empty()) {
-        auto customCategory = infrastructure::config::ConfigParser::matchCategory(
-            customRules_, counterparty, description, amountCents);
-        if (customCategory) {
-            // Find which rule matched to track stats
-            std::string cp{counterparty};
-            std::string desc{description};
-            std::transform(cp.begin(), cp.end(), cp.begin(), ::tolower);
-            std::transform(desc.begin(), desc.end(), desc.begin(), ::tolower);
-
-            // Strip spaces for ING bank formatting normalization
-            auto stripSpaces = [](const std::string& s) {
-                std::string r;
-                r.reserve(s.size());
-                for (char c : s) if (c != ' ') r += c;
-                return r;
-            };
-            auto cpN = stripSpaces(cp);
-            auto descN = stripSpaces(desc);
+    ARES_PERF_SCOPE("CategoryMatcher::categorize");
+    // Counterparty normalization is a cache hit after the first sighting
+    // of a name; the description (mostly unique memo text) is normalized
+    // into the reusable buffer as before
+    cpNormalized_ = cache_.strippedSpaces(counterparty);
+    core::text::lowercaseStripSpacesInto(description, descNormalized_);
 
-            for (const auto& rule : customRules_) {
-                auto patN = stripSpaces(rule.pattern);
-                if (cpN.find(patN) != std::string::npos ||
-                    descN.find(patN) != std::string::npos) {
-                    ruleHits_[rule.pattern]++;
-                    return {*customCategory, rule.pattern, true};
-                }
-            }
-            // Matched but couldn't identify which rule (wildcard match perhaps)
-            ruleHits_["custom"]++;
-            return {*customCategory, "custom", true};
+    // Check custom rules first. matchCompiledNormalized reports the
+    // matching rule directly, so stats need no second scan over the rules.
+    const auto& customRules = activeRules();
+    if (!customRules.empty()) {
+        const auto* match = infrastructure::config::ConfigParser::matchCompiledNormalized(
+            customRules, cpNormalized_, descNormalized_, amountCents);
+        if (match) {
+            // Amount-only rules carry no text pattern; keep them in the
+            // shared "custom" stats bucket
+            std::string label = match->rule.pattern.empty()
+                ? "custom" : match->rule.pattern;
+            ruleHits_[label]++;
+            return {match->rule.category, label, true};
         }
     }
 
     // Fall through to built-in rules
-    auto builtIn = matchBuiltInRules(counterparty, description);
+    auto builtIn = matchBuiltInRules(description, merchant);
     if (builtIn) {
         return {*builtIn, "built-in", false};
     }
@@ -72,190 +304,73 @@ auto CategoryMatcher::resetStats() -> void {
     ruleHits_.clear();
 }
 
-auto CategoryMatcher::matchBuiltInRules(
-    std::string_view counterparty,
-    std::string_view description)
+auto CategoryMatcher::matchBuiltInRules(std::string_view description,
+                                        std::string_view merchant)
     -> std::optional<core::TransactionCategory>
 {
-    // Convert to lowercase for matching
-    std::string cp{counterparty};
-    std::string desc{description};
-    std::transform(cp.begin(), cp.end(), cp.begin(), ::tolower);
-    std::transform(desc.begin(), desc.end(), desc.begin(), ::tolower);
-
-    // Extract actual merchant from PayPal descriptions
+    // For PayPal charges, match against the real merchant instead of the
+    // boilerplate memo. The extracted merchant is normally stored on the
+    // transaction (import runs the extractor once); re-parsing the memo here
+    // is the fallback for callers without one.
     // Format: "...Ihr Einkauf bei MERCHANT NAME" or "/. MERCHANT NAME ,"
-    std::string paypalMerchant;
-    if (cp.find("paypal") != std::string::npos) {
-        auto pos = desc.find("einkauf bei ");
+    // The markers contain spaces, so the fallback rebuilds the spaced
+    // lowercase description in descScratch_, carves in place, and strips.
+    std::string_view desc = descNormalized_;
+    if (!merchant.empty()) {
+        core::text::lowercaseStripSpacesInto(merchant, descScratch_);
+        desc = descScratch_;
+    } else if (cpNormalized_.find("paypal") != std::string::npos) {
+        core::text::lowercaseInto(description, descScratch_);
+        auto pos = descScratch_.find("einkauf bei ");
         if (pos != std::string::npos) {
-            paypalMerchant = desc.substr(pos + 12);
-            // Also check the merchant name
-            desc = paypalMerchant;
+            descScratch_.erase(0, pos + 12);
         }
-        pos = desc.find("/. ");
+        pos = descScratch_.find("/. ");
         if (pos != std::string::npos) {
-            auto end = desc.find(" ,", pos);
+            auto end = descScratch_.find(" ,", pos);
             if (end != std::string::npos) {
-                paypalMerchant = desc.substr(pos + 3, end - pos - 3);
-                desc = paypalMerchant;
+                descScratch_.erase(0, pos + 3);
+                descScratch_.resize(end - pos - 3);
             }
         }
+        descScratch_.erase(std::remove(descScratch_.begin(), descScratch_.end(), ' '),
+                           descScratch_.end());
+        desc = descScratch_;
     }
 
-    // Strip spaces to handle ING bank column-break formatting artifacts
-    // (e.g., "Sony Int eractive" → "sonyinteractive")
-    cp.erase(std::remove(cp.begin(), cp.end(), ' '), cp.end());
-    desc.erase(std::remove(desc.begin(), desc.end(), ' '), desc.end());
-
-    // Salary / Income patterns
-    if (cp.find("gehalt") != std::string::npos || cp.find("lohn") != std::string::npos ||
-        desc.find("gehalt") != std::string::npos || desc.find("salary") != std::string::npos ||
-        cp.find("ovh") != std::string::npos) {
-        return core::TransactionCategory::Salary;
-    }
-
-    // Loan payments (KfW, student loans)
-    if (cp.find("kfw") != std::string::npos || desc.find("kfw") != std::string::npos ||
-        cp.find("studienkredit") != std::string::npos || desc.find("studienkredit") != std::string::npos ||
-        desc.find("studiendarlehen") != std::string::npos) {
-        return core::TransactionCategory::LoanPayment;
-    }
-
-    // Line of credit (Rahmenkredit)
-    if (desc.find("rahmenkredit") != std::string::npos || desc.find("kreditlinie") != std::string::npos ||
-        cp.find("rahmenkredit") != std::string::npos) {
-        return core::TransactionCategory::LineOfCredit;
-    }
-
-    // Internal transfers (self-transfers between own accounts)
-    if (desc.find("umbuchung") != std::string::npos || desc.find("ownaccount") != std::string::npos ||
-        desc.find("eigeneskonto") != std::string::npos) {
-        return core::TransactionCategory::InternalTransfer;
-    }
-
-    // ATM Withdrawals
-    if (desc.find("geldautomat") != std::string::npos || desc.find("bargeld") != std::string::npos ||
-        desc.find("atm") != std::string::npos || cp.find("geldautomat") != std::string::npos ||
-        desc.find("barabhebung") != std::string::npos || desc.find("auszahlung") != std::string::npos) {
-        return core::TransactionCategory::ATMWithdrawal;
-    }
-
-    // Housing (rent) - check early
-    if (desc.find("miete") != std::string::npos || desc.find("rent") != std::string::npos ||
-        cp.find("hausverwaltung") != std::string::npos) {
-        return core::TransactionCategory::Housing;
-    }
+    // One automaton pass per input, collecting which rules hit in which
+    // field; resolution below then picks the first rule whose field matched
+    std::array<bool, kBuiltInRules.size()> cpHits{};
+    std::array<bool, kBuiltInRules.size()> descHits{};
+    const auto& automaton = builtInAutomaton();
+    automaton.forEachMatch(cpNormalized_, [&](int id) { cpHits[static_cast<std::size_t>(id)] = true; });
+    automaton.forEachMatch(desc, [&](int id) { descHits[static_cast<std::size_t>(id)] = true; });
 
-    // Healthcare
-    if (cp.find("chiropraktik") != std::string::npos || cp.find("arzt") != std::string::npos ||
-        cp.find("apotheke") != std::string::npos || cp.find("klinik") != std::string::npos ||
-        cp.find("praxis") != std::string::npos || cp.find("physio") != std::string::npos ||
-        desc.find("chiropraktik") != std::string::npos || desc.find("behandlung") != std::string::npos ||
-        cp.find("fitstar") != std::string::npos ||
-        cp.find("fitness") != std::string::npos || cp.find("gym") != std::string::npos ||
-        desc.find("mitgliedsbeitrag") != std::string::npos) {
-        return core::TransactionCategory::Healthcare;
-    }
-
-    // Restaurants & Food Delivery - check before subscriptions
-    if (cp.find("wolt") != std::string::npos || cp.find("lieferando") != std::string::npos ||
-        cp.find("ubereats") != std::string::npos || cp.find("deliveroo") != std::string::npos ||
-        cp.find("restaurant") != std::string::npos || cp.find("cafe") != std::string::npos ||
-        cp.find("bistro") != std::string::npos || cp.find("imbiss") != std::string::npos ||
-        desc.find("sushi") != std::string::npos || desc.find("pizza") != std::string::npos ||
-        desc.find("burger") != std::string::npos || desc.find("cafe") != std::string::npos ||
-        desc.find("restaurant") != std::string::npos || desc.find("amari") != std::string::npos ||
-        desc.find("kantine") != std::string::npos || desc.find("ciaoamore") != std::string::npos) {
-        return core::TransactionCategory::Restaurants;
-    }
-
-    // Cinema
-    if (cp.find("cinemaxx") != std::string::npos || cp.find("cinestar") != std::string::npos ||
-        cp.find("kino") != std::string::npos || desc.find("kino") != std::string::npos ||
-        cp.find("cinema") != std::string::npos || cp.find("uci") != std::string::npos ||
-        desc.find("cinemaxx") != std::string::npos || desc.find("cinestar") != std::string::npos) {
-        return core::TransactionCategory::Cinema;
-    }
-
-    // Entertainment (games, streaming purchases)
-    if (desc.find("steam") != std::string::npos || desc.find("humble") != std::string::npos ||
-        desc.find("gog.com") != std::string::npos || desc.find("epicgames") != std::string::npos ||
-        desc.find("nintendo") != std::string::npos || desc.find("xbox") != std::string::npos ||
-        cp.find("steam") != std::string::npos || cp.find("valve") != std::string::npos) {
-        return core::TransactionCategory::Entertainment;
-    }
-
-    // Subscriptions - digital services
-    if (cp.find("netflix") != std::string::npos || desc.find("netflix") != std::string::npos ||
-        cp.find("spotify") != std::string::npos || desc.find("spotify") != std::string::npos ||
-        cp.find("disney") != std::string::npos || desc.find("disney") != std::string::npos ||
-        desc.find("primevideo") != std::string::npos ||
-        desc.find("amznprime") != std::string::npos ||
-        cp.find("apple.com") != std::string::npos || desc.find("itunes") != std::string::npos ||
-        desc.find("appleservices") != std::string::npos || desc.find("applese") != std::string::npos ||
-        desc.find("ytpremium") != std::string::npos || desc.find("youtube") != std::string::npos ||
-        desc.find("googlepayment") != std::string::npos || desc.find("google,") != std::string::npos ||
-        desc.find("proton") != std::string::npos ||
-        desc.find("sonyinteractive") != std::string::npos || desc.find("playstation") != std::string::npos ||
-        desc.find("adfree") != std::string::npos) {
-        return core::TransactionCategory::Subscriptions;
-    }
-
-    // Groceries
-    if (cp.find("rewe") != std::string::npos || cp.find("edeka") != std::string::npos ||
-        cp.find("aldi") != std::string::npos || cp.find("lidl") != std::string::npos ||
-        cp.find("penny") != std::string::npos || cp.find("netto") != std::string::npos ||
-        cp.find("kaufland") != std::string::npos || cp.find("norma") != std::string::npos ||
-        desc.find("rewe") != std::string::npos || desc.find("edeka") != std::string::npos ||
-        desc.find("aldi") != std::string::npos || desc.find("lidl") != std::string::npos) {
-        return core::TransactionCategory::Groceries;
-    }
-
-    // Utilities
-    if (cp.find("eprimo") != std::string::npos || cp.find("stadtwerke") != std::string::npos ||
-        cp.find("m-net") != std::string::npos || cp.find("telekom") != std::string::npos ||
-        cp.find("vodafone") != std::string::npos || cp.find("o2") != std::string::npos ||
-        cp.find("congstar") != std::string::npos ||
-        desc.find("telefonie") != std::string::npos || desc.find("strom") != std::string::npos ||
-        (desc.find("gas") != std::string::npos && desc.find("agip") == std::string::npos)) {
-        return core::TransactionCategory::Utilities;
-    }
-
-    // Transportation - gas stations, parking, car sharing, public transport
-    if (cp.find("miles") != std::string::npos || desc.find("milesmo") != std::string::npos ||
-        cp.find("db") != std::string::npos || cp.find("deutschebahn") != std::string::npos ||
-        cp.find("tankstelle") != std::string::npos ||
-        cp.find("shell") != std::string::npos || cp.find("aral") != std::string::npos ||
-        cp.find("agip") != std::string::npos || desc.find("agip") != std::string::npos ||
-        desc.find("parkster") != std::string::npos || desc.find("parking") != std::string::npos ||
-        cp.find("sixt") != std::string::npos || cp.find("sharenow") != std::string::npos ||
-        desc.find("tanken") != std::string::npos || desc.find("service-station") != std::string::npos) {
-        return core::TransactionCategory::Transportation;
-    }
-
-    // Insurance
-    if (cp.find("versicher") != std::string::npos || cp.find("vers.") != std::string::npos ||
-        cp.find("hanse") != std::string::npos || cp.find("allianz") != std::string::npos ||
-        cp.find("axa") != std::string::npos || cp.find("roland") != std::string::npos ||
-        desc.find("versicherung") != std::string::npos || desc.find("rechtsschutz") != std::string::npos ||
-        desc.find("haftpflicht") != std::string::npos || desc.find("sachversicherung") != std::string::npos) {
-        return core::TransactionCategory::Insurance;
-    }
-
-    // Shopping (Amazon marketplace, Zalando, Klarna, etc.)
-    if (desc.find("amznmktp") != std::string::npos || desc.find("amazonmktp") != std::string::npos ||
-        desc.find("amazonmonatsabrech") != std::string::npos ||
-        cp.find("amazonpayments") != std::string::npos ||
-        cp.find("zalando") != std::string::npos || desc.find("zalando") != std::string::npos ||
-        cp.find("riverty") != std::string::npos ||
-        cp.find("klarna") != std::string::npos || desc.find("klarna") != std::string::npos) {
-        return core::TransactionCategory::Shopping;
+    // "agip" anywhere in the description vetoes the Utilities "gas" rule
+    bool descHasAgip = false;
+    for (std::size_t i = 0; i < kBuiltInRules.size(); ++i) {
+        if (kBuiltInRules[i].pattern == "agip" && descHits[i]) {
+            descHasAgip = true;
+            break;
+        }
     }
 
-    // Bank fees
-    if (cp.find("ing") != std::string::npos && desc.find("entgelt") != std::string::npos) {
-        return core::TransactionCategory::Fee;
+    for (std::size_t i = 0; i < kBuiltInRules.size(); ++i) {
+        const auto& rule = kBuiltInRules[i];
+        bool hit = rule.field == Field::Counterparty ? cpHits[i] : descHits[i];
+        if (!hit) {
+            continue;
+        }
+        if (rule.pattern == "gas" && rule.category == Cat::Utilities && descHasAgip) {
+            continue;
+        }
+        if (i == kFeeIngRule || i == kFeeEntgeltRule) {
+            if (cpHits[kFeeIngRule] && descHits[kFeeEntgeltRule]) {
+                return Cat::Fee;
+            }
+            continue;
+        }
+        return rule.category;
     }
 
     return std::nullopt;
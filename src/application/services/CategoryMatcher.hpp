@@ -1,10 +1,12 @@
 #pragma once
 
 #include <map>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
 #include <vector>
+#include "application/services/NormalizationCache.hpp"
 #include "core/transaction/Transaction.hpp"
 #include "infrastructure/config/ConfigParser.hpp"
 
@@ -22,10 +24,21 @@ public:
 
     auto setCustomRules(std::vector<infrastructure::config::CategorizationRule> rules) -> void;
 
+    // Adopt an already-compiled rule set (e.g. the ConfigWatcher's warm
+    // snapshot) instead of compiling a private copy; the set is shared
+    // and must stay immutable for the matcher's lifetime
+    auto setCompiledRules(
+        std::shared_ptr<const infrastructure::config::CompiledRuleSet> rules) -> void;
+
+    // `merchant` is the extracted PayPal merchant when the transaction has
+    // one stored (import extracts it once, migration v13 backfilled old
+    // rows); empty means "none known" and the matcher falls back to carving
+    // the memo itself
     [[nodiscard]] auto categorize(
         std::string_view counterparty,
         std::string_view description,
-        std::optional<int64_t> amountCents = std::nullopt)
+        std::optional<int64_t> amountCents = std::nullopt,
+        std::string_view merchant = {})
         -> CategorizationResult;
 
     [[nodiscard]] auto getRuleStats() const
@@ -34,12 +47,34 @@ public:
     auto resetStats() -> void;
 
 private:
-    std::vector<infrastructure::config::CategorizationRule> customRules_;
+    // Custom rules are compiled once on assignment; categorize() then does
+    // a single normalization of its inputs per call. sharedRules_ takes
+    // precedence when set (activeRules() picks).
+    infrastructure::config::CompiledRuleSet customRules_;
+    std::shared_ptr<const infrastructure::config::CompiledRuleSet> sharedRules_;
+
+    [[nodiscard]] auto activeRules() const
+        -> const infrastructure::config::CompiledRuleSet& {
+        return sharedRules_ ? *sharedRules_ : customRules_;
+    }
     std::map<std::string, int> ruleHits_;
 
-    [[nodiscard]] auto matchBuiltInRules(
-        std::string_view counterparty,
-        std::string_view description)
+    // Counterparty strings repeat constantly (a history has a few hundred
+    // distinct names), so their normalization is memoized; cpNormalized_
+    // views into the cache, whose entries are reference-stable.
+    // Descriptions are mostly unique memos, so descNormalized_ stays a
+    // reused scratch buffer (clear() keeps capacity); descScratch_ is used
+    // by the PayPal merchant extraction.
+    NormalizationCache cache_;
+    std::string_view cpNormalized_;
+    std::string descNormalized_;
+    std::string descScratch_;
+
+    // Matches against cpNormalized_/descNormalized_, which categorize()
+    // must have filled; the raw description is only needed for the PayPal
+    // merchant carve-out, and only when no stored merchant was passed in
+    [[nodiscard]] auto matchBuiltInRules(std::string_view description,
+                                         std::string_view merchant)
         -> std::optional<core::TransactionCategory>;
 };
 
@@ -1,4 +1,5 @@
 #include "application/services/ConfigService.hpp"
+#include "infrastructure/config/ConfigCache.hpp"
 #include "infrastructure/config/ConfigWriter.hpp"
 #include "infrastructure/config/YamlConfigParser.hpp"
 #include <fstream>
@@ -38,8 +39,18 @@ auto ConfigService::loadConfig()
 {
     auto yamlPath = getConfigPath();
     if (std::filesystem::exists(yamlPath)) {
+        // The config changes rarely, so most invocations are served from
+        // the binary cache; the YAML parser only runs when the file's
+        // mtime or content hash no longer matches
+        if (auto cached = infrastructure::config::ConfigCache::load(yamlPath)) {
+            return std::move(*cached);
+        }
         infrastructure::config::YamlConfigParser yamlParser;
-        return yamlParser.parse(yamlPath);
+        auto config = yamlParser.parse(yamlPath);
+        if (config) {
+            infrastructure::config::ConfigCache::store(yamlPath, *config);
+        }
+        return config;
     }
 
     // Fall back to legacy config.txt
@@ -61,8 +72,15 @@ auto ConfigService::loadConfig(const std::filesystem::path& path)
     }
 
     if (path.extension() == ".yaml" || path.extension() == ".yml") {
+        if (auto cached = infrastructure::config::ConfigCache::load(path)) {
+            return std::move(*cached);
+        }
         infrastructure::config::YamlConfigParser yamlParser;
-        return yamlParser.parse(path);
+        auto config = yamlParser.parse(path);
+        if (config) {
+            infrastructure::config::ConfigCache::store(path, *config);
+        }
+        return config;
     }
 
     infrastructure::config::ConfigParser parser;
@@ -0,0 +1,104 @@
+#include "application/services/ConfigWatcher.hpp"
+#include <filesystem>
+#include <utility>
+#include "application/services/ConfigService.hpp"
+
+namespace ares::application::services {
+
+namespace {
+
+auto sameRules(const std::vector<infrastructure::config::CategorizationRule>& a,
+               const std::vector<infrastructure::config::CategorizationRule>& b)
+    -> bool
+{
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        if (a[i].pattern != b[i].pattern ||
+            a[i].category != b[i].category ||
+            a[i].amountCents != b[i].amountCents) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // anonymous namespace
+
+auto ConfigWatcher::shared() -> ConfigWatcher& {
+    static ConfigWatcher instance;
+    return instance;
+}
+
+auto ConfigWatcher::currentFingerprint() -> Fingerprint {
+    // Mirror ConfigService's resolution: the YAML config when present,
+    // the legacy config.txt otherwise
+    ConfigService configService;
+    auto path = configService.getConfigPath();
+    if (!std::filesystem::exists(path)) {
+        auto legacyPath = configService.getLegacyConfigPath();
+        if (std::filesystem::exists(legacyPath)) {
+            path = legacyPath;
+        }
+    }
+
+    Fingerprint fp;
+    fp.path = path.string();
+    std::error_code ec;
+    auto size = std::filesystem::file_size(path, ec);
+    if (ec) {
+        return fp;
+    }
+    auto mtime = std::filesystem::last_write_time(path, ec);
+    if (ec) {
+        return fp;
+    }
+    fp.exists = true;
+    fp.size = size;
+    fp.mtime = mtime.time_since_epoch().count();
+    return fp;
+}
+
+auto ConfigWatcher::snapshot() -> std::shared_ptr<const ConfigSnapshot> {
+    std::lock_guard lock{mutex_};
+
+    auto fp = currentFingerprint();
+    if (current_ && fp == fingerprint_) {
+        return current_;
+    }
+
+    ConfigService configService;
+    auto loaded = configService.loadConfig();
+
+    auto next = std::make_shared<ConfigSnapshot>();
+    if (loaded) {
+        next->config = std::move(*loaded);
+    }
+    next->generation = (current_ ? current_->generation : 0) + 1;
+
+    // Diff against the previous generation: when the rule set is
+    // unchanged (a comment edit, a budget tweak) the warm compiled set
+    // carries over instead of being rebuilt
+    if (current_ && sameRules(current_->config.categorizationRules,
+                              next->config.categorizationRules)) {
+        next->compiledRules = current_->compiledRules;
+    } else {
+        next->compiledRules =
+            std::make_shared<const infrastructure::config::CompiledRuleSet>(
+                infrastructure::config::ConfigParser::compileRules(
+                    next->config.categorizationRules));
+    }
+
+    fingerprint_ = fp;
+    current_ = std::move(next);
+    return current_;
+}
+
+auto ConfigWatcher::invalidate() -> void {
+    std::lock_guard lock{mutex_};
+    current_.reset();
+    fingerprint_ = {};
+}
+
+} // namespace ares::application::services
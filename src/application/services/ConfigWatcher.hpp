@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include "infrastructure/config/ConfigParser.hpp"
+
+namespace ares::application::services {
+
+// One loaded config generation. compiledRules is shared, immutable and
+// reference-counted, so matchers across commands (and worker shards) can
+// hold the same warm rule set without copying or recompiling it.
+struct ConfigSnapshot {
+    infrastructure::config::UserConfig config;
+    std::shared_ptr<const infrastructure::config::CompiledRuleSet> compiledRules;
+    std::uint64_t generation{0};
+};
+
+// Process-lifetime config state for the daemon: commands take a snapshot
+// instead of loading the config themselves, and the watcher only reloads
+// when the file on disk actually changed (checked by a stat per call, so
+// an edited config.yaml is picked up without a restart). On reload the
+// old and new rule sets are diffed; an edit that leaves the rules intact
+// - a comment, a budget tweak - keeps the previous compiled rule set
+// alive instead of rebuilding it. In one-shot invocations the watcher
+// degrades to a single load.
+class ConfigWatcher {
+public:
+    [[nodiscard]] static auto shared() -> ConfigWatcher&;
+
+    // Current config, reloading first if the file changed since the
+    // previous call. The returned snapshot is immutable; a concurrent
+    // reload produces a new generation and never mutates handed-out
+    // snapshots.
+    [[nodiscard]] auto snapshot() -> std::shared_ptr<const ConfigSnapshot>;
+
+    // Forget the cached state so the next snapshot() reloads
+    auto invalidate() -> void;
+
+private:
+    struct Fingerprint {
+        std::string path;
+        bool exists{false};
+        std::uintmax_t size{0};
+        std::int64_t mtime{0};
+
+        auto operator==(const Fingerprint&) const -> bool = default;
+    };
+
+    [[nodiscard]] static auto currentFingerprint() -> Fingerprint;
+
+    std::mutex mutex_;
+    Fingerprint fingerprint_;
+    std::shared_ptr<const ConfigSnapshot> current_;
+};
+
+} // namespace ares::application::services
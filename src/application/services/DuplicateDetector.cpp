@@ -1,14 +1,24 @@
 #include "application/services/DuplicateDetector.hpp"
+#include "core/common/PerfCounters.hpp"
+#include "application/WorkerPool.hpp"
 #include <algorithm>
+#include <array>
 #include <chrono>
+#include "core/common/CivilDate.hpp"
 #include <cmath>
-#include <set>
+#include <map>
+#include <memory_resource>
+#include <thread>
 #include <fmt/format.h>
+#include "core/common/TextNormalize.hpp"
 
 namespace ares::application::services {
 
 DuplicateDetector::DuplicateDetector(DuplicateDetectionConfig config)
-    : config_{config}
+    : config_{config},
+      highConfidenceReason_{"Same amount, date, counterparty, and account"},
+      windowReason_{fmt::format("Same amount and date within {} day(s)",
+                                config.dateWindowDays)}
 {
 }
 
@@ -16,40 +26,20 @@ auto DuplicateDetector::normalizeCounterpartyName(const std::string& name)
     -> std::string
 {
     std::string result;
-    result.reserve(name.size());
-
-    bool lastWasSpace = true;  // Treat start as space to trim leading
-
-    for (char c : name) {
-        if (c == ' ' || c == '\t') {
-            if (!lastWasSpace) {
-                result += ' ';
-                lastWasSpace = true;
-            }
-        } else {
-            result += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
-            lastWasSpace = false;
-        }
-    }
-
-    // Trim trailing space
-    while (!result.empty() && result.back() == ' ') {
-        result.pop_back();
-    }
-
+    core::text::lowercaseCollapseSpacesInto(name, result);
     return result;
 }
 
-auto DuplicateDetector::datesWithinTolerance(core::Date a, core::Date b)
+auto DuplicateDetector::datesWithinTolerance(core::Date a, core::Date b) const
     -> bool
 {
-    auto sysDays1 = std::chrono::sys_days{a};
-    auto sysDays2 = std::chrono::sys_days{b};
-    auto diff = sysDays1 > sysDays2 ? sysDays1 - sysDays2 : sysDays2 - sysDays1;
-    return diff.count() <= config_.dateWindowDays;
+    auto days1 = core::civil::toEpochDay(a);
+    auto days2 = core::civil::toEpochDay(b);
+    auto diff = days1 > days2 ? days1 - days2 : days2 - days1;
+    return diff <= config_.dateWindowDays;
 }
 
-auto DuplicateDetector::amountsWithinTolerance(core::Money a, core::Money b)
+auto DuplicateDetector::amountsWithinTolerance(core::Money a, core::Money b) const
     -> bool
 {
     auto diff = std::abs(a.cents() - b.cents());
@@ -57,8 +47,9 @@ auto DuplicateDetector::amountsWithinTolerance(core::Money a, core::Money b)
 }
 
 auto DuplicateDetector::counterpartiesMatch(
-    const std::optional<std::string>& a,
-    const std::optional<std::string>& b)
+    const std::optional<core::InternedString>& a,
+    const std::optional<core::InternedString>& b,
+    NormalizationCache& cache) const
     -> bool
 {
     if (!a.has_value() && !b.has_value()) {
@@ -69,8 +60,22 @@ auto DuplicateDetector::counterpartiesMatch(
         return false;
     }
 
+    // Interned rows from the same repository share storage, so identical
+    // counterparties match on the pointer before any normalization runs
+    if (a->sharesStorageWith(*b)) {
+        return true;
+    }
+
     if (config_.normalizeCounterparty) {
-        return normalizeCounterpartyName(*a) == normalizeCounterpartyName(*b);
+        // References into the cache are stable, so comparing two lookups
+        // directly is safe
+        if (cache.collapsedSpaces(*a) == cache.collapsedSpaces(*b)) {
+            return true;
+        }
+        // ING renders the same merchant differently across months ("Sony
+        // Int eractive" vs "SONY INTERACTIVE ENT."); precomputed trigram
+        // signatures catch those without per-pair edit distance
+        return tokenSignaturesMatch(cache.signature(*a), cache.signature(*b));
     }
 
     return *a == *b;
@@ -78,9 +83,11 @@ auto DuplicateDetector::counterpartiesMatch(
 
 auto DuplicateDetector::similarity(
     const core::Transaction& a,
-    const core::Transaction& b)
+    const core::Transaction& b,
+    NormalizationCache& cache) const
     -> double
 {
+    ARES_PERF_SCOPE("DuplicateDetector::similarity");
     // If amounts differ beyond tolerance, not a duplicate
     if (!amountsWithinTolerance(a.amount(), b.amount())) {
         return 0.0;
@@ -95,7 +102,7 @@ auto DuplicateDetector::similarity(
     double score = 0.5;
 
     // +0.3 if counterparties match
-    if (counterpartiesMatch(a.counterpartyName(), b.counterpartyName())) {
+    if (counterpartiesMatch(a.counterpartyName(), b.counterpartyName(), cache)) {
         score += 0.3;
     }
 
@@ -112,47 +119,119 @@ auto DuplicateDetector::findDuplicates(
     -> std::vector<DuplicateCandidate>
 {
     std::vector<DuplicateCandidate> duplicates;
-    std::set<std::pair<std::string, std::string>> seen;
-
-    for (size_t i = 0; i < transactions.size(); ++i) {
-        for (size_t j = i + 1; j < transactions.size(); ++j) {
-            const auto& txn1 = transactions[i];
-            const auto& txn2 = transactions[j];
 
-            // Skip same transaction (same ID)
-            if (txn1.id() == txn2.id()) {
-                continue;
-            }
-
-            double score = similarity(txn1, txn2);
+    // similarity() returns 0 unless amounts are within amountToleranceCents
+    // and dates within dateWindowDays, so with bucket widths of tolerance+1
+    // every qualifying pair lands in the same or an adjacent bucket along
+    // both axes. Bucketing makes the scan effectively linear on real
+    // histories while producing the same candidates as the old O(n^2)
+    // pair loop.
+    const int64_t amountWidth = config_.amountToleranceCents + 1;
+    const int64_t dayWidth = static_cast<int64_t>(config_.dateWindowDays) + 1;
+
+    // Integer division truncates toward zero; buckets need floor semantics
+    // so negative amounts do not straddle zero
+    auto floorDiv = [](int64_t value, int64_t width) {
+        return value >= 0 ? value / width : -((-value + width - 1) / width);
+    };
+
+    // All bucket scratch - map nodes and member vectors - comes from one
+    // per-call arena: filling it is pointer bumps, and teardown is a single
+    // release when detection finishes instead of a free per node
+    std::pmr::monotonic_buffer_resource arena{64 * 1024};
+    std::pmr::map<std::pair<int64_t, int64_t>, std::pmr::vector<std::size_t>> buckets{&arena};
+    for (std::size_t i = 0; i < transactions.size(); ++i) {
+        auto days = core::civil::toEpochDay(transactions[i].date());
+        buckets[{floorDiv(transactions[i].amount().cents(), amountWidth),
+                 floorDiv(days, dayWidth)}].push_back(i);
+    }
 
-            if (score >= 0.5) {
-                // Deduplicate: don't report A-B and B-A
-                auto key = std::make_pair(
-                    std::min(txn1.id().value, txn2.id().value),
-                    std::max(txn1.id().value, txn2.id().value));
+    // Buckets are independent units of work: scoring only reads the
+    // transactions and the (now immutable) bucket map, so contiguous shards
+    // of buckets run on a worker pool with per-worker candidate vectors
+    std::pmr::vector<const std::pmr::vector<std::size_t>*> bucketOrder{&arena};
+    std::pmr::vector<std::pair<int64_t, int64_t>> bucketKeys{&arena};
+    bucketOrder.reserve(buckets.size());
+    bucketKeys.reserve(buckets.size());
+    for (const auto& [key, members] : buckets) {
+        bucketKeys.push_back(key);
+        bucketOrder.push_back(&members);
+    }
 
-                if (seen.contains(key)) {
-                    continue;
-                }
-                seen.insert(key);
-
-                std::string reason;
-                if (score >= 0.8) {
-                    reason = fmt::format("Same amount, date, counterparty, and account");
-                } else if (score >= 0.5) {
-                    reason = fmt::format("Same amount and date within {} day(s)",
-                                         config_.dateWindowDays);
+    // Each bucket is compared against itself and the half of its 3x3
+    // neighbourhood with a lexicographically greater key, so every
+    // candidate pair is visited exactly once and no A-B/B-A dedup set is
+    // needed
+    constexpr std::array<std::pair<int64_t, int64_t>, 4> kNeighbours{{
+        {0, 1}, {1, -1}, {1, 0}, {1, 1}
+    }};
+
+    auto configured = config_.workerCount != 0
+        ? config_.workerCount
+        : std::max(1u, std::thread::hardware_concurrency());
+    // Never spawn more workers than buckets
+    auto workers = std::min<std::size_t>(
+        configured, std::max<std::size_t>(bucketOrder.size(), 1));
+    std::vector<std::vector<DuplicateCandidate>> shards(workers);
+    WorkerPool::shared().parallelFor(bucketOrder.size(), workers,
+        [&](std::size_t w, std::size_t begin, std::size_t end) {
+                auto& shard = shards[w];
+                NormalizationCache cache;
+
+                auto compare = [&](std::size_t i, std::size_t j) {
+                    if (i > j) {
+                        std::swap(i, j);  // keep the pair orientation of the old scan
+                    }
+                    const auto& txn1 = transactions[i];
+                    const auto& txn2 = transactions[j];
+
+                    // Skip same transaction (same ID)
+                    if (txn1.id() == txn2.id()) {
+                        return;
+                    }
+
+                    double score = similarity(txn1, txn2, cache);
+                    if (score < 0.5) {
+                        return;
+                    }
+
+                    shard.push_back(DuplicateCandidate{
+                        .first = i,
+                        .second = j,
+                        .confidence = score,
+                        .reason = score >= 0.8 ? highConfidenceReason_
+                                               : windowReason_
+                    });
+                };
+
+                for (std::size_t n = begin; n < end; ++n) {
+                    const auto& key = bucketKeys[n];
+                    const auto& members = *bucketOrder[n];
+                    for (std::size_t a = 0; a < members.size(); ++a) {
+                        for (std::size_t b = a + 1; b < members.size(); ++b) {
+                            compare(members[a], members[b]);
+                        }
+                    }
+                    for (const auto& [deltaAmount, deltaDay] : kNeighbours) {
+                        auto it = buckets.find({key.first + deltaAmount,
+                                                key.second + deltaDay});
+                        if (it == buckets.end()) {
+                            continue;
+                        }
+                        for (auto i : members) {
+                            for (auto j : it->second) {
+                                compare(i, j);
+                            }
+                        }
+                    }
                 }
+        });
 
-                duplicates.push_back(DuplicateCandidate{
-                    .transaction1 = txn1,
-                    .transaction2 = txn2,
-                    .confidence = score,
-                    .reason = std::move(reason)
-                });
-            }
-        }
+    // Merge in worker order so the pre-sort order stays deterministic
+    for (auto& shard : shards) {
+        duplicates.insert(duplicates.end(),
+                          std::make_move_iterator(shard.begin()),
+                          std::make_move_iterator(shard.end()));
     }
 
     // Sort by confidence descending
@@ -169,21 +248,23 @@ auto DuplicateDetector::isDuplicate(
     const std::vector<core::Transaction>& existing)
     -> std::optional<DuplicateCandidate>
 {
-    for (const auto& txn : existing) {
+    NormalizationCache cache;
+
+    for (std::size_t j = 0; j < existing.size(); ++j) {
+        const auto& txn = existing[j];
         if (txn.id() == newTxn.id()) {
             continue;
         }
 
-        double score = similarity(newTxn, txn);
+        double score = similarity(newTxn, txn, cache);
 
         if (score > 0.5) {
-            std::string reason = fmt::format("Matches existing transaction with {:.0f}% confidence",
-                                             score * 100);
             return DuplicateCandidate{
-                .transaction1 = newTxn,
-                .transaction2 = txn,
+                .first = 0,
+                .second = j,
                 .confidence = score,
-                .reason = std::move(reason)
+                .reason = score >= 0.8 ? highConfidenceReason_
+                                       : windowReason_
             };
         }
     }
@@ -2,22 +2,31 @@
 
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
+#include "application/services/NormalizationCache.hpp"
 #include "core/transaction/Transaction.hpp"
 
 namespace ares::application::services {
 
+// A candidate pair as indices into the transaction vector the detection
+// ran over, so results never carry owned Transaction copies. For
+// isDuplicate the probe is implicit and `second` indexes `existing`.
+// `reason` views one of the detector's prebuilt explanation strings
+// (valid for the detector's lifetime): a candidate is one push_back, with
+// no string allocation in the scoring loop.
 struct DuplicateCandidate {
-    core::Transaction transaction1;
-    core::Transaction transaction2;
-    double confidence;
-    std::string reason;
+    std::size_t first{};
+    std::size_t second{};
+    double confidence{};
+    std::string_view reason;
 };
 
 struct DuplicateDetectionConfig {
     int dateWindowDays{1};
     int64_t amountToleranceCents{0};
     bool normalizeCounterparty{true};
+    unsigned workerCount{0};  // 0 = one per hardware thread
 };
 
 class DuplicateDetector {
@@ -39,22 +48,32 @@ public:
 private:
     DuplicateDetectionConfig config_;
 
+    // Candidate explanations depend only on the (immutable) config, so they
+    // are formatted once at construction and shared by every candidate
+    std::string highConfidenceReason_;
+    std::string windowReason_;
+
+    // The cache is caller-provided so concurrent workers can score pairs
+    // independently; each worker owns one, and repeated counterparty
+    // strings normalize to a hash lookup after the first sighting
     [[nodiscard]] auto similarity(
         const core::Transaction& a,
-        const core::Transaction& b)
+        const core::Transaction& b,
+        NormalizationCache& cache) const
         -> double;
 
     [[nodiscard]] auto datesWithinTolerance(
-        core::Date a, core::Date b)
+        core::Date a, core::Date b) const
         -> bool;
 
     [[nodiscard]] auto amountsWithinTolerance(
-        core::Money a, core::Money b)
+        core::Money a, core::Money b) const
         -> bool;
 
     [[nodiscard]] auto counterpartiesMatch(
-        const std::optional<std::string>& a,
-        const std::optional<std::string>& b)
+        const std::optional<core::InternedString>& a,
+        const std::optional<core::InternedString>& b,
+        NormalizationCache& cache) const
         -> bool;
 };
 
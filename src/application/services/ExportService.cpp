@@ -1,7 +1,11 @@
 #include "application/services/ExportService.hpp"
 #include <chrono>
 #include <fstream>
+#include <optional>
 #include <fmt/format.h>
+#include "core/common/CivilDate.hpp"
+#include "infrastructure/analytics/ColumnarSnapshot.hpp"
+#include "infrastructure/compression/Gzip.hpp"
 
 namespace ares::application::services {
 
@@ -41,6 +45,106 @@ auto formatDate(core::Date date) -> std::string {
         static_cast<unsigned>(date.day()));
 }
 
+auto appendCsvRow(std::string& out, const core::Transaction& txn) -> void {
+    fmt::format_to(std::back_inserter(out), "{},{:.2f},{},{},{},{},{}\n",
+        formatDate(txn.date()),
+        txn.amount().toDouble(),
+        core::currencyCode(txn.amount().currency()),
+        core::transactionTypeName(txn.type()),
+        escapeCsvField(std::string(core::categoryName(txn.category()))),
+        escapeCsvField(txn.counterpartyName().value_or("")),
+        escapeCsvField(txn.description()));
+}
+
+auto appendJsonRow(std::string& out, const core::Transaction& txn) -> void {
+    auto type = std::string(core::transactionTypeName(txn.type()));
+    auto category = std::string(core::categoryName(txn.category()));
+
+    // Convert type name to lowercase
+    for (auto& c : type) {
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    // Convert category name to lowercase
+    for (auto& c : category) {
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+
+    fmt::format_to(std::back_inserter(out),
+        "{{\"date\":\"{}\",\"amount\":{:.2f},\"currency\":\"{}\","
+        "\"type\":\"{}\",\"category\":\"{}\","
+        "\"counterparty\":\"{}\",\"description\":\"{}\"}}",
+        formatDate(txn.date()),
+        txn.amount().toDouble(),
+        core::currencyCode(txn.amount().currency()),
+        escapeJson(type),
+        escapeJson(category),
+        escapeJson(txn.counterpartyName().value_or("")),
+        escapeJson(txn.description()));
+}
+
+// Rows are formatted into the buffer and flushed once it grows past this,
+// so exports of any size keep a constant footprint
+constexpr std::size_t kFlushBytes = 64 * 1024;
+
+// The export filter maps one-to-one onto the repository's pushdown
+// predicates, so a filtered export only ever hydrates matching rows
+auto toRepositoryFilter(const ExportFilter& filter) -> core::TransactionRepository::Filter {
+    return {.from = filter.fromDate, .to = filter.toDate, .category = filter.category};
+}
+
+// Where flushed buffers go: straight to the file, or through the gzip
+// stage when the output path ends in ".gz"
+class RowSink {
+public:
+    [[nodiscard]] static auto open(const std::filesystem::path& path)
+        -> std::expected<RowSink, core::Error>
+    {
+        RowSink sink;
+        if (path.extension() == ".gz") {
+            auto writer = infrastructure::compression::GzipWriter::open(path);
+            if (!writer) {
+                return std::unexpected(writer.error());
+            }
+            sink.gzip_.emplace(std::move(*writer));
+            return sink;
+        }
+        sink.file_.open(path);
+        if (!sink.file_.is_open()) {
+            return std::unexpected(core::IoError{path.string(), "Failed to open file for writing"});
+        }
+        sink.path_ = path;
+        return sink;
+    }
+
+    [[nodiscard]] auto flush(std::string& buffer) -> std::expected<void, core::Error> {
+        if (gzip_) {
+            auto written = gzip_->write(buffer);
+            buffer.clear();
+            return written;
+        }
+        file_.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        buffer.clear();
+        if (!file_.good()) {
+            return std::unexpected(core::IoError{path_.string(), "Failed to write to file"});
+        }
+        return {};
+    }
+
+    [[nodiscard]] auto finish() -> std::expected<void, core::Error> {
+        if (gzip_) {
+            return gzip_->close();
+        }
+        return {};
+    }
+
+private:
+    RowSink() = default;
+
+    std::ofstream file_;
+    std::filesystem::path path_;
+    std::optional<infrastructure::compression::GzipWriter> gzip_;
+};
+
 } // anonymous namespace
 
 auto ExportService::toCsvString(
@@ -50,22 +154,7 @@ auto ExportService::toCsvString(
     std::string result = "Date,Amount,Currency,Type,Category,Counterparty,Description\n";
 
     for (const auto& txn : transactions) {
-        auto dateStr = formatDate(txn.date());
-        auto amountStr = fmt::format("{:.2f}", txn.amount().toDouble());
-        auto currency = std::string(core::currencyCode(txn.amount().currency()));
-        auto type = std::string(core::transactionTypeName(txn.type()));
-        auto category = std::string(core::categoryName(txn.category()));
-        auto counterparty = txn.counterpartyName().value_or("");
-        auto description = txn.description();
-
-        result += fmt::format("{},{},{},{},{},{},{}\n",
-            dateStr,
-            amountStr,
-            currency,
-            type,
-            escapeCsvField(category),
-            escapeCsvField(counterparty),
-            escapeCsvField(description));
+        appendCsvRow(result, txn);
     }
 
     return result;
@@ -84,37 +173,8 @@ auto ExportService::toJsonString(
         exportedAt, transactions.size());
 
     for (size_t i = 0; i < transactions.size(); ++i) {
-        const auto& txn = transactions[i];
-
-        auto dateStr = formatDate(txn.date());
-        auto amountStr = fmt::format("{:.2f}", txn.amount().toDouble());
-        auto currency = std::string(core::currencyCode(txn.amount().currency()));
-        auto type = std::string(core::transactionTypeName(txn.type()));
-        auto category = std::string(core::categoryName(txn.category()));
-        auto counterparty = txn.counterpartyName().value_or("");
-        auto description = txn.description();
-
-        // Convert type name to lowercase
-        for (auto& c : type) {
-            c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
-        }
-        // Convert category name to lowercase
-        for (auto& c : category) {
-            c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
-        }
-
         if (i > 0) result += ",";
-        result += fmt::format(
-            "{{\"date\":\"{}\",\"amount\":{},\"currency\":\"{}\","
-            "\"type\":\"{}\",\"category\":\"{}\","
-            "\"counterparty\":\"{}\",\"description\":\"{}\"}}",
-            dateStr,
-            amountStr,
-            currency,
-            escapeJson(type),
-            escapeJson(category),
-            escapeJson(counterparty),
-            escapeJson(description));
+        appendJsonRow(result, transactions[i]);
     }
 
     result += "]}";
@@ -159,6 +219,212 @@ auto ExportService::exportJson(
     return {};
 }
 
+auto ExportService::exportCsv(
+    core::TransactionRepository& repository,
+    const ExportFilter& filter,
+    const std::filesystem::path& outputPath)
+    -> std::expected<int, core::Error>
+{
+    auto sink = RowSink::open(outputPath);
+    if (!sink) {
+        return std::unexpected(sink.error());
+    }
+
+    std::string buffer = "Date,Amount,Currency,Type,Category,Counterparty,Description\n";
+    int written = 0;
+    std::optional<core::Error> ioError;
+
+    auto visited = repository.forEachFiltered(toRepositoryFilter(filter),
+                                              [&](const core::Transaction& txn) {
+        if (ioError) return;
+        appendCsvRow(buffer, txn);
+        ++written;
+        if (buffer.size() >= kFlushBytes) {
+            if (auto flushed = sink->flush(buffer); !flushed) {
+                ioError = flushed.error();
+            }
+        }
+    });
+    if (!visited) {
+        return std::unexpected(visited.error());
+    }
+    if (ioError) {
+        return std::unexpected(*ioError);
+    }
+
+    if (auto flushed = sink->flush(buffer); !flushed) {
+        return std::unexpected(flushed.error());
+    }
+    if (auto finished = sink->finish(); !finished) {
+        return std::unexpected(finished.error());
+    }
+    return written;
+}
+
+auto ExportService::exportJson(
+    core::TransactionRepository& repository,
+    const ExportFilter& filter,
+    const std::filesystem::path& outputPath)
+    -> std::expected<int, core::Error>
+{
+    auto sink = RowSink::open(outputPath);
+    if (!sink) {
+        return std::unexpected(sink.error());
+    }
+
+    auto now = std::chrono::system_clock::now();
+    auto days = std::chrono::floor<std::chrono::days>(now);
+    auto ymd = std::chrono::year_month_day{days};
+
+    std::string buffer = fmt::format("{{\"exported_at\":\"{}\",\"transactions\":[",
+        formatDate(ymd));
+    int written = 0;
+    std::optional<core::Error> ioError;
+
+    auto visited = repository.forEachFiltered(toRepositoryFilter(filter),
+                                              [&](const core::Transaction& txn) {
+        if (ioError) return;
+        if (written > 0) buffer += ",";
+        appendJsonRow(buffer, txn);
+        ++written;
+        if (buffer.size() >= kFlushBytes) {
+            if (auto flushed = sink->flush(buffer); !flushed) {
+                ioError = flushed.error();
+            }
+        }
+    });
+    if (!visited) {
+        return std::unexpected(visited.error());
+    }
+    if (ioError) {
+        return std::unexpected(*ioError);
+    }
+
+    fmt::format_to(std::back_inserter(buffer), "],\"count\":{}}}", written);
+    if (auto flushed = sink->flush(buffer); !flushed) {
+        return std::unexpected(flushed.error());
+    }
+    if (auto finished = sink->finish(); !finished) {
+        return std::unexpected(finished.error());
+    }
+    return written;
+}
+
+auto ExportService::exportColumnar(
+    core::TransactionRepository& repository,
+    const ExportFilter& filter,
+    const std::filesystem::path& outputPath)
+    -> std::expected<int, core::Error>
+{
+    // Columns accumulate in memory - four machine words per row plus the
+    // tiny interned table - and the file is written in one pass at the end
+    infrastructure::analytics::ColumnarSnapshotWriter writer;
+
+    auto visited = repository.forEachFiltered(toRepositoryFilter(filter),
+                                              [&](const core::Transaction& txn) {
+        writer.append(static_cast<int32_t>(core::civil::toEpochDay(txn.date())),
+                      txn.amount().cents(),
+                      static_cast<uint16_t>(txn.category()),
+                      txn.counterpartyName() ? txn.counterpartyName()->view()
+                                             : std::string_view{});
+    });
+    if (!visited) {
+        return std::unexpected(visited.error());
+    }
+
+    if (auto written = writer.write(outputPath); !written) {
+        return std::unexpected(written.error());
+    }
+    return static_cast<int>(writer.rowCount());
+}
+
+auto ExportService::exportAll(
+    core::TransactionRepository& repository,
+    const ExportFilter& filter,
+    const ExportTargets& targets)
+    -> std::expected<int, core::Error>
+{
+    // Per-format state; formats not requested stay disengaged
+    std::optional<RowSink> csvSink;
+    std::optional<RowSink> jsonSink;
+    std::string csvBuffer;
+    std::string jsonBuffer;
+
+    if (targets.csvPath) {
+        auto sink = RowSink::open(*targets.csvPath);
+        if (!sink) {
+            return std::unexpected(sink.error());
+        }
+        csvSink.emplace(std::move(*sink));
+        csvBuffer = "Date,Amount,Currency,Type,Category,Counterparty,Description\n";
+    }
+    if (targets.jsonPath) {
+        auto sink = RowSink::open(*targets.jsonPath);
+        if (!sink) {
+            return std::unexpected(sink.error());
+        }
+        jsonSink.emplace(std::move(*sink));
+        auto now = std::chrono::system_clock::now();
+        auto days = std::chrono::floor<std::chrono::days>(now);
+        jsonBuffer = fmt::format("{{\"exported_at\":\"{}\",\"transactions\":[",
+            formatDate(std::chrono::year_month_day{days}));
+    }
+
+    int written = 0;
+    std::optional<core::Error> ioError;
+
+    // One cursor pass feeds every requested writer
+    auto visited = repository.forEachFiltered(toRepositoryFilter(filter),
+                                              [&](const core::Transaction& txn) {
+        if (ioError) return;
+        if (csvSink) {
+            appendCsvRow(csvBuffer, txn);
+            if (csvBuffer.size() >= kFlushBytes) {
+                if (auto flushed = csvSink->flush(csvBuffer); !flushed) {
+                    ioError = flushed.error();
+                    return;
+                }
+            }
+        }
+        if (jsonSink) {
+            if (written > 0) jsonBuffer += ",";
+            appendJsonRow(jsonBuffer, txn);
+            if (jsonBuffer.size() >= kFlushBytes) {
+                if (auto flushed = jsonSink->flush(jsonBuffer); !flushed) {
+                    ioError = flushed.error();
+                    return;
+                }
+            }
+        }
+        ++written;
+    });
+    if (!visited) {
+        return std::unexpected(visited.error());
+    }
+    if (ioError) {
+        return std::unexpected(*ioError);
+    }
+
+    if (csvSink) {
+        if (auto flushed = csvSink->flush(csvBuffer); !flushed) {
+            return std::unexpected(flushed.error());
+        }
+        if (auto finished = csvSink->finish(); !finished) {
+            return std::unexpected(finished.error());
+        }
+    }
+    if (jsonSink) {
+        fmt::format_to(std::back_inserter(jsonBuffer), "],\"count\":{}}}", written);
+        if (auto flushed = jsonSink->flush(jsonBuffer); !flushed) {
+            return std::unexpected(flushed.error());
+        }
+        if (auto finished = jsonSink->finish(); !finished) {
+            return std::unexpected(finished.error());
+        }
+    }
+    return written;
+}
+
 auto ExportService::filterTransactions(
     const std::vector<core::Transaction>& transactions,
     const ExportFilter& filter)
@@ -167,19 +433,27 @@ auto ExportService::filterTransactions(
     std::vector<core::Transaction> result;
 
     for (const auto& txn : transactions) {
-        if (filter.fromDate && txn.date() < *filter.fromDate) {
-            continue;
-        }
-        if (filter.toDate && txn.date() > *filter.toDate) {
-            continue;
-        }
-        if (filter.category && txn.category() != *filter.category) {
-            continue;
+        if (matchesFilter(txn, filter)) {
+            result.push_back(txn);
         }
-        result.push_back(txn);
     }
 
     return result;
 }
 
+auto ExportService::matchesFilter(const core::Transaction& transaction, const ExportFilter& filter)
+    -> bool
+{
+    if (filter.fromDate && transaction.date() < *filter.fromDate) {
+        return false;
+    }
+    if (filter.toDate && transaction.date() > *filter.toDate) {
+        return false;
+    }
+    if (filter.category && transaction.category() != *filter.category) {
+        return false;
+    }
+    return true;
+}
+
 } // namespace ares::application::services
@@ -30,6 +30,51 @@ public:
         const std::filesystem::path& outputPath)
         -> std::expected<void, core::Error>;
 
+    // Streaming writers: rows come through the repository cursor, get
+    // formatted into a fixed buffer and are flushed to the file
+    // incrementally, so peak memory stays constant for any export size.
+    // Returns the number of rows written. In the JSON variant "count"
+    // trails the transaction array because it is not known until the
+    // cursor finishes.
+    [[nodiscard]] auto exportCsv(
+        core::TransactionRepository& repository,
+        const ExportFilter& filter,
+        const std::filesystem::path& outputPath)
+        -> std::expected<int, core::Error>;
+
+    [[nodiscard]] auto exportJson(
+        core::TransactionRepository& repository,
+        const ExportFilter& filter,
+        const std::filesystem::path& outputPath)
+        -> std::expected<int, core::Error>;
+
+    // Columnar snapshot: contiguous typed arrays of epoch day, cents and
+    // category plus an interned counterparty table, written as one
+    // memory-mappable file (see infrastructure::analytics). No per-field
+    // string formatting on the way out and no parsing on the way back in,
+    // for external tooling and the in-process analytics reads alike.
+    // Returns the number of rows written.
+    [[nodiscard]] auto exportColumnar(
+        core::TransactionRepository& repository,
+        const ExportFilter& filter,
+        const std::filesystem::path& outputPath)
+        -> std::expected<int, core::Error>;
+
+    // Multi-format export over a single cursor pass: each hydrated row is
+    // fed to every requested format writer, so filtering and hydration -
+    // the expensive part - are paid once no matter how many outputs are
+    // requested. Formatting itself is a small fraction of the per-row cost.
+    struct ExportTargets {
+        std::optional<std::filesystem::path> csvPath;
+        std::optional<std::filesystem::path> jsonPath;
+    };
+
+    [[nodiscard]] auto exportAll(
+        core::TransactionRepository& repository,
+        const ExportFilter& filter,
+        const ExportTargets& targets)
+        -> std::expected<int, core::Error>;
+
     [[nodiscard]] auto toCsvString(
         const std::vector<core::Transaction>& transactions)
         -> std::string;
@@ -42,6 +87,9 @@ public:
         const std::vector<core::Transaction>& transactions,
         const ExportFilter& filter)
         -> std::vector<core::Transaction>;
+
+    [[nodiscard]] static auto matchesFilter(const core::Transaction& transaction,
+                                            const ExportFilter& filter) -> bool;
 };
 
 } // namespace ares::application::services
@@ -2,6 +2,7 @@
 
 #include <expected>
 #include <filesystem>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string>
@@ -18,14 +19,38 @@ struct ImportResult {
     std::string iban;
 };
 
+// Snapshot handed to the progress sink after each committed chunk
+struct ImportProgress {
+    int rowsParsed{0};
+    int newTransactions{0};
+    // Newline count of the file - an upper bound that includes the
+    // metadata header, so the bar can slightly undershoot 100%
+    int estimatedTotalRows{0};
+    double rowsPerSecond{0.0};
+    int etaSeconds{-1};  // -1 until there is enough signal to extrapolate
+};
+
 class ImportService {
 public:
+    // Invoked on the importing thread after each persisted chunk; keep it cheap
+    using ProgressSink = std::function<void(const ImportProgress&)>;
+
     ImportService() = default;
 
+    // Streamed for the ING DE path: rows flow through the parse/persist
+    // pipeline in chunks, so peak memory stays at one chunk. The whole
+    // session - every chunk plus the account upsert - runs inside one
+    // transaction (chunks are savepoints within it), applying atomically
+    // with a single journal sync; an interrupted import rolls back
+    // cleanly and re-running the file starts over, with the content-hash
+    // dedupe skipping anything imported by earlier sessions at one
+    // indexed probe each. `onProgress`, when set, is called after each
+    // chunk with running rate and ETA.
     [[nodiscard]] auto importFromFile(
         const std::filesystem::path& filePath,
         std::shared_ptr<infrastructure::persistence::DatabaseConnection> db,
-        const std::optional<std::string>& formatName = std::nullopt)
+        const std::optional<std::string>& formatName = std::nullopt,
+        const ProgressSink& onProgress = {})
         -> std::expected<ImportResult, core::Error>;
 
     [[nodiscard]] auto autoImportFromDirectory(
@@ -35,6 +60,11 @@ public:
 private:
     // Detect if the CSV content starts with the ING DE header signature
     [[nodiscard]] static auto isIngDeFormat(std::string_view content) -> bool;
+
+    // Same detection but reads only the first few KB of the file; the ING DE
+    // metadata block and column header always sit near the top, so sniffing
+    // is O(1) in file size
+    [[nodiscard]] static auto isIngDeFile(const std::filesystem::path& filePath) -> bool;
 };
 
 } // namespace ares::application::services
@@ -0,0 +1,108 @@
+#include "application/services/NormalizationCache.hpp"
+#include <algorithm>
+#include "core/common/TextNormalize.hpp"
+
+namespace ares::application::services {
+
+auto computeTokenSignature(std::string_view name) -> TokenSignature {
+    // Alphanumeric words, lowercased, then space-free: punctuation and the
+    // column breaks ING inserts both disappear before the trigrams are cut
+    std::string normalized;
+    core::text::lowercaseAlnumWordsInto(name, normalized);
+    std::erase(normalized, ' ');
+
+    TokenSignature signature;
+    if (normalized.size() < 3) {
+        if (!normalized.empty()) {
+            std::uint64_t packed = 0;
+            for (unsigned char c : normalized) {
+                packed = (packed << 8) | c;
+            }
+            signature.grams.push_back(packed);
+        }
+        return signature;
+    }
+
+    signature.grams.reserve(normalized.size() - 2);
+    for (std::size_t i = 0; i + 3 <= normalized.size(); ++i) {
+        auto g0 = static_cast<std::uint64_t>(static_cast<unsigned char>(normalized[i]));
+        auto g1 = static_cast<std::uint64_t>(static_cast<unsigned char>(normalized[i + 1]));
+        auto g2 = static_cast<std::uint64_t>(static_cast<unsigned char>(normalized[i + 2]));
+        signature.grams.push_back((g0 << 16) | (g1 << 8) | g2);
+    }
+
+    std::sort(signature.grams.begin(), signature.grams.end());
+    signature.grams.erase(std::unique(signature.grams.begin(), signature.grams.end()),
+                          signature.grams.end());
+    return signature;
+}
+
+auto signatureSimilarity(const TokenSignature& a, const TokenSignature& b) -> double {
+    if (a.grams.empty() || b.grams.empty()) {
+        return 0.0;
+    }
+
+    std::size_t shared = 0;
+    auto itA = a.grams.begin();
+    auto itB = b.grams.begin();
+    while (itA != a.grams.end() && itB != b.grams.end()) {
+        if (*itA < *itB) {
+            ++itA;
+        } else if (*itB < *itA) {
+            ++itB;
+        } else {
+            ++shared;
+            ++itA;
+            ++itB;
+        }
+    }
+
+    return static_cast<double>(shared) /
+           static_cast<double>(std::min(a.grams.size(), b.grams.size()));
+}
+
+auto tokenSignaturesMatch(const TokenSignature& a, const TokenSignature& b) -> bool {
+    // Below four trigrams (names shorter than six letters) the overlap
+    // coefficient is too coarse to mean anything; require identity
+    constexpr std::size_t kMinGrams = 4;
+    constexpr double kThreshold = 0.8;
+
+    if (std::min(a.grams.size(), b.grams.size()) < kMinGrams) {
+        return a.grams == b.grams && !a.grams.empty();
+    }
+    return signatureSimilarity(a, b) >= kThreshold;
+}
+
+auto NormalizationCache::lookup(Cache& cache, std::string_view name,
+                                void (*kernel)(std::string_view, std::string&))
+    -> const std::string&
+{
+    if (auto it = cache.find(name); it != cache.end()) {
+        return it->second;
+    }
+
+    std::string normalized;
+    kernel(name, normalized);
+    return cache.emplace(std::string{name}, std::move(normalized)).first->second;
+}
+
+auto NormalizationCache::collapsedSpaces(std::string_view name) -> const std::string& {
+    return lookup(collapsed_, name, core::text::lowercaseCollapseSpacesInto);
+}
+
+auto NormalizationCache::strippedSpaces(std::string_view name) -> const std::string& {
+    return lookup(stripped_, name, core::text::lowercaseStripSpacesInto);
+}
+
+auto NormalizationCache::alnumWords(std::string_view name) -> const std::string& {
+    return lookup(alnum_, name, core::text::lowercaseAlnumWordsInto);
+}
+
+auto NormalizationCache::signature(std::string_view name) -> const TokenSignature& {
+    if (auto it = signatures_.find(name); it != signatures_.end()) {
+        return it->second;
+    }
+    return signatures_.emplace(std::string{name}, computeTokenSignature(name)).first->second;
+}
+
+} // namespace ares::application::services
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace ares::application::services {
+
+// Token-hash fingerprint of a counterparty name: the sorted unique hashes
+// of the character trigrams of its normalized, space-free form. Word-level
+// tokens cannot bridge ING's mid-word column breaks ("Sony Int eractive"),
+// so the tokens are trigrams - "sonyinteractive" and "sonyinteractiveent"
+// share almost all of theirs.
+struct TokenSignature {
+    std::vector<std::uint64_t> grams;
+};
+
+[[nodiscard]] auto computeTokenSignature(std::string_view name) -> TokenSignature;
+
+// Overlap coefficient |A intersect B| / min(|A|, |B|); both inputs are
+// sorted, so this is a linear merge of integer vectors
+[[nodiscard]] auto signatureSimilarity(const TokenSignature& a, const TokenSignature& b)
+    -> double;
+
+// The match rule both detectors use: tiny signatures (very short names)
+// only match exactly, everything else by overlap coefficient. A short name
+// that is a substring of many others ("ing") must not fuzzy-merge.
+[[nodiscard]] auto tokenSignaturesMatch(const TokenSignature& a, const TokenSignature& b)
+    -> bool;
+
+// Memoizes the core::text normalization kernels for strings that repeat
+// across a run. Bank histories have a few hundred distinct counterparty
+// names over tens of thousands of rows, so after warm-up nearly every
+// normalization becomes a hash lookup on the original string.
+//
+// Instances are not thread-safe by design: each service (or each worker
+// in a parallel scan) owns one, because a process-wide cache would need a
+// lock on exactly the hot path this exists to speed up. Returned
+// references stay valid for the cache's lifetime (the map is node-based).
+class NormalizationCache {
+public:
+    // core::text::lowercaseCollapseSpacesInto, memoized
+    [[nodiscard]] auto collapsedSpaces(std::string_view name) -> const std::string&;
+
+    // core::text::lowercaseStripSpacesInto, memoized
+    [[nodiscard]] auto strippedSpaces(std::string_view name) -> const std::string&;
+
+    // core::text::lowercaseAlnumWordsInto, memoized
+    [[nodiscard]] auto alnumWords(std::string_view name) -> const std::string&;
+
+    // computeTokenSignature, memoized - the fingerprint of a distinct
+    // counterparty is computed once and then compared many times
+    [[nodiscard]] auto signature(std::string_view name) -> const TokenSignature&;
+
+    [[nodiscard]] auto size() const -> std::size_t {
+        return collapsed_.size() + stripped_.size() + alnum_.size();
+    }
+
+private:
+    // Transparent hashing so cache hits never allocate a key string
+    struct StringHash {
+        using is_transparent = void;
+        auto operator()(std::string_view sv) const -> std::size_t {
+            return std::hash<std::string_view>{}(sv);
+        }
+    };
+    using Cache = std::unordered_map<std::string, std::string, StringHash, std::equal_to<>>;
+
+    static auto lookup(Cache& cache, std::string_view name,
+                       void (*kernel)(std::string_view, std::string&))
+        -> const std::string&;
+
+    Cache collapsed_;
+    Cache stripped_;
+    Cache alnum_;
+    std::unordered_map<std::string, TokenSignature, StringHash, std::equal_to<>> signatures_;
+};
+
+} // namespace ares::application::services
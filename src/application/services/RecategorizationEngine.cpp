@@ -0,0 +1,191 @@
+#include "application/services/RecategorizationEngine.hpp"
+#include "application/WorkerPool.hpp"
+#include <algorithm>
+#include <thread>
+#include <fmt/format.h>
+#include "application/services/CategoryMatcher.hpp"
+
+namespace ares::application::services {
+
+RecategorizationEngine::RecategorizationEngine(
+    std::vector<infrastructure::config::CategorizationRule> rules,
+    unsigned workerCount)
+    : RecategorizationEngine{
+          std::make_shared<const infrastructure::config::CompiledRuleSet>(
+              infrastructure::config::ConfigParser::compileRules(std::move(rules))),
+          workerCount}
+{}
+
+RecategorizationEngine::RecategorizationEngine(
+    std::shared_ptr<const infrastructure::config::CompiledRuleSet> rules,
+    unsigned workerCount)
+    : rules_{std::move(rules)},
+      workerCount_{workerCount != 0
+                       ? workerCount
+                       : std::max(1u, std::thread::hardware_concurrency())}
+{}
+
+auto RecategorizationEngine::run(std::vector<core::Transaction>& transactions)
+    -> RecategorizationResult
+{
+    struct ShardResult {
+        std::map<std::pair<core::TransactionCategory, std::string>,
+                 std::vector<core::TransactionId>> pending;
+        int skipped{0};
+        std::vector<std::pair<std::string, int>> ruleStats;
+    };
+
+    // Never spawn more workers than rows
+    auto workers = std::min<std::size_t>(
+        workerCount_, std::max<std::size_t>(transactions.size(), 1));
+    std::vector<ShardResult> shards(workers);
+    WorkerPool::shared().parallelFor(transactions.size(), workers,
+        [this, &transactions, &shards](std::size_t w, std::size_t begin, std::size_t end) {
+                CategoryMatcher matcher;
+                if (!rules_->empty()) {
+                    matcher.setCompiledRules(rules_);
+                }
+                auto& shard = shards[w];
+                for (std::size_t i = begin; i < end; ++i) {
+                    auto& txn = transactions[i];
+                    // Honor manual user overrides - never overwrite a
+                    // category the user set explicitly
+                    if (txn.userCategoryOverride()) {
+                        ++shard.skipped;
+                        continue;
+                    }
+                    auto result = matcher.categorize(
+                        txn.counterpartyName().value_or(""),
+                        txn.description(),
+                        txn.amount().cents(),
+                        txn.merchant() ? txn.merchant()->view() : std::string_view{});
+                    txn.setCategory(result.category);
+                    txn.setMatchedRule(result.matchedRule);
+                    if (txn.isDirty()) {
+                        shard.pending[{result.category, result.matchedRule}]
+                            .push_back(txn.id());
+                    }
+                }
+                shard.ruleStats = matcher.getRuleStats();
+        });
+
+    // Merge the shards in worker order so id ordering stays deterministic
+    RecategorizationResult merged;
+    std::map<std::string, int> mergedStats;
+    for (auto& shard : shards) {
+        merged.skipped += shard.skipped;
+        for (auto& [key, ids] : shard.pending) {
+            auto& target = merged.pending[key];
+            target.insert(target.end(),
+                          std::make_move_iterator(ids.begin()),
+                          std::make_move_iterator(ids.end()));
+        }
+        for (const auto& [rule, hits] : shard.ruleStats) {
+            mergedStats[rule] += hits;
+        }
+    }
+
+    merged.ruleStats.assign(mergedStats.begin(), mergedStats.end());
+    // Same presentation order as CategoryMatcher::getRuleStats
+    std::sort(merged.ruleStats.begin(), merged.ruleStats.end(),
+              [](const auto& a, const auto& b) { return a.second > b.second; });
+
+    return merged;
+}
+
+namespace {
+
+// The label CategoryMatcher records for a transaction matched by the rule
+// behind this key: amount rules all share the "custom" stats bucket
+auto staleLabelFor(const std::string& ruleKey) -> std::string {
+    return ruleKey.starts_with("amount:") ? "custom" : ruleKey;
+}
+
+} // namespace
+
+auto RecategorizationEngine::ruleState(
+    const std::vector<infrastructure::config::CategorizationRule>& rules)
+    -> std::vector<infrastructure::persistence::CategorizationRuleState>
+{
+    std::vector<infrastructure::persistence::CategorizationRuleState> state;
+    state.reserve(rules.size());
+    for (std::size_t i = 0; i < rules.size(); ++i) {
+        const auto& rule = rules[i];
+        // An amount rule's identity is its amount; a pattern rule's is its
+        // pattern. Either way the key pins the rule's match condition, so a
+        // state entry with an unchanged key still matches the same rows.
+        auto key = rule.amountCents
+            ? fmt::format("amount:{}", *rule.amountCents)
+            : rule.pattern;
+        state.push_back({
+            .ruleKey = std::move(key),
+            .category = static_cast<int>(rule.category),
+            .position = static_cast<int>(i)
+        });
+    }
+    return state;
+}
+
+auto RecategorizationEngine::planIncremental(
+    const std::vector<infrastructure::persistence::CategorizationRuleState>& previous,
+    const std::vector<infrastructure::persistence::CategorizationRuleState>& current)
+    -> RecategorizationPlan
+{
+    RecategorizationPlan plan;  // fullScan until proven otherwise
+
+    // No snapshot yet (first run after the migration) - scan everything so
+    // matched_rule gets backfilled
+    if (previous.empty()) {
+        return plan;
+    }
+
+    std::map<std::string, const infrastructure::persistence::CategorizationRuleState*> prevByKey;
+    for (const auto& state : previous) {
+        if (!prevByKey.emplace(state.ruleKey, &state).second) {
+            return plan;  // duplicate keys make the delta ambiguous
+        }
+    }
+
+    // An added rule can claim rows currently owned by any later rule or by
+    // the built-ins, and a reorder shifts priorities the same way - both
+    // need the full history
+    int lastPrevPosition = -1;
+    std::map<std::string, bool> seen;
+    for (const auto& state : current) {
+        if (!seen.emplace(state.ruleKey, true).second) {
+            return plan;
+        }
+        auto it = prevByKey.find(state.ruleKey);
+        if (it == prevByKey.end()) {
+            return plan;  // rule added
+        }
+        if (it->second->position <= lastPrevPosition) {
+            return plan;  // surviving rules reordered
+        }
+        lastPrevPosition = it->second->position;
+    }
+
+    // Remaining delta: removed rules and category edits. A rule's key pins
+    // its match condition, so only the rows it owns are affected.
+    plan.fullScan = false;
+    std::map<std::string, bool> staleLabels;
+    for (const auto& prev : previous) {
+        const infrastructure::persistence::CategorizationRuleState* now = nullptr;
+        for (const auto& state : current) {
+            if (state.ruleKey == prev.ruleKey) {
+                now = &state;
+                break;
+            }
+        }
+        if (!now || now->category != prev.category) {
+            staleLabels.emplace(staleLabelFor(prev.ruleKey), true);
+        }
+    }
+    plan.staleRules.reserve(staleLabels.size());
+    for (const auto& [label, _] : staleLabels) {
+        plan.staleRules.push_back(label);
+    }
+    return plan;
+}
+
+} // namespace ares::application::services
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "core/transaction/Transaction.hpp"
+#include "infrastructure/config/ConfigParser.hpp"
+#include "infrastructure/persistence/SqliteRuleStateRepository.hpp"
+
+namespace ares::application::services {
+
+// Outcome of a recategorization pass. pending holds the ids of transactions
+// whose category actually changed, grouped by (category, matched rule) so
+// the caller can issue one bulk UPDATE per group; ruleStats is the per-rule
+// hit count merged across all workers.
+struct RecategorizationResult {
+    std::map<std::pair<core::TransactionCategory, std::string>,
+             std::vector<core::TransactionId>> pending;
+    int skipped{0};  // rows preserved because of a manual user override
+    std::vector<std::pair<std::string, int>> ruleStats;
+};
+
+// What an incremental categorize run has to touch. When the rule delta is
+// confined to removed rules or category edits, only Uncategorized rows and
+// rows whose stored matched_rule is in staleRules need re-evaluation; an
+// added or reordered rule can claim rows from any other rule, which forces
+// a full scan.
+struct RecategorizationPlan {
+    bool fullScan{true};
+    std::vector<std::string> staleRules;
+};
+
+// Re-applies categorization rules to a transaction set, sharded across a
+// worker pool. CategoryMatcher is deterministic for a fixed rule set, so
+// each worker runs its own matcher over a contiguous slice and the merged
+// result is identical to a sequential pass.
+class RecategorizationEngine {
+public:
+    explicit RecategorizationEngine(
+        std::vector<infrastructure::config::CategorizationRule> rules,
+        unsigned workerCount = 0);  // 0 = hardware concurrency
+
+    // Use a rule set somebody already compiled (the ConfigWatcher's warm
+    // snapshot under the daemon) instead of compiling a fresh one
+    explicit RecategorizationEngine(
+        std::shared_ptr<const infrastructure::config::CompiledRuleSet> rules,
+        unsigned workerCount = 0);
+
+    // Re-categorizes every transaction in place via setCategory; rows with
+    // a user override are counted as skipped and never touched. Only rows
+    // whose category changed (dirty after setCategory) are reported.
+    [[nodiscard]] auto run(std::vector<core::Transaction>& transactions)
+        -> RecategorizationResult;
+
+    // Snapshot of a rule set in the form persisted between categorize runs
+    [[nodiscard]] static auto ruleState(
+        const std::vector<infrastructure::config::CategorizationRule>& rules)
+        -> std::vector<infrastructure::persistence::CategorizationRuleState>;
+
+    // Compares the previous run's snapshot against the current rules and
+    // decides between a full scan and an incremental pass
+    [[nodiscard]] static auto planIncremental(
+        const std::vector<infrastructure::persistence::CategorizationRuleState>& previous,
+        const std::vector<infrastructure::persistence::CategorizationRuleState>& current)
+        -> RecategorizationPlan;
+
+private:
+    // Compiled once at construction; every worker shard shares this set
+    // through its matcher rather than compiling a private copy
+    std::shared_ptr<const infrastructure::config::CompiledRuleSet> rules_;
+    unsigned workerCount_;
+};
+
+} // namespace ares::application::services
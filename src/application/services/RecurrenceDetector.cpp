@@ -1,7 +1,9 @@
 #include "application/services/RecurrenceDetector.hpp"
 #include <algorithm>
+#include "core/common/CivilDate.hpp"
 #include <cmath>
 #include <numeric>
+#include <unordered_map>
 
 namespace ares::application::services {
 
@@ -14,78 +16,132 @@ auto RecurrenceDetector::detectPatterns(const std::vector<core::Transaction>& tr
     auto counterpartyGroups = groupByCounterparty(transactions);
 
     for (const auto& [counterparty, txns] : counterpartyGroups) {
-        if (txns.size() < static_cast<size_t>(minOccurrences_)) {
+        analyzeGroup(counterparty, txns, patterns);
+    }
+
+    // Sort by confidence descending
+    std::sort(patterns.begin(), patterns.end(),
+              [](const auto& a, const auto& b) { return a.confidence > b.confidence; });
+
+    return patterns;
+}
+
+auto RecurrenceDetector::detectPatternsIncremental(
+    const std::vector<core::Transaction>& transactions,
+    const std::vector<infrastructure::persistence::RecurrenceGroupState>& previous)
+    -> IncrementalDetection
+{
+    IncrementalDetection result;
+
+    std::map<std::string, const infrastructure::persistence::RecurrenceGroupState*> prevByName;
+    for (const auto& state : previous) {
+        prevByName.emplace(state.counterparty, &state);
+    }
+
+    // Grouping is a single cheap pass; the per-group clustering and
+    // frequency analysis is what gets skipped for untouched groups
+    auto counterpartyGroups = groupByCounterparty(transactions);
+    result.groupState.reserve(counterpartyGroups.size());
+
+    for (const auto& [counterparty, txns] : counterpartyGroups) {
+        auto lastDate = int64_t{0};
+        for (const auto* txn : txns) {
+            lastDate = std::max(lastDate, core::civil::toEpochDay(txn->date()));
+        }
+        result.groupState.push_back({
+            .counterparty = counterparty,
+            .lastDate = lastDate,
+            .txnCount = static_cast<int>(txns.size())
+        });
+
+        // A group with the same membership count and newest date as last
+        // time cannot yield a different pattern (imports only append)
+        auto prev = prevByName.find(counterparty);
+        if (prev != prevByName.end() &&
+            prev->second->txnCount == static_cast<int>(txns.size()) &&
+            prev->second->lastDate == lastDate) {
+            result.unchangedCounterparties.push_back(counterparty);
             continue;
         }
 
-        // Sub-group by similar amounts
-        auto amountGroups = groupByAmount(txns);
+        analyzeGroup(counterparty, txns, result.patterns);
+    }
 
-        for (const auto& amountGroup : amountGroups) {
-            if (amountGroup.size() < static_cast<size_t>(minOccurrences_)) {
-                continue;
-            }
+    std::sort(result.patterns.begin(), result.patterns.end(),
+              [](const auto& a, const auto& b) { return a.confidence > b.confidence; });
 
-            // Extract dates and sort
-            std::vector<core::Date> dates;
-            for (const auto* txn : amountGroup) {
-                dates.push_back(txn->date());
-            }
-            std::sort(dates.begin(), dates.end());
+    return result;
+}
 
-            // Detect frequency
-            auto [frequency, frequencyConfidence] = detectFrequency(dates);
+auto RecurrenceDetector::analyzeGroup(const std::string& counterparty,
+                                      const std::vector<const core::Transaction*>& txns,
+                                      std::vector<DetectedPattern>& patterns) -> void
+{
+    if (txns.size() < static_cast<size_t>(minOccurrences_)) {
+        return;
+    }
 
-            if (frequency == core::RecurrenceFrequency::None) {
-                continue;
-            }
+    // Sub-group by similar amounts
+    auto amountGroups = groupByAmount(txns);
 
-            // Calculate average amount
-            auto avgAmount = calculateAverageAmount(amountGroup);
+    for (const auto& amountGroup : amountGroups) {
+        if (amountGroup.size() < static_cast<size_t>(minOccurrences_)) {
+            continue;
+        }
 
-            // Calculate amount variance for confidence
-            double sumSquaredDiff = 0;
-            for (const auto* txn : amountGroup) {
-                double diff = static_cast<double>(txn->amount().cents() - avgAmount.cents());
-                sumSquaredDiff += diff * diff;
-            }
-            double amountVariance = sumSquaredDiff / static_cast<double>(amountGroup.size());
+        // Extract dates and sort
+        std::vector<core::Date> dates;
+        for (const auto* txn : amountGroup) {
+            dates.push_back(txn->date());
+        }
+        std::sort(dates.begin(), dates.end());
 
-            // Calculate confidence
-            int confidence = calculateConfidence(frequency, dates, amountVariance);
+        // Detect frequency
+        auto [frequency, frequencyConfidence] = detectFrequency(dates);
 
-            // Get most common category
-            std::map<core::TransactionCategory, int> categoryCount;
-            for (const auto* txn : amountGroup) {
-                categoryCount[txn->category()]++;
-            }
-            std::optional<core::TransactionCategory> mostCommonCategory;
-            int maxCount = 0;
-            for (const auto& [cat, count] : categoryCount) {
-                if (count > maxCount) {
-                    maxCount = count;
-                    mostCommonCategory = cat;
-                }
-            }
+        if (frequency == core::RecurrenceFrequency::None) {
+            continue;
+        }
 
-            DetectedPattern pattern{
-                .counterpartyName = counterparty,
-                .averageAmount = avgAmount,
-                .frequency = frequency,
-                .category = mostCommonCategory,
-                .occurrences = dates,
-                .confidence = confidence
-            };
+        // Calculate average amount
+        auto avgAmount = calculateAverageAmount(amountGroup);
 
-            patterns.push_back(std::move(pattern));
+        // Calculate amount variance for confidence
+        double sumSquaredDiff = 0;
+        for (const auto* txn : amountGroup) {
+            double diff = static_cast<double>(txn->amount().cents() - avgAmount.cents());
+            sumSquaredDiff += diff * diff;
         }
-    }
+        double amountVariance = sumSquaredDiff / static_cast<double>(amountGroup.size());
 
-    // Sort by confidence descending
-    std::sort(patterns.begin(), patterns.end(),
-              [](const auto& a, const auto& b) { return a.confidence > b.confidence; });
+        // Calculate confidence
+        int confidence = calculateConfidence(frequency, dates, amountVariance);
 
-    return patterns;
+        // Get most common category
+        std::map<core::TransactionCategory, int> categoryCount;
+        for (const auto* txn : amountGroup) {
+            categoryCount[txn->category()]++;
+        }
+        std::optional<core::TransactionCategory> mostCommonCategory;
+        int maxCount = 0;
+        for (const auto& [cat, count] : categoryCount) {
+            if (count > maxCount) {
+                maxCount = count;
+                mostCommonCategory = cat;
+            }
+        }
+
+        DetectedPattern pattern{
+            .counterpartyName = counterparty,
+            .averageAmount = avgAmount,
+            .frequency = frequency,
+            .category = mostCommonCategory,
+            .occurrences = dates,
+            .confidence = confidence
+        };
+
+        patterns.push_back(std::move(pattern));
+    }
 }
 
 auto RecurrenceDetector::groupByCounterparty(const std::vector<core::Transaction>& transactions)
@@ -93,38 +149,55 @@ auto RecurrenceDetector::groupByCounterparty(const std::vector<core::Transaction
 {
     std::map<std::string, std::vector<const core::Transaction*>> groups;
 
+    // Distinct spellings of the same merchant ("Sony Int eractive",
+    // "SONY INTERACTIVE ENT.") fold into one group: the first spelling
+    // whose signature matches becomes the group's canonical name. The
+    // signature scan runs once per distinct spelling, not per row.
+    std::unordered_map<std::string, std::string> canonicalByName;
+    std::vector<std::pair<const std::string*, const TokenSignature*>> representatives;
+
     for (const auto& txn : transactions) {
-        if (!txn.counterpartyName()) {
+        // PayPal rows group by the extracted merchant: the counterparty is
+        // just "PayPal", which would fold every PayPal subscription into one
+        // meaningless group
+        const auto& groupName = txn.merchant() ? txn.merchant() : txn.counterpartyName();
+        if (!groupName) {
             continue;
         }
 
-        auto normalized = normalizeCounterparty(*txn.counterpartyName());
-        if (!normalized.empty()) {
-            groups[normalized].push_back(&txn);
+        const auto& normalized = normalizeCounterparty(*groupName);
+        if (normalized.empty()) {
+            continue;
         }
-    }
-
-    return groups;
-}
-
-auto RecurrenceDetector::normalizeCounterparty(const std::string& name) -> std::string {
-    std::string normalized;
-    normalized.reserve(name.size());
 
-    for (char c : name) {
-        if (std::isalnum(static_cast<unsigned char>(c))) {
-            normalized += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
-        } else if (c == ' ' && !normalized.empty() && normalized.back() != ' ') {
-            normalized += ' ';
+        auto memo = canonicalByName.find(normalized);
+        if (memo == canonicalByName.end()) {
+            const auto& signature = cache_.signature(*groupName);
+            const std::string* canonical = &normalized;
+            for (const auto& [repName, repSignature] : representatives) {
+                if (tokenSignaturesMatch(signature, *repSignature)) {
+                    canonical = repName;
+                    break;
+                }
+            }
+            memo = canonicalByName.emplace(normalized, *canonical).first;
+            if (canonical == &normalized) {
+                // References into the cache and into canonicalByName keys
+                // are stable for the lifetime of this pass
+                representatives.emplace_back(&memo->first, &signature);
+            }
         }
-    }
 
-    // Trim trailing space
-    while (!normalized.empty() && normalized.back() == ' ') {
-        normalized.pop_back();
+        groups[memo->second].push_back(&txn);
     }
 
-    return normalized;
+    return groups;
+}
+
+auto RecurrenceDetector::normalizeCounterparty(const std::string& name) -> const std::string& {
+    // The grouping map copies the key only when it sees a counterparty for
+    // the first time; every later row is a cache hit plus a map lookup
+    return cache_.alnumWords(name);
 }
 
 auto RecurrenceDetector::groupByAmount(const std::vector<const core::Transaction*>& transactions)
@@ -182,8 +255,8 @@ auto RecurrenceDetector::detectFrequency(const std::vector<core::Date>& dates)
     // Calculate intervals in days
     std::vector<int> intervals;
     for (size_t i = 1; i < dates.size(); ++i) {
-        auto days = std::chrono::sys_days{dates[i]} - std::chrono::sys_days{dates[i - 1]};
-        intervals.push_back(days.count());
+        intervals.push_back(static_cast<int>(core::civil::toEpochDay(dates[i]) -
+                                             core::civil::toEpochDay(dates[i - 1])));
     }
 
     // Calculate average interval
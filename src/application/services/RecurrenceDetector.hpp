@@ -4,9 +4,11 @@
 #include <map>
 #include <string>
 #include <vector>
+#include "application/services/NormalizationCache.hpp"
 #include "core/common/Error.hpp"
 #include "core/transaction/Transaction.hpp"
 #include "core/transaction/RecurringPattern.hpp"
+#include "infrastructure/persistence/SqliteRecurringPatternRepository.hpp"
 
 namespace ares::application::services {
 
@@ -19,6 +21,15 @@ struct DetectedPattern {
     int confidence;  // 0-100 confidence score
 };
 
+// Outcome of an incremental detection pass: freshly analyzed patterns for
+// the touched groups, the groups whose stored patterns are still valid,
+// and the snapshot to persist once those patterns have been saved
+struct IncrementalDetection {
+    std::vector<DetectedPattern> patterns;
+    std::vector<std::string> unchangedCounterparties;
+    std::vector<infrastructure::persistence::RecurrenceGroupState> groupState;
+};
+
 class RecurrenceDetector {
 public:
     RecurrenceDetector() = default;
@@ -27,6 +38,15 @@ public:
     [[nodiscard]] auto detectPatterns(const std::vector<core::Transaction>& transactions)
         -> std::vector<DetectedPattern>;
 
+    // Incremental mode: groups whose transaction count and newest date
+    // match the previous snapshot are skipped, so after a monthly import
+    // only the counterparties in the delta are re-analyzed. An empty
+    // snapshot degenerates to a full detectPatterns pass.
+    [[nodiscard]] auto detectPatternsIncremental(
+        const std::vector<core::Transaction>& transactions,
+        const std::vector<infrastructure::persistence::RecurrenceGroupState>& previous)
+        -> IncrementalDetection;
+
     // Settings
     auto setAmountTolerance(double tolerance) -> void { amountTolerance_ = tolerance; }
     auto setMinOccurrences(int min) -> void { minOccurrences_ = min; }
@@ -36,13 +56,20 @@ private:
     [[nodiscard]] auto groupByCounterparty(const std::vector<core::Transaction>& transactions)
         -> std::map<std::string, std::vector<const core::Transaction*>>;
 
-    // Normalize counterparty name for matching
-    [[nodiscard]] auto normalizeCounterparty(const std::string& name) -> std::string;
+    // Normalize counterparty name for matching; memoized, so the few
+    // hundred distinct names in a history normalize once each
+    [[nodiscard]] auto normalizeCounterparty(const std::string& name) -> const std::string&;
 
     // Sub-group by similar amounts within tolerance
     [[nodiscard]] auto groupByAmount(const std::vector<const core::Transaction*>& transactions)
         -> std::vector<std::vector<const core::Transaction*>>;
 
+    // Amount clustering, frequency and confidence analysis for one
+    // counterparty group; appends any detected patterns
+    auto analyzeGroup(const std::string& counterparty,
+                      const std::vector<const core::Transaction*>& txns,
+                      std::vector<DetectedPattern>& patterns) -> void;
+
     // Detect frequency from date intervals
     [[nodiscard]] auto detectFrequency(const std::vector<core::Date>& dates)
         -> std::pair<core::RecurrenceFrequency, int>;
@@ -58,6 +85,7 @@ private:
 
     double amountTolerance_{0.05};  // 5% tolerance
     int minOccurrences_{2};
+    NormalizationCache cache_;
 };
 
 } // namespace ares::application::services
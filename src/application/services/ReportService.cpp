@@ -1,44 +1,58 @@
 #include "application/services/ReportService.hpp"
+#include "application/WorkerPool.hpp"
 #include <algorithm>
+#include "core/common/CivilDate.hpp"
 #include <map>
+#include <thread>
 #include <fmt/format.h>
 
 namespace ares::application::services {
 
-auto ReportService::monthlySummary(
-    const std::vector<core::Transaction>& transactions,
-    core::Date month)
-    -> MonthlySummary
-{
-    MonthlySummary summary;
-    summary.month = month;
-    summary.totalIncome = core::Money{0, core::Currency::EUR};
-    summary.totalExpenses = core::Money{0, core::Currency::EUR};
-    summary.netAmount = core::Money{0, core::Currency::EUR};
-    summary.savingsRate = 0.0;
-    summary.transactionCount = 0;
+auto ReportService::beginMonthly(core::Date month) -> MonthlyAccumulation {
+    MonthlyAccumulation acc;
+    acc.summary.month = month;
+    acc.summary.totalIncome = core::Money{0, core::Currency::EUR};
+    acc.summary.totalExpenses = core::Money{0, core::Currency::EUR};
+    acc.summary.netAmount = core::Money{0, core::Currency::EUR};
+    acc.summary.savingsRate = 0.0;
+    acc.summary.transactionCount = 0;
+    return acc;
+}
 
-    std::map<core::TransactionCategory, int64_t> incomeByCat;
-    std::map<core::TransactionCategory, int64_t> expensesByCat;
+auto ReportService::accumulateMonthly(MonthlyAccumulation& acc, core::Date date, int64_t cents,
+                                      core::TransactionCategory category) -> void {
+    auto& summary = acc.summary;
+    bool inMonth = date.year() == summary.month.year() && date.month() == summary.month.month();
+    if (!inMonth) return;
 
-    for (const auto& txn : transactions) {
-        bool inMonth = txn.date().year() == month.year() && txn.date().month() == month.month();
-        if (!inMonth) continue;
+    ++summary.transactionCount;
 
-        ++summary.transactionCount;
+    if (cents > 0) {
+        acc.incomeCents += cents;
+        acc.incomeByCat[categoryIndex(category)] += cents;
+    } else {
+        acc.expenseCents += -cents;
+        acc.expensesByCat[categoryIndex(category)] += -cents;
+    }
+}
 
-        if (txn.amount().isPositive()) {
-            if (auto sum = summary.totalIncome + txn.amount()) {
-                summary.totalIncome = *sum;
-            }
-            incomeByCat[txn.category()] += txn.amount().cents();
-        } else {
-            if (auto sum = summary.totalExpenses + txn.amount().abs()) {
-                summary.totalExpenses = *sum;
-            }
-            expensesByCat[txn.category()] += txn.amount().abs().cents();
-        }
+auto ReportService::accumulateAggregate(MonthlyAccumulation& acc,
+                                        const core::CategoryAggregate& aggregate) -> void {
+    acc.summary.transactionCount += aggregate.incomeCount + aggregate.expenseCount;
+    if (aggregate.incomeCount > 0) {
+        acc.incomeCents += aggregate.incomeCents;
+        acc.incomeByCat[categoryIndex(aggregate.category)] += aggregate.incomeCents;
+    }
+    if (aggregate.expenseCount > 0) {
+        acc.expenseCents += aggregate.expenseCents;
+        acc.expensesByCat[categoryIndex(aggregate.category)] += aggregate.expenseCents;
     }
+}
+
+auto ReportService::finishMonthly(MonthlyAccumulation&& acc) -> MonthlySummary {
+    auto summary = std::move(acc.summary);
+    summary.totalIncome = core::Money{acc.incomeCents, core::Currency::EUR};
+    summary.totalExpenses = core::Money{acc.expenseCents, core::Currency::EUR};
 
     // Calculate net amount
     if (auto net = summary.totalIncome - summary.totalExpenses) {
@@ -52,22 +66,28 @@ auto ReportService::monthlySummary(
     }
 
     // Build income category breakdowns
-    for (const auto& [cat, cents] : incomeByCat) {
+    for (std::size_t i = 0; i < acc.incomeByCat.size(); ++i) {
+        auto cents = acc.incomeByCat[i];
+        if (cents == 0) continue;
         double pct = summary.totalIncome.cents() > 0
             ? static_cast<double>(cents) / static_cast<double>(summary.totalIncome.cents()) * 100.0
             : 0.0;
-        summary.incomeByCategory.push_back({cat, core::Money{cents, core::Currency::EUR}, pct});
+        summary.incomeByCategory.push_back({static_cast<core::TransactionCategory>(i),
+                                            core::Money{cents, core::Currency::EUR}, pct});
     }
     // Sort by amount descending
     std::sort(summary.incomeByCategory.begin(), summary.incomeByCategory.end(),
         [](const auto& a, const auto& b) { return a.amount.cents() > b.amount.cents(); });
 
     // Build expense category breakdowns
-    for (const auto& [cat, cents] : expensesByCat) {
+    for (std::size_t i = 0; i < acc.expensesByCat.size(); ++i) {
+        auto cents = acc.expensesByCat[i];
+        if (cents == 0) continue;
         double pct = summary.totalExpenses.cents() > 0
             ? static_cast<double>(cents) / static_cast<double>(summary.totalExpenses.cents()) * 100.0
             : 0.0;
-        summary.expensesByCategory.push_back({cat, core::Money{cents, core::Currency::EUR}, pct});
+        summary.expensesByCategory.push_back({static_cast<core::TransactionCategory>(i),
+                                              core::Money{cents, core::Currency::EUR}, pct});
     }
     // Sort by amount descending
     std::sort(summary.expensesByCategory.begin(), summary.expensesByCategory.end(),
@@ -76,44 +96,95 @@ auto ReportService::monthlySummary(
     return summary;
 }
 
-auto ReportService::yearlySummary(
+auto ReportService::mergeMonthly(MonthlyAccumulation& into, const MonthlyAccumulation& from)
+    -> void
+{
+    into.summary.transactionCount += from.summary.transactionCount;
+    into.incomeCents += from.incomeCents;
+    into.expenseCents += from.expenseCents;
+    for (std::size_t i = 0; i < from.incomeByCat.size(); ++i) {
+        into.incomeByCat[i] += from.incomeByCat[i];
+        into.expensesByCat[i] += from.expensesByCat[i];
+    }
+}
+
+auto ReportService::monthlySummary(
     const std::vector<core::Transaction>& transactions,
-    int year)
-    -> YearlySummary
+    core::Date month)
+    -> MonthlySummary
 {
+    auto acc = beginMonthly(month);
+    for (const auto& txn : transactions) {
+        accumulateMonthly(acc, txn.date(), txn.amount().cents(), txn.category());
+    }
+    return finishMonthly(std::move(acc));
+}
+
+auto ReportService::syncCacheGeneration(const core::TransactionRepository& repository) -> void {
+    auto generation = repository.generation();
+    if (generation != cachedGeneration_) {
+        monthlyCache_.clear();
+        yearlyCache_.clear();
+        cachedGeneration_ = generation;
+    }
+}
+
+auto ReportService::monthlySummary(core::TransactionRepository& repository, core::Date month)
+    -> std::expected<MonthlySummary, core::Error>
+{
+    syncCacheGeneration(repository);
+    auto cacheKey = static_cast<int>(month.year()) * 12 +
+                    static_cast<int>(static_cast<unsigned>(month.month())) - 1;
+    if (auto it = monthlyCache_.find(cacheKey); it != monthlyCache_.end()) {
+        return it->second;
+    }
+
+    // Totals are summed inside the database; only one row per category
+    // crosses the repository boundary
+    auto acc = beginMonthly(month);
+
+    core::Date first{month.year(), month.month(), std::chrono::day{1}};
+    core::Date last{std::chrono::year_month_day_last{month.year(),
+                                                     std::chrono::month_day_last{month.month()}}};
+    auto aggregates = repository.aggregateByCategory(first, last);
+    if (!aggregates) {
+        return std::unexpected(aggregates.error());
+    }
+    for (const auto& aggregate : *aggregates) {
+        accumulateAggregate(acc, aggregate);
+    }
+
+    return monthlyCache_.emplace(cacheKey, finishMonthly(std::move(acc))).first->second;
+}
+
+auto ReportService::aggregateYearly(int year, std::vector<MonthlySummary> months) -> YearlySummary {
     YearlySummary summary;
     summary.year = year;
     summary.totalIncome = core::Money{0, core::Currency::EUR};
     summary.totalExpenses = core::Money{0, core::Currency::EUR};
     summary.netAmount = core::Money{0, core::Currency::EUR};
     summary.savingsRate = 0.0;
+    summary.months = std::move(months);
 
-    // Generate monthly summaries for each month 1-12
-    for (unsigned m = 1; m <= 12; ++m) {
-        core::Date monthDate{std::chrono::year{year}, std::chrono::month{m}, std::chrono::day{1}};
-        auto monthly = monthlySummary(transactions, monthDate);
-        summary.months.push_back(monthly);
-    }
-
-    // Aggregate totals across months
-    std::map<core::TransactionCategory, int64_t> incomeByCat;
-    std::map<core::TransactionCategory, int64_t> expensesByCat;
+    // Aggregate totals across months; raw cents, validated once at the end
+    CategoryCents incomeByCat{};
+    CategoryCents expensesByCat{};
 
+    core::MoneyAccumulator income;
+    core::MoneyAccumulator expenses;
     for (const auto& m : summary.months) {
-        if (auto sum = summary.totalIncome + m.totalIncome) {
-            summary.totalIncome = *sum;
-        }
-        if (auto sum = summary.totalExpenses + m.totalExpenses) {
-            summary.totalExpenses = *sum;
-        }
+        income.add(m.totalIncome);
+        expenses.add(m.totalExpenses);
 
         for (const auto& item : m.incomeByCategory) {
-            incomeByCat[item.category] += item.amount.cents();
+            incomeByCat[categoryIndex(item.category)] += item.amount.cents();
         }
         for (const auto& item : m.expensesByCategory) {
-            expensesByCat[item.category] += item.amount.cents();
+            expensesByCat[categoryIndex(item.category)] += item.amount.cents();
         }
     }
+    summary.totalIncome = income.total().value_or(core::Money{0, core::Currency::EUR});
+    summary.totalExpenses = expenses.total().value_or(core::Money{0, core::Currency::EUR});
 
     // Calculate net and savings rate
     if (auto net = summary.totalIncome - summary.totalExpenses) {
@@ -125,20 +196,26 @@ auto ReportService::yearlySummary(
     }
 
     // Build aggregated category breakdowns
-    for (const auto& [cat, cents] : incomeByCat) {
+    for (std::size_t i = 0; i < incomeByCat.size(); ++i) {
+        auto cents = incomeByCat[i];
+        if (cents == 0) continue;
         double pct = summary.totalIncome.cents() > 0
             ? static_cast<double>(cents) / static_cast<double>(summary.totalIncome.cents()) * 100.0
             : 0.0;
-        summary.incomeByCategory.push_back({cat, core::Money{cents, core::Currency::EUR}, pct});
+        summary.incomeByCategory.push_back({static_cast<core::TransactionCategory>(i),
+                                            core::Money{cents, core::Currency::EUR}, pct});
     }
     std::sort(summary.incomeByCategory.begin(), summary.incomeByCategory.end(),
         [](const auto& a, const auto& b) { return a.amount.cents() > b.amount.cents(); });
 
-    for (const auto& [cat, cents] : expensesByCat) {
+    for (std::size_t i = 0; i < expensesByCat.size(); ++i) {
+        auto cents = expensesByCat[i];
+        if (cents == 0) continue;
         double pct = summary.totalExpenses.cents() > 0
             ? static_cast<double>(cents) / static_cast<double>(summary.totalExpenses.cents()) * 100.0
             : 0.0;
-        summary.expensesByCategory.push_back({cat, core::Money{cents, core::Currency::EUR}, pct});
+        summary.expensesByCategory.push_back({static_cast<core::TransactionCategory>(i),
+                                              core::Money{cents, core::Currency::EUR}, pct});
     }
     std::sort(summary.expensesByCategory.begin(), summary.expensesByCategory.end(),
         [](const auto& a, const auto& b) { return a.amount.cents() > b.amount.cents(); });
@@ -146,13 +223,118 @@ auto ReportService::yearlySummary(
     return summary;
 }
 
-auto ReportService::spendingTrends(
+auto ReportService::yearlySummary(
     const std::vector<core::Transaction>& transactions,
-    core::Date endMonth,
-    int monthCount)
-    -> std::vector<TrendData>
+    int year)
+    -> YearlySummary
+{
+    // One pass over the vector: each transaction is binned into its month's
+    // accumulator instead of twelve full scans filtering by month
+    std::vector<MonthlyAccumulation> accumulators;
+    accumulators.reserve(12);
+    for (unsigned m = 1; m <= 12; ++m) {
+        accumulators.push_back(beginMonthly(
+            core::Date{std::chrono::year{year}, std::chrono::month{m}, std::chrono::day{1}}));
+    }
+
+    auto binInto = [&](std::vector<MonthlyAccumulation>& bins, const core::Transaction& txn) {
+        if (static_cast<int>(txn.date().year()) != year) {
+            return;
+        }
+        auto month = static_cast<unsigned>(txn.date().month());
+        if (month < 1 || month > 12) return;
+        accumulateMonthly(bins[month - 1], txn.date(), txn.amount().cents(), txn.category());
+    };
+
+    // Binning is a pure reduction, so contiguous shards of the vector run
+    // on a worker pool with per-worker accumulators that merge afterwards.
+    // Small inputs stay on the calling thread - spawning costs more than
+    // the scan below ~16k rows per worker.
+    constexpr std::size_t kMinRowsPerWorker = 16 * 1024;
+    auto workers = workerCount_ != 0
+        ? static_cast<std::size_t>(workerCount_)
+        : std::min<std::size_t>(std::max(1u, std::thread::hardware_concurrency()),
+                                std::max<std::size_t>(transactions.size() / kMinRowsPerWorker, 1));
+
+    if (workers > 1) {
+        std::vector<std::vector<MonthlyAccumulation>> partials(workers);
+        WorkerPool::shared().parallelFor(transactions.size(), workers,
+            [&](std::size_t w, std::size_t begin, std::size_t end) {
+                auto& bins = partials[w];
+                bins.reserve(12);
+                for (unsigned m = 1; m <= 12; ++m) {
+                    bins.push_back(beginMonthly(core::Date{
+                        std::chrono::year{year}, std::chrono::month{m}, std::chrono::day{1}}));
+                }
+                for (std::size_t i = begin; i < end; ++i) {
+                    binInto(bins, transactions[i]);
+                }
+            });
+
+        for (auto& bins : partials) {
+            for (std::size_t m = 0; m < 12; ++m) {
+                mergeMonthly(accumulators[m], bins[m]);
+            }
+        }
+    } else {
+        for (const auto& txn : transactions) {
+            binInto(accumulators, txn);
+        }
+    }
+
+    std::vector<MonthlySummary> months;
+    months.reserve(12);
+    for (auto& acc : accumulators) {
+        months.push_back(finishMonthly(std::move(acc)));
+    }
+    return aggregateYearly(year, std::move(months));
+}
+
+auto ReportService::yearlySummary(core::TransactionRepository& repository, int year)
+    -> std::expected<YearlySummary, core::Error>
+{
+    syncCacheGeneration(repository);
+    if (auto it = yearlyCache_.find(year); it != yearlyCache_.end()) {
+        return it->second;
+    }
+
+    // One GROUP BY month, category query for the whole year; at most
+    // 12 * category-count rows cross the repository boundary
+    std::vector<MonthlyAccumulation> accumulators;
+    accumulators.reserve(12);
+    for (unsigned m = 1; m <= 12; ++m) {
+        accumulators.push_back(beginMonthly(
+            core::Date{std::chrono::year{year}, std::chrono::month{m}, std::chrono::day{1}}));
+    }
+
+    auto aggregates = repository.aggregateByMonthAndCategory(year);
+    if (!aggregates) {
+        return std::unexpected(aggregates.error());
+    }
+    for (const auto& aggregate : *aggregates) {
+        if (aggregate.month < 1 || aggregate.month > 12) continue;
+        accumulateAggregate(accumulators[static_cast<size_t>(aggregate.month - 1)],
+                            core::CategoryAggregate{
+                                .category = aggregate.category,
+                                .incomeCents = aggregate.incomeCents,
+                                .expenseCents = aggregate.expenseCents,
+                                .incomeCount = aggregate.incomeCount,
+                                .expenseCount = aggregate.expenseCount
+                            });
+    }
+
+    std::vector<MonthlySummary> months;
+    months.reserve(12);
+    for (auto& acc : accumulators) {
+        months.push_back(finishMonthly(std::move(acc)));
+    }
+    return yearlyCache_.emplace(year, aggregateYearly(year, std::move(months))).first->second;
+}
+
+auto ReportService::trendMonths(core::Date endMonth, int monthCount)
+    -> std::vector<core::Date>
 {
-    // Build list of months (from endMonth - monthCount + 1 to endMonth)
+    // Consecutive months from endMonth - monthCount + 1 to endMonth
     std::vector<core::Date> months;
     for (int i = monthCount - 1; i >= 0; --i) {
         auto y = static_cast<int>(endMonth.year());
@@ -169,36 +351,31 @@ auto ReportService::spendingTrends(
             std::chrono::month{static_cast<unsigned>(m)},
             std::chrono::day{1}});
     }
+    return months;
+}
 
-    // Collect expense amounts per category per month
-    // Key: category, Value: map of month index -> total cents
-    std::map<core::TransactionCategory, std::map<int, int64_t>> categoryMonthly;
-
-    for (const auto& txn : transactions) {
-        if (!txn.amount().isNegative()) continue;
-
-        for (int idx = 0; idx < static_cast<int>(months.size()); ++idx) {
-            if (txn.date().year() == months[static_cast<size_t>(idx)].year() &&
-                txn.date().month() == months[static_cast<size_t>(idx)].month()) {
-                categoryMonthly[txn.category()][idx] += txn.amount().abs().cents();
-                break;
-            }
-        }
-    }
+auto ReportService::epochMonthIndex(core::Date date) -> int {
+    return static_cast<int>(date.year()) * 12 +
+           static_cast<int>(static_cast<unsigned>(date.month())) - 1;
+}
 
+auto ReportService::trendsFromBins(
+    const std::vector<core::Date>& months,
+    const std::vector<CategoryCents>& monthlyBins)
+    -> std::vector<TrendData>
+{
     std::vector<TrendData> trends;
 
-    for (const auto& [cat, monthMap] : categoryMonthly) {
+    for (std::size_t c = 0; c < core::kTransactionCategoryCount; ++c) {
         TrendData trend;
-        trend.category = cat;
+        trend.category = static_cast<core::TransactionCategory>(c);
 
         int64_t totalCents = 0;
         int monthsWithData = 0;
 
-        for (int idx = 0; idx < static_cast<int>(months.size()); ++idx) {
-            auto it = monthMap.find(idx);
-            int64_t cents = (it != monthMap.end()) ? it->second : 0;
-            trend.monthlyAmounts.push_back({months[static_cast<size_t>(idx)], core::Money{cents, core::Currency::EUR}});
+        for (size_t idx = 0; idx < months.size(); ++idx) {
+            int64_t cents = monthlyBins[idx][c];
+            trend.monthlyAmounts.push_back({months[idx], core::Money{cents, core::Currency::EUR}});
             totalCents += cents;
             if (cents > 0) ++monthsWithData;
         }
@@ -237,4 +414,68 @@ auto ReportService::spendingTrends(
     return trends;
 }
 
+auto ReportService::spendingTrends(
+    const std::vector<core::Transaction>& transactions,
+    core::Date endMonth,
+    int monthCount)
+    -> std::vector<TrendData>
+{
+    auto months = trendMonths(endMonth, monthCount);
+    if (months.empty()) {
+        return {};
+    }
+
+    // Collect expense amounts into month-major category bins; a
+    // transaction's slot is its epoch month minus the window's first month
+    std::vector<CategoryCents> monthlyBins(months.size(), CategoryCents{});
+    const int firstMonth = epochMonthIndex(months.front());
+
+    for (const auto& txn : transactions) {
+        if (!txn.amount().isNegative()) continue;
+
+        int idx = epochMonthIndex(txn.date()) - firstMonth;
+        if (idx >= 0 && idx < static_cast<int>(months.size())) {
+            monthlyBins[static_cast<size_t>(idx)][categoryIndex(txn.category())] +=
+                txn.amount().abs().cents();
+        }
+    }
+
+    return trendsFromBins(months, monthlyBins);
+}
+
+auto ReportService::spendingTrends(
+    core::TransactionRepository& repository,
+    core::Date endMonth,
+    int monthCount)
+    -> std::expected<std::vector<TrendData>, core::Error>
+{
+    auto months = trendMonths(endMonth, monthCount);
+    if (months.empty()) {
+        return std::vector<TrendData>{};
+    }
+
+    core::Date to{std::chrono::year_month_day_last{
+        endMonth.year(), std::chrono::month_day_last{endMonth.month()}}};
+    auto columns = repository.findColumnsByDateRange(months.front(), to);
+    if (!columns) {
+        return std::unexpected(columns.error());
+    }
+
+    std::vector<CategoryCents> monthlyBins(months.size(), CategoryCents{});
+    const int firstMonth = epochMonthIndex(months.front());
+
+    for (size_t i = 0; i < columns->size(); ++i) {
+        auto cents = columns->cents[i];
+        if (cents >= 0) continue;
+
+        auto date = core::civil::fromEpochDay(columns->epochDay[i]);
+        int idx = epochMonthIndex(date) - firstMonth;
+        if (idx >= 0 && idx < static_cast<int>(months.size())) {
+            monthlyBins[static_cast<size_t>(idx)][categoryIndex(columns->category[i])] += -cents;
+        }
+    }
+
+    return trendsFromBins(months, monthlyBins);
+}
+
 } // namespace ares::application::services
@@ -1,7 +1,11 @@
 #pragma once
 
+#include <array>
+#include <expected>
+#include <map>
 #include <string>
 #include <vector>
+#include "core/common/Error.hpp"
 #include "core/common/Money.hpp"
 #include "core/common/Types.hpp"
 #include "core/transaction/Transaction.hpp"
@@ -47,6 +51,10 @@ class ReportService {
 public:
     ReportService() = default;
 
+    // workerCount for the parallel yearly scan; 0 picks a size-based count
+    // capped at one worker per hardware thread
+    explicit ReportService(unsigned workerCount) : workerCount_{workerCount} {}
+
     [[nodiscard]] auto monthlySummary(
         const std::vector<core::Transaction>& transactions,
         core::Date month)
@@ -57,11 +65,84 @@ public:
         int year)
         -> YearlySummary;
 
+    // Streaming variants: aggregate directly off the repository cursor so
+    // reporting over large histories never loads all rows into memory
+    [[nodiscard]] auto monthlySummary(core::TransactionRepository& repository, core::Date month)
+        -> std::expected<MonthlySummary, core::Error>;
+
+    [[nodiscard]] auto yearlySummary(core::TransactionRepository& repository, int year)
+        -> std::expected<YearlySummary, core::Error>;
+
     [[nodiscard]] auto spendingTrends(
         const std::vector<core::Transaction>& transactions,
         core::Date endMonth,
         int monthCount = 6)
         -> std::vector<TrendData>;
+
+    // Columnar variant: fetches only (epoch day, cents, category) for the
+    // trend window via the repository's projection, so the per-row scan
+    // walks contiguous arrays instead of full Transaction objects
+    [[nodiscard]] auto spendingTrends(
+        core::TransactionRepository& repository,
+        core::Date endMonth,
+        int monthCount = 6)
+        -> std::expected<std::vector<TrendData>, core::Error>;
+
+private:
+    // Per-category cents indexed by the dense category enum: no allocation
+    // or tree traversal on the per-row path
+    using CategoryCents = std::array<int64_t, core::kTransactionCategoryCount>;
+
+    [[nodiscard]] static constexpr auto categoryIndex(core::TransactionCategory category)
+        -> std::size_t
+    {
+        return static_cast<std::size_t>(category);
+    }
+
+    // Running state for a single month's summary; shared by the vector and
+    // projection-based overloads. Totals stay in raw cents until finish.
+    struct MonthlyAccumulation {
+        MonthlySummary summary;
+        int64_t incomeCents{0};
+        int64_t expenseCents{0};
+        CategoryCents incomeByCat{};
+        CategoryCents expensesByCat{};
+    };
+
+    [[nodiscard]] static auto beginMonthly(core::Date month) -> MonthlyAccumulation;
+    static auto accumulateMonthly(MonthlyAccumulation& acc, core::Date date, int64_t cents,
+                                  core::TransactionCategory category) -> void;
+    static auto accumulateAggregate(MonthlyAccumulation& acc,
+                                    const core::CategoryAggregate& aggregate) -> void;
+    [[nodiscard]] static auto finishMonthly(MonthlyAccumulation&& acc) -> MonthlySummary;
+    // Folds a worker's partial month accumulation into the shared one;
+    // plain integer and per-category-map sums, so merge order is irrelevant
+    static auto mergeMonthly(MonthlyAccumulation& into, const MonthlyAccumulation& from) -> void;
+    [[nodiscard]] static auto aggregateYearly(int year, std::vector<MonthlySummary> months)
+        -> YearlySummary;
+
+    // Shared trend plumbing: the consecutive month window, the epoch-month
+    // slot of a date within it, and the bins-to-TrendData construction
+    [[nodiscard]] static auto trendMonths(core::Date endMonth, int monthCount)
+        -> std::vector<core::Date>;
+    [[nodiscard]] static auto epochMonthIndex(core::Date date) -> int;
+    [[nodiscard]] static auto trendsFromBins(
+        const std::vector<core::Date>& months,
+        const std::vector<CategoryCents>& monthlyBins)
+        -> std::vector<TrendData>;
+
+    // Repository-backed summaries are cached per data generation: repeated
+    // and overlapping requests within one run (or a long-lived process)
+    // reuse computed summaries, and the first read after a repository write
+    // sees a new generation and drops everything. Months key by epoch month
+    // (year*12 + month), years by year.
+    auto syncCacheGeneration(const core::TransactionRepository& repository) -> void;
+
+    uint64_t cachedGeneration_{0};
+    std::map<int, MonthlySummary> monthlyCache_;
+    std::map<int, YearlySummary> yearlyCache_;
+
+    unsigned workerCount_{0};
 };
 
 } // namespace ares::application::services
@@ -0,0 +1,128 @@
+#include "application/services/RuleAnalyzer.hpp"
+#include <cmath>
+#include <fmt/format.h>
+#include "core/common/TextNormalize.hpp"
+
+namespace ares::application::services {
+
+namespace {
+
+using infrastructure::config::CompiledCategorizationRule;
+using infrastructure::config::ConfigParser;
+
+auto labelFor(const CompiledCategorizationRule& compiled) -> std::string {
+    return compiled.rule.amountCents
+        ? fmt::format("amount:{}", *compiled.rule.amountCents)
+        : compiled.rule.pattern;
+}
+
+// True when any input matching `later` necessarily matches `earlier` too,
+// so `later` can never fire under first-match-wins. Only the provable
+// cases are claimed: a non-wildcard pattern that contains an earlier
+// non-wildcard pattern as a substring, an identical pattern (wildcard or
+// not), and an amount rule whose absolute amount an earlier amount rule
+// already owns.
+auto shadows(const CompiledCategorizationRule& earlier,
+             const CompiledCategorizationRule& later) -> bool {
+    if (earlier.rule.amountCents || later.rule.amountCents) {
+        return earlier.rule.amountCents && later.rule.amountCents &&
+               std::abs(*earlier.rule.amountCents) ==
+                   std::abs(*later.rule.amountCents);
+    }
+    if (earlier.hasWildcard || later.hasWildcard) {
+        return earlier.normalizedPattern == later.normalizedPattern;
+    }
+    return later.normalizedPattern.find(earlier.normalizedPattern) !=
+           std::string::npos;
+}
+
+} // namespace
+
+RuleAnalyzer::RuleAnalyzer(
+    std::vector<infrastructure::config::CategorizationRule> rules)
+    : rules_{ConfigParser::compileRules(std::move(rules))}
+{}
+
+auto RuleAnalyzer::analyze(
+    const std::vector<core::Transaction>& transactions) const
+    -> RuleAnalysis
+{
+    RuleAnalysis analysis;
+    analysis.rules.reserve(rules_.size());
+    for (std::size_t i = 0; i < rules_.size(); ++i) {
+        const auto& compiled = rules_.rules[i];
+        RuleReport report{
+            .label = labelFor(compiled),
+            .category = compiled.rule.category,
+            .position = i
+        };
+        for (std::size_t j = 0; j < i; ++j) {
+            if (shadows(rules_.rules[j], compiled)) {
+                report.shadowedBy = j;
+                break;
+            }
+        }
+        analysis.rules.push_back(std::move(report));
+    }
+
+    // Replay: the same scan matchCompiledNormalized does, instrumented.
+    // A pattern rule is probed by every transaction that reaches its
+    // position; an amount rule costs one hash lookup per transaction
+    // regardless of position, so it accrues no scan bytes.
+    std::string cpN;
+    std::string descN;
+    for (const auto& txn : transactions) {
+        if (txn.userCategoryOverride()) {
+            continue;
+        }
+        ++analysis.transactionsScanned;
+        core::text::lowercaseStripSpacesInto(
+            txn.counterpartyName().value_or(""), cpN);
+        core::text::lowercaseStripSpacesInto(txn.description(), descN);
+
+        std::size_t amountRule = rules_.size();
+        if (auto it = rules_.amountIndex.find(std::abs(txn.amount().cents()));
+            it != rules_.amountIndex.end()) {
+            amountRule = it->second;
+        }
+
+        bool matched = false;
+        for (std::size_t i = 0; i < rules_.size(); ++i) {
+            if (amountRule <= i) {
+                ++analysis.rules[amountRule].hits;
+                matched = true;
+                break;
+            }
+            const auto& compiled = rules_.rules[i];
+            if (compiled.rule.amountCents) {
+                continue;
+            }
+
+            auto& report = analysis.rules[i];
+            ++report.probes;
+            report.scannedBytes +=
+                (cpN.size() + descN.size()) * compiled.normalizedPattern.size();
+
+            bool hit = compiled.hasWildcard
+                ? (ConfigParser::matchesNormalized(compiled.normalizedPattern, cpN) ||
+                   ConfigParser::matchesNormalized(compiled.normalizedPattern, descN))
+                : (cpN.find(compiled.normalizedPattern) != std::string::npos ||
+                   descN.find(compiled.normalizedPattern) != std::string::npos);
+            if (hit) {
+                ++report.hits;
+                matched = true;
+                break;
+            }
+        }
+        if (!matched && amountRule < rules_.size()) {
+            ++analysis.rules[amountRule].hits;
+        }
+    }
+
+    for (const auto& report : analysis.rules) {
+        analysis.totalScannedBytes += report.scannedBytes;
+    }
+    return analysis;
+}
+
+} // namespace ares::application::services
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+#include "core/transaction/Transaction.hpp"
+#include "infrastructure/config/ConfigParser.hpp"
+
+namespace ares::application::services {
+
+// Per-rule findings from a history replay. probes counts how many
+// transactions had to evaluate this rule before something earlier in the
+// list matched (or nothing did); scannedBytes is probes times the pattern
+// length — the substring scan work the rule costs, since every probe scans
+// the counterparty and memo for the pattern.
+struct RuleReport {
+    std::string label;  // pattern, or "amount:<cents>" for amount rules
+    core::TransactionCategory category;
+    std::size_t position{0};
+    int hits{0};
+    std::uint64_t probes{0};
+    std::uint64_t scannedBytes{0};
+    // Position of an earlier rule that makes this one unreachable
+    // regardless of input, when that is statically provable
+    std::optional<std::size_t> shadowedBy;
+};
+
+struct RuleAnalysis {
+    std::vector<RuleReport> rules;  // in rule-set order
+    std::size_t transactionsScanned{0};
+    std::uint64_t totalScannedBytes{0};
+};
+
+// Replays the custom rule set over a transaction history with the same
+// first-match-wins semantics as CategoryMatcher, but instrumented: it
+// records which rules ever fire, how much scan work each rule costs every
+// transaction, and which rules are shadowed by an earlier rule. Feeds
+// `categorize --analyze` so a rule set can be pruned and reordered for
+// throughput.
+class RuleAnalyzer {
+public:
+    explicit RuleAnalyzer(
+        std::vector<infrastructure::config::CategorizationRule> rules);
+
+    // Rows with a user override are skipped, mirroring the
+    // RecategorizationEngine - the matcher never runs on them, so they
+    // cost no rule scans in practice
+    [[nodiscard]] auto analyze(
+        const std::vector<core::Transaction>& transactions) const
+        -> RuleAnalysis;
+
+private:
+    infrastructure::config::CompiledRuleSet rules_;
+};
+
+} // namespace ares::application::services
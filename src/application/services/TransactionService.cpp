@@ -56,6 +56,16 @@ auto TransactionService::listAll(
     return transactions;
 }
 
+auto TransactionService::streamAll(
+    infrastructure::persistence::SqliteTransactionRepository& repo,
+    int limit)
+    -> std::expected<core::Generator<core::Transaction>, core::Error>
+{
+    // The limit is pushed down into the cursor, so unlike listAll there
+    // is never an over-fetch to truncate
+    return repo.streamAll(limit);
+}
+
 auto TransactionService::parseTransactionCategory(const std::string& catStr)
     -> std::optional<core::TransactionCategory>
 {
@@ -102,7 +112,8 @@ auto TransactionService::parseDate(const std::string& dateStr)
 }
 
 auto TransactionService::generateTransactionId() -> std::string {
-    return fmt::format("txn-manual-{}", ++counter_);
+    // Fixed width keeps the id inside the small-string buffer (no heap)
+    return fmt::format("txn-manual-{:04d}", ++counter_);
 }
 
 } // namespace ares::application::services
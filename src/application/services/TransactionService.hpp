@@ -6,6 +6,8 @@
 #include <vector>
 #include "core/transaction/Transaction.hpp"
 #include "core/common/Error.hpp"
+#include "core/common/Generator.hpp"
+#include "infrastructure/persistence/SqliteTransactionRepository.hpp"
 
 namespace ares::application::services {
 
@@ -27,6 +29,15 @@ public:
         int limit = 0)
         -> std::expected<std::vector<core::Transaction>, core::Error>;
 
+    // Streaming variant of listAll: the generator pulls rows one at a
+    // time off the repository cursor, so no layer between SQLite and the
+    // renderer ever holds a collection. The repository must outlive the
+    // returned generator.
+    [[nodiscard]] auto streamAll(
+        infrastructure::persistence::SqliteTransactionRepository& repo,
+        int limit = 0)
+        -> std::expected<core::Generator<core::Transaction>, core::Error>;
+
     [[nodiscard]] static auto parseTransactionCategory(const std::string& catStr)
         -> std::optional<core::TransactionCategory>;
 
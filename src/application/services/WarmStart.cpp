@@ -0,0 +1,275 @@
+#include "application/services/WarmStart.hpp"
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <fmt/format.h>
+#include <sqlite3.h>
+
+namespace ares::application::services {
+
+namespace {
+
+constexpr std::uint32_t kMagic = 0x4D525741;  // "AWRM"
+// Bump whenever the serialized layout changes; an unknown version is
+// just a miss
+constexpr std::uint32_t kVersion = 1;
+
+// The small aggregate tables every summary command reads first. The
+// transactions table is deliberately absent: walking a full history to
+// warm it would cost more than the first query it is meant to speed up.
+constexpr std::array<std::string_view, 6> kHotTables{
+    "monthly_rollups", "accounts", "credits",
+    "net_worth_snapshot", "archive_state", "schema_version"
+};
+
+struct TableHint {
+    std::string name;
+    std::int64_t rowCount{0};
+};
+
+// Fingerprint of the database file the snapshot was taken from. Size and
+// mtime are deliberately loose (WAL commits touch the main file only at
+// checkpoint) - the per-table row counts in apply() do the real
+// validation, and the snapshot carries no data that could go stale
+// anyway. Hashing a multi-megabyte database on each start would defeat
+// the point.
+struct Fingerprint {
+    std::string path;
+    std::uint64_t size{0};
+    std::int64_t mtime{0};
+};
+
+auto fingerprint(const std::filesystem::path& dbPath) -> std::optional<Fingerprint> {
+    std::error_code ec;
+    auto size = std::filesystem::file_size(dbPath, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    auto mtime = std::filesystem::last_write_time(dbPath, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    return Fingerprint{
+        .path = std::filesystem::absolute(dbPath, ec).string(),
+        .size = size,
+        .mtime = mtime.time_since_epoch().count()
+    };
+}
+
+// Walks the whole table, which is exactly the point: the count doubles
+// as the warmup touch that pulls the table's pages through the page
+// cache. nullopt when the table does not exist.
+auto countRows(infrastructure::persistence::DatabaseConnection& db,
+               const std::string& table) -> std::optional<std::int64_t>
+{
+    auto sql = fmt::format("SELECT COUNT(*) FROM \"{}\"", table);
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v2(db.handle(), sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
+        return std::nullopt;
+    }
+    std::optional<std::int64_t> count;
+    if (sqlite3_step(stmt) == SQLITE_ROW) {
+        count = sqlite3_column_int64(stmt, 0);
+    }
+    sqlite3_finalize(stmt);
+    return count;
+}
+
+struct Writer {
+    std::string out;
+
+    auto put32(std::uint32_t value) -> void {
+        out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+    auto put64(std::uint64_t value) -> void {
+        out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+    auto putI64(std::int64_t value) -> void {
+        out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+    auto putString(std::string_view value) -> void {
+        put32(static_cast<std::uint32_t>(value.size()));
+        out.append(value);
+    }
+};
+
+struct Reader {
+    std::string_view data;
+    std::size_t pos{0};
+    bool ok{true};
+
+    auto take(void* dest, std::size_t size) -> void {
+        if (!ok || data.size() - pos < size) {
+            ok = false;
+            return;
+        }
+        std::memcpy(dest, data.data() + pos, size);
+        pos += size;
+    }
+    auto get32() -> std::uint32_t {
+        std::uint32_t value{0};
+        take(&value, sizeof(value));
+        return value;
+    }
+    auto get64() -> std::uint64_t {
+        std::uint64_t value{0};
+        take(&value, sizeof(value));
+        return value;
+    }
+    auto getI64() -> std::int64_t {
+        std::int64_t value{0};
+        take(&value, sizeof(value));
+        return value;
+    }
+    auto getString() -> std::string {
+        auto size = get32();
+        if (!ok || data.size() - pos < size) {
+            ok = false;
+            return {};
+        }
+        std::string value{data.substr(pos, size)};
+        pos += size;
+        return value;
+    }
+};
+
+auto readFile(const std::filesystem::path& path) -> std::optional<std::string> {
+    std::ifstream file{path, std::ios::binary};
+    if (!file) {
+        return std::nullopt;
+    }
+    return std::string{std::istreambuf_iterator<char>{file},
+                       std::istreambuf_iterator<char>{}};
+}
+
+} // namespace
+
+auto WarmStart::snapshotPath() -> std::filesystem::path {
+    if (const auto* xdg = std::getenv("XDG_CACHE_HOME"); xdg && *xdg != '\0') {
+        return std::filesystem::path{xdg} / "ares" / "warmstart.bin";
+    }
+    if (const auto* home = std::getenv("HOME"); home && *home != '\0') {
+        return std::filesystem::path{home} / ".cache" / "ares" / "warmstart.bin";
+    }
+    return std::filesystem::path{".ares-warmstart.bin"};
+}
+
+auto WarmStart::write(infrastructure::persistence::DatabaseConnection& db,
+                      const std::filesystem::path& dbPath) -> void
+{
+    auto fp = fingerprint(dbPath);
+    if (!fp) {
+        return;
+    }
+
+    std::vector<TableHint> hints;
+    for (auto table : kHotTables) {
+        std::string name{table};
+        if (auto count = countRows(db, name)) {
+            hints.push_back(TableHint{.name = std::move(name), .rowCount = *count});
+        }
+    }
+    if (hints.empty()) {
+        return;
+    }
+
+    Writer w;
+    w.put32(kMagic);
+    w.put32(kVersion);
+    w.putString(fp->path);
+    w.put64(fp->size);
+    w.putI64(fp->mtime);
+    w.put32(static_cast<std::uint32_t>(hints.size()));
+    for (const auto& hint : hints) {
+        w.putString(hint.name);
+        w.putI64(hint.rowCount);
+    }
+
+    auto path = snapshotPath();
+    std::error_code ec;
+    std::filesystem::create_directories(path.parent_path(), ec);
+    if (ec) {
+        return;
+    }
+
+    // Temp file + rename so a concurrent reader never sees a half-written
+    // snapshot
+    auto tempPath = path;
+    tempPath += ".tmp";
+    {
+        std::ofstream file{tempPath, std::ios::binary | std::ios::trunc};
+        if (!file) {
+            return;
+        }
+        file.write(w.out.data(), static_cast<std::streamsize>(w.out.size()));
+        if (!file) {
+            std::filesystem::remove(tempPath, ec);
+            return;
+        }
+    }
+    std::filesystem::rename(tempPath, path, ec);
+    if (ec) {
+        std::filesystem::remove(tempPath, ec);
+    }
+}
+
+auto WarmStart::apply(infrastructure::persistence::DatabaseConnection& db,
+                      const std::filesystem::path& dbPath) -> bool
+{
+    auto path = snapshotPath();
+    auto snapshot = readFile(path);
+    if (!snapshot) {
+        return false;
+    }
+
+    auto drop = [&path] {
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+        return false;
+    };
+
+    Reader r{.data = *snapshot};
+    if (r.get32() != kMagic || r.get32() != kVersion) {
+        return drop();
+    }
+
+    auto fp = fingerprint(dbPath);
+    if (!fp) {
+        return drop();
+    }
+    if (r.getString() != fp->path ||
+        r.get64() != fp->size ||
+        r.getI64() != fp->mtime ||
+        !r.ok) {
+        return drop();
+    }
+
+    // The validating counts are the warmup: each one walks its table and
+    // leaves the pages hot for the command about to run
+    auto hintCount = r.get32();
+    for (std::uint32_t i = 0; r.ok && i < hintCount; ++i) {
+        auto name = r.getString();
+        auto expected = r.getI64();
+        if (!r.ok) {
+            return drop();
+        }
+        auto count = countRows(db, name);
+        if (!count || *count != expected) {
+            return drop();
+        }
+    }
+    if (!r.ok || r.pos != r.data.size()) {
+        return drop();
+    }
+
+    return true;
+}
+
+} // namespace ares::application::services
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <filesystem>
+#include "infrastructure/persistence/DatabaseConnection.hpp"
+
+namespace ares::application::services {
+
+// Warm-start snapshot ($XDG_CACHE_HOME/ares/warmstart.bin). A cold
+// invocation pays the first-query walk over the hot aggregate tables
+// (rollups, accounts, snapshots) before anything useful prints; the
+// snapshot records those tables together with a fingerprint of the
+// database file, and apply() touches them right after open - one
+// sequential pass while their pages are still adjacent in the OS cache
+// from the previous run. Validation follows ConfigCache: size and mtime
+// of the database file plus per-table row counts stored at write time;
+// any mismatch is a miss and the snapshot is dropped. The daemon writes
+// one on shutdown, and `ares warm` writes one on demand. Like the config
+// cache it is never the source of truth - a stale or missing snapshot
+// only costs the warmup it would have saved.
+class WarmStart {
+public:
+    // Best-effort snapshot of the current database state; failures are
+    // silent
+    static auto write(infrastructure::persistence::DatabaseConnection& db,
+                      const std::filesystem::path& dbPath) -> void;
+
+    // Touch the hinted tables if the snapshot still matches the database
+    // file. Returns true when the warmup ran; false (after removing the
+    // snapshot) on any mismatch.
+    static auto apply(infrastructure::persistence::DatabaseConnection& db,
+                      const std::filesystem::path& dbPath) -> bool;
+
+    // Snapshot location ($XDG_CACHE_HOME/ares/warmstart.bin, falling
+    // back to ~/.cache/ares/warmstart.bin)
+    [[nodiscard]] static auto snapshotPath() -> std::filesystem::path;
+};
+
+} // namespace ares::application::services
@@ -0,0 +1,86 @@
+#include "core/common/AhoCorasick.hpp"
+#include <cassert>
+#include <queue>
+
+namespace ares::core {
+
+auto AhoCorasick::addPattern(std::string_view pattern, int id) -> void {
+    assert(!built_);
+    if (pattern.empty()) {
+        return;
+    }
+
+    int node = 0;
+    for (unsigned char c : pattern) {
+        auto it = nodes_[static_cast<std::size_t>(node)].next.find(c);
+        if (it == nodes_[static_cast<std::size_t>(node)].next.end()) {
+            nodes_.emplace_back();
+            int created = static_cast<int>(nodes_.size()) - 1;
+            nodes_[static_cast<std::size_t>(node)].next.emplace(c, created);
+            node = created;
+        } else {
+            node = it->second;
+        }
+    }
+    nodes_[static_cast<std::size_t>(node)].output.push_back(id);
+    ++patternCount_;
+}
+
+auto AhoCorasick::build() -> void {
+    assert(!built_);
+
+    // Breadth-first pass assigns each node the longest proper suffix that
+    // is also a path from the root. Output lists are merged down the
+    // failure chain so matching never has to walk it.
+    std::queue<int> pending;
+    for (auto& [c, child] : nodes_[0].next) {
+        nodes_[static_cast<std::size_t>(child)].fail = 0;
+        pending.push(child);
+    }
+
+    while (!pending.empty()) {
+        int node = pending.front();
+        pending.pop();
+
+        for (auto& [c, child] : nodes_[static_cast<std::size_t>(node)].next) {
+            int fail = nodes_[static_cast<std::size_t>(node)].fail;
+            while (fail != 0 && !nodes_[static_cast<std::size_t>(fail)].next.contains(c)) {
+                fail = nodes_[static_cast<std::size_t>(fail)].fail;
+            }
+            auto it = nodes_[static_cast<std::size_t>(fail)].next.find(c);
+            if (it != nodes_[static_cast<std::size_t>(fail)].next.end() && it->second != child) {
+                fail = it->second;
+            } else {
+                fail = 0;
+            }
+
+            auto& childNode = nodes_[static_cast<std::size_t>(child)];
+            childNode.fail = fail;
+            const auto& failOutput = nodes_[static_cast<std::size_t>(fail)].output;
+            childNode.output.insert(childNode.output.end(),
+                                    failOutput.begin(), failOutput.end());
+            pending.push(child);
+        }
+    }
+
+    built_ = true;
+}
+
+auto AhoCorasick::forEachMatch(std::string_view text, const MatchCallback& onMatch) const -> void {
+    assert(built_);
+
+    int node = 0;
+    for (unsigned char c : text) {
+        while (node != 0 && !nodes_[static_cast<std::size_t>(node)].next.contains(c)) {
+            node = nodes_[static_cast<std::size_t>(node)].fail;
+        }
+        auto it = nodes_[static_cast<std::size_t>(node)].next.find(c);
+        node = it != nodes_[static_cast<std::size_t>(node)].next.end() ? it->second : 0;
+
+        for (int id : nodes_[static_cast<std::size_t>(node)].output) {
+            onMatch(id);
+        }
+    }
+}
+
+} // namespace ares::core
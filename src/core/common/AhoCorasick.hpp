@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <string_view>
+#include <vector>
+
+namespace ares::core {
+
+// Aho-Corasick multi-pattern matcher. All patterns are compiled into one
+// automaton so matching is a single pass over the text, instead of one
+// substring scan per pattern. Patterns are byte sequences; callers are
+// responsible for any normalization (lowercasing etc.) of both sides.
+class AhoCorasick {
+public:
+    AhoCorasick() = default;
+
+    // Registers a pattern under a caller-chosen id. Ids may repeat and do
+    // not have to be dense. Must be called before build().
+    auto addPattern(std::string_view pattern, int id) -> void;
+
+    // Compiles the failure links. Call exactly once, after all patterns
+    // have been added.
+    auto build() -> void;
+
+    // Invokes onMatch with the id of every pattern occurrence in text.
+    // A pattern matching in several places reports once per occurrence.
+    using MatchCallback = std::function<void(int id)>;
+    auto forEachMatch(std::string_view text, const MatchCallback& onMatch) const -> void;
+
+    [[nodiscard]] auto patternCount() const -> std::size_t { return patternCount_; }
+
+private:
+    struct Node {
+        std::map<unsigned char, int> next;
+        int fail{0};
+        std::vector<int> output;  // ids of patterns ending at this node
+    };
+
+    std::vector<Node> nodes_{1};  // node 0 is the root
+    std::size_t patternCount_{0};
+    bool built_{false};
+};
+
+} // namespace ares::core
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+
+namespace ares::core {
+
+// Bounded blocking queue connecting pipeline stages. A producer pushes until
+// the queue is full, then blocks; consumers pop until the producer calls
+// close() and the queue drains, after which pop() returns nullopt.
+template <typename T>
+class BoundedQueue {
+public:
+    explicit BoundedQueue(std::size_t capacity)
+        : capacity_{capacity}
+    {}
+
+    // Blocks while the queue is full. Items pushed after close() are dropped.
+    auto push(T item) -> void {
+        std::unique_lock lock{mutex_};
+        notFull_.wait(lock, [this] { return items_.size() < capacity_ || closed_; });
+        if (closed_) return;
+        items_.push_back(std::move(item));
+        notEmpty_.notify_one();
+    }
+
+    // Blocks while the queue is empty and still open; nullopt means the
+    // producer has closed the queue and everything has been consumed
+    [[nodiscard]] auto pop() -> std::optional<T> {
+        std::unique_lock lock{mutex_};
+        notEmpty_.wait(lock, [this] { return !items_.empty() || closed_; });
+        if (items_.empty()) return std::nullopt;
+        T item = std::move(items_.front());
+        items_.pop_front();
+        notFull_.notify_one();
+        return item;
+    }
+
+    auto close() -> void {
+        {
+            std::scoped_lock lock{mutex_};
+            closed_ = true;
+        }
+        notEmpty_.notify_all();
+        notFull_.notify_all();
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable notFull_;
+    std::condition_variable notEmpty_;
+    std::deque<T> items_;
+    std::size_t capacity_;
+    bool closed_{false};
+};
+
+} // namespace ares::core
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include "core/common/Types.hpp"
+
+namespace ares::core::civil {
+
+// Constexpr civil-date <-> epoch-day conversion (Howard Hinnant's
+// days-from-civil algorithm): a handful of integer operations each way,
+// no chrono calendar machinery, no formatted-string round trips. Every
+// date the database stores is an epoch day (days since 1970-01-01), so
+// these sit on the hydration and binding hot paths.
+
+/// Epoch day for a civil date. Valid for the full proleptic Gregorian
+/// calendar range the application can encounter.
+[[nodiscard]] constexpr auto daysFromCivil(int year, unsigned month, unsigned day) -> int64_t {
+    year -= month <= 2;
+    const int64_t era = (year >= 0 ? year : year - 399) / 400;
+    const auto yoe = static_cast<unsigned>(year - era * 400);                       // [0, 399]
+    const unsigned doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;  // [0, 365]
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;                     // [0, 146096]
+    return era * 146097 + static_cast<int64_t>(doe) - 719468;
+}
+
+/// Civil date for an epoch day - the exact inverse of daysFromCivil
+[[nodiscard]] constexpr auto civilFromDays(int64_t epochDay) -> Date {
+    epochDay += 719468;
+    const int64_t era = (epochDay >= 0 ? epochDay : epochDay - 146096) / 146097;
+    const auto doe = static_cast<unsigned>(epochDay - era * 146097);                // [0, 146096]
+    const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;     // [0, 399]
+    const int64_t year = static_cast<int64_t>(yoe) + era * 400;
+    const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);                   // [0, 365]
+    const unsigned mp = (5 * doy + 2) / 153;                                        // [0, 11]
+    const unsigned day = doy - (153 * mp + 2) / 5 + 1;                              // [1, 31]
+    const unsigned month = mp + (mp < 10 ? 3 : -9);                                 // [1, 12]
+    return Date{std::chrono::year{static_cast<int>(year + (month <= 2))},
+                std::chrono::month{month}, std::chrono::day{day}};
+}
+
+[[nodiscard]] constexpr auto toEpochDay(Date date) -> int64_t {
+    return daysFromCivil(static_cast<int>(date.year()),
+                         static_cast<unsigned>(date.month()),
+                         static_cast<unsigned>(date.day()));
+}
+
+[[nodiscard]] constexpr auto fromEpochDay(int64_t epochDay) -> Date {
+    return civilFromDays(epochDay);
+}
+
+/// Calendar month as yyyymm - the month-binning key used by the rollups
+[[nodiscard]] constexpr auto monthKey(Date date) -> int64_t {
+    return static_cast<int64_t>(static_cast<int>(date.year())) * 100 +
+           static_cast<unsigned>(date.month());
+}
+
+// The conversions are their own inverse and agree with the chrono epoch
+static_assert(daysFromCivil(1970, 1, 1) == 0);
+static_assert(daysFromCivil(2026, 3, 1) == 20513);
+static_assert(toEpochDay(civilFromDays(20513)) == 20513);
+static_assert(civilFromDays(-1) ==
+              Date{std::chrono::year{1969}, std::chrono::month{12}, std::chrono::day{31}});
+
+} // namespace ares::core::civil
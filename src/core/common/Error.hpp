@@ -1,6 +1,9 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <variant>
 #include <fmt/format.h>
 
@@ -23,6 +26,50 @@ struct ParseError {
     }
 };
 
+// Light tier for per-row hot paths: a trivially copyable code + location
+// instead of a string-bearing struct, so the std::expected those functions
+// return is a couple of machine words and failure rows allocate nothing.
+// expandParseError turns one into the rich ParseError at the reporting
+// boundary, where the offending text is still at hand.
+enum class ParseCode : std::uint8_t {
+    InsufficientColumns,
+    EmptyField,
+    InvalidDate,
+    InvalidAmount,
+};
+
+struct LightParseError {
+    ParseCode code{ParseCode::InvalidDate};
+    int line{0};
+    // Field index of the offending column; for InsufficientColumns, the
+    // number of columns the row actually had
+    int column{0};
+};
+static_assert(std::is_trivially_copyable_v<LightParseError>);
+
+[[nodiscard]] inline auto expandParseError(LightParseError error,
+                                           std::string_view context = {}) -> ParseError {
+    auto message = [&]() -> std::string {
+        switch (error.code) {
+            case ParseCode::InsufficientColumns:
+                return fmt::format("Row has insufficient columns ({})", error.column);
+            case ParseCode::EmptyField:
+                return "Required field is empty";
+            case ParseCode::InvalidDate:
+                return "Failed to parse date";
+            case ParseCode::InvalidAmount:
+                return "Failed to parse amount";
+        }
+        return "Parse error";
+    }();
+    return ParseError{
+        .message = std::move(message),
+        .line = error.line,
+        .column = error.column,
+        .sourceLine = std::string{context}
+    };
+}
+
 struct ValidationError {
     std::string field;
     std::string message;
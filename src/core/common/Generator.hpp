@@ -0,0 +1,105 @@
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <iterator>
+#include <utility>
+
+namespace ares::core {
+
+// Minimal coroutine generator - a stand-in for std::generator until
+// libstdc++ ships <generator>. Rows stream from producer to consumer one
+// at a time: the producer suspends at each co_yield, so nothing is ever
+// collected and the first element is available before the second is
+// produced. Move-only; destroying the generator mid-walk unwinds the
+// producer's locals, so RAII cleanup (statement finalizers, file
+// handles) runs however early the consumer stops.
+template <typename T>
+class Generator {
+public:
+    struct promise_type {
+        const T* current{nullptr};
+        std::exception_ptr exception;
+
+        auto get_return_object() -> Generator {
+            return Generator{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+        auto initial_suspend() noexcept -> std::suspend_always { return {}; }
+        auto final_suspend() noexcept -> std::suspend_always { return {}; }
+        // The yielded operand lives in the coroutine frame for the whole
+        // suspension, so holding a pointer to it is safe
+        auto yield_value(const T& value) noexcept -> std::suspend_always {
+            current = &value;
+            return {};
+        }
+        auto return_void() noexcept -> void {}
+        auto unhandled_exception() -> void { exception = std::current_exception(); }
+    };
+
+    Generator() = default;
+    ~Generator() {
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+
+    Generator(const Generator&) = delete;
+    auto operator=(const Generator&) -> Generator& = delete;
+
+    Generator(Generator&& other) noexcept : handle_{std::exchange(other.handle_, {})} {}
+    auto operator=(Generator&& other) noexcept -> Generator& {
+        if (this != &other) {
+            if (handle_) {
+                handle_.destroy();
+            }
+            handle_ = std::exchange(other.handle_, {});
+        }
+        return *this;
+    }
+
+    class iterator {
+    public:
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+        explicit iterator(std::coroutine_handle<promise_type> handle) : handle_{handle} {}
+
+        auto operator*() const -> const T& { return *handle_.promise().current; }
+        auto operator++() -> iterator& {
+            handle_.resume();
+            rethrowIfFailed(handle_);
+            return *this;
+        }
+        auto operator++(int) -> void { ++*this; }
+
+        friend auto operator==(const iterator& it, std::default_sentinel_t) -> bool {
+            return !it.handle_ || it.handle_.done();
+        }
+
+    private:
+        std::coroutine_handle<promise_type> handle_;
+    };
+
+    [[nodiscard]] auto begin() -> iterator {
+        if (handle_) {
+            handle_.resume();
+            rethrowIfFailed(handle_);
+        }
+        return iterator{handle_};
+    }
+    [[nodiscard]] auto end() -> std::default_sentinel_t { return {}; }
+
+private:
+    explicit Generator(std::coroutine_handle<promise_type> handle) : handle_{handle} {}
+
+    static auto rethrowIfFailed(std::coroutine_handle<promise_type> handle) -> void {
+        if (handle.done() && handle.promise().exception) {
+            std::rethrow_exception(handle.promise().exception);
+        }
+    }
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+} // namespace ares::core
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace ares::core {
+
+// Immutable shared string for values that repeat across many rows: a
+// 100k-row history carries only a few hundred distinct counterparties
+// and a handful of mutation codes, so hydrating each row with its own
+// std::string duplicates the same bytes tens of thousands of times.
+// Copies share one allocation, and two strings interned through the same
+// pool compare equal with a pointer check before any byte is touched.
+// Converts implicitly to const std::string& and std::string_view so it
+// slots into existing call sites.
+class InternedString {
+public:
+    InternedString() : str_{emptyString()} {}
+    InternedString(std::string value)
+        : str_{std::make_shared<const std::string>(std::move(value))} {}
+    InternedString(std::string_view value)
+        : str_{std::make_shared<const std::string>(value)} {}
+    InternedString(const char* value) : InternedString(std::string_view{value}) {}
+
+    [[nodiscard]] auto str() const -> const std::string& { return *str_; }
+    [[nodiscard]] auto view() const -> std::string_view { return *str_; }
+    [[nodiscard]] auto c_str() const -> const char* { return str_->c_str(); }
+    [[nodiscard]] auto size() const -> std::size_t { return str_->size(); }
+    [[nodiscard]] auto empty() const -> bool { return str_->empty(); }
+
+    operator const std::string&() const { return *str_; }
+    operator std::string_view() const { return *str_; }
+
+    /// True when both values point at the same pool entry
+    [[nodiscard]] auto sharesStorageWith(const InternedString& other) const -> bool {
+        return str_ == other.str_;
+    }
+
+    // Pointer equality first: interned copies of the same value share
+    // their allocation, so the common case never compares bytes
+    friend auto operator==(const InternedString& a, const InternedString& b) -> bool {
+        return a.str_ == b.str_ || *a.str_ == *b.str_;
+    }
+    friend auto operator==(const InternedString& a, const std::string& b) -> bool {
+        return *a.str_ == b;
+    }
+    friend auto operator==(const InternedString& a, const char* b) -> bool {
+        return *a.str_ == b;
+    }
+
+private:
+    friend class StringPool;
+    explicit InternedString(std::shared_ptr<const std::string> str) : str_{std::move(str)} {}
+
+    static auto emptyString() -> const std::shared_ptr<const std::string>& {
+        static const auto empty = std::make_shared<const std::string>();
+        return empty;
+    }
+
+    std::shared_ptr<const std::string> str_;
+};
+
+// fmt picks this up via ADL, so interned values format like plain strings
+[[nodiscard]] inline auto format_as(const InternedString& value) -> const std::string& {
+    return value.str();
+}
+
+// Deduplicating pool: the first request for a value allocates it, every
+// later request returns a handle to the same allocation. Not thread-safe;
+// owned by whoever hydrates (one pool per repository).
+class StringPool {
+public:
+    [[nodiscard]] auto intern(std::string_view value) -> InternedString {
+        auto it = entries_.find(value);
+        if (it == entries_.end()) {
+            auto stored = std::make_shared<const std::string>(value);
+            it = entries_.emplace(*stored, std::move(stored)).first;
+        }
+        return InternedString{it->second};
+    }
+
+    [[nodiscard]] auto size() const -> std::size_t { return entries_.size(); }
+
+private:
+    struct Hash {
+        using is_transparent = void;
+        auto operator()(std::string_view value) const -> std::size_t {
+            return std::hash<std::string_view>{}(value);
+        }
+    };
+
+    std::unordered_map<std::string, std::shared_ptr<const std::string>, Hash, std::equal_to<>>
+        entries_;
+};
+
+} // namespace ares::core
@@ -111,6 +111,97 @@ auto Money::fromString(std::string_view str, Currency currency) -> std::expected
     return fromDouble(value, currency);
 }
 
+auto Money::parseCents(std::string_view str, AmountFormat format) noexcept
+    -> std::optional<int64_t>
+{
+    const char thousandSep = format == AmountFormat::European ? '.' : ',';
+    const char decimalSep = format == AmountFormat::European ? ',' : '.';
+
+    while (!str.empty() && (str.front() == ' ' || str.front() == '\t')) str.remove_prefix(1);
+    while (!str.empty() && (str.back() == ' ' || str.back() == '\t')) str.remove_suffix(1);
+
+    bool negative = false;
+    if (!str.empty() && (str.front() == '-' || str.front() == '+')) {
+        negative = str.front() == '-';
+        str.remove_prefix(1);
+    }
+    if (str.empty()) {
+        return std::nullopt;
+    }
+
+    // Integer part: digits with interspersed thousand separators, which must
+    // sit between digits - a leading or doubled separator is malformed input
+    int64_t euros = 0;
+    bool sawDigit = false;
+    bool lastWasSeparator = true;
+    std::size_t i = 0;
+    for (; i < str.size() && str[i] != decimalSep; ++i) {
+        char c = str[i];
+        if (c >= '0' && c <= '9') {
+            euros = euros * 10 + (c - '0');
+            sawDigit = true;
+            lastWasSeparator = false;
+        } else if (c == thousandSep && !lastWasSeparator) {
+            lastWasSeparator = true;
+        } else {
+            return std::nullopt;
+        }
+    }
+    if (sawDigit && lastWasSeparator && i > 0) {
+        return std::nullopt;  // Trailing thousand separator
+    }
+
+    // Fractional part: at most two digits after the decimal separator
+    int64_t cents = 0;
+    if (i < str.size()) {
+        auto frac = str.substr(i + 1);
+        if (frac.empty() || frac.size() > 2) {
+            return std::nullopt;
+        }
+        for (char c : frac) {
+            if (c < '0' || c > '9') {
+                return std::nullopt;
+            }
+            cents = cents * 10 + (c - '0');
+        }
+        if (frac.size() == 1) {
+            cents *= 10;  // ",5" means 50 cents
+        }
+        sawDigit = true;
+    }
+    if (!sawDigit) {
+        return std::nullopt;
+    }
+
+    auto totalCents = euros * 100 + cents;
+    return negative ? -totalCents : totalCents;
+}
+
+auto Money::parseColumn(std::span<const std::string_view> column,
+                        AmountFormat format,
+                        std::span<int64_t> out)
+    -> std::expected<std::size_t, Error>
+{
+    if (out.size() < column.size()) {
+        return std::unexpected(ParseError{
+            .message = fmt::format("parseColumn output holds {} of {} entries",
+                                   out.size(), column.size())
+        });
+    }
+
+    for (std::size_t i = 0; i < column.size(); ++i) {
+        auto cents = parseCents(column[i], format);
+        if (!cents) {
+            return std::unexpected(ParseError{
+                .message = fmt::format("Invalid amount at entry {}: {}", i, column[i])
+            });
+        }
+        out[i] = *cents;
+    }
+
+    return column.size();
+}
+
 auto Money::toString() const -> std::string {
     auto absValue = std::abs(toDouble());
     if (isNegative()) {
@@ -178,4 +269,11 @@ auto Money::operator-=(const Money& other) -> std::expected<void, Error> {
     return {};
 }
 
+auto MoneyAccumulator::total() const -> std::expected<Money, Error> {
+    if (mismatched_) {
+        return std::unexpected(CurrencyMismatchError{});
+    }
+    return Money{cents_, currency_};
+}
+
 } // namespace ares::core
@@ -0,0 +1,221 @@
+#include "core/common/PerfCounters.hpp"
+
+#if defined(ARES_PERF_COUNTERS) || defined(ARES_ALLOC_ACCOUNTING)
+#define ARES_COUNTING_ALLOCATOR 1
+#include <cstdlib>
+#include <new>
+#endif
+#ifdef ARES_PERF_COUNTERS
+#include <memory>
+#include <mutex>
+#endif
+#ifdef ARES_ALLOC_ACCOUNTING
+#include <atomic>
+#include <malloc.h>
+#endif
+
+namespace ares::core::perf {
+
+#ifdef ARES_COUNTING_ALLOCATOR
+namespace {
+    thread_local std::uint64_t tlAllocations = 0;
+} // namespace
+#endif
+
+#ifdef ARES_PERF_COUNTERS
+
+namespace {
+    // Sites are heap-pinned so references handed out by registerSite stay
+    // valid as the registry grows
+    struct Registry {
+        std::mutex mutex;
+        std::vector<std::unique_ptr<Site>> sites;
+    };
+
+    auto registry() -> Registry& {
+        static Registry instance;
+        return instance;
+    }
+} // namespace
+
+auto registerSite(std::string_view name) -> Site& {
+    auto& reg = registry();
+    std::lock_guard lock{reg.mutex};
+    for (const auto& site : reg.sites) {
+        if (site->name == name) {
+            return *site;
+        }
+    }
+    reg.sites.push_back(std::make_unique<Site>());
+    reg.sites.back()->name = name;
+    return *reg.sites.back();
+}
+
+auto threadAllocationCount() -> std::uint64_t {
+    return tlAllocations;
+}
+
+auto snapshot() -> std::vector<SiteStats> {
+    auto& reg = registry();
+    std::lock_guard lock{reg.mutex};
+    std::vector<SiteStats> stats;
+    stats.reserve(reg.sites.size());
+    for (const auto& site : reg.sites) {
+        stats.push_back(SiteStats{
+            .name = site->name,
+            .calls = site->calls.load(std::memory_order_relaxed),
+            .totalNanos = site->totalNanos.load(std::memory_order_relaxed),
+            .allocations = site->allocations.load(std::memory_order_relaxed)
+        });
+    }
+    return stats;
+}
+
+auto reset() -> void {
+    auto& reg = registry();
+    std::lock_guard lock{reg.mutex};
+    for (const auto& site : reg.sites) {
+        site->calls.store(0, std::memory_order_relaxed);
+        site->totalNanos.store(0, std::memory_order_relaxed);
+        site->allocations.store(0, std::memory_order_relaxed);
+    }
+}
+
+#else
+
+auto snapshot() -> std::vector<SiteStats> {
+    return {};
+}
+
+auto reset() -> void {}
+
+#endif // ARES_PERF_COUNTERS
+
+#ifdef ARES_ALLOC_ACCOUNTING
+
+namespace {
+    std::atomic<std::uint64_t> gAllocations{0};
+    std::atomic<std::uint64_t> gBytesAllocated{0};
+    std::atomic<std::uint64_t> gLiveBytes{0};
+    std::atomic<std::uint64_t> gPeakLiveBytes{0};
+
+    // Sizes come from malloc_usable_size on the returned pointer, so both
+    // sides of the ledger see the allocator's actual block size and the
+    // unsized operator delete forms can still subtract correctly
+    auto trackAlloc(void* ptr) -> void {
+        if (ptr == nullptr) {
+            return;
+        }
+        auto size = static_cast<std::uint64_t>(malloc_usable_size(ptr));
+        gAllocations.fetch_add(1, std::memory_order_relaxed);
+        gBytesAllocated.fetch_add(size, std::memory_order_relaxed);
+        auto live = gLiveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+        auto peak = gPeakLiveBytes.load(std::memory_order_relaxed);
+        while (live > peak &&
+               !gPeakLiveBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+        }
+    }
+
+    auto trackFree(void* ptr) -> void {
+        if (ptr == nullptr) {
+            return;
+        }
+        gLiveBytes.fetch_sub(static_cast<std::uint64_t>(malloc_usable_size(ptr)),
+                             std::memory_order_relaxed);
+    }
+} // namespace
+
+auto allocTotals() -> AllocTotals {
+    return AllocTotals{
+        .allocations = gAllocations.load(std::memory_order_relaxed),
+        .bytesAllocated = gBytesAllocated.load(std::memory_order_relaxed),
+        .liveBytes = gLiveBytes.load(std::memory_order_relaxed),
+        .peakLiveBytes = gPeakLiveBytes.load(std::memory_order_relaxed)
+    };
+}
+
+#else
+
+auto allocTotals() -> AllocTotals {
+    return {};
+}
+
+#endif // ARES_ALLOC_ACCOUNTING
+
+} // namespace ares::core::perf
+
+#ifdef ARES_COUNTING_ALLOCATOR
+
+// Counting replacements for the global allocation functions. The
+// thread-local counter feeds the per-site perf scopes; the accounting
+// atomics (when compiled in) feed the process-wide totals behind
+// --timings and stats --perf.
+namespace {
+    auto countedAlloc(std::size_t size) -> void* {
+        ++ares::core::perf::tlAllocations;
+        auto* ptr = std::malloc(size != 0 ? size : 1);
+#ifdef ARES_ALLOC_ACCOUNTING
+        ares::core::perf::trackAlloc(ptr);
+#endif
+        return ptr;
+    }
+
+    auto countedAlignedAlloc(std::size_t size, std::size_t alignment) -> void* {
+        ++ares::core::perf::tlAllocations;
+        // aligned_alloc requires the size to be a multiple of the alignment
+        auto rounded = (size + alignment - 1) / alignment * alignment;
+        auto* ptr = std::aligned_alloc(alignment, rounded != 0 ? rounded : alignment);
+#ifdef ARES_ALLOC_ACCOUNTING
+        ares::core::perf::trackAlloc(ptr);
+#endif
+        return ptr;
+    }
+
+    auto countedFree(void* ptr) -> void {
+#ifdef ARES_ALLOC_ACCOUNTING
+        ares::core::perf::trackFree(ptr);
+#endif
+        std::free(ptr);
+    }
+} // namespace
+
+auto operator new(std::size_t size) -> void* {
+    if (auto* p = countedAlloc(size)) return p;
+    throw std::bad_alloc{};
+}
+
+auto operator new[](std::size_t size) -> void* {
+    if (auto* p = countedAlloc(size)) return p;
+    throw std::bad_alloc{};
+}
+
+auto operator new(std::size_t size, const std::nothrow_t&) noexcept -> void* {
+    return countedAlloc(size);
+}
+
+auto operator new[](std::size_t size, const std::nothrow_t&) noexcept -> void* {
+    return countedAlloc(size);
+}
+
+auto operator new(std::size_t size, std::align_val_t alignment) -> void* {
+    if (auto* p = countedAlignedAlloc(size, static_cast<std::size_t>(alignment))) return p;
+    throw std::bad_alloc{};
+}
+
+auto operator new[](std::size_t size, std::align_val_t alignment) -> void* {
+    if (auto* p = countedAlignedAlloc(size, static_cast<std::size_t>(alignment))) return p;
+    throw std::bad_alloc{};
+}
+
+auto operator delete(void* ptr) noexcept -> void { countedFree(ptr); }
+auto operator delete[](void* ptr) noexcept -> void { countedFree(ptr); }
+auto operator delete(void* ptr, std::size_t) noexcept -> void { countedFree(ptr); }
+auto operator delete[](void* ptr, std::size_t) noexcept -> void { countedFree(ptr); }
+auto operator delete(void* ptr, std::align_val_t) noexcept -> void { countedFree(ptr); }
+auto operator delete[](void* ptr, std::align_val_t) noexcept -> void { countedFree(ptr); }
+auto operator delete(void* ptr, std::size_t, std::align_val_t) noexcept -> void { countedFree(ptr); }
+auto operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept -> void { countedFree(ptr); }
+auto operator delete(void* ptr, const std::nothrow_t&) noexcept -> void { countedFree(ptr); }
+auto operator delete[](void* ptr, const std::nothrow_t&) noexcept -> void { countedFree(ptr); }
+
+#endif // ARES_COUNTING_ALLOCATOR
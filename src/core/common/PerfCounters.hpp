@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+#ifdef ARES_PERF_COUNTERS
+#include <atomic>
+#include <chrono>
+#endif
+
+namespace ares::core::perf {
+
+// Opt-in hot-path instrumentation, compiled out by default. Building with
+// -DARES_PERF_COUNTERS=ON turns ARES_PERF_SCOPE("name") into a scoped
+// counter recording call count, cumulative wall time and heap allocations
+// (counted via replacement operator new) per named site. The aggregate
+// prints through `ares stats --perf`; counters accumulate for the process
+// lifetime, so the numbers are most useful under the daemon where one
+// process serves many commands. In the default build the macro expands to
+// nothing and the hot paths carry no instrumentation at all.
+
+struct SiteStats {
+    std::string_view name;
+    std::uint64_t calls{0};
+    std::uint64_t totalNanos{0};
+    std::uint64_t allocations{0};
+};
+
+/// Whether this build carries the instrumentation
+[[nodiscard]] constexpr auto compiledIn() -> bool {
+#ifdef ARES_PERF_COUNTERS
+    return true;
+#else
+    return false;
+#endif
+}
+
+/// Current aggregate per site, in registration order. Always callable;
+/// empty when the instrumentation is compiled out or nothing ran.
+[[nodiscard]] auto snapshot() -> std::vector<SiteStats>;
+
+/// Zero all counters (sites stay registered)
+auto reset() -> void;
+
+// Allocation accounting (-DARES_ALLOC_ACCOUNTING=ON) interposes the
+// global allocation functions to track process-wide totals, giving each
+// command a memory number to compare across releases. Per-phase byte
+// deltas ride the --timings report; the totals print under
+// `ares stats --perf`.
+
+struct AllocTotals {
+    std::uint64_t allocations{0};
+    std::uint64_t bytesAllocated{0};
+    std::uint64_t liveBytes{0};
+    std::uint64_t peakLiveBytes{0};
+};
+
+/// Whether this build accounts allocations
+[[nodiscard]] constexpr auto allocAccountingCompiledIn() -> bool {
+#ifdef ARES_ALLOC_ACCOUNTING
+    return true;
+#else
+    return false;
+#endif
+}
+
+/// Process-wide allocation totals; all zeros when accounting is
+/// compiled out
+[[nodiscard]] auto allocTotals() -> AllocTotals;
+
+#ifdef ARES_PERF_COUNTERS
+
+struct Site {
+    std::string_view name;
+    std::atomic<std::uint64_t> calls{0};
+    std::atomic<std::uint64_t> totalNanos{0};
+    std::atomic<std::uint64_t> allocations{0};
+};
+
+/// One-time site registration; the macro caches the reference in a
+/// function-local static so repeat calls are a single load
+[[nodiscard]] auto registerSite(std::string_view name) -> Site&;
+
+/// Allocations made by this thread so far (bumped by operator new)
+[[nodiscard]] auto threadAllocationCount() -> std::uint64_t;
+
+class Scope {
+public:
+    explicit Scope(Site& site)
+        : site_{site},
+          start_{std::chrono::steady_clock::now()},
+          allocsAtStart_{threadAllocationCount()} {}
+
+    ~Scope() {
+        auto elapsed = std::chrono::steady_clock::now() - start_;
+        site_.calls.fetch_add(1, std::memory_order_relaxed);
+        site_.totalNanos.fetch_add(
+            static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()),
+            std::memory_order_relaxed);
+        site_.allocations.fetch_add(threadAllocationCount() - allocsAtStart_,
+                                    std::memory_order_relaxed);
+    }
+
+    Scope(const Scope&) = delete;
+    auto operator=(const Scope&) -> Scope& = delete;
+
+private:
+    Site& site_;
+    std::chrono::steady_clock::time_point start_;
+    std::uint64_t allocsAtStart_;
+};
+
+#define ARES_PERF_SCOPE(name)                                                    \
+    static auto& aresPerfSite_ = ::ares::core::perf::registerSite(name);         \
+    ::ares::core::perf::Scope aresPerfScope_ { aresPerfSite_ }
+
+#else
+
+#define ARES_PERF_SCOPE(name)
+
+#endif // ARES_PERF_COUNTERS
+
+} // namespace ares::core::perf
@@ -0,0 +1,85 @@
+#include "core/common/TextNormalize.hpp"
+#include <array>
+#include <cstddef>
+
+namespace ares::core::text {
+
+namespace {
+
+constexpr auto makeLowerTable() -> std::array<char, 256> {
+    std::array<char, 256> table{};
+    for (int c = 0; c < 256; ++c) {
+        table[static_cast<std::size_t>(c)] =
+            (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a')
+                                   : static_cast<char>(c);
+    }
+    return table;
+}
+
+constexpr auto makeAlnumTable() -> std::array<bool, 256> {
+    std::array<bool, 256> table{};
+    for (int c = '0'; c <= '9'; ++c) table[static_cast<std::size_t>(c)] = true;
+    for (int c = 'a'; c <= 'z'; ++c) table[static_cast<std::size_t>(c)] = true;
+    for (int c = 'A'; c <= 'Z'; ++c) table[static_cast<std::size_t>(c)] = true;
+    return table;
+}
+
+constexpr auto kLower = makeLowerTable();
+constexpr auto kAlnum = makeAlnumTable();
+
+auto lower(char c) -> char {
+    return kLower[static_cast<unsigned char>(c)];
+}
+
+} // namespace
+
+auto lowercaseInto(std::string_view input, std::string& out) -> void {
+    out.resize(input.size());
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        out[i] = lower(input[i]);
+    }
+}
+
+auto lowercaseStripSpacesInto(std::string_view input, std::string& out) -> void {
+    out.clear();
+    for (char c : input) {
+        if (c != ' ') {
+            out += lower(c);
+        }
+    }
+}
+
+auto lowercaseCollapseSpacesInto(std::string_view input, std::string& out) -> void {
+    out.clear();
+    bool lastWasSpace = true;  // treat start as space to trim leading
+    for (char c : input) {
+        if (c == ' ' || c == '\t') {
+            if (!lastWasSpace) {
+                out += ' ';
+                lastWasSpace = true;
+            }
+        } else {
+            out += lower(c);
+            lastWasSpace = false;
+        }
+    }
+    while (!out.empty() && out.back() == ' ') {
+        out.pop_back();
+    }
+}
+
+auto lowercaseAlnumWordsInto(std::string_view input, std::string& out) -> void {
+    out.clear();
+    for (char c : input) {
+        if (kAlnum[static_cast<unsigned char>(c)]) {
+            out += lower(c);
+        } else if (c == ' ' && !out.empty() && out.back() != ' ') {
+            out += ' ';
+        }
+    }
+    while (!out.empty() && out.back() == ' ') {
+        out.pop_back();
+    }
+}
+
+} // namespace ares::core::text
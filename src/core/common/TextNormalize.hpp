@@ -0,0 +1,32 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+namespace ares::core::text {
+
+// Shared text-normalization kernel for the matching hot paths
+// (categorization, duplicate detection, recurrence grouping). All variants
+// are table-driven - one 256-entry lowercase lookup instead of a
+// std::tolower call per byte - and write into a caller-provided buffer,
+// which is cleared but keeps its capacity, so reusing the same buffer
+// across calls settles into zero allocations. Only ASCII letters are
+// case-folded, matching the previous per-site std::tolower loops.
+
+// Plain lowercase; out is resized to match input, and the branch-free
+// byte loop auto-vectorizes
+auto lowercaseInto(std::string_view input, std::string& out) -> void;
+
+// Lowercase and drop every space - the categorization normal form, which
+// also heals ING column-break artifacts ("Sony Int eractive")
+auto lowercaseStripSpacesInto(std::string_view input, std::string& out) -> void;
+
+// Lowercase, collapse space/tab runs to a single space, trim both ends -
+// the duplicate-detection normal form
+auto lowercaseCollapseSpacesInto(std::string_view input, std::string& out) -> void;
+
+// Lowercase keeping only alphanumerics and single separating spaces -
+// the recurrence-grouping normal form
+auto lowercaseAlnumWordsInto(std::string_view input, std::string& out) -> void;
+
+} // namespace ares::core::text
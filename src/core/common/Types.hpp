@@ -1,12 +1,18 @@
 #pragma once
 
+#include <cstddef>
+#include <functional>
 #include <string>
 #include <chrono>
 #include <compare>
 
 namespace ares::core {
 
-// Strong type wrapper for IDs
+// Strong type wrapper for IDs. Generated ids are fixed-width and at most
+// 15 characters, so the value always sits in the small-string buffer:
+// copies are trivial, comparisons touch inline bytes, and no id ever
+// allocates. The std::hash specialization below makes ids directly
+// usable as unordered-container keys.
 template<typename Tag>
 struct Id {
     std::string value;
@@ -40,3 +46,10 @@ using Date = std::chrono::year_month_day;
 }
 
 } // namespace ares::core
+
+template<typename Tag>
+struct std::hash<ares::core::Id<Tag>> {
+    auto operator()(const ares::core::Id<Tag>& id) const -> std::size_t {
+        return std::hash<std::string>{}(id.value);
+    }
+};
@@ -1,10 +1,14 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <expected>
+#include <functional>
 #include <optional>
 #include <string>
 #include <vector>
 #include "core/common/Error.hpp"
+#include "core/common/InternedString.hpp"
 #include "core/common/Money.hpp"
 #include "core/common/Types.hpp"
 
@@ -95,6 +99,11 @@ enum class TransactionCategory {
     Uncategorized
 };
 
+// Number of categories. The enum is dense from zero, so aggregation code can
+// index fixed-size arrays by category instead of walking node-based maps.
+inline constexpr std::size_t kTransactionCategoryCount =
+    static_cast<std::size_t>(TransactionCategory::Uncategorized) + 1;
+
 [[nodiscard]] constexpr auto categoryName(TransactionCategory cat) -> std::string_view {
     switch (cat) {
         case TransactionCategory::Salary: return "Salary";
@@ -143,10 +152,10 @@ public:
     [[nodiscard]] auto type() const -> TransactionType { return type_; }
     [[nodiscard]] auto category() const -> TransactionCategory { return category_; }
     [[nodiscard]] auto description() const -> const std::string& { return description_; }
-    [[nodiscard]] auto counterpartyName() const -> const std::optional<std::string>& { return counterpartyName_; }
+    [[nodiscard]] auto counterpartyName() const -> const std::optional<InternedString>& { return counterpartyName_; }
     [[nodiscard]] auto counterpartyIban() const -> const std::optional<std::string>& { return counterpartyIban_; }
     [[nodiscard]] auto rawDescription() const -> const std::string& { return rawDescription_; }
-    [[nodiscard]] auto mutationCode() const -> const std::optional<std::string>& { return mutationCode_; }
+    [[nodiscard]] auto mutationCode() const -> const std::optional<InternedString>& { return mutationCode_; }
 
     // Recurring transaction fields
     [[nodiscard]] auto isRecurring() const -> bool { return isRecurring_; }
@@ -154,20 +163,79 @@ public:
     [[nodiscard]] auto isActive() const -> bool { return isActive_; }
     [[nodiscard]] auto userCategoryOverride() const -> const std::optional<TransactionCategory>& { return userCategoryOverride_; }
 
-    // Setters
-    auto setCategory(TransactionCategory category) -> void { category_ = category; }
-    auto setDescription(std::string description) -> void { description_ = std::move(description); }
-    auto setCounterpartyName(std::string name) -> void { counterpartyName_ = std::move(name); }
-    auto setCounterpartyIban(std::string iban) -> void { counterpartyIban_ = std::move(iban); }
-    auto setRawDescription(std::string raw) -> void { rawDescription_ = std::move(raw); }
-    auto setMutationCode(std::string code) -> void { mutationCode_ = std::move(code); }
+    // Label of the categorization rule that produced category() - a custom
+    // rule's pattern, "custom" for amount rules, or "built-in". Lets an
+    // incremental recategorize touch only rows whose rule changed.
+    [[nodiscard]] auto matchedRule() const -> const std::optional<std::string>& { return matchedRule_; }
+
+    // Real merchant behind an intermediary counterparty (PayPal charges
+    // carry it in the memo, if at all), extracted once at import.
+    // Categorization and recurrence grouping prefer this over re-parsing
+    // the memo.
+    [[nodiscard]] auto merchant() const -> const std::optional<InternedString>& { return merchant_; }
+
+    // Setters. Each one only marks the transaction dirty when the value
+    // actually changes, so bulk flows can re-apply state unconditionally and
+    // use isDirty() to skip the write for untouched rows.
+    auto setCategory(TransactionCategory category) -> void {
+        dirty_ |= category_ != category;
+        category_ = category;
+    }
+    auto setDescription(std::string description) -> void {
+        dirty_ |= description_ != description;
+        description_ = std::move(description);
+    }
+    auto setCounterpartyName(InternedString name) -> void {
+        dirty_ |= counterpartyName_ != name;
+        counterpartyName_ = std::move(name);
+    }
+    auto setCounterpartyIban(std::string iban) -> void {
+        dirty_ |= counterpartyIban_ != iban;
+        counterpartyIban_ = std::move(iban);
+    }
+    auto setRawDescription(std::string raw) -> void {
+        dirty_ |= rawDescription_ != raw;
+        rawDescription_ = std::move(raw);
+    }
+    auto setMutationCode(InternedString code) -> void {
+        dirty_ |= mutationCode_ != code;
+        mutationCode_ = std::move(code);
+    }
+    auto setMerchant(InternedString merchant) -> void {
+        dirty_ |= merchant_ != merchant;
+        merchant_ = std::move(merchant);
+    }
+    auto setMatchedRule(std::string rule) -> void {
+        dirty_ |= matchedRule_ != rule;
+        matchedRule_ = std::move(rule);
+    }
 
     // Recurring transaction setters
-    auto setRecurring(bool recurring) -> void { isRecurring_ = recurring; }
-    auto setFrequency(RecurrenceFrequency freq) -> void { frequency_ = freq; }
-    auto setActive(bool active) -> void { isActive_ = active; }
-    auto setUserCategoryOverride(TransactionCategory cat) -> void { userCategoryOverride_ = cat; }
-    auto clearUserCategoryOverride() -> void { userCategoryOverride_.reset(); }
+    auto setRecurring(bool recurring) -> void {
+        dirty_ |= isRecurring_ != recurring;
+        isRecurring_ = recurring;
+    }
+    auto setFrequency(RecurrenceFrequency freq) -> void {
+        dirty_ |= frequency_ != freq;
+        frequency_ = freq;
+    }
+    auto setActive(bool active) -> void {
+        dirty_ |= isActive_ != active;
+        isActive_ = active;
+    }
+    auto setUserCategoryOverride(TransactionCategory cat) -> void {
+        dirty_ |= userCategoryOverride_ != cat;
+        userCategoryOverride_ = cat;
+    }
+    auto clearUserCategoryOverride() -> void {
+        dirty_ |= userCategoryOverride_.has_value();
+        userCategoryOverride_.reset();
+    }
+
+    // Dirty-state tracking: true once any setter changed a stored value.
+    // Repositories call markClean() after hydrating so only real edits count.
+    [[nodiscard]] auto isDirty() const -> bool { return dirty_; }
+    auto markClean() -> void { dirty_ = false; }
 
     // Helper to check if this is an expense
     [[nodiscard]] auto isExpense() const -> bool {
@@ -187,19 +255,65 @@ private:
     TransactionType type_;
     TransactionCategory category_{TransactionCategory::Uncategorized};
     std::string description_;
-    std::optional<std::string> counterpartyName_;
+    std::optional<InternedString> counterpartyName_;
     std::optional<std::string> counterpartyIban_;
     std::string rawDescription_;
-    std::optional<std::string> mutationCode_;
+    std::optional<InternedString> mutationCode_;
 
     // Recurring transaction fields
     bool isRecurring_{false};
     RecurrenceFrequency frequency_{RecurrenceFrequency::None};
     bool isActive_{true};  // false = canceled subscription
     std::optional<TransactionCategory> userCategoryOverride_;
+    std::optional<std::string> matchedRule_;
+    std::optional<InternedString> merchant_;
+    bool dirty_{false};
 };
 
 // Repository interface
+// Packed projection of a transaction for analytics queries: date, signed
+// amount in cents and category only, so reports never hydrate the string
+// columns they immediately discard
+struct TransactionAmount {
+    Date date;
+    int64_t cents;
+    TransactionCategory category;
+};
+
+// Columnar (structure-of-arrays) variant of the analytics projection:
+// parallel arrays of epoch day, signed cents and category. Scans that
+// touch every row but only these fields walk contiguous memory instead of
+// striding over full Transaction objects.
+struct TransactionColumns {
+    std::vector<int64_t> epochDay;
+    std::vector<int64_t> cents;
+    std::vector<TransactionCategory> category;
+
+    [[nodiscard]] auto size() const -> size_t { return epochDay.size(); }
+};
+
+// Per-category totals for a date range, computed inside the database.
+// Income and expenses are summed separately since a category can see both
+// signs; expenseCents is a positive magnitude.
+struct CategoryAggregate {
+    TransactionCategory category;
+    int64_t incomeCents;
+    int64_t expenseCents;
+    int incomeCount;
+    int expenseCount;
+};
+
+// CategoryAggregate additionally grouped by calendar month (1-12) for
+// single-query yearly rollups
+struct MonthlyCategoryAggregate {
+    int month;
+    TransactionCategory category;
+    int64_t incomeCents;
+    int64_t expenseCents;
+    int incomeCount;
+    int expenseCount;
+};
+
 class TransactionRepository {
 public:
     virtual ~TransactionRepository() = default;
@@ -213,8 +327,75 @@ public:
     virtual auto findByCategory(TransactionCategory category)
         -> std::expected<std::vector<Transaction>, Error> = 0;
     virtual auto findAll() -> std::expected<std::vector<Transaction>, Error> = 0;
+
+    // Keyset pagination for listings: rows come newest-first, ordered by
+    // (date, id) descending so ties on date break stably. The cursor is the
+    // last row of the previous page; 'before' pages further into the past,
+    // 'after' back toward the present. LIMIT lives in the query, so a page
+    // costs O(page), not O(history).
+    struct PageCursor {
+        Date date;
+        TransactionId id;
+    };
+
+    virtual auto findPage(int limit, const std::optional<PageCursor>& before,
+                          const std::optional<PageCursor>& after)
+        -> std::expected<std::vector<Transaction>, Error> = 0;
+
+    /// Full-text search over description, counterparty and raw memo. The
+    /// query is plain words (each matched as a prefix, all required);
+    /// results come back newest-first, capped at limit.
+    virtual auto search(const std::string& query, int limit)
+        -> std::expected<std::vector<Transaction>, Error> = 0;
+
     virtual auto remove(const TransactionId& id) -> std::expected<void, Error> = 0;
     virtual auto update(const Transaction& transaction) -> std::expected<void, Error> = 0;
+
+    // Streaming variants: each hydrated row is passed to the visitor while
+    // the underlying cursor advances, so aggregations over large histories
+    // never materialize a full vector
+    using TransactionVisitor = std::function<void(const Transaction&)>;
+
+    // Predicates a cursor can push down into the backing query, so a
+    // filtered scan touches only the matching rows
+    struct Filter {
+        std::optional<Date> from;
+        std::optional<Date> to;
+        std::optional<TransactionCategory> category;
+    };
+
+    virtual auto forEach(const TransactionVisitor& visitor) -> std::expected<void, Error> = 0;
+    virtual auto forEachFiltered(const Filter& filter, const TransactionVisitor& visitor)
+        -> std::expected<void, Error> = 0;
+    virtual auto forEachInDateRange(Date from, Date to, const TransactionVisitor& visitor)
+        -> std::expected<void, Error> = 0;
+
+    // Column projection for analytics - fetches only date, amount and category
+    virtual auto findAmountsByDateRange(Date from, Date to)
+        -> std::expected<std::vector<TransactionAmount>, Error> = 0;
+
+    // Same projection in columnar form for cache-friendly full-range scans
+    virtual auto findColumnsByDateRange(Date from, Date to)
+        -> std::expected<TransactionColumns, Error> = 0;
+
+    // Aggregate pushdown: SUM/COUNT grouped inside the database, so summary
+    // reports never transfer per-row data at all
+    virtual auto aggregateByCategory(Date from, Date to)
+        -> std::expected<std::vector<CategoryAggregate>, Error> = 0;
+    virtual auto aggregateByMonthAndCategory(int year)
+        -> std::expected<std::vector<MonthlyCategoryAggregate>, Error> = 0;
+
+    // Data generation for caches: implementations bump it on every
+    // successful mutation, so a result tagged with the generation it was
+    // computed under stays valid exactly while the counter is unchanged.
+    // Decorators that delegate writes forward to the wrapped repository.
+    [[nodiscard]] virtual auto generation() const -> uint64_t { return generation_; }
+
+protected:
+    auto bumpGeneration() -> void { ++generation_; }
+
+private:
+    uint64_t generation_{0};
 };
 
 } // namespace ares::core
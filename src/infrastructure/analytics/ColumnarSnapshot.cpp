@@ -0,0 +1,178 @@
+#include "infrastructure/analytics/ColumnarSnapshot.hpp"
+#include <cstring>
+#include <fstream>
+
+namespace ares::infrastructure::analytics {
+
+namespace {
+
+constexpr uint64_t kAlignment = 8;
+
+auto alignUp(uint64_t offset) -> uint64_t {
+    return (offset + kAlignment - 1) & ~(kAlignment - 1);
+}
+
+// Zero padding keeps every section 8-byte aligned in the mapping, so the
+// typed spans never hit misaligned loads
+auto padTo(std::ofstream& out, uint64_t offset) -> void {
+    static constexpr char zeros[kAlignment] = {};
+    auto current = static_cast<uint64_t>(out.tellp());
+    if (current < offset) {
+        out.write(zeros, static_cast<std::streamsize>(offset - current));
+    }
+}
+
+template <typename T>
+auto writeColumn(std::ofstream& out, const std::vector<T>& column) -> void {
+    out.write(reinterpret_cast<const char*>(column.data()),
+              static_cast<std::streamsize>(column.size() * sizeof(T)));
+}
+
+} // namespace
+
+auto ColumnarSnapshotWriter::append(int32_t epochDay, int64_t amountCents, uint16_t category,
+                                    std::string_view counterparty) -> void {
+    epochDays_.push_back(epochDay);
+    amountCents_.push_back(amountCents);
+    categories_.push_back(category);
+
+    auto [it, inserted] = internIndex_.try_emplace(std::string{counterparty},
+                                                   static_cast<uint32_t>(strings_.size()));
+    if (inserted) {
+        strings_.emplace_back(counterparty);
+    }
+    counterpartyIdx_.push_back(it->second);
+}
+
+auto ColumnarSnapshotWriter::write(const std::filesystem::path& outputPath)
+    -> std::expected<void, core::Error>
+{
+    // String table: exclusive-end offsets delimit the concatenated bytes
+    std::vector<uint32_t> stringOffsets;
+    stringOffsets.reserve(strings_.size() + 1);
+    uint32_t cursor = 0;
+    stringOffsets.push_back(cursor);
+    for (const auto& s : strings_) {
+        cursor += static_cast<uint32_t>(s.size());
+        stringOffsets.push_back(cursor);
+    }
+
+    SnapshotHeader header{};
+    std::memcpy(header.magic, kSnapshotMagic.data(), kSnapshotMagic.size());
+    header.rowCount = epochDays_.size();
+    header.stringCount = strings_.size();
+
+    uint64_t offset = alignUp(sizeof(SnapshotHeader));
+    header.epochDayOffset = offset;
+    offset = alignUp(offset + header.rowCount * sizeof(int32_t));
+    header.amountCentsOffset = offset;
+    offset = alignUp(offset + header.rowCount * sizeof(int64_t));
+    header.categoryOffset = offset;
+    offset = alignUp(offset + header.rowCount * sizeof(uint16_t));
+    header.counterpartyIdxOffset = offset;
+    offset = alignUp(offset + header.rowCount * sizeof(uint32_t));
+    header.stringOffsetsOffset = offset;
+    offset = alignUp(offset + stringOffsets.size() * sizeof(uint32_t));
+    header.stringBytesOffset = offset;
+    header.fileSize = offset + cursor;
+
+    std::ofstream out{outputPath, std::ios::binary | std::ios::trunc};
+    if (!out.is_open()) {
+        return std::unexpected(core::IoError{outputPath.string(),
+                                             "Failed to open snapshot file for writing"});
+    }
+
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    padTo(out, header.epochDayOffset);
+    writeColumn(out, epochDays_);
+    padTo(out, header.amountCentsOffset);
+    writeColumn(out, amountCents_);
+    padTo(out, header.categoryOffset);
+    writeColumn(out, categories_);
+    padTo(out, header.counterpartyIdxOffset);
+    writeColumn(out, counterpartyIdx_);
+    padTo(out, header.stringOffsetsOffset);
+    writeColumn(out, stringOffsets);
+    padTo(out, header.stringBytesOffset);
+    for (const auto& s : strings_) {
+        out.write(s.data(), static_cast<std::streamsize>(s.size()));
+    }
+
+    out.flush();
+    if (!out.good()) {
+        return std::unexpected(core::IoError{outputPath.string(),
+                                             "Failed to write snapshot file"});
+    }
+    return {};
+}
+
+auto ColumnarSnapshotView::open(const std::filesystem::path& snapshotPath)
+    -> std::expected<ColumnarSnapshotView, core::Error>
+{
+    auto mapped = import::MappedFile::open(snapshotPath);
+    if (!mapped) {
+        return std::unexpected(mapped.error());
+    }
+
+    if (mapped->size() < sizeof(SnapshotHeader)) {
+        return std::unexpected(core::IoError{snapshotPath.string(),
+                                             "Snapshot file too small for header"});
+    }
+    const auto* header = reinterpret_cast<const SnapshotHeader*>(mapped->view().data());
+    if (std::string_view{header->magic, kSnapshotMagic.size()} != kSnapshotMagic) {
+        return std::unexpected(core::IoError{snapshotPath.string(),
+                                             "Not a columnar snapshot (bad magic)"});
+    }
+    if (header->fileSize != mapped->size()) {
+        return std::unexpected(core::IoError{snapshotPath.string(),
+                                             "Snapshot file truncated"});
+    }
+
+    return ColumnarSnapshotView{std::move(*mapped)};
+}
+
+auto ColumnarSnapshotView::header() const -> const SnapshotHeader& {
+    return *reinterpret_cast<const SnapshotHeader*>(file_.view().data());
+}
+
+auto ColumnarSnapshotView::rowCount() const -> std::size_t {
+    return header().rowCount;
+}
+
+auto ColumnarSnapshotView::epochDays() const -> std::span<const int32_t> {
+    const auto& h = header();
+    return {reinterpret_cast<const int32_t*>(file_.view().data() + h.epochDayOffset),
+            h.rowCount};
+}
+
+auto ColumnarSnapshotView::amountCents() const -> std::span<const int64_t> {
+    const auto& h = header();
+    return {reinterpret_cast<const int64_t*>(file_.view().data() + h.amountCentsOffset),
+            h.rowCount};
+}
+
+auto ColumnarSnapshotView::categories() const -> std::span<const uint16_t> {
+    const auto& h = header();
+    return {reinterpret_cast<const uint16_t*>(file_.view().data() + h.categoryOffset),
+            h.rowCount};
+}
+
+auto ColumnarSnapshotView::counterpartyIdx() const -> std::span<const uint32_t> {
+    const auto& h = header();
+    return {reinterpret_cast<const uint32_t*>(file_.view().data() + h.counterpartyIdxOffset),
+            h.rowCount};
+}
+
+auto ColumnarSnapshotView::counterpartyCount() const -> std::size_t {
+    return header().stringCount;
+}
+
+auto ColumnarSnapshotView::counterparty(uint32_t index) const -> std::string_view {
+    const auto& h = header();
+    const auto* offsets =
+        reinterpret_cast<const uint32_t*>(file_.view().data() + h.stringOffsetsOffset);
+    const char* bytes = file_.view().data() + h.stringBytesOffset;
+    return {bytes + offsets[index], offsets[index + 1] - offsets[index]};
+}
+
+} // namespace ares::infrastructure::analytics
@@ -0,0 +1,141 @@
+#include "infrastructure/compression/Gzip.hpp"
+#include <array>
+#include <fstream>
+#include <fmt/format.h>
+#include <zlib.h>
+
+namespace ares::infrastructure::compression {
+
+namespace {
+
+// Chunk size for the streaming copy loops; large enough to amortize the
+// per-call overhead, small enough to keep the footprint constant
+constexpr std::size_t kChunkBytes = 64 * 1024;
+
+} // namespace
+
+auto isGzipFile(const std::filesystem::path& path) -> bool {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    std::array<unsigned char, 2> magic{};
+    file.read(reinterpret_cast<char*>(magic.data()), 2);
+    return file.gcount() == 2 && magic[0] == 0x1f && magic[1] == 0x8b;
+}
+
+auto compressFile(const std::filesystem::path& source, const std::filesystem::path& dest)
+    -> std::expected<void, core::Error>
+{
+    std::ifstream in(source, std::ios::binary);
+    if (!in.is_open()) {
+        return std::unexpected(core::IoError{source.string(), "cannot open file for compression"});
+    }
+
+    auto writer = GzipWriter::open(dest);
+    if (!writer) {
+        return std::unexpected(writer.error());
+    }
+
+    std::array<char, kChunkBytes> buffer{};
+    while (in.read(buffer.data(), static_cast<std::streamsize>(buffer.size())),
+           in.gcount() > 0) {
+        auto written = writer->write({buffer.data(), static_cast<std::size_t>(in.gcount())});
+        if (!written) {
+            return std::unexpected(written.error());
+        }
+    }
+    return writer->close();
+}
+
+auto decompressFile(const std::filesystem::path& source, const std::filesystem::path& dest)
+    -> std::expected<void, core::Error>
+{
+    gzFile in = gzopen(source.c_str(), "rb");
+    if (!in) {
+        return std::unexpected(core::IoError{source.string(), "cannot open file for decompression"});
+    }
+
+    std::ofstream out(dest, std::ios::binary);
+    if (!out.is_open()) {
+        gzclose(in);
+        return std::unexpected(core::IoError{dest.string(), "cannot open file for writing"});
+    }
+
+    std::array<char, kChunkBytes> buffer{};
+    int bytesRead = 0;
+    while ((bytesRead = gzread(in, buffer.data(), static_cast<unsigned>(buffer.size()))) > 0) {
+        out.write(buffer.data(), bytesRead);
+    }
+
+    bool readFailed = bytesRead < 0;
+    gzclose(in);
+    if (readFailed) {
+        return std::unexpected(core::IoError{source.string(), "corrupt gzip stream"});
+    }
+    if (!out.good()) {
+        return std::unexpected(core::IoError{dest.string(), "failed to write decompressed file"});
+    }
+    return {};
+}
+
+auto GzipWriter::open(const std::filesystem::path& path)
+    -> std::expected<GzipWriter, core::Error>
+{
+    gzFile file = gzopen(path.c_str(), "wb");
+    if (!file) {
+        return std::unexpected(core::IoError{path.string(), "cannot open gzip file for writing"});
+    }
+    return GzipWriter{file, path};
+}
+
+GzipWriter::GzipWriter(GzipWriter&& other) noexcept
+    : file_{other.file_}, path_{std::move(other.path_)}
+{
+    other.file_ = nullptr;
+}
+
+auto GzipWriter::operator=(GzipWriter&& other) noexcept -> GzipWriter& {
+    if (this != &other) {
+        if (file_) {
+            gzclose(static_cast<gzFile>(file_));
+        }
+        file_ = other.file_;
+        path_ = std::move(other.path_);
+        other.file_ = nullptr;
+    }
+    return *this;
+}
+
+GzipWriter::~GzipWriter() {
+    if (file_) {
+        gzclose(static_cast<gzFile>(file_));
+    }
+}
+
+auto GzipWriter::write(std::string_view data) -> std::expected<void, core::Error> {
+    if (data.empty()) {
+        return {};
+    }
+    auto written = gzwrite(static_cast<gzFile>(file_), data.data(),
+                           static_cast<unsigned>(data.size()));
+    if (written <= 0 || static_cast<std::size_t>(written) != data.size()) {
+        return std::unexpected(core::IoError{path_.string(), "gzip write failed"});
+    }
+    return {};
+}
+
+auto GzipWriter::close() -> std::expected<void, core::Error> {
+    if (!file_) {
+        return {};
+    }
+    auto rc = gzclose(static_cast<gzFile>(file_));
+    file_ = nullptr;
+    if (rc != Z_OK) {
+        return std::unexpected(core::IoError{path_.string(),
+            fmt::format("gzip close failed (zlib error {})", rc)});
+    }
+    return {};
+}
+
+} // namespace ares::infrastructure::compression
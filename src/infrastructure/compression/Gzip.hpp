@@ -0,0 +1,56 @@
+#pragma once
+
+#include <expected>
+#include <filesystem>
+#include <string_view>
+#include "core/common/Error.hpp"
+
+namespace ares::infrastructure::compression {
+
+// Streaming gzip stage over zlib's gzFile API. Exports and backups are
+// highly compressible (SQLite pages, repetitive ING memos compress 5-10x),
+// so writing them compressed cuts both storage and the I/O time of pushing
+// them to slow backup targets. zlib is the format choice because it ships
+// everywhere SQLite does; the callers only see this module.
+
+// True when the file starts with the gzip magic bytes
+[[nodiscard]] auto isGzipFile(const std::filesystem::path& path) -> bool;
+
+// Compress source into dest in fixed-size chunks; memory stays constant
+// regardless of file size
+[[nodiscard]] auto compressFile(const std::filesystem::path& source,
+                                const std::filesystem::path& dest)
+    -> std::expected<void, core::Error>;
+
+// Inverse of compressFile. Also accepts an uncompressed source, which is
+// copied through unchanged (zlib reads plain files transparently).
+[[nodiscard]] auto decompressFile(const std::filesystem::path& source,
+                                  const std::filesystem::path& dest)
+    -> std::expected<void, core::Error>;
+
+// Incremental writer for producers that format output in chunks, like the
+// streaming export. Move-only; close() finalizes the gzip trailer and must
+// be checked before the output is trusted.
+class GzipWriter {
+public:
+    [[nodiscard]] static auto open(const std::filesystem::path& path)
+        -> std::expected<GzipWriter, core::Error>;
+
+    GzipWriter(GzipWriter&& other) noexcept;
+    auto operator=(GzipWriter&& other) noexcept -> GzipWriter&;
+    GzipWriter(const GzipWriter&) = delete;
+    auto operator=(const GzipWriter&) -> GzipWriter& = delete;
+    ~GzipWriter();
+
+    [[nodiscard]] auto write(std::string_view data) -> std::expected<void, core::Error>;
+    [[nodiscard]] auto close() -> std::expected<void, core::Error>;
+
+private:
+    explicit GzipWriter(void* file, std::filesystem::path path)
+        : file_{file}, path_{std::move(path)} {}
+
+    void* file_{nullptr};  // gzFile; kept opaque so zlib.h stays out of the header
+    std::filesystem::path path_;
+};
+
+} // namespace ares::infrastructure::compression
@@ -0,0 +1,400 @@
+#include "infrastructure/config/ConfigCache.hpp"
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+namespace ares::infrastructure::config {
+
+namespace {
+
+constexpr std::uint32_t kMagic = 0x47464341;  // "ACFG"
+// Bump whenever the serialized layout or any stored enum changes; an
+// unknown version is just a cache miss
+constexpr std::uint32_t kVersion = 1;
+
+auto fnv1a(std::string_view data) -> std::uint64_t {
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (unsigned char c : data) {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+auto readFile(const std::filesystem::path& path) -> std::optional<std::string> {
+    std::ifstream file{path, std::ios::binary};
+    if (!file) {
+        return std::nullopt;
+    }
+    return std::string{std::istreambuf_iterator<char>{file},
+                       std::istreambuf_iterator<char>{}};
+}
+
+// Fingerprint of the config file the cache was built from. Path, size
+// and mtime catch the common cases; the content hash catches editors
+// that preserve timestamps and restored backups.
+struct Fingerprint {
+    std::string path;
+    std::uint64_t size{0};
+    std::int64_t mtime{0};
+    std::uint64_t contentHash{0};
+};
+
+auto fingerprint(const std::filesystem::path& configPath)
+    -> std::optional<Fingerprint>
+{
+    std::error_code ec;
+    auto size = std::filesystem::file_size(configPath, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    auto mtime = std::filesystem::last_write_time(configPath, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    auto content = readFile(configPath);
+    if (!content) {
+        return std::nullopt;
+    }
+    return Fingerprint{
+        .path = std::filesystem::absolute(configPath, ec).string(),
+        .size = size,
+        .mtime = mtime.time_since_epoch().count(),
+        .contentHash = fnv1a(*content)
+    };
+}
+
+// Append-only writer over a byte buffer. The cache lives on one machine,
+// so values are stored in host byte order.
+struct Writer {
+    std::string out;
+
+    auto put32(std::uint32_t value) -> void {
+        out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+    auto put64(std::uint64_t value) -> void {
+        out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+    auto putI64(std::int64_t value) -> void {
+        out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+    auto putDouble(double value) -> void {
+        out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+    auto putString(std::string_view value) -> void {
+        put32(static_cast<std::uint32_t>(value.size()));
+        out.append(value);
+    }
+    auto putOptI64(const std::optional<std::int64_t>& value) -> void {
+        put32(value.has_value() ? 1 : 0);
+        putI64(value.value_or(0));
+    }
+};
+
+// Bounds-checked reader; any overrun sets ok=false and the caller
+// treats the whole cache as a miss
+struct Reader {
+    std::string_view data;
+    std::size_t pos{0};
+    bool ok{true};
+
+    auto take(void* dest, std::size_t size) -> void {
+        if (!ok || data.size() - pos < size) {
+            ok = false;
+            return;
+        }
+        std::memcpy(dest, data.data() + pos, size);
+        pos += size;
+    }
+    auto get32() -> std::uint32_t {
+        std::uint32_t value{0};
+        take(&value, sizeof(value));
+        return value;
+    }
+    auto get64() -> std::uint64_t {
+        std::uint64_t value{0};
+        take(&value, sizeof(value));
+        return value;
+    }
+    auto getI64() -> std::int64_t {
+        std::int64_t value{0};
+        take(&value, sizeof(value));
+        return value;
+    }
+    auto getDouble() -> double {
+        double value{0};
+        take(&value, sizeof(value));
+        return value;
+    }
+    auto getString() -> std::string {
+        auto size = get32();
+        if (!ok || data.size() - pos < size) {
+            ok = false;
+            return {};
+        }
+        std::string value{data.substr(pos, size)};
+        pos += size;
+        return value;
+    }
+    auto getOptI64() -> std::optional<std::int64_t> {
+        auto has = get32();
+        auto value = getI64();
+        if (has == 0) {
+            return std::nullopt;
+        }
+        return value;
+    }
+};
+
+auto serialize(const Fingerprint& fp, const UserConfig& config) -> std::string {
+    Writer w;
+    w.put32(kMagic);
+    w.put32(kVersion);
+    w.putString(fp.path);
+    w.put64(fp.size);
+    w.putI64(fp.mtime);
+    w.put64(fp.contentHash);
+
+    w.put32(static_cast<std::uint32_t>(config.categorizationRules.size()));
+    for (const auto& rule : config.categorizationRules) {
+        w.putString(rule.pattern);
+        w.put32(static_cast<std::uint32_t>(rule.category));
+        w.putOptI64(rule.amountCents);
+    }
+
+    w.put32(static_cast<std::uint32_t>(config.income.size()));
+    for (const auto& item : config.income) {
+        w.putString(item.name);
+        w.putI64(item.amount.cents());
+        w.put32(static_cast<std::uint32_t>(item.frequency));
+        w.putOptI64(item.category
+            ? std::optional<std::int64_t>{static_cast<std::int64_t>(*item.category)}
+            : std::nullopt);
+    }
+
+    w.put32(static_cast<std::uint32_t>(config.expenses.size()));
+    for (const auto& item : config.expenses) {
+        w.putString(item.name);
+        w.putI64(item.amount.cents());
+        w.put32(static_cast<std::uint32_t>(item.frequency));
+        w.putOptI64(item.category
+            ? std::optional<std::int64_t>{static_cast<std::int64_t>(*item.category)}
+            : std::nullopt);
+    }
+
+    w.put32(static_cast<std::uint32_t>(config.credits.size()));
+    for (const auto& item : config.credits) {
+        w.putString(item.name);
+        w.put32(static_cast<std::uint32_t>(item.type));
+        w.putI64(item.balance.cents());
+        w.putDouble(item.interestRate);
+        w.putI64(item.minimumPayment.cents());
+        w.putOptI64(item.originalAmount
+            ? std::optional<std::int64_t>{item.originalAmount->cents()}
+            : std::nullopt);
+    }
+
+    w.put32(static_cast<std::uint32_t>(config.accounts.size()));
+    for (const auto& item : config.accounts) {
+        w.putString(item.name);
+        w.put32(static_cast<std::uint32_t>(item.type));
+        w.put32(static_cast<std::uint32_t>(item.bank));
+        w.putOptI64(item.balance
+            ? std::optional<std::int64_t>{item.balance->cents()}
+            : std::nullopt);
+    }
+
+    w.put32(static_cast<std::uint32_t>(config.budgets.size()));
+    for (const auto& item : config.budgets) {
+        w.put32(static_cast<std::uint32_t>(item.category));
+        w.putI64(item.limit.cents());
+    }
+
+    w.put32(static_cast<std::uint32_t>(config.importFormats.size()));
+    for (const auto& item : config.importFormats) {
+        w.putString(item.name);
+        w.put32(static_cast<std::uint32_t>(static_cast<unsigned char>(item.separator)));
+        w.put32(static_cast<std::uint32_t>(item.dateCol));
+        w.put32(static_cast<std::uint32_t>(item.amountCol));
+        w.put32(static_cast<std::uint32_t>(item.descriptionCol));
+        w.put32(static_cast<std::uint32_t>(item.counterpartyCol));
+        w.putString(item.dateFormat);
+        w.putString(item.amountFormat);
+        w.put32(static_cast<std::uint32_t>(item.skipRows));
+    }
+
+    return std::move(w.out);
+}
+
+auto deserialize(Reader& r) -> std::optional<UserConfig> {
+    UserConfig config;
+
+    auto ruleCount = r.get32();
+    for (std::uint32_t i = 0; r.ok && i < ruleCount; ++i) {
+        CategorizationRule rule;
+        rule.pattern = r.getString();
+        rule.category = static_cast<core::TransactionCategory>(r.get32());
+        rule.amountCents = r.getOptI64();
+        config.categorizationRules.push_back(std::move(rule));
+    }
+
+    auto incomeCount = r.get32();
+    for (std::uint32_t i = 0; r.ok && i < incomeCount; ++i) {
+        ConfiguredIncome item;
+        item.name = r.getString();
+        item.amount = core::Money{r.getI64()};
+        item.frequency = static_cast<core::RecurrenceFrequency>(r.get32());
+        if (auto cat = r.getOptI64()) {
+            item.category = static_cast<core::TransactionCategory>(*cat);
+        }
+        config.income.push_back(std::move(item));
+    }
+
+    auto expenseCount = r.get32();
+    for (std::uint32_t i = 0; r.ok && i < expenseCount; ++i) {
+        ConfiguredExpense item;
+        item.name = r.getString();
+        item.amount = core::Money{r.getI64()};
+        item.frequency = static_cast<core::RecurrenceFrequency>(r.get32());
+        if (auto cat = r.getOptI64()) {
+            item.category = static_cast<core::TransactionCategory>(*cat);
+        }
+        config.expenses.push_back(std::move(item));
+    }
+
+    auto creditCount = r.get32();
+    for (std::uint32_t i = 0; r.ok && i < creditCount; ++i) {
+        ConfiguredCredit item;
+        item.name = r.getString();
+        item.type = static_cast<core::CreditType>(r.get32());
+        item.balance = core::Money{r.getI64()};
+        item.interestRate = r.getDouble();
+        item.minimumPayment = core::Money{r.getI64()};
+        if (auto original = r.getOptI64()) {
+            item.originalAmount = core::Money{*original};
+        }
+        config.credits.push_back(std::move(item));
+    }
+
+    auto accountCount = r.get32();
+    for (std::uint32_t i = 0; r.ok && i < accountCount; ++i) {
+        ConfiguredAccount item;
+        item.name = r.getString();
+        item.type = static_cast<core::AccountType>(r.get32());
+        item.bank = static_cast<core::BankIdentifier>(r.get32());
+        if (auto balance = r.getOptI64()) {
+            item.balance = core::Money{*balance};
+        }
+        config.accounts.push_back(std::move(item));
+    }
+
+    auto budgetCount = r.get32();
+    for (std::uint32_t i = 0; r.ok && i < budgetCount; ++i) {
+        auto category = static_cast<core::TransactionCategory>(r.get32());
+        auto limit = core::Money{r.getI64()};
+        config.budgets.push_back(CategoryBudget{category, limit});
+    }
+
+    auto formatCount = r.get32();
+    for (std::uint32_t i = 0; r.ok && i < formatCount; ++i) {
+        ConfiguredImportFormat item;
+        item.name = r.getString();
+        item.separator = static_cast<char>(r.get32());
+        item.dateCol = static_cast<int>(r.get32());
+        item.amountCol = static_cast<int>(r.get32());
+        item.descriptionCol = static_cast<int>(r.get32());
+        item.counterpartyCol = static_cast<int>(r.get32());
+        item.dateFormat = r.getString();
+        item.amountFormat = r.getString();
+        item.skipRows = static_cast<int>(r.get32());
+        config.importFormats.push_back(std::move(item));
+    }
+
+    if (!r.ok || r.pos != r.data.size()) {
+        return std::nullopt;
+    }
+    return config;
+}
+
+} // anonymous namespace
+
+auto ConfigCache::cachePath() -> std::filesystem::path {
+    if (const auto* xdg = std::getenv("XDG_CACHE_HOME"); xdg && *xdg != '\0') {
+        return std::filesystem::path{xdg} / "ares" / "config.bin";
+    }
+    if (const auto* home = std::getenv("HOME"); home && *home != '\0') {
+        return std::filesystem::path{home} / ".cache" / "ares" / "config.bin";
+    }
+    return std::filesystem::path{".ares-config.bin"};
+}
+
+auto ConfigCache::load(const std::filesystem::path& configPath)
+    -> std::optional<UserConfig>
+{
+    auto fp = fingerprint(configPath);
+    if (!fp) {
+        return std::nullopt;
+    }
+
+    auto cached = readFile(cachePath());
+    if (!cached) {
+        return std::nullopt;
+    }
+
+    Reader r{.data = *cached};
+    if (r.get32() != kMagic || r.get32() != kVersion) {
+        return std::nullopt;
+    }
+    if (r.getString() != fp->path ||
+        r.get64() != fp->size ||
+        r.getI64() != fp->mtime ||
+        r.get64() != fp->contentHash ||
+        !r.ok) {
+        return std::nullopt;
+    }
+
+    return deserialize(r);
+}
+
+auto ConfigCache::store(const std::filesystem::path& configPath,
+                        const UserConfig& config) -> void
+{
+    auto fp = fingerprint(configPath);
+    if (!fp) {
+        return;
+    }
+
+    auto path = cachePath();
+    std::error_code ec;
+    std::filesystem::create_directories(path.parent_path(), ec);
+    if (ec) {
+        return;
+    }
+
+    // Write to a sibling temp file and rename so a concurrent reader
+    // never sees a half-written cache
+    auto tempPath = path;
+    tempPath += ".tmp";
+    {
+        std::ofstream file{tempPath, std::ios::binary | std::ios::trunc};
+        if (!file) {
+            return;
+        }
+        auto buffer = serialize(*fp, config);
+        file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        if (!file) {
+            std::filesystem::remove(tempPath, ec);
+            return;
+        }
+    }
+    std::filesystem::rename(tempPath, path, ec);
+    if (ec) {
+        std::filesystem::remove(tempPath, ec);
+    }
+}
+
+} // namespace ares::infrastructure::config
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <filesystem>
+#include <optional>
+#include "infrastructure/config/ConfigParser.hpp"
+
+namespace ares::infrastructure::config {
+
+// Binary cache of a parsed config (~/.cache/ares/config.bin). The config
+// file changes rarely but is read on every invocation, so ConfigService
+// consults the cache first and only falls back to the YAML parser on a
+// miss. Validation is a header check against the config's absolute path,
+// size, mtime and content hash; any mismatch, short read or unknown
+// format version simply reports a miss and the caller reparses (and
+// re-stores). The cache is strictly a read-through copy - it is never
+// the source of truth, and failures to write it are ignored.
+class ConfigCache {
+public:
+    // Returns the cached config if the cache exists and still matches
+    // the file at configPath; nullopt on any mismatch or read problem
+    [[nodiscard]] static auto load(const std::filesystem::path& configPath)
+        -> std::optional<UserConfig>;
+
+    // Best-effort store of a freshly parsed config; failures are silent
+    static auto store(const std::filesystem::path& configPath,
+                      const UserConfig& config) -> void;
+
+    // Cache file location ($XDG_CACHE_HOME/ares/config.bin, falling back
+    // to ~/.cache/ares/config.bin)
+    [[nodiscard]] static auto cachePath() -> std::filesystem::path;
+};
+
+} // namespace ares::infrastructure::config
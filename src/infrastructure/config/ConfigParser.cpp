@@ -1,20 +1,22 @@
 #include "infrastructure/config/ConfigParser.hpp"
 #include "infrastructure/config/ConfigUtils.hpp"
 #include <algorithm>
+#include <charconv>
 #include <fstream>
 #include <sstream>
 #include <cctype>
 #include <fmt/format.h>
+#include "core/common/TextNormalize.hpp"
 
 namespace ares::infrastructure::config {
 
 namespace {
 
-auto trim(std::string_view str) -> std::string {
+auto trim(std::string_view str) -> std::string_view {
     auto start = str.find_first_not_of(" \t\r\n");
-    if (start == std::string_view::npos) return "";
+    if (start == std::string_view::npos) return {};
     auto end = str.find_last_not_of(" \t\r\n");
-    return std::string{str.substr(start, end - start + 1)};
+    return str.substr(start, end - start + 1);
 }
 
 auto toLower(std::string_view str) -> std::string {
@@ -24,6 +26,24 @@ auto toLower(std::string_view str) -> std::string {
     return result;
 }
 
+// Case-insensitive comparison against keywords without materializing a
+// lowercased copy; toLower above remains for values that are stored
+auto equalsIgnoreCase(std::string_view a, std::string_view b) -> bool {
+    return a.size() == b.size() &&
+           std::equal(a.begin(), a.end(), b.begin(), [](unsigned char x, unsigned char y) {
+               return std::tolower(x) == std::tolower(y);
+           });
+}
+
+auto parseInt(std::string_view str) -> std::optional<int> {
+    int value = 0;
+    auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), value);
+    if (ec != std::errc{} || ptr != str.data() + str.size()) {
+        return std::nullopt;
+    }
+    return value;
+}
+
 } // anonymous namespace
 
 auto ConfigParser::parse(const std::filesystem::path& path)
@@ -46,17 +66,28 @@ auto ConfigParser::parse(const std::filesystem::path& path)
 auto ConfigParser::parse(std::string_view content)
     -> std::expected<UserConfig, core::Error>
 {
+    // Single pass over the caller's buffer: every line, token and keyword
+    // below is a string_view into `content`, so parsing a config with
+    // hundreds of categorization rules allocates only for the fields that
+    // end up stored in the UserConfig
     UserConfig config;
-    std::istringstream stream{std::string{content}};
-    std::string line;
+    std::size_t pos = 0;
     int lineNumber = 0;
 
-    while (std::getline(stream, line)) {
+    while (pos <= content.size()) {
+        auto newline = content.find('\n', pos);
+        auto line = newline == std::string_view::npos
+            ? content.substr(pos)
+            : content.substr(pos, newline - pos);
         ++lineNumber;
         auto result = parseLine(line, line, lineNumber, config);
         if (!result) {
             return std::unexpected(result.error());
         }
+        if (newline == std::string_view::npos) {
+            break;
+        }
+        pos = newline + 1;
     }
 
     return config;
@@ -65,7 +96,7 @@ auto ConfigParser::parse(std::string_view content)
 auto ConfigParser::parseLine(std::string_view line, std::string_view rawLine, int lineNumber, UserConfig& config)
     -> std::expected<void, core::ParseError>
 {
-    std::string trimmedLine = trim(line);
+    std::string_view trimmedLine = trim(line);
 
     // Skip empty lines and comments
     if (trimmedLine.empty() || trimmedLine[0] == '#') {
@@ -74,7 +105,7 @@ auto ConfigParser::parseLine(std::string_view line, std::string_view rawLine, in
 
     // Determine line type by first word
     auto firstSpace = trimmedLine.find(' ');
-    if (firstSpace == std::string::npos) {
+    if (firstSpace == std::string_view::npos) {
         return std::unexpected(core::ParseError{
             .message = "Invalid line format - expected command followed by arguments",
             .line = lineNumber,
@@ -82,40 +113,40 @@ auto ConfigParser::parseLine(std::string_view line, std::string_view rawLine, in
         });
     }
 
-    std::string command = toLower(trimmedLine.substr(0, firstSpace));
-    std::string_view rest = std::string_view{trimmedLine}.substr(firstSpace + 1);
+    std::string_view command = trimmedLine.substr(0, firstSpace);
+    std::string_view rest = trimmedLine.substr(firstSpace + 1);
 
-    if (command == "import-format") {
+    if (equalsIgnoreCase(command, "import-format")) {
         auto result = parseImportFormatLine(rest, rawLine, lineNumber);
         if (!result) return std::unexpected(result.error());
         config.importFormats.push_back(std::move(*result));
     }
-    else if (command == "categorize") {
+    else if (equalsIgnoreCase(command, "categorize")) {
         auto result = parseCategorizeLine(rest, rawLine, lineNumber);
         if (!result) return std::unexpected(result.error());
         config.categorizationRules.push_back(std::move(*result));
     }
-    else if (command == "income") {
+    else if (equalsIgnoreCase(command, "income")) {
         auto result = parseIncomeLine(rest, rawLine, lineNumber);
         if (!result) return std::unexpected(result.error());
         config.income.push_back(std::move(*result));
     }
-    else if (command == "expense") {
+    else if (equalsIgnoreCase(command, "expense")) {
         auto result = parseExpenseLine(rest, rawLine, lineNumber);
         if (!result) return std::unexpected(result.error());
         config.expenses.push_back(std::move(*result));
     }
-    else if (command == "credit") {
+    else if (equalsIgnoreCase(command, "credit")) {
         auto result = parseCreditLine(rest, rawLine, lineNumber);
         if (!result) return std::unexpected(result.error());
         config.credits.push_back(std::move(*result));
     }
-    else if (command == "account") {
+    else if (equalsIgnoreCase(command, "account")) {
         auto result = parseAccountLine(rest, rawLine, lineNumber);
         if (!result) return std::unexpected(result.error());
         config.accounts.push_back(std::move(*result));
     }
-    else if (command == "budget") {
+    else if (equalsIgnoreCase(command, "budget")) {
         auto result = parseBudgetLine(rest, rawLine, lineNumber);
         if (!result) return std::unexpected(result.error());
         config.budgets.push_back(std::move(*result));
@@ -147,7 +178,7 @@ auto ConfigParser::parseCategorizeLine(std::string_view line, std::string_view r
     // Find "as" keyword
     size_t asIndex = 0;
     for (size_t i = 0; i < tokens.size(); ++i) {
-        if (toLower(tokens[i]) == "as") {
+        if (equalsIgnoreCase(tokens[i], "as")) {
             asIndex = i;
             break;
         }
@@ -221,7 +252,7 @@ auto ConfigParser::parseIncomeLine(std::string_view line, std::string_view rawLi
         });
     }
 
-    std::string name = tokens[0];
+    std::string name{tokens[0]};
     auto amount = parseAmount(tokens[1]);
     if (!amount) {
         return std::unexpected(core::ParseError{
@@ -266,7 +297,7 @@ auto ConfigParser::parseExpenseLine(std::string_view line, std::string_view rawL
         });
     }
 
-    std::string name = tokens[0];
+    std::string name{tokens[0]};
     auto amount = parseAmount(tokens[1]);
     if (!amount) {
         return std::unexpected(core::ParseError{
@@ -311,7 +342,7 @@ auto ConfigParser::parseCreditLine(std::string_view line, std::string_view rawLi
         });
     }
 
-    std::string name = tokens[0];
+    std::string name{tokens[0]};
 
     auto type = parseCreditType(tokens[1]);
     if (!type) {
@@ -332,9 +363,8 @@ auto ConfigParser::parseCreditLine(std::string_view line, std::string_view rawLi
     }
 
     double rate = 0;
-    try {
-        rate = std::stod(tokens[3]);
-    } catch (...) {
+    auto [ratePtr, rateEc] = std::from_chars(tokens[3].data(), tokens[3].data() + tokens[3].size(), rate);
+    if (rateEc != std::errc{} || ratePtr != tokens[3].data() + tokens[3].size()) {
         return std::unexpected(core::ParseError{
             .message = fmt::format("Invalid interest rate: '{}'", tokens[3]),
             .line = lineNumber,
@@ -379,7 +409,7 @@ auto ConfigParser::parseAccountLine(std::string_view line, std::string_view rawL
         });
     }
 
-    std::string name = tokens[0];
+    std::string name{tokens[0]};
 
     auto type = parseAccountType(tokens[1]);
     if (!type) {
@@ -470,7 +500,7 @@ auto ConfigParser::parseImportFormatLine(std::string_view line, std::string_view
     }
 
     ConfiguredImportFormat format;
-    format.name = tokens[0];
+    format.name = std::string{tokens[0]};
 
     for (size_t i = 1; i < tokens.size(); ++i) {
         auto eqPos = tokens[i].find('=');
@@ -482,54 +512,58 @@ auto ConfigParser::parseImportFormatLine(std::string_view line, std::string_view
             });
         }
 
-        auto key = toLower(tokens[i].substr(0, eqPos));
+        auto key = tokens[i].substr(0, eqPos);
         auto value = tokens[i].substr(eqPos + 1);
 
-        if (key == "separator") {
+        if (equalsIgnoreCase(key, "separator")) {
             if (value == "\\t" || value == "tab") {
                 format.separator = '\t';
             } else if (!value.empty()) {
                 format.separator = value[0];
             }
-        } else if (key == "date-col") {
-            try { format.dateCol = std::stoi(value); }
-            catch (...) {
+        } else if (equalsIgnoreCase(key, "date-col")) {
+            auto parsed = parseInt(value);
+            if (!parsed) {
                 return std::unexpected(core::ParseError{
                     .message = fmt::format("Invalid date-col value: '{}'", value),
                     .line = lineNumber,
                     .sourceLine = std::string{rawLine}
                 });
             }
-        } else if (key == "amount-col") {
-            try { format.amountCol = std::stoi(value); }
-            catch (...) {
+            format.dateCol = *parsed;
+        } else if (equalsIgnoreCase(key, "amount-col")) {
+            auto parsed = parseInt(value);
+            if (!parsed) {
                 return std::unexpected(core::ParseError{
                     .message = fmt::format("Invalid amount-col value: '{}'", value),
                     .line = lineNumber,
                     .sourceLine = std::string{rawLine}
                 });
             }
-        } else if (key == "description-col") {
-            try { format.descriptionCol = std::stoi(value); }
-            catch (...) {
+            format.amountCol = *parsed;
+        } else if (equalsIgnoreCase(key, "description-col")) {
+            auto parsed = parseInt(value);
+            if (!parsed) {
                 return std::unexpected(core::ParseError{
                     .message = fmt::format("Invalid description-col value: '{}'", value),
                     .line = lineNumber,
                     .sourceLine = std::string{rawLine}
                 });
             }
-        } else if (key == "counterparty-col") {
-            try { format.counterpartyCol = std::stoi(value); }
-            catch (...) {
+            format.descriptionCol = *parsed;
+        } else if (equalsIgnoreCase(key, "counterparty-col")) {
+            auto parsed = parseInt(value);
+            if (!parsed) {
                 return std::unexpected(core::ParseError{
                     .message = fmt::format("Invalid counterparty-col value: '{}'", value),
                     .line = lineNumber,
                     .sourceLine = std::string{rawLine}
                 });
             }
-        } else if (key == "date-format") {
+            format.counterpartyCol = *parsed;
+        } else if (equalsIgnoreCase(key, "date-format")) {
             format.dateFormat = toLower(value);
-        } else if (key == "amount-format") {
+        } else if (equalsIgnoreCase(key, "amount-format")) {
             auto lowerVal = toLower(value);
             if (lowerVal != "standard" && lowerVal != "european") {
                 return std::unexpected(core::ParseError{
@@ -539,15 +573,16 @@ auto ConfigParser::parseImportFormatLine(std::string_view line, std::string_view
                 });
             }
             format.amountFormat = lowerVal;
-        } else if (key == "skip-rows") {
-            try { format.skipRows = std::stoi(value); }
-            catch (...) {
+        } else if (equalsIgnoreCase(key, "skip-rows")) {
+            auto parsed = parseInt(value);
+            if (!parsed) {
                 return std::unexpected(core::ParseError{
                     .message = fmt::format("Invalid skip-rows value: '{}'", value),
                     .line = lineNumber,
                     .sourceLine = std::string{rawLine}
                 });
             }
+            format.skipRows = *parsed;
         } else {
             return std::unexpected(core::ParseError{
                 .message = fmt::format("Unknown import-format key: '{}'. Valid keys: separator, date-col, amount-col, description-col, counterparty-col, date-format, amount-format, skip-rows", key),
@@ -561,66 +596,57 @@ auto ConfigParser::parseImportFormatLine(std::string_view line, std::string_view
 }
 
 auto ConfigParser::tokenize(std::string_view line)
-    -> std::vector<std::string>
+    -> std::vector<std::string_view>
 {
-    std::vector<std::string> tokens;
-    std::string current;
-    bool inQuotes = false;
-    char quoteChar = '\0';
+    // Every token is a slice of the input: a quoted token is the span
+    // between its quotes (no escape processing happens inside quotes),
+    // a bare token runs to the next whitespace. Nothing is copied here.
+    std::vector<std::string_view> tokens;
+    std::size_t i = 0;
 
-    for (size_t i = 0; i < line.size(); ++i) {
+    while (i < line.size()) {
         char c = line[i];
 
-        if (!inQuotes && (c == '"' || c == '\'')) {
-            inQuotes = true;
-            quoteChar = c;
-        }
-        else if (inQuotes && c == quoteChar) {
-            inQuotes = false;
-            quoteChar = '\0';
+        if (c == ' ' || c == '\t') {
+            ++i;
+            continue;
         }
-        else if (!inQuotes && (c == ' ' || c == '\t')) {
-            if (!current.empty()) {
-                tokens.push_back(std::move(current));
-                current.clear();
+
+        if (c == '"' || c == '\'') {
+            auto start = ++i;
+            while (i < line.size() && line[i] != c) {
+                ++i;
             }
+            tokens.push_back(line.substr(start, i - start));
+            if (i < line.size()) {
+                ++i;  // Skip the closing quote
+            }
+            continue;
         }
-        else {
-            current += c;
-        }
-    }
 
-    if (!current.empty()) {
-        tokens.push_back(std::move(current));
+        auto start = i;
+        while (i < line.size() && line[i] != ' ' && line[i] != '\t') {
+            ++i;
+        }
+        tokens.push_back(line.substr(start, i - start));
     }
 
     return tokens;
 }
 
-auto ConfigParser::matchesPattern(std::string_view pattern, std::string_view text)
+auto ConfigParser::matchesNormalized(std::string_view pattern, std::string_view text)
     -> bool
 {
-    // Simple wildcard matching with * support
-    // Pattern is already lowercase, text needs to be lowercased
-    std::string lowerText{text};
-    std::transform(lowerText.begin(), lowerText.end(), lowerText.begin(),
-                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
-
-    // Strip spaces from both to handle ING bank column-break formatting artifacts
-    lowerText.erase(std::remove(lowerText.begin(), lowerText.end(), ' '), lowerText.end());
-    std::string normalizedPattern{pattern};
-    normalizedPattern.erase(std::remove(normalizedPattern.begin(), normalizedPattern.end(), ' '),
-                            normalizedPattern.end());
-    pattern = normalizedPattern;
-
+    // Simple wildcard matching with * and ? support; both sides are
+    // already lowercase and space-stripped
     size_t patternIdx = 0;
     size_t textIdx = 0;
     size_t starIdx = std::string::npos;
     size_t matchIdx = 0;
 
-    while (textIdx < lowerText.size()) {
+    while (textIdx < text.size()) {
         if (patternIdx < pattern.size() &&
-            (pattern[patternIdx] == lowerText[textIdx] || pattern[patternIdx] == '?')) {
+            (pattern[patternIdx] == text[textIdx] || pattern[patternIdx] == '?')) {
             ++patternIdx;
             ++textIdx;
         }
@@ -653,47 +679,102 @@ auto ConfigParser::matchCategory(
     std::optional<int64_t> amountCents)
     -> std::optional<core::TransactionCategory>
 {
-    std::string lowerCp{counterparty};
-    std::string lowerDesc{description};
-    std::transform(lowerCp.begin(), lowerCp.end(), lowerCp.begin(),
-                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
-    std::transform(lowerDesc.begin(), lowerDesc.end(), lowerDesc.begin(),
-                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
-
-    // Strip spaces to handle ING bank column-break formatting artifacts
-    auto stripSpaces = [](const std::string& s) {
-        std::string r;
-        r.reserve(s.size());
-        for (char c : s) if (c != ' ') r += c;
-        return r;
-    };
-    auto cpN = stripSpaces(lowerCp);
-    auto descN = stripSpaces(lowerDesc);
+    auto compiled = compileRules(rules);
+    const auto* match = matchCompiled(compiled, counterparty, description, amountCents);
+    if (!match) {
+        return std::nullopt;
+    }
+    return match->rule.category;
+}
 
-    for (const auto& rule : rules) {
-        // Amount-only rule: match on exact amount (absolute value)
+auto ConfigParser::compileRules(std::vector<CategorizationRule> rules)
+    -> CompiledRuleSet
+{
+    CompiledRuleSet compiled;
+    compiled.rules.reserve(rules.size());
+    for (auto& rule : rules) {
+        // Lowercase and strip spaces to handle ING bank column-break
+        // formatting artifacts
+        std::string normalized;
+        core::text::lowercaseStripSpacesInto(rule.pattern, normalized);
+        bool hasWildcard = normalized.find_first_of("*?") != std::string::npos;
         if (rule.amountCents) {
-            if (amountCents && std::abs(*amountCents) == std::abs(*rule.amountCents)) {
-                return rule.category;
-            }
-            continue;  // Amount rules don't do text matching
+            // emplace keeps the first entry, so the earliest rule wins
+            // when several share an amount
+            compiled.amountIndex.emplace(std::abs(*rule.amountCents),
+                                         compiled.rules.size());
+        }
+        compiled.rules.push_back(CompiledCategorizationRule{
+            .rule = std::move(rule),
+            .normalizedPattern = std::move(normalized),
+            .hasWildcard = hasWildcard
+        });
+    }
+    return compiled;
+}
+
+auto ConfigParser::matchCompiled(
+    const CompiledRuleSet& rules,
+    std::string_view counterparty,
+    std::string_view description,
+    std::optional<int64_t> amountCents)
+    -> const CompiledCategorizationRule*
+{
+    // Normalize the inputs once; every rule check below is then an index
+    // lookup or a substring scan over these two strings
+    std::string cpN;
+    std::string descN;
+    core::text::lowercaseStripSpacesInto(counterparty, cpN);
+    core::text::lowercaseStripSpacesInto(description, descN);
+    return matchCompiledNormalized(rules, cpN, descN, amountCents);
+}
+
+auto ConfigParser::matchCompiledNormalized(
+    const CompiledRuleSet& rules,
+    std::string_view cpN,
+    std::string_view descN,
+    std::optional<int64_t> amountCents)
+    -> const CompiledCategorizationRule*
+{
+    // Amount rules are resolved with one hash lookup (absolute value);
+    // the index comparison in the loop below keeps first-match-wins
+    // ordering against the pattern rules
+    std::size_t amountRule = rules.rules.size();
+    if (amountCents) {
+        auto it = rules.amountIndex.find(std::abs(*amountCents));
+        if (it != rules.amountIndex.end()) {
+            amountRule = it->second;
         }
+    }
 
-        // Check if pattern matches counterparty or description (wildcard)
-        if (matchesPattern(rule.pattern, lowerCp) ||
-            matchesPattern(rule.pattern, lowerDesc)) {
-            return rule.category;
+    for (std::size_t i = 0; i < rules.rules.size(); ++i) {
+        if (amountRule <= i) {
+            return &rules.rules[amountRule];
         }
 
-        // Also check for simple substring match (space-normalized)
-        auto patN = stripSpaces(rule.pattern);
-        if (cpN.find(patN) != std::string::npos ||
-            descN.find(patN) != std::string::npos) {
-            return rule.category;
+        const auto& compiled = rules.rules[i];
+        if (compiled.rule.amountCents) {
+            continue;  // Amount rules are handled via the index
+        }
+
+        // Wildcard match against counterparty or description
+        if (compiled.hasWildcard &&
+            (matchesNormalized(compiled.normalizedPattern, cpN) ||
+             matchesNormalized(compiled.normalizedPattern, descN))) {
+            return &compiled;
+        }
+
+        // Simple substring match (space-normalized)
+        if (cpN.find(compiled.normalizedPattern) != std::string::npos ||
+            descN.find(compiled.normalizedPattern) != std::string::npos) {
+            return &compiled;
         }
     }
 
-    return std::nullopt;
+    if (amountRule < rules.rules.size()) {
+        return &rules.rules[amountRule];
+    }
+    return nullptr;
 }
 
 } // namespace ares::infrastructure::config
@@ -5,6 +5,7 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 #include "core/common/Error.hpp"
 #include "core/common/Money.hpp"
@@ -20,6 +21,27 @@ struct CategorizationRule {
     std::optional<int64_t> amountCents;  // If set, only match this exact amount
 };
 
+// A categorization rule whose pattern has been normalized (space-stripped)
+// once up front, so matching a transaction does no per-rule string work
+struct CompiledCategorizationRule {
+    CategorizationRule rule;
+    std::string normalizedPattern;  // rule.pattern without spaces
+    bool hasWildcard{false};        // pattern contains '*' or '?'
+};
+
+// A rule set compiled for repeated matching. amount:NN.NN rules are
+// additionally indexed by absolute cents so an amount lookup is O(1)
+// instead of a scan through the whole list; first-match-wins ordering
+// between amount and pattern rules is preserved via the stored indices.
+struct CompiledRuleSet {
+    std::vector<CompiledCategorizationRule> rules;
+    // abs(cents) -> index of the earliest amount rule with that amount
+    std::unordered_map<int64_t, std::size_t> amountIndex;
+
+    [[nodiscard]] auto empty() const -> bool { return rules.empty(); }
+    [[nodiscard]] auto size() const -> std::size_t { return rules.size(); }
+};
+
 struct ConfiguredIncome {
     std::string name;
     core::Money amount;
@@ -110,6 +132,36 @@ public:
         std::optional<int64_t> amountCents = std::nullopt)
         -> std::optional<core::TransactionCategory>;
 
+    // Normalizes every rule pattern once and indexes amount rules by
+    // cents. Callers that categorize many transactions should compile
+    // their rule set up front and match with matchCompiled instead of
+    // paying the normalization per transaction.
+    [[nodiscard]] static auto compileRules(std::vector<CategorizationRule> rules)
+        -> CompiledRuleSet;
+
+    // First matching rule in order (order = priority), or nullptr if none
+    // matched. The pointer refers into the passed rule set.
+    [[nodiscard]] static auto matchCompiled(
+        const CompiledRuleSet& rules,
+        std::string_view counterparty,
+        std::string_view description,
+        std::optional<int64_t> amountCents = std::nullopt)
+        -> const CompiledCategorizationRule*;
+
+    // Same as matchCompiled but for callers that already hold lowercased,
+    // space-stripped inputs; allocates nothing
+    [[nodiscard]] static auto matchCompiledNormalized(
+        const CompiledRuleSet& rules,
+        std::string_view normalizedCounterparty,
+        std::string_view normalizedDescription,
+        std::optional<int64_t> amountCents = std::nullopt)
+        -> const CompiledCategorizationRule*;
+
+    // Pattern matching with * / ? wildcard support. Both sides must already
+    // be lowercased and space-stripped.
+    [[nodiscard]] static auto matchesNormalized(std::string_view pattern, std::string_view text)
+        -> bool;
+
 private:
     auto parseLine(std::string_view line, std::string_view rawLine, int lineNumber, UserConfig& config)
         -> std::expected<void, core::ParseError>;
@@ -135,13 +187,11 @@ private:
     [[nodiscard]] auto parseImportFormatLine(std::string_view line, std::string_view rawLine, int lineNumber)
         -> std::expected<ConfiguredImportFormat, core::ParseError>;
 
-    // Tokenize a line respecting quoted strings
+    // Tokenize a line respecting quoted strings. Tokens are views into the
+    // caller's line; they stay valid only while the line does, and callers
+    // copy into std::string at the point a field is stored.
     [[nodiscard]] static auto tokenize(std::string_view line)
-        -> std::vector<std::string>;
-
-    // Pattern matching with * wildcard support
-    [[nodiscard]] static auto matchesPattern(std::string_view pattern, std::string_view text)
-        -> bool;
+        -> std::vector<std::string_view>;
 };
 
 } // namespace ares::infrastructure::config
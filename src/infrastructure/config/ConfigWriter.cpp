@@ -1,147 +1,200 @@
 #include "infrastructure/config/ConfigWriter.hpp"
-#include "infrastructure/config/YamlConfigParser.hpp"
 #include "infrastructure/config/ConfigUtils.hpp"
 #include <fmt/format.h>
 #include <fstream>
-#include <vector>
+#include <iterator>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace ares::infrastructure::config {
 
 namespace {
 
-// Read the file content as lines (each line retains its newline if present)
-auto readLines(const std::filesystem::path& path) -> std::vector<std::string> {
-    std::ifstream file{path};
-    std::vector<std::string> lines;
-    std::string line;
-    while (std::getline(file, line)) {
-        lines.push_back(line);
+// Mutations are byte-range splices against the file buffer: everything
+// outside the affected entry is preserved byte-for-byte, comments and
+// formatting included. An append at end-of-file (the common case for
+// `config add-rule` et al.) writes only the new bytes; a mid-file edit
+// rewrites through a temp file and rename so a crash never leaves a
+// half-written config.
+
+auto readFile(const std::filesystem::path& path) -> std::string {
+    std::ifstream file{path, std::ios::binary};
+    if (!file) {
+        return {};
     }
-    return lines;
+    return std::string{std::istreambuf_iterator<char>{file},
+                       std::istreambuf_iterator<char>{}};
 }
 
-// Write lines back to file
-auto writeLines(const std::filesystem::path& path,
-                const std::vector<std::string>& lines)
-    -> std::expected<void, core::Error>
-{
-    std::ofstream file{path};
-    if (!file) {
-        return std::unexpected(core::IoError{path.string(), "Failed to open file for writing"});
+// The line starting at pos, excluding the newline
+auto lineAt(std::string_view buffer, std::size_t pos) -> std::string_view {
+    auto end = buffer.find('\n', pos);
+    if (end == std::string_view::npos) {
+        end = buffer.size();
     }
-    for (const auto& line : lines) {
-        file << line << '\n';
+    return buffer.substr(pos, end - pos);
+}
+
+// Start of the line after the one at pos (buffer.size() at EOF)
+auto nextLineStart(std::string_view buffer, std::size_t pos) -> std::size_t {
+    auto end = buffer.find('\n', pos);
+    if (end == std::string_view::npos) {
+        return buffer.size();
     }
-    return {};
+    return end + 1;
 }
 
 // Check if a line is a top-level YAML key (starts with a non-space char, contains ':')
-auto isTopLevelKey(const std::string& line) -> bool {
+auto isTopLevelKey(std::string_view line) -> bool {
     if (line.empty() || line[0] == '#' || line[0] == ' ' || line[0] == '\t') {
         return false;
     }
-    return line.find(':') != std::string::npos;
+    return line.find(':') != std::string_view::npos;
 }
 
-// Find the line index of a top-level section (e.g. "expenses:")
-// Returns lines.size() if not found.
-auto findSection(const std::vector<std::string>& lines,
-                 const std::string& sectionKey) -> size_t
+// Byte range of a top-level section: the header line, the start of its
+// body and the start of the next top-level key (or EOF)
+struct SectionRange {
+    bool found{false};
+    std::size_t headerPos{0};
+    std::size_t bodyBegin{0};
+    std::size_t end{0};
+};
+
+// sectionKey includes the colon, e.g. "expenses:"
+auto findSection(std::string_view buffer, std::string_view sectionKey)
+    -> SectionRange
 {
-    for (size_t i = 0; i < lines.size(); ++i) {
-        const auto& line = lines[i];
-        // Match "sectionKey:" at the start of a line (with optional trailing space/comment)
-        if (line == sectionKey || line.starts_with(sectionKey + " ") ||
-            line.starts_with(sectionKey + "\t")) {
-            return i;
-        }
-        // Also match "sectionKey:" directly
-        std::string withColon = sectionKey;  // e.g. "expenses:" already has colon
-        if (line == withColon) {
-            return i;
+    for (std::size_t pos = 0; pos < buffer.size(); pos = nextLineStart(buffer, pos)) {
+        auto line = lineAt(buffer, pos);
+        if (line.starts_with(sectionKey) &&
+            (line.size() == sectionKey.size() ||
+             line[sectionKey.size()] == ' ' || line[sectionKey.size()] == '\t')) {
+            SectionRange section;
+            section.found = true;
+            section.headerPos = pos;
+            section.bodyBegin = nextLineStart(buffer, pos);
+            section.end = section.bodyBegin;
+            while (section.end < buffer.size() &&
+                   !isTopLevelKey(lineAt(buffer, section.end))) {
+                section.end = nextLineStart(buffer, section.end);
+            }
+            return section;
         }
     }
-    return lines.size();  // not found
+    return {};
 }
 
-// Find the end of a section: the line index of the next top-level key after `startLine`,
-// or lines.size() if there is none.
-auto findSectionEnd(const std::vector<std::string>& lines, size_t startLine) -> size_t {
-    for (size_t i = startLine + 1; i < lines.size(); ++i) {
-        if (isTopLevelKey(lines[i])) {
-            return i;
+// Start offsets of the "  - " entry lines within a section body
+auto findEntryStarts(std::string_view buffer, const SectionRange& section)
+    -> std::vector<std::size_t>
+{
+    std::vector<std::size_t> starts;
+    for (std::size_t pos = section.bodyBegin; pos < section.end;
+         pos = nextLineStart(buffer, pos)) {
+        if (lineAt(buffer, pos).starts_with("  - ")) {
+            starts.push_back(pos);
         }
     }
-    return lines.size();
+    return starts;
 }
 
-// Add a section + entry if the section doesn't exist, or add just the entry
-// after the last entry in the existing section.
-// `sectionName` is e.g. "expenses"
-// `entryLines` are the YAML lines for the new entry (each without trailing newline)
-auto addToSection(std::vector<std::string>& lines,
-                  const std::string& sectionName,
-                  const std::vector<std::string>& entryLines) -> void
+// Replace buffer[pos, pos + removeLen) with insertText on disk. A pure
+// append touches only the new bytes; anything else goes through a
+// sibling temp file and rename.
+auto spliceFile(const std::filesystem::path& path, const std::string& buffer,
+                std::size_t pos, std::size_t removeLen, std::string_view insertText)
+    -> std::expected<void, core::Error>
 {
-    std::string sectionKey = sectionName + ":";
-    size_t sectionIdx = findSection(lines, sectionKey);
-
-    if (sectionIdx == lines.size()) {
-        // Section not found — append section header + entry at end
-        // Add a blank line before section if file is non-empty and last line non-empty
-        if (!lines.empty() && !lines.back().empty()) {
-            lines.push_back("");
+    if (removeLen == 0 && pos == buffer.size()) {
+        std::ofstream file{path, std::ios::binary | std::ios::app};
+        if (!file) {
+            return std::unexpected(core::IoError{path.string(), "Failed to open file for writing"});
         }
-        lines.push_back(sectionKey);
-        for (const auto& el : entryLines) {
-            lines.push_back(el);
+        file.write(insertText.data(), static_cast<std::streamsize>(insertText.size()));
+        if (!file) {
+            return std::unexpected(core::IoError{path.string(), "Failed to write config file"});
         }
-    } else {
-        // Section found — find insertion point: just before the next top-level key
-        size_t sectionEnd = findSectionEnd(lines, sectionIdx);
-        // Insert before sectionEnd
-        for (size_t i = 0; i < entryLines.size(); ++i) {
-            lines.insert(lines.begin() + static_cast<std::ptrdiff_t>(sectionEnd) + static_cast<std::ptrdiff_t>(i),
-                         entryLines[i]);
+        return {};
+    }
+
+    auto tempPath = path;
+    tempPath += ".tmp";
+    {
+        std::ofstream file{tempPath, std::ios::binary | std::ios::trunc};
+        if (!file) {
+            return std::unexpected(core::IoError{path.string(), "Failed to open file for writing"});
+        }
+        file.write(buffer.data(), static_cast<std::streamsize>(pos));
+        file.write(insertText.data(), static_cast<std::streamsize>(insertText.size()));
+        file.write(buffer.data() + pos + removeLen,
+                   static_cast<std::streamsize>(buffer.size() - pos - removeLen));
+        if (!file) {
+            return std::unexpected(core::IoError{path.string(), "Failed to write config file"});
         }
     }
+
+    std::error_code ec;
+    std::filesystem::rename(tempPath, path, ec);
+    if (ec) {
+        std::filesystem::remove(tempPath, ec);
+        return std::unexpected(core::IoError{path.string(), "Failed to replace config file"});
+    }
+    return {};
 }
 
-// Remove the Nth entry (0-indexed) from a section.
-// Returns error if index is out of range.
-auto removeFromSection(std::vector<std::string>& lines,
-                       const std::string& sectionName,
-                       size_t index,
-                       size_t totalCount,
-                       const std::filesystem::path& path)
+// Append an entry to a section: after the section's last entry if the
+// section exists, as a new section at end-of-file otherwise
+auto addToSection(const std::filesystem::path& path, const std::string& buffer,
+                  const std::string& sectionName,
+                  const std::vector<std::string>& entryLines)
     -> std::expected<void, core::Error>
 {
-    if (index >= totalCount) {
-        return std::unexpected(core::ValidationError{
-            "index",
-            fmt::format("Index {} is out of range (section '{}' has {} entries)",
-                        index, sectionName, totalCount)
-        });
+    std::string entryText;
+    for (const auto& line : entryLines) {
+        entryText += line;
+        entryText += '\n';
     }
 
-    std::string sectionKey = sectionName + ":";
-    size_t sectionIdx = findSection(lines, sectionKey);
-    if (sectionIdx == lines.size()) {
-        return std::unexpected(core::IoError{path.string(),
-            fmt::format("Section '{}' not found in config", sectionName)});
+    auto section = findSection(buffer, sectionName + ":");
+    if (section.found) {
+        // A file whose last line lacks a newline needs one before the
+        // appended entry
+        if (section.end == buffer.size() && !buffer.ends_with('\n')) {
+            entryText.insert(entryText.begin(), '\n');
+        }
+        return spliceFile(path, buffer, section.end, 0, entryText);
     }
 
-    size_t sectionEnd = findSectionEnd(lines, sectionIdx);
-
-    // Find all "  - " entry start lines within the section
-    std::vector<size_t> entryStarts;
-    for (size_t i = sectionIdx + 1; i < sectionEnd; ++i) {
-        if (lines[i].starts_with("  - ")) {
-            entryStarts.push_back(i);
+    // Section not found - append section header + entry at end,
+    // separated from a non-empty file by a blank line
+    std::string text;
+    if (!buffer.empty()) {
+        if (!buffer.ends_with('\n')) {
+            text += '\n';
+        }
+        if (!buffer.ends_with("\n\n")) {
+            text += '\n';
         }
     }
+    text += sectionName + ":\n";
+    text += entryText;
+    return spliceFile(path, buffer, buffer.size(), 0, text);
+}
 
+// Remove the Nth entry (0-indexed) from a section
+auto removeFromSection(const std::filesystem::path& path, const std::string& buffer,
+                       const std::string& sectionName, std::size_t index)
+    -> std::expected<void, core::Error>
+{
+    auto section = findSection(buffer, sectionName + ":");
+    if (!section.found) {
+        return std::unexpected(core::IoError{path.string(),
+            fmt::format("Section '{}' not found in config", sectionName)});
+    }
+
+    auto entryStarts = findEntryStarts(buffer, section);
     if (index >= entryStarts.size()) {
         return std::unexpected(core::ValidationError{
             "index",
@@ -150,19 +203,10 @@ auto removeFromSection(std::vector<std::string>& lines,
         });
     }
 
-    size_t entryStart = entryStarts[index];
-    size_t entryEnd;
-    if (index + 1 < entryStarts.size()) {
-        entryEnd = entryStarts[index + 1];
-    } else {
-        entryEnd = sectionEnd;
-    }
-
-    // Remove lines [entryStart, entryEnd)
-    lines.erase(lines.begin() + static_cast<std::ptrdiff_t>(entryStart),
-                lines.begin() + static_cast<std::ptrdiff_t>(entryEnd));
-
-    return {};
+    auto entryStart = entryStarts[index];
+    auto entryEnd = index + 1 < entryStarts.size() ? entryStarts[index + 1]
+                                                   : section.end;
+    return spliceFile(path, buffer, entryStart, entryEnd - entryStart, {});
 }
 
 // Format a monetary amount as "1234.56"
@@ -233,25 +277,17 @@ auto ConfigWriter::addExpense(const std::filesystem::path& configPath,
                               core::TransactionCategory category)
     -> std::expected<void, core::Error>
 {
-    auto lines = readLines(configPath);
-    auto entryLines = buildExpenseEntry(name, amount, frequency, category);
-    addToSection(lines, "expenses", entryLines);
-    return writeLines(configPath, lines);
+    auto buffer = readFile(configPath);
+    return addToSection(configPath, buffer, "expenses",
+                        buildExpenseEntry(name, amount, frequency, category));
 }
 
 auto ConfigWriter::removeExpense(const std::filesystem::path& configPath,
                                   size_t index)
     -> std::expected<void, core::Error>
 {
-    // Parse first to validate index
-    YamlConfigParser parser;
-    auto config = parser.parse(configPath);
-    if (!config) return std::unexpected(config.error());
-
-    auto lines = readLines(configPath);
-    auto result = removeFromSection(lines, "expenses", index, config->expenses.size(), configPath);
-    if (!result) return result;
-    return writeLines(configPath, lines);
+    auto buffer = readFile(configPath);
+    return removeFromSection(configPath, buffer, "expenses", index);
 }
 
 auto ConfigWriter::addIncome(const std::filesystem::path& configPath,
@@ -260,24 +296,17 @@ auto ConfigWriter::addIncome(const std::filesystem::path& configPath,
                               core::TransactionCategory category)
     -> std::expected<void, core::Error>
 {
-    auto lines = readLines(configPath);
-    auto entryLines = buildExpenseEntry(name, amount, frequency, category);
-    addToSection(lines, "income", entryLines);
-    return writeLines(configPath, lines);
+    auto buffer = readFile(configPath);
+    return addToSection(configPath, buffer, "income",
+                        buildExpenseEntry(name, amount, frequency, category));
 }
 
 auto ConfigWriter::removeIncome(const std::filesystem::path& configPath,
                                   size_t index)
     -> std::expected<void, core::Error>
 {
-    YamlConfigParser parser;
-    auto config = parser.parse(configPath);
-    if (!config) return std::unexpected(config.error());
-
-    auto lines = readLines(configPath);
-    auto result = removeFromSection(lines, "income", index, config->income.size(), configPath);
-    if (!result) return result;
-    return writeLines(configPath, lines);
+    auto buffer = readFile(configPath);
+    return removeFromSection(configPath, buffer, "income", index);
 }
 
 auto ConfigWriter::addRule(const std::filesystem::path& configPath,
@@ -285,25 +314,17 @@ auto ConfigWriter::addRule(const std::filesystem::path& configPath,
                             core::TransactionCategory category)
     -> std::expected<void, core::Error>
 {
-    auto lines = readLines(configPath);
-    auto entryLines = buildRuleEntry(pattern, category);
-    addToSection(lines, "categorization", entryLines);
-    return writeLines(configPath, lines);
+    auto buffer = readFile(configPath);
+    return addToSection(configPath, buffer, "categorization",
+                        buildRuleEntry(pattern, category));
 }
 
 auto ConfigWriter::removeRule(const std::filesystem::path& configPath,
                                size_t index)
     -> std::expected<void, core::Error>
 {
-    YamlConfigParser parser;
-    auto config = parser.parse(configPath);
-    if (!config) return std::unexpected(config.error());
-
-    auto lines = readLines(configPath);
-    auto result = removeFromSection(lines, "categorization", index,
-                                   config->categorizationRules.size(), configPath);
-    if (!result) return result;
-    return writeLines(configPath, lines);
+    auto buffer = readFile(configPath);
+    return removeFromSection(configPath, buffer, "categorization", index);
 }
 
 auto ConfigWriter::addBudget(const std::filesystem::path& configPath,
@@ -311,24 +332,17 @@ auto ConfigWriter::addBudget(const std::filesystem::path& configPath,
                               core::Money limit)
     -> std::expected<void, core::Error>
 {
-    auto lines = readLines(configPath);
-    auto entryLines = buildBudgetEntry(category, limit);
-    addToSection(lines, "budgets", entryLines);
-    return writeLines(configPath, lines);
+    auto buffer = readFile(configPath);
+    return addToSection(configPath, buffer, "budgets",
+                        buildBudgetEntry(category, limit));
 }
 
 auto ConfigWriter::removeBudget(const std::filesystem::path& configPath,
                                   size_t index)
     -> std::expected<void, core::Error>
 {
-    YamlConfigParser parser;
-    auto config = parser.parse(configPath);
-    if (!config) return std::unexpected(config.error());
-
-    auto lines = readLines(configPath);
-    auto result = removeFromSection(lines, "budgets", index, config->budgets.size(), configPath);
-    if (!result) return result;
-    return writeLines(configPath, lines);
+    auto buffer = readFile(configPath);
+    return removeFromSection(configPath, buffer, "budgets", index);
 }
 
 auto ConfigWriter::addCredit(const std::filesystem::path& configPath,
@@ -338,24 +352,17 @@ auto ConfigWriter::addCredit(const std::filesystem::path& configPath,
                               std::optional<core::Money> original)
     -> std::expected<void, core::Error>
 {
-    auto lines = readLines(configPath);
-    auto entryLines = buildCreditEntry(name, type, balance, rate, minPayment, original);
-    addToSection(lines, "credits", entryLines);
-    return writeLines(configPath, lines);
+    auto buffer = readFile(configPath);
+    return addToSection(configPath, buffer, "credits",
+                        buildCreditEntry(name, type, balance, rate, minPayment, original));
 }
 
 auto ConfigWriter::removeCredit(const std::filesystem::path& configPath,
                                   size_t index)
     -> std::expected<void, core::Error>
 {
-    YamlConfigParser parser;
-    auto config = parser.parse(configPath);
-    if (!config) return std::unexpected(config.error());
-
-    auto lines = readLines(configPath);
-    auto result = removeFromSection(lines, "credits", index, config->credits.size(), configPath);
-    if (!result) return result;
-    return writeLines(configPath, lines);
+    auto buffer = readFile(configPath);
+    return removeFromSection(configPath, buffer, "credits", index);
 }
 
 auto ConfigWriter::writeConfig(const std::filesystem::path& configPath,
@@ -3,6 +3,7 @@
 #include "core/common/Money.hpp"
 #include <yaml-cpp/yaml.h>
 #include <fmt/format.h>
+#include <optional>
 #include <string>
 
 namespace ares::infrastructure::config {
@@ -37,20 +38,37 @@ auto parseCategorizationRules(const YAML::Node& seq)
     -> std::expected<std::vector<CategorizationRule>, core::Error>
 {
     std::vector<CategorizationRule> rules;
+    rules.reserve(seq.size());
     for (std::size_t i = 0; i < seq.size(); ++i) {
         const auto& entry = seq[i];
 
-        if (!entry["pattern"]) {
+        // This is the big section (hundreds of rules in a lived-in
+        // config), so walk each entry's fields once instead of paying a
+        // keyed map scan per field
+        std::optional<YAML::Node> patternNode;
+        std::optional<YAML::Node> categoryNode;
+        if (entry.IsMap()) {
+            for (const auto& field : entry) {
+                auto key = field.first.as<std::string>();
+                if (key == "pattern") {
+                    patternNode = field.second;
+                } else if (key == "category") {
+                    categoryNode = field.second;
+                }
+            }
+        }
+
+        if (!patternNode) {
             return std::unexpected(makeError(
                 fmt::format("categorization[{}]: missing required field 'pattern'", i)));
         }
-        if (!entry["category"]) {
+        if (!categoryNode) {
             return std::unexpected(makeError(
                 fmt::format("categorization[{}]: missing required field 'category'", i)));
         }
 
-        std::string rawPattern = entry["pattern"].as<std::string>();
-        std::string categoryStr = entry["category"].as<std::string>();
+        std::string rawPattern = patternNode->as<std::string>();
+        std::string categoryStr = categoryNode->as<std::string>();
 
         auto cat = parseCategory(categoryStr);
         if (!cat) {
@@ -383,50 +401,52 @@ auto processDocument(const YAML::Node& doc)
     UserConfig config;
 
     // Empty or null document => empty config (not an error)
-    if (!doc || doc.IsNull()) {
+    if (!doc || doc.IsNull() || !doc.IsMap()) {
         return config;
     }
 
-    if (doc["categorization"]) {
-        auto result = parseCategorizationRules(doc["categorization"]);
-        if (!result) return std::unexpected(result.error());
-        config.categorizationRules = std::move(*result);
-    }
-
-    if (doc["income"]) {
-        auto result = parseIncome(doc["income"]);
-        if (!result) return std::unexpected(result.error());
-        config.income = std::move(*result);
-    }
-
-    if (doc["expenses"]) {
-        auto result = parseExpenses(doc["expenses"]);
-        if (!result) return std::unexpected(result.error());
-        config.expenses = std::move(*result);
-    }
-
-    if (doc["credits"]) {
-        auto result = parseCredits(doc["credits"]);
-        if (!result) return std::unexpected(result.error());
-        config.credits = std::move(*result);
-    }
-
-    if (doc["budgets"]) {
-        auto result = parseBudgets(doc["budgets"]);
-        if (!result) return std::unexpected(result.error());
-        config.budgets = std::move(*result);
-    }
-
-    if (doc["accounts"]) {
-        auto result = parseAccounts(doc["accounts"]);
-        if (!result) return std::unexpected(result.error());
-        config.accounts = std::move(*result);
-    }
-
-    if (doc["import-formats"]) {
-        auto result = parseImportFormats(doc["import-formats"]);
-        if (!result) return std::unexpected(result.error());
-        config.importFormats = std::move(*result);
+    // One pass over the top-level map, dispatching per section; each
+    // doc["section"] lookup would otherwise re-scan the map's entries.
+    // Unknown sections are ignored, as before.
+    for (const auto& section : doc) {
+        auto key = section.first.as<std::string>();
+        const auto& value = section.second;
+
+        if (key == "categorization") {
+            auto result = parseCategorizationRules(value);
+            if (!result) return std::unexpected(result.error());
+            config.categorizationRules = std::move(*result);
+        }
+        else if (key == "income") {
+            auto result = parseIncome(value);
+            if (!result) return std::unexpected(result.error());
+            config.income = std::move(*result);
+        }
+        else if (key == "expenses") {
+            auto result = parseExpenses(value);
+            if (!result) return std::unexpected(result.error());
+            config.expenses = std::move(*result);
+        }
+        else if (key == "credits") {
+            auto result = parseCredits(value);
+            if (!result) return std::unexpected(result.error());
+            config.credits = std::move(*result);
+        }
+        else if (key == "budgets") {
+            auto result = parseBudgets(value);
+            if (!result) return std::unexpected(result.error());
+            config.budgets = std::move(*result);
+        }
+        else if (key == "accounts") {
+            auto result = parseAccounts(value);
+            if (!result) return std::unexpected(result.error());
+            config.accounts = std::move(*result);
+        }
+        else if (key == "import-formats") {
+            auto result = parseImportFormats(value);
+            if (!result) return std::unexpected(result.error());
+            config.importFormats = std::move(*result);
+        }
     }
 
     return config;
@@ -1,9 +1,75 @@
 #include "infrastructure/import/CsvParser.hpp"
+#include "core/common/PerfCounters.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
 #include <fstream>
 #include <sstream>
 
 namespace ares::infrastructure::import {
 
+namespace {
+    // Position of the next occurrence of either character at or after `from`.
+    // memchr lets the C library do the scanning with vector instructions
+    // instead of a per-character loop.
+    auto findEither(std::string_view text, std::size_t from, char a, char b) -> std::size_t {
+        const char* base = text.data() + from;
+        const auto length = text.size() - from;
+        const auto* posA = static_cast<const char*>(std::memchr(base, a, length));
+        const auto* posB = static_cast<const char*>(std::memchr(base, b, length));
+
+        if (posA == nullptr && posB == nullptr) return std::string_view::npos;
+        const char* nearest = (posA == nullptr) ? posB
+                            : (posB == nullptr) ? posA
+                            : std::min(posA, posB);
+        return static_cast<std::size_t>(nearest - text.data());
+    }
+
+    // Core field scanner shared by the owned-string and arena-backed parsers.
+    // Accumulates into `field` and calls `emit` at every field boundary;
+    // `emit` is expected to take the field's contents and reset it.
+    template <typename String, typename EmitField>
+    auto scanFields(std::string_view line, char delimiter, char quote,
+                    String& field, const EmitField& emit) -> void
+    {
+        bool inQuotes = false;
+        std::size_t i = 0;
+
+        while (i < line.size()) {
+            if (inQuotes) {
+                auto next = line.find(quote, i);
+                if (next == std::string_view::npos) {
+                    field.append(line.substr(i));
+                    break;
+                }
+                field.append(line.substr(i, next - i));
+                if (next + 1 < line.size() && line[next + 1] == quote) {
+                    field += quote;
+                    i = next + 2;
+                } else {
+                    inQuotes = false;
+                    i = next + 1;
+                }
+            } else {
+                auto next = findEither(line, i, delimiter, quote);
+                if (next == std::string_view::npos) {
+                    field.append(line.substr(i));
+                    break;
+                }
+                field.append(line.substr(i, next - i));
+                if (line[next] == delimiter) {
+                    emit();
+                } else {
+                    inQuotes = true;
+                }
+                i = next + 1;
+            }
+        }
+
+        emit();
+    }
+}
+
 CsvParser::CsvParser(CsvParserOptions options)
     : options_{options}
 {}
@@ -19,14 +85,10 @@ auto CsvParser::parse(std::string_view content) -> std::expected<CsvDocument, co
         if (line.empty()) continue;
 
         auto row = parseLine(line, lineNumber);
-        if (!row) {
-            return std::unexpected(row.error());
-        }
-
         if (options_.hasHeader && lineNumber == 1) {
-            doc.headers = std::move(*row);
+            doc.headers = std::move(row);
         } else {
-            doc.rows.push_back(std::move(*row));
+            doc.rows.push_back(std::move(row));
         }
     }
 
@@ -36,7 +98,21 @@ auto CsvParser::parse(std::string_view content) -> std::expected<CsvDocument, co
 auto CsvParser::parse(const std::filesystem::path& filePath)
     -> std::expected<CsvDocument, core::Error>
 {
-    std::ifstream file{filePath};
+    CsvDocument doc;
+    auto result = parseStream(filePath, [&doc](CsvRow&& row) {
+        doc.rows.push_back(std::move(row));
+    });
+    if (!result) {
+        return std::unexpected(result.error());
+    }
+    doc.headers = std::move(result->headers);
+    return doc;
+}
+
+auto CsvParser::parseStream(const std::filesystem::path& filePath, const CsvRowHandler& onRow)
+    -> std::expected<CsvStreamResult, core::Error>
+{
+    std::ifstream file{filePath, std::ios::binary};
     if (!file) {
         return std::unexpected(core::IoError{
             .path = filePath.string(),
@@ -44,38 +120,220 @@ auto CsvParser::parse(const std::filesystem::path& filePath)
         });
     }
 
-    std::ostringstream buffer;
-    buffer << file.rdbuf();
-    std::string content = buffer.str();
-    return parse(std::string_view{content});
+    CsvStreamResult result;
+    std::string pending;  // Carries a partial line across chunk boundaries
+    int lineNumber = 0;
+    bool headerPending = options_.hasHeader;
+
+    auto processLine = [&](std::string_view line) -> void {
+        if (line.ends_with('\r')) {
+            line.remove_suffix(1);
+        }
+        ++lineNumber;
+        if (line.empty()) return;
+
+        auto row = parseLine(line, lineNumber);
+        if (headerPending) {
+            headerPending = false;
+            result.headers = std::move(row);
+        } else {
+            ++result.rowCount;
+            onRow(std::move(row));
+        }
+    };
+
+    static constexpr std::size_t kChunkSize = 64 * 1024;
+    std::array<char, kChunkSize> chunk;
+
+    while (file) {
+        file.read(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+        auto bytesRead = file.gcount();
+        if (bytesRead <= 0) break;
+
+        std::string_view data{chunk.data(), static_cast<std::size_t>(bytesRead)};
+        std::size_t start = 0;
+        while (start <= data.size()) {
+            auto newline = data.find('\n', start);
+            if (newline == std::string_view::npos) {
+                pending.append(data.substr(start));
+                break;
+            }
+
+            if (pending.empty()) {
+                processLine(data.substr(start, newline - start));
+            } else {
+                pending.append(data.substr(start, newline - start));
+                processLine(pending);
+                pending.clear();
+            }
+            start = newline + 1;
+        }
+    }
+
+    if (!pending.empty()) {
+        processLine(pending);
+    }
+
+    return result;
 }
 
-auto CsvParser::parseLine(std::string_view line, [[maybe_unused]] int lineNumber)
-    -> std::expected<CsvRow, core::ParseError>
-{
+auto CsvParser::parseViews(std::string_view content) -> std::expected<CsvDocumentView, core::Error> {
+    CsvDocumentView doc;
+    int lineNumber = 0;
+    bool headerPending = options_.hasHeader;
+    std::size_t pos = 0;
+
+    while (pos < content.size()) {
+        auto newline = content.find('\n', pos);
+        auto lineEnd = (newline == std::string_view::npos) ? content.size() : newline;
+        auto line = content.substr(pos, lineEnd - pos);
+        pos = lineEnd + 1;
+
+        if (line.ends_with('\r')) {
+            line.remove_suffix(1);
+        }
+        ++lineNumber;
+        if (line.empty()) continue;
+
+        auto row = parseLineView(line, lineNumber);
+        if (headerPending) {
+            headerPending = false;
+            doc.headers = std::move(row);
+        } else {
+            doc.rows.push_back(std::move(row));
+        }
+    }
+
+    return doc;
+}
+
+auto CsvParser::parseLine(std::string_view line, [[maybe_unused]] int lineNumber) -> CsvRow {
+    ARES_PERF_SCOPE("CsvParser::parseLine");
     CsvRow row;
     std::string field;
-    bool inQuotes = false;
 
-    for (size_t i = 0; i < line.size(); ++i) {
-        char c = line[i];
+    // Spans between special characters are copied wholesale; the scalar
+    // work is confined to the quote handling inside scanFields
+    scanFields(line, options_.delimiter, options_.quote, field, [&] {
+        row.push_back(std::move(field));
+        field.clear();
+    });
 
-        if (c == options_.quote) {
-            if (inQuotes && i + 1 < line.size() && line[i + 1] == options_.quote) {
-                field += c;
-                ++i;
-            } else {
-                inQuotes = !inQuotes;
-            }
-        } else if (c == options_.delimiter && !inQuotes) {
+    return row;
+}
+
+auto CsvParser::parseArena(std::string_view content, std::pmr::memory_resource& arena)
+    -> std::expected<PmrCsvDocument, core::Error>
+{
+    PmrCsvDocument doc{
+        .headers = PmrCsvRow{&arena},
+        .rows = std::pmr::vector<PmrCsvRow>{&arena}
+    };
+    bool headerPending = options_.hasHeader;
+    std::size_t pos = 0;
+
+    while (pos < content.size()) {
+        auto newline = content.find('\n', pos);
+        auto lineEnd = (newline == std::string_view::npos) ? content.size() : newline;
+        auto line = content.substr(pos, lineEnd - pos);
+        pos = lineEnd + 1;
+
+        if (line.ends_with('\r')) {
+            line.remove_suffix(1);
+        }
+        if (line.empty()) continue;
+
+        PmrCsvRow row{&arena};
+        std::pmr::string field{&arena};
+        scanFields(line, options_.delimiter, options_.quote, field, [&] {
             row.push_back(std::move(field));
             field.clear();
+        });
+
+        if (headerPending) {
+            headerPending = false;
+            doc.headers = std::move(row);
         } else {
-            field += c;
+            doc.rows.push_back(std::move(row));
         }
     }
 
-    row.push_back(std::move(field));
+    return doc;
+}
+
+auto CsvParser::parseLineView(std::string_view line, [[maybe_unused]] int lineNumber) -> CsvRowView {
+    CsvRowView row;
+
+    // Fields rewritten into `storage` get their views patched in at the end,
+    // once the storage buffer has stopped growing.
+    struct Patch {
+        std::size_t field;
+        std::size_t offset;
+        std::size_t length;
+    };
+    std::vector<Patch> patches;
+
+    const char delimiter = options_.delimiter;
+    const char quote = options_.quote;
+    std::size_t i = 0;
+
+    while (true) {
+        if (i < line.size() && line[i] == quote) {
+            // Quoted field: find the closing quote, noting doubled quotes
+            std::size_t j = i + 1;
+            bool needsCopy = false;
+            while (j < line.size()) {
+                if (line[j] == quote) {
+                    if (j + 1 < line.size() && line[j + 1] == quote) {
+                        needsCopy = true;
+                        j += 2;
+                    } else {
+                        break;
+                    }
+                } else {
+                    ++j;
+                }
+            }
+            auto inner = line.substr(i + 1, j - i - 1);
+            i = (j < line.size()) ? j + 1 : j;
+
+            // Stray characters between the closing quote and the delimiter are
+            // folded into the field (matching the owned-string parser), which
+            // also forces a copy
+            auto fieldEnd = line.find(delimiter, i);
+            if (fieldEnd == std::string_view::npos) fieldEnd = line.size();
+            auto tail = line.substr(i, fieldEnd - i);
+            if (!tail.empty()) needsCopy = true;
+
+            if (needsCopy) {
+                auto offset = row.storage.size();
+                for (std::size_t k = 0; k < inner.size(); ++k) {
+                    row.storage.push_back(inner[k]);
+                    if (inner[k] == quote) ++k;  // Collapse the doubled quote
+                }
+                row.storage.insert(row.storage.end(), tail.begin(), tail.end());
+                patches.push_back({row.fields.size(), offset, row.storage.size() - offset});
+                row.fields.emplace_back();
+            } else {
+                row.fields.push_back(inner);
+            }
+            i = fieldEnd;
+        } else {
+            auto fieldEnd = line.find(delimiter, i);
+            if (fieldEnd == std::string_view::npos) fieldEnd = line.size();
+            row.fields.push_back(line.substr(i, fieldEnd - i));
+            i = fieldEnd;
+        }
+
+        if (i >= line.size()) break;
+        ++i;  // Skip the delimiter
+    }
+
+    for (const auto& patch : patches) {
+        row.fields[patch.field] =
+            std::string_view{row.storage.data() + patch.offset, patch.length};
+    }
+
     return row;
 }
 
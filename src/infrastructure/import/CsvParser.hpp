@@ -2,6 +2,8 @@
 
 #include <expected>
 #include <filesystem>
+#include <functional>
+#include <memory_resource>
 #include <string>
 #include <vector>
 #include "core/common/Error.hpp"
@@ -21,6 +23,42 @@ struct CsvParserOptions {
     bool hasHeader{true};
 };
 
+// Arena-backed row: rows, headers and field storage all come from a caller
+// provided memory resource, so parsing is pointer bumps and teardown is a
+// single release when the arena goes away.
+using PmrCsvRow = std::pmr::vector<std::pmr::string>;
+
+struct PmrCsvDocument {
+    PmrCsvRow headers;
+    std::pmr::vector<PmrCsvRow> rows;
+};
+
+// Zero-copy row: fields are string_view slices into the content buffer
+// passed to the parser, so the buffer must outlive the row. Quoted fields
+// containing escaped quotes are the only ones that need rewriting; those
+// are materialized into `storage` and their views point there instead.
+// The storage is a vector<char> so that moving a row keeps the heap buffer
+// (and therefore the views into it) stable.
+struct CsvRowView {
+    std::vector<std::string_view> fields;
+    std::vector<char> storage;
+};
+
+struct CsvDocumentView {
+    CsvRowView headers;
+    std::vector<CsvRowView> rows;
+};
+
+// Summary of a streaming parse: the header row (if any) plus how many
+// data rows were handed to the row handler.
+struct CsvStreamResult {
+    std::vector<std::string> headers;
+    std::size_t rowCount{0};
+};
+
+// Invoked once per data row during a streaming parse.
+using CsvRowHandler = std::function<void(CsvRow&&)>;
+
 class CsvParser {
 public:
     explicit CsvParser(CsvParserOptions options = {});
@@ -31,11 +69,35 @@ public:
     [[nodiscard]] auto parse(const std::filesystem::path& filePath)
         -> std::expected<CsvDocument, core::Error>;
 
+    // Streaming parse: reads the file in fixed-size chunks and yields rows
+    // to `onRow` as they are parsed, so memory stays constant regardless of
+    // file size. Headers are returned in the result, not passed to `onRow`.
+    [[nodiscard]] auto parseStream(const std::filesystem::path& filePath,
+                                   const CsvRowHandler& onRow)
+        -> std::expected<CsvStreamResult, core::Error>;
+
+    // Zero-copy parse: rows hold string_view slices into `content`, which
+    // must outlive the returned document. Only quoted fields with escaped
+    // quotes allocate; unquoted fields - the overwhelming majority in bank
+    // exports - are plain slices.
+    [[nodiscard]] auto parseViews(std::string_view content)
+        -> std::expected<CsvDocumentView, core::Error>;
+
+    // Arena-backed parse: every allocation the document makes is served from
+    // `arena` (pass a std::pmr::monotonic_buffer_resource for bump
+    // allocation). The document must not outlive the arena.
+    [[nodiscard]] auto parseArena(std::string_view content, std::pmr::memory_resource& arena)
+        -> std::expected<PmrCsvDocument, core::Error>;
+
 private:
     CsvParserOptions options_;
 
-    [[nodiscard]] auto parseLine(std::string_view line, int lineNumber)
-        -> std::expected<CsvRow, core::ParseError>;
+    // Line scanners cannot fail - malformed quoting degrades to literal
+    // characters - so they return rows directly with no error machinery
+    // on the per-row path.
+    [[nodiscard]] auto parseLine(std::string_view line, int lineNumber) -> CsvRow;
+
+    [[nodiscard]] auto parseLineView(std::string_view line, int lineNumber) -> CsvRowView;
 };
 
 } // namespace ares::infrastructure::import
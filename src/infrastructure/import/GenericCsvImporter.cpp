@@ -1,16 +1,18 @@
 #include "infrastructure/import/GenericCsvImporter.hpp"
+#include "infrastructure/import/MappedFile.hpp"
+#include <atomic>
 #include <algorithm>
 #include <charconv>
-#include <fstream>
-#include <sstream>
 #include <fmt/format.h>
 
 namespace ares::infrastructure::import {
 
 namespace {
     auto generateTransactionId() -> std::string {
-        static int counter = 0;
-        return fmt::format("txn-generic-{}", ++counter);
+        // Atomic so importers can run on parallel import workers
+        static std::atomic<int> counter{0};
+        // Fixed width keeps the id inside the small-string buffer (no heap)
+        return fmt::format("txn-gen-{:07d}", ++counter);
     }
 
     auto trim(std::string_view str) -> std::string {
@@ -28,18 +30,12 @@ GenericCsvImporter::GenericCsvImporter(config::ConfiguredImportFormat format)
 auto GenericCsvImporter::import(const std::filesystem::path& filePath)
     -> std::expected<std::vector<core::Transaction>, core::Error>
 {
-    std::ifstream file{filePath};
-    if (!file) {
-        return std::unexpected(core::IoError{
-            .path = filePath.string(),
-            .message = "Failed to open file"
-        });
+    // Combined with string_view rows this parses with zero buffer copies
+    auto mapped = MappedFile::open(filePath);
+    if (!mapped) {
+        return std::unexpected(mapped.error());
     }
-
-    std::ostringstream buffer;
-    buffer << file.rdbuf();
-    std::string content = buffer.str();
-    return import(std::string_view{content});
+    return import(mapped->view());
 }
 
 auto GenericCsvImporter::import(std::string_view csvContent)
@@ -50,13 +46,22 @@ auto GenericCsvImporter::import(std::string_view csvContent)
     options.hasHeader = false;  // We handle skipping ourselves
 
     CsvParser parser{options};
-    auto docResult = parser.parse(csvContent);
+
+    // Rows are string_view slices into csvContent - no per-field copies
+    auto docResult = parser.parseViews(csvContent);
     if (!docResult) {
         return std::unexpected(docResult.error());
     }
 
     auto& doc = *docResult;
 
+    // Resolve the column mapping and format dispatch once up front; the row
+    // loop below then never touches the format strings
+    auto mapping = compileMapping();
+    if (!mapping) {
+        return std::unexpected(mapping.error());
+    }
+
     // All rows are in doc.rows since we set hasHeader = false
     // Skip the configured number of rows (header rows)
     std::vector<core::Transaction> transactions;
@@ -69,13 +74,13 @@ auto GenericCsvImporter::import(std::string_view csvContent)
         }
 
         // Skip empty rows
-        if (doc.rows[i].empty()) {
+        if (doc.rows[i].fields.empty()) {
             continue;
         }
 
         // Skip rows that are entirely empty fields
         bool allEmpty = true;
-        for (const auto& field : doc.rows[i]) {
+        for (const auto& field : doc.rows[i].fields) {
             if (!trim(field).empty()) {
                 allEmpty = false;
                 break;
@@ -84,9 +89,16 @@ auto GenericCsvImporter::import(std::string_view csvContent)
         if (allEmpty) continue;
 
         auto lineNumber = static_cast<int>(i + 1);
-        auto txnResult = parseTransaction(doc.rows[i], lineNumber);
+        auto txnResult = parseTransaction(doc.rows[i].fields, *mapping, lineNumber);
         if (!txnResult) {
-            return std::unexpected(txnResult.error());
+            auto err = txnResult.error();
+            // Attach the offending field where the code points at one
+            std::string_view context;
+            if (err.code != core::ParseCode::InsufficientColumns &&
+                err.column >= 0 && static_cast<std::size_t>(err.column) < doc.rows[i].fields.size()) {
+                context = doc.rows[i].fields[static_cast<std::size_t>(err.column)];
+            }
+            return std::unexpected(core::expandParseError(err, context));
         }
 
         transactions.push_back(std::move(*txnResult));
@@ -100,31 +112,63 @@ auto GenericCsvImporter::setAccountId(core::AccountId accountId) -> void {
 }
 
 auto GenericCsvImporter::setCategorizationRules(std::vector<config::CategorizationRule> rules) -> void {
-    customRules_ = std::move(rules);
+    customRules_ = config::ConfigParser::compileRules(std::move(rules));
 }
 
-auto GenericCsvImporter::parseTransaction(const CsvRow& fields, int lineNumber)
-    -> std::expected<core::Transaction, core::ParseError>
+auto GenericCsvImporter::compileMapping() const
+    -> std::expected<CompiledMapping, core::ParseError>
 {
-    // Validate required column indices
-    auto maxCol = static_cast<int>(fields.size()) - 1;
-
-    if (format_.dateCol > maxCol || format_.amountCol > maxCol) {
+    CompiledMapping mapping;
+    mapping.dateCol = static_cast<std::size_t>(format_.dateCol);
+    mapping.amountCol = static_cast<std::size_t>(format_.amountCol);
+    mapping.counterpartyCol = format_.counterpartyCol;
+    mapping.descriptionCol = format_.descriptionCol;
+    mapping.europeanAmount = format_.amountFormat == "european";
+
+    // All supported layouts place day/month/year at fixed offsets
+    if (format_.dateFormat == "dd.mm.yyyy" || format_.dateFormat == "dd-mm-yyyy" ||
+        format_.dateFormat == "dd/mm/yyyy") {
+        mapping.dayPos = 0;
+        mapping.monthPos = 3;
+        mapping.yearPos = 6;
+    } else if (format_.dateFormat == "yyyy-mm-dd") {
+        mapping.yearPos = 0;
+        mapping.monthPos = 5;
+        mapping.dayPos = 8;
+    } else if (format_.dateFormat == "mm/dd/yyyy") {
+        mapping.monthPos = 0;
+        mapping.dayPos = 3;
+        mapping.yearPos = 6;
+    } else {
         return std::unexpected(core::ParseError{
-            .message = fmt::format("Row has {} columns, but date-col={} or amount-col={} is out of range",
-                                   fields.size(), format_.dateCol, format_.amountCol),
-            .line = lineNumber
+            .message = fmt::format("Unsupported date format: '{}'", format_.dateFormat)
+        });
+    }
+
+    return mapping;
+}
+
+auto GenericCsvImporter::parseTransaction(const std::vector<std::string_view>& fields,
+                                          const CompiledMapping& mapping, int lineNumber)
+    -> std::expected<core::Transaction, core::LightParseError>
+{
+    // Validate required column indices
+    if (mapping.dateCol >= fields.size() || mapping.amountCol >= fields.size()) {
+        return std::unexpected(core::LightParseError{
+            .code = core::ParseCode::InsufficientColumns,
+            .line = lineNumber,
+            .column = static_cast<int>(fields.size())
         });
     }
 
     // Parse date
-    auto date = parseDate(trim(fields[static_cast<size_t>(format_.dateCol)]), lineNumber);
+    auto date = parseDate(trim(fields[mapping.dateCol]), mapping, lineNumber);
     if (!date) {
         return std::unexpected(date.error());
     }
 
     // Parse amount
-    auto amount = parseAmount(trim(fields[static_cast<size_t>(format_.amountCol)]), lineNumber);
+    auto amount = parseAmount(trim(fields[mapping.amountCol]), mapping, lineNumber);
     if (!amount) {
         return std::unexpected(amount.error());
     }
@@ -143,139 +187,68 @@ auto GenericCsvImporter::parseTransaction(const CsvRow& fields, int lineNumber)
     };
 
     // Set counterparty if column is configured and present
-    if (format_.counterpartyCol >= 0 && format_.counterpartyCol <= maxCol) {
-        auto counterparty = trim(fields[static_cast<size_t>(format_.counterpartyCol)]);
+    if (mapping.counterpartyCol >= 0 && static_cast<std::size_t>(mapping.counterpartyCol) < fields.size()) {
+        auto counterparty = trim(fields[static_cast<size_t>(mapping.counterpartyCol)]);
         if (!counterparty.empty()) {
             txn.setCounterpartyName(counterparty);
         }
     }
 
     // Set description if column is configured and present
-    if (format_.descriptionCol >= 0 && format_.descriptionCol <= maxCol) {
-        auto description = trim(fields[static_cast<size_t>(format_.descriptionCol)]);
+    if (mapping.descriptionCol >= 0 && static_cast<std::size_t>(mapping.descriptionCol) < fields.size()) {
+        auto description = trim(fields[static_cast<size_t>(mapping.descriptionCol)]);
         if (!description.empty()) {
             txn.setDescription(description);
             txn.setRawDescription(description);
         }
     }
 
-    // Infer category
+    // Infer category - custom rules first, recording which rule matched so
+    // incremental recategorization knows which rows a rule edit affects
     auto counterparty = txn.counterpartyName().value_or("");
-    auto category = inferCategory(counterparty, txn.description());
-    txn.setCategory(category);
+    const auto* match = config::ConfigParser::matchCompiled(
+        customRules_, counterparty, txn.description());
+    if (match) {
+        txn.setCategory(match->rule.category);
+        txn.setMatchedRule(match->rule.pattern.empty() ? "custom" : match->rule.pattern);
+    }
 
     return txn;
 }
 
-auto GenericCsvImporter::parseDate(std::string_view dateStr, int lineNumber)
-    -> std::expected<core::Date, core::ParseError>
+auto GenericCsvImporter::parseDate(std::string_view dateStr, const CompiledMapping& mapping,
+                                   int lineNumber)
+    -> std::expected<core::Date, core::LightParseError>
 {
+    auto column = static_cast<int>(mapping.dateCol);
     if (dateStr.empty()) {
-        return std::unexpected(core::ParseError{
-            .message = "Empty date field",
-            .line = lineNumber
+        return std::unexpected(core::LightParseError{
+            .code = core::ParseCode::EmptyField, .line = lineNumber, .column = column
         });
     }
 
-    int day = 0, month = 0, year = 0;
+    // The component offsets were compiled once from format_.dateFormat; every
+    // supported layout is exactly 10 characters wide
+    if (dateStr.size() < 10) {
+        return std::unexpected(core::LightParseError{
+            .code = core::ParseCode::InvalidDate, .line = lineNumber, .column = column
+        });
+    }
 
-    if (format_.dateFormat == "dd.mm.yyyy") {
-        // German format: dd.mm.yyyy
-        if (dateStr.size() < 10) {
-            return std::unexpected(core::ParseError{
-                .message = fmt::format("Invalid date format (expected dd.mm.yyyy): '{}'", dateStr),
-                .line = lineNumber
-            });
-        }
-        auto r1 = std::from_chars(dateStr.data(), dateStr.data() + 2, day);
-        auto r2 = std::from_chars(dateStr.data() + 3, dateStr.data() + 5, month);
-        auto r3 = std::from_chars(dateStr.data() + 6, dateStr.data() + 10, year);
-        if (r1.ec != std::errc{} || r2.ec != std::errc{} || r3.ec != std::errc{}) {
-            return std::unexpected(core::ParseError{
-                .message = fmt::format("Failed to parse date (dd.mm.yyyy): '{}'", dateStr),
-                .line = lineNumber
-            });
-        }
-    } else if (format_.dateFormat == "dd-mm-yyyy") {
-        // Dutch format: dd-mm-yyyy
-        if (dateStr.size() < 10) {
-            return std::unexpected(core::ParseError{
-                .message = fmt::format("Invalid date format (expected dd-mm-yyyy): '{}'", dateStr),
-                .line = lineNumber
-            });
-        }
-        auto r1 = std::from_chars(dateStr.data(), dateStr.data() + 2, day);
-        auto r2 = std::from_chars(dateStr.data() + 3, dateStr.data() + 5, month);
-        auto r3 = std::from_chars(dateStr.data() + 6, dateStr.data() + 10, year);
-        if (r1.ec != std::errc{} || r2.ec != std::errc{} || r3.ec != std::errc{}) {
-            return std::unexpected(core::ParseError{
-                .message = fmt::format("Failed to parse date (dd-mm-yyyy): '{}'", dateStr),
-                .line = lineNumber
-            });
-        }
-    } else if (format_.dateFormat == "yyyy-mm-dd") {
-        // ISO format: yyyy-mm-dd
-        if (dateStr.size() < 10) {
-            return std::unexpected(core::ParseError{
-                .message = fmt::format("Invalid date format (expected yyyy-mm-dd): '{}'", dateStr),
-                .line = lineNumber
-            });
-        }
-        auto r1 = std::from_chars(dateStr.data(), dateStr.data() + 4, year);
-        auto r2 = std::from_chars(dateStr.data() + 5, dateStr.data() + 7, month);
-        auto r3 = std::from_chars(dateStr.data() + 8, dateStr.data() + 10, day);
-        if (r1.ec != std::errc{} || r2.ec != std::errc{} || r3.ec != std::errc{}) {
-            return std::unexpected(core::ParseError{
-                .message = fmt::format("Failed to parse date (yyyy-mm-dd): '{}'", dateStr),
-                .line = lineNumber
-            });
-        }
-    } else if (format_.dateFormat == "mm/dd/yyyy") {
-        // US format: mm/dd/yyyy
-        if (dateStr.size() < 10) {
-            return std::unexpected(core::ParseError{
-                .message = fmt::format("Invalid date format (expected mm/dd/yyyy): '{}'", dateStr),
-                .line = lineNumber
-            });
-        }
-        auto r1 = std::from_chars(dateStr.data(), dateStr.data() + 2, month);
-        auto r2 = std::from_chars(dateStr.data() + 3, dateStr.data() + 5, day);
-        auto r3 = std::from_chars(dateStr.data() + 6, dateStr.data() + 10, year);
-        if (r1.ec != std::errc{} || r2.ec != std::errc{} || r3.ec != std::errc{}) {
-            return std::unexpected(core::ParseError{
-                .message = fmt::format("Failed to parse date (mm/dd/yyyy): '{}'", dateStr),
-                .line = lineNumber
-            });
-        }
-    } else if (format_.dateFormat == "dd/mm/yyyy") {
-        // UK/European format: dd/mm/yyyy
-        if (dateStr.size() < 10) {
-            return std::unexpected(core::ParseError{
-                .message = fmt::format("Invalid date format (expected dd/mm/yyyy): '{}'", dateStr),
-                .line = lineNumber
-            });
-        }
-        auto r1 = std::from_chars(dateStr.data(), dateStr.data() + 2, day);
-        auto r2 = std::from_chars(dateStr.data() + 3, dateStr.data() + 5, month);
-        auto r3 = std::from_chars(dateStr.data() + 6, dateStr.data() + 10, year);
-        if (r1.ec != std::errc{} || r2.ec != std::errc{} || r3.ec != std::errc{}) {
-            return std::unexpected(core::ParseError{
-                .message = fmt::format("Failed to parse date (dd/mm/yyyy): '{}'", dateStr),
-                .line = lineNumber
-            });
-        }
-    } else {
-        return std::unexpected(core::ParseError{
-            .message = fmt::format("Unsupported date format: '{}'", format_.dateFormat),
-            .line = lineNumber
+    int day = 0, month = 0, year = 0;
+    auto r1 = std::from_chars(dateStr.data() + mapping.dayPos, dateStr.data() + mapping.dayPos + 2, day);
+    auto r2 = std::from_chars(dateStr.data() + mapping.monthPos, dateStr.data() + mapping.monthPos + 2, month);
+    auto r3 = std::from_chars(dateStr.data() + mapping.yearPos, dateStr.data() + mapping.yearPos + 4, year);
+    if (r1.ec != std::errc{} || r2.ec != std::errc{} || r3.ec != std::errc{}) {
+        return std::unexpected(core::LightParseError{
+            .code = core::ParseCode::InvalidDate, .line = lineNumber, .column = column
         });
     }
 
     // Validate date components
     if (month < 1 || month > 12 || day < 1 || day > 31 || year < 1900 || year > 2100) {
-        return std::unexpected(core::ParseError{
-            .message = fmt::format("Invalid date values: day={}, month={}, year={}", day, month, year),
-            .line = lineNumber
+        return std::unexpected(core::LightParseError{
+            .code = core::ParseCode::InvalidDate, .line = lineNumber, .column = column
         });
     }
 
@@ -286,80 +259,28 @@ auto GenericCsvImporter::parseDate(std::string_view dateStr, int lineNumber)
     };
 }
 
-auto GenericCsvImporter::parseAmount(std::string_view amountStr, int lineNumber)
-    -> std::expected<core::Money, core::ParseError>
+auto GenericCsvImporter::parseAmount(std::string_view amountStr, const CompiledMapping& mapping,
+                                     int lineNumber)
+    -> std::expected<core::Money, core::LightParseError>
 {
+    auto column = static_cast<int>(mapping.amountCol);
     if (amountStr.empty()) {
-        return std::unexpected(core::ParseError{
-            .message = "Empty amount field",
-            .line = lineNumber
+        return std::unexpected(core::LightParseError{
+            .code = core::ParseCode::EmptyField, .line = lineNumber, .column = column
         });
     }
 
-    std::string normalized;
-
-    if (format_.amountFormat == "european") {
-        // European format: 1.234,56 -> remove dots, replace comma with period
-        for (char c : amountStr) {
-            if (c == '.') continue;  // Skip thousand separator
-            if (c == ',') {
-                normalized += '.';   // Comma -> period for decimal
-            } else {
-                normalized += c;
-            }
-        }
-    } else {
-        // Standard format: 1,234.56 -> remove commas
-        for (char c : amountStr) {
-            if (c == ',') continue;  // Skip thousand separator
-            normalized += c;
-        }
-    }
-
-    // Trim whitespace
-    auto start = normalized.find_first_not_of(" \t");
-    if (start == std::string::npos) {
-        return std::unexpected(core::ParseError{
-            .message = fmt::format("Empty amount after normalization: '{}'", amountStr),
-            .line = lineNumber
+    // Fixed-format kernel: straight to integer cents, no normalization copy
+    // and no double round trip
+    auto format = mapping.europeanAmount ? core::AmountFormat::European
+                                         : core::AmountFormat::Standard;
+    auto cents = core::Money::parseCents(amountStr, format);
+    if (!cents) {
+        return std::unexpected(core::LightParseError{
+            .code = core::ParseCode::InvalidAmount, .line = lineNumber, .column = column
         });
     }
-    auto end = normalized.find_last_not_of(" \t");
-    normalized = normalized.substr(start, end - start + 1);
-
-    double value = 0.0;
-    auto [ptr, ec] = std::from_chars(normalized.data(), normalized.data() + normalized.size(), value);
-
-    if (ec != std::errc{}) {
-        return std::unexpected(core::ParseError{
-            .message = fmt::format("Failed to parse amount: '{}' (normalized: '{}')", amountStr, normalized),
-            .line = lineNumber
-        });
-    }
-
-    auto money = core::Money::fromDouble(value, core::Currency::EUR);
-    if (!money) {
-        return std::unexpected(core::ParseError{
-            .message = fmt::format("Failed to create Money from: '{}'", amountStr),
-            .line = lineNumber
-        });
-    }
-    return *money;
-}
-
-auto GenericCsvImporter::inferCategory(std::string_view counterparty, std::string_view description)
-    -> core::TransactionCategory
-{
-    // Check custom categorization rules first
-    if (!customRules_.empty()) {
-        auto customCategory = config::ConfigParser::matchCategory(
-            customRules_, counterparty, description);
-        if (customCategory) {
-            return *customCategory;
-        }
-    }
-
-    return core::TransactionCategory::Uncategorized;
+    return core::Money{*cents, core::Currency::EUR};
 }
 
 } // namespace ares::infrastructure::import
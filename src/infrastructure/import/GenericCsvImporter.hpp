@@ -2,6 +2,7 @@
 
 #include <expected>
 #include <filesystem>
+#include <string_view>
 #include <vector>
 #include "core/common/Error.hpp"
 #include "core/transaction/Transaction.hpp"
@@ -29,19 +30,40 @@ public:
 private:
     config::ConfiguredImportFormat format_;
     std::optional<core::AccountId> accountId_;
-    std::vector<config::CategorizationRule> customRules_;
+    config::CompiledRuleSet customRules_;
 
-    [[nodiscard]] auto parseTransaction(const CsvRow& fields, int lineNumber)
-        -> std::expected<core::Transaction, core::ParseError>;
+    // Column indices and format choices resolved once per import, so the row
+    // loop is direct indexed access with no per-row string comparisons
+    struct CompiledMapping {
+        std::size_t dateCol{0};
+        std::size_t amountCol{0};
+        int counterpartyCol{-1};
+        int descriptionCol{-1};
+        // Fixed character offsets of the date components; every supported
+        // date layout is exactly 10 characters wide
+        std::size_t dayPos{0};
+        std::size_t monthPos{0};
+        std::size_t yearPos{0};
+        bool europeanAmount{false};
+    };
 
-    [[nodiscard]] auto parseDate(std::string_view dateStr, int lineNumber)
-        -> std::expected<core::Date, core::ParseError>;
+    [[nodiscard]] auto compileMapping() const
+        -> std::expected<CompiledMapping, core::ParseError>;
 
-    [[nodiscard]] auto parseAmount(std::string_view amountStr, int lineNumber)
-        -> std::expected<core::Money, core::ParseError>;
+    // Per-row functions return the light error tier; import expands a
+    // failure into a rich ParseError with the offending field attached.
+    [[nodiscard]] auto parseTransaction(const std::vector<std::string_view>& fields,
+                                        const CompiledMapping& mapping, int lineNumber)
+        -> std::expected<core::Transaction, core::LightParseError>;
+
+    [[nodiscard]] auto parseDate(std::string_view dateStr, const CompiledMapping& mapping,
+                                 int lineNumber)
+        -> std::expected<core::Date, core::LightParseError>;
+
+    [[nodiscard]] auto parseAmount(std::string_view amountStr, const CompiledMapping& mapping,
+                                   int lineNumber)
+        -> std::expected<core::Money, core::LightParseError>;
 
-    [[nodiscard]] auto inferCategory(std::string_view counterparty, std::string_view description)
-        -> core::TransactionCategory;
 };
 
 } // namespace ares::infrastructure::import
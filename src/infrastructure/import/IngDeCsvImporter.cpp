@@ -1,44 +1,50 @@
 #include "infrastructure/import/IngDeCsvImporter.hpp"
+#include "infrastructure/import/MappedFile.hpp"
+#include "infrastructure/import/MerchantExtractor.hpp"
+#include <atomic>
 #include <algorithm>
 #include <charconv>
-#include <fstream>
-#include <sstream>
+#include <memory_resource>
 #include <fmt/format.h>
 
 namespace ares::infrastructure::import {
 
 namespace {
     auto generateTransactionId() -> std::string {
-        static int counter = 0;
-        return fmt::format("txn-de-{}", ++counter);
-    }
-
-    auto splitLine(std::string_view line, char delimiter) -> std::vector<std::string> {
-        std::vector<std::string> fields;
-        std::string field;
-
-        for (char c : line) {
-            if (c == delimiter) {
-                fields.push_back(std::move(field));
-                field.clear();
-            } else {
-                field += c;
+        // Atomic so importers can run on parallel import workers
+        static std::atomic<int> counter{0};
+        // Fixed width keeps the id inside the small-string buffer (no heap)
+        return fmt::format("txn-de-{:08d}", ++counter);
+    }
+
+    // Fields are slices of the line - the ING DE format has no quoting, so
+    // splitting never copies a byte. The caller-provided vector is reused
+    // across rows and reaches its steady capacity after the first one.
+    auto splitFieldsInto(std::string_view line, char delimiter,
+                         std::pmr::vector<std::string_view>& fields) -> void {
+        fields.clear();
+        std::size_t start = 0;
+        while (true) {
+            auto pos = line.find(delimiter, start);
+            if (pos == std::string_view::npos) {
+                fields.push_back(line.substr(start));
+                return;
             }
+            fields.push_back(line.substr(start, pos - start));
+            start = pos + 1;
         }
-        fields.push_back(std::move(field));
-        return fields;
     }
 
-    auto trim(std::string_view str) -> std::string {
+    auto trim(std::string_view str) -> std::string_view {
         auto start = str.find_first_not_of(" \t\r\n");
-        if (start == std::string_view::npos) return "";
+        if (start == std::string_view::npos) return {};
         auto end = str.find_last_not_of(" \t\r\n");
-        return std::string{str.substr(start, end - start + 1)};
+        return str.substr(start, end - start + 1);
     }
 
-    auto extractValue(const std::string& line, char delimiter) -> std::string {
+    auto extractValue(std::string_view line, char delimiter) -> std::string_view {
         auto pos = line.find(delimiter);
-        if (pos == std::string::npos) return "";
+        if (pos == std::string_view::npos) return {};
         return trim(line.substr(pos + 1));
     }
 }
@@ -48,40 +54,62 @@ IngDeCsvImporter::IngDeCsvImporter() = default;
 auto IngDeCsvImporter::import(const std::filesystem::path& filePath)
     -> std::expected<IngDeImportResult, core::Error>
 {
-    std::ifstream file{filePath};
-    if (!file) {
-        return std::unexpected(core::IoError{
-            .path = filePath.string(),
-            .message = "Failed to open file"
-        });
+    // Parse straight out of the page cache - no read syscalls or buffer copies
+    auto mapped = MappedFile::open(filePath);
+    if (!mapped) {
+        return std::unexpected(mapped.error());
     }
-
-    std::ostringstream buffer;
-    buffer << file.rdbuf();
-    std::string content = buffer.str();
-    return import(std::string_view{content});
+    return import(mapped->view());
 }
 
 auto IngDeCsvImporter::import(std::string_view csvContent)
     -> std::expected<IngDeImportResult, core::Error>
 {
-    // Split into lines
-    std::vector<std::string> lines;
-    std::istringstream stream{std::string{csvContent}};
-    std::string line;
-    while (std::getline(stream, line)) {
-        // Remove BOM if present
-        if (line.size() >= 3 &&
-            static_cast<unsigned char>(line[0]) == 0xEF &&
-            static_cast<unsigned char>(line[1]) == 0xBB &&
-            static_cast<unsigned char>(line[2]) == 0xBF) {
-            line = line.substr(3);
+    std::vector<core::Transaction> transactions;
+    auto result = importBatched(csvContent, 1024, [&transactions](std::vector<core::Transaction>&& batch) {
+        transactions.insert(transactions.end(),
+                            std::make_move_iterator(batch.begin()),
+                            std::make_move_iterator(batch.end()));
+    });
+    if (!result) {
+        return result;
+    }
+    result->transactions = std::move(transactions);
+    return result;
+}
+
+auto IngDeCsvImporter::importBatched(std::string_view csvContent, std::size_t batchSize,
+                                     const TransactionBatchHandler& onBatch)
+    -> std::expected<IngDeImportResult, core::Error>
+{
+    // Per-import arena: the line table and the per-row field scratch are
+    // bump-allocated and released together when the import returns. Lines
+    // are slices of csvContent, so splitting copies nothing.
+    std::pmr::monotonic_buffer_resource arena{64 * 1024};
+    std::pmr::vector<std::string_view> lines{&arena};
+
+    // Remove BOM if present
+    if (csvContent.starts_with("\xEF\xBB\xBF")) {
+        csvContent.remove_prefix(3);
+    }
+
+    std::size_t pos = 0;
+    while (pos < csvContent.size()) {
+        auto newline = csvContent.find('\n', pos);
+        auto line = csvContent.substr(
+            pos, newline == std::string_view::npos ? std::string_view::npos : newline - pos);
+        if (line.ends_with('\r')) {
+            line.remove_suffix(1);
         }
-        lines.push_back(std::move(line));
+        lines.push_back(line);
+        if (newline == std::string_view::npos) {
+            break;
+        }
+        pos = newline + 1;
     }
 
     // Parse metadata from header
-    auto result = parseMetadata(lines);
+    auto result = parseMetadata({lines.data(), lines.size()});
     if (!result) {
         return std::unexpected(result.error());
     }
@@ -101,22 +129,35 @@ auto IngDeCsvImporter::import(std::string_view csvContent)
         });
     }
 
-    // Parse transactions
+    // Parse transactions, flushing a batch whenever it fills up
+    std::vector<core::Transaction> batch;
+    batch.reserve(batchSize);
+    std::pmr::vector<std::string_view> fields{&arena};
+
     for (size_t i = dataStartLine; i < lines.size(); ++i) {
-        if (lines[i].empty() || lines[i].find(';') == std::string::npos) {
+        if (lines[i].empty() || lines[i].find(';') == std::string_view::npos) {
             continue;
         }
 
-        auto txn = parseTransaction(lines[i], static_cast<int>(i + 1));
+        auto txn = parseTransaction(lines[i], static_cast<int>(i + 1), fields);
         if (txn) {
-            result->transactions.push_back(std::move(*txn));
+            batch.push_back(std::move(*txn));
             ++result->successfulRows;
+            if (batch.size() >= batchSize) {
+                onBatch(std::move(batch));
+                batch = {};
+                batch.reserve(batchSize);
+            }
         } else {
-            result->errors.push_back(txn.error());
+            result->errors.push_back(core::expandParseError(txn.error(), lines[i]));
         }
         ++result->totalRows;
     }
 
+    if (!batch.empty()) {
+        onBatch(std::move(batch));
+    }
+
     return result;
 }
 
@@ -125,10 +166,10 @@ auto IngDeCsvImporter::setAccountId(core::AccountId accountId) -> void {
 }
 
 auto IngDeCsvImporter::setCategorizationRules(std::vector<config::CategorizationRule> rules) -> void {
-    customRules_ = std::move(rules);
+    customRules_ = config::ConfigParser::compileRules(std::move(rules));
 }
 
-auto IngDeCsvImporter::parseMetadata(const std::vector<std::string>& lines)
+auto IngDeCsvImporter::parseMetadata(std::span<const std::string_view> lines)
     -> std::expected<IngDeImportResult, core::ParseError>
 {
     IngDeImportResult result;
@@ -143,7 +184,8 @@ auto IngDeCsvImporter::parseMetadata(const std::vector<std::string>& lines)
         } else if (line.starts_with("Kunde;")) {
             result.customerName = extractValue(line, ';');
         } else if (line.starts_with("Saldo;")) {
-            auto fields = splitLine(line, ';');
+            std::pmr::vector<std::string_view> fields;
+            splitFieldsInto(line, ';', fields);
             if (fields.size() >= 2) {
                 auto balance = parseGermanAmount(fields[1]);
                 if (balance) {
@@ -158,16 +200,18 @@ auto IngDeCsvImporter::parseMetadata(const std::vector<std::string>& lines)
     return result;
 }
 
-auto IngDeCsvImporter::parseTransaction(const std::string& line, int lineNumber)
-    -> std::expected<core::Transaction, core::ParseError>
+auto IngDeCsvImporter::parseTransaction(std::string_view line, int lineNumber,
+                                        std::pmr::vector<std::string_view>& fields)
+    -> std::expected<core::Transaction, core::LightParseError>
 {
     // Columns: Buchung;Wertstellungsdatum;Auftraggeber/Empfänger;Buchungstext;Verwendungszweck;Saldo;Währung;Betrag;Währung
-    auto fields = splitLine(line, ';');
+    splitFieldsInto(line, ';', fields);
 
     if (fields.size() < 9) {
-        return std::unexpected(core::ParseError{
-            .message = fmt::format("Row has insufficient columns ({}), expected 9", fields.size()),
-            .line = lineNumber
+        return std::unexpected(core::LightParseError{
+            .code = core::ParseCode::InsufficientColumns,
+            .line = lineNumber,
+            .column = static_cast<int>(fields.size())
         });
     }
 
@@ -176,6 +220,7 @@ auto IngDeCsvImporter::parseTransaction(const std::string& line, int lineNumber)
     if (!date) {
         auto err = date.error();
         err.line = lineNumber;
+        err.column = 0;
         return std::unexpected(err);
     }
 
@@ -184,6 +229,7 @@ auto IngDeCsvImporter::parseTransaction(const std::string& line, int lineNumber)
     if (!amount) {
         auto err = amount.error();
         err.line = lineNumber;
+        err.column = 7;
         return std::unexpected(err);
     }
 
@@ -208,8 +254,8 @@ auto IngDeCsvImporter::parseTransaction(const std::string& line, int lineNumber)
 
     // Set description from Verwendungszweck (column 4)
     if (!fields[4].empty()) {
-        txn.setDescription(trim(fields[4]));
-        txn.setRawDescription(trim(fields[4]));
+        txn.setDescription(std::string{trim(fields[4])});
+        txn.setRawDescription(std::string{trim(fields[4])});
     }
 
     // Set mutation code from Buchungstext (column 3)
@@ -217,21 +263,32 @@ auto IngDeCsvImporter::parseTransaction(const std::string& line, int lineNumber)
         txn.setMutationCode(trim(fields[3]));
     }
 
-    // Infer category
-    auto category = inferCategory(fields[2], fields[4]);
-    txn.setCategory(category);
+    // Extract the real merchant behind PayPal charges once, here; everything
+    // downstream (categorization, recurrence grouping) reads the stored value
+    auto merchant = extractPayPalMerchant(fields[2], fields[4]);
+    if (merchant) {
+        txn.setMerchant(*merchant);
+    }
+
+    // Infer category - custom rules first, recording which rule matched so
+    // incremental recategorization knows which rows a rule edit affects
+    const auto* match = config::ConfigParser::matchCompiled(customRules_, fields[2], fields[4]);
+    if (match) {
+        txn.setCategory(match->rule.category);
+        txn.setMatchedRule(match->rule.pattern.empty() ? "custom" : match->rule.pattern);
+    } else {
+        txn.setCategory(inferCategory(fields[2], fields[4], merchant.value_or(std::string_view{})));
+    }
 
     return txn;
 }
 
 auto IngDeCsvImporter::parseGermanDate(std::string_view dateStr)
-    -> std::expected<core::Date, core::ParseError>
+    -> std::expected<core::Date, core::LightParseError>
 {
     // German format: dd.mm.yyyy
     if (dateStr.size() < 10) {
-        return std::unexpected(core::ParseError{
-            .message = fmt::format("Invalid date format: {}", dateStr)
-        });
+        return std::unexpected(core::LightParseError{.code = core::ParseCode::InvalidDate});
     }
 
     int day, month, year;
@@ -240,9 +297,7 @@ auto IngDeCsvImporter::parseGermanDate(std::string_view dateStr)
     auto res3 = std::from_chars(dateStr.data() + 6, dateStr.data() + 10, year);
 
     if (res1.ec != std::errc{} || res2.ec != std::errc{} || res3.ec != std::errc{}) {
-        return std::unexpected(core::ParseError{
-            .message = fmt::format("Failed to parse date: {}", dateStr)
-        });
+        return std::unexpected(core::LightParseError{.code = core::ParseCode::InvalidDate});
     }
 
     return core::Date{
@@ -253,86 +308,37 @@ auto IngDeCsvImporter::parseGermanDate(std::string_view dateStr)
 }
 
 auto IngDeCsvImporter::parseGermanAmount(std::string_view amountStr)
-    -> std::expected<core::Money, core::ParseError>
+    -> std::expected<core::Money, core::LightParseError>
 {
-    // German format: -1.234,56 or 1.234,56
-    // Remove dots (thousand separators), replace comma with period
-    std::string normalized;
-    for (char c : amountStr) {
-        if (c == '.') continue;  // Skip thousand separator
-        if (c == ',') {
-            normalized += '.';   // Comma -> period for decimal
-        } else {
-            normalized += c;
-        }
-    }
-
-    // Trim whitespace
-    auto start = normalized.find_first_not_of(" \t");
-    if (start == std::string::npos) {
-        return std::unexpected(core::ParseError{
-            .message = fmt::format("Empty amount: {}", amountStr)
-        });
-    }
-    auto end = normalized.find_last_not_of(" \t");
-    normalized = normalized.substr(start, end - start + 1);
-
-    double value = 0.0;
-    auto [ptr, ec] = std::from_chars(normalized.data(), normalized.data() + normalized.size(), value);
-
-    if (ec != std::errc{}) {
-        return std::unexpected(core::ParseError{
-            .message = fmt::format("Failed to parse amount: {} (normalized: {})", amountStr, normalized)
+    // German format: -1.234,56 or 1.234,56 — dots are thousand separators,
+    // the comma is the decimal point. The shared fixed-format kernel scans
+    // straight into integer cents, with no intermediate string or double
+    // round trip.
+    auto cents = core::Money::parseCents(amountStr, core::AmountFormat::European);
+    if (!cents) {
+        return std::unexpected(core::LightParseError{
+            .code = amountStr.empty() ? core::ParseCode::EmptyField
+                                      : core::ParseCode::InvalidAmount
         });
     }
-
-    auto money = core::Money::fromDouble(value, core::Currency::EUR);
-    if (!money) {
-        return std::unexpected(core::ParseError{
-            .message = fmt::format("Failed to create Money from: {}", amountStr)
-        });
-    }
-    return *money;
+    return core::Money{*cents, core::Currency::EUR};
 }
 
-auto IngDeCsvImporter::inferCategory(std::string_view counterparty, std::string_view description)
+auto IngDeCsvImporter::inferCategory(std::string_view counterparty, std::string_view description,
+                                     std::string_view merchant)
     -> core::TransactionCategory
 {
-    // Check custom categorization rules first
-    if (!customRules_.empty()) {
-        auto customCategory = config::ConfigParser::matchCategory(
-            customRules_, counterparty, description);
-        if (customCategory) {
-            return *customCategory;
-        }
-    }
+    // Built-in rules only; custom rules are matched by the caller so the
+    // matched rule can be recorded on the transaction
 
-    // Convert to lowercase for matching
+    // Convert to lowercase for matching. For PayPal charges the extracted
+    // merchant replaces the memo - matching against the full memo would hit
+    // the boilerplate around the merchant name, not the merchant.
     std::string cp{counterparty};
-    std::string desc{description};
+    std::string desc{merchant.empty() ? description : merchant};
     std::transform(cp.begin(), cp.end(), cp.begin(), ::tolower);
     std::transform(desc.begin(), desc.end(), desc.begin(), ::tolower);
 
-    // Extract actual merchant from PayPal descriptions
-    // Format: "...Ihr Einkauf bei MERCHANT NAME" or "/. MERCHANT NAME ,"
-    std::string paypalMerchant;
-    if (cp.find("paypal") != std::string::npos) {
-        auto pos = desc.find("einkauf bei ");
-        if (pos != std::string::npos) {
-            paypalMerchant = desc.substr(pos + 12);
-            // Also check the merchant name
-            desc = paypalMerchant;
-        }
-        pos = desc.find("/. ");
-        if (pos != std::string::npos) {
-            auto end = desc.find(" ,", pos);
-            if (end != std::string::npos) {
-                paypalMerchant = desc.substr(pos + 3, end - pos - 3);
-                desc = paypalMerchant;
-            }
-        }
-    }
-
     // Salary / Income patterns
     if (cp.find("gehalt") != std::string::npos || cp.find("lohn") != std::string::npos ||
         desc.find("gehalt") != std::string::npos || desc.find("salary") != std::string::npos ||
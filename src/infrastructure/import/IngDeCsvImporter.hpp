@@ -2,6 +2,10 @@
 
 #include <expected>
 #include <filesystem>
+#include <functional>
+#include <memory_resource>
+#include <span>
+#include <string_view>
 #include <vector>
 #include "core/common/Error.hpp"
 #include "core/transaction/Transaction.hpp"
@@ -34,6 +38,17 @@ public:
     [[nodiscard]] auto import(std::string_view csvContent)
         -> std::expected<IngDeImportResult, core::Error>;
 
+    // Invoked with up to batchSize parsed transactions at a time
+    using TransactionBatchHandler = std::function<void(std::vector<core::Transaction>&&)>;
+
+    // Batched import: transactions are handed to `onBatch` as they are
+    // parsed and categorized instead of being materialized in the result,
+    // so persistence can overlap with parsing. The returned result carries
+    // metadata and counts; its transactions vector stays empty.
+    [[nodiscard]] auto importBatched(std::string_view csvContent, std::size_t batchSize,
+                                     const TransactionBatchHandler& onBatch)
+        -> std::expected<IngDeImportResult, core::Error>;
+
     auto setAccountId(core::AccountId accountId) -> void;
 
     // Set custom categorization rules (checked before built-in rules)
@@ -41,21 +56,26 @@ public:
 
 private:
     std::optional<core::AccountId> accountId_;
-    std::vector<config::CategorizationRule> customRules_;
+    config::CompiledRuleSet customRules_;
 
-    [[nodiscard]] auto parseMetadata(const std::vector<std::string>& lines)
+    [[nodiscard]] auto parseMetadata(std::span<const std::string_view> lines)
         -> std::expected<IngDeImportResult, core::ParseError>;
 
-    [[nodiscard]] auto parseTransaction(const std::string& line, int lineNumber)
-        -> std::expected<core::Transaction, core::ParseError>;
+    // Per-row functions return the light error tier: a code + location that
+    // costs nothing to construct; importBatched expands failures into rich
+    // ParseErrors while the source line is still in view.
+    [[nodiscard]] auto parseTransaction(std::string_view line, int lineNumber,
+                                        std::pmr::vector<std::string_view>& fields)
+        -> std::expected<core::Transaction, core::LightParseError>;
 
     [[nodiscard]] auto parseGermanDate(std::string_view dateStr)
-        -> std::expected<core::Date, core::ParseError>;
+        -> std::expected<core::Date, core::LightParseError>;
 
     [[nodiscard]] auto parseGermanAmount(std::string_view amountStr)
-        -> std::expected<core::Money, core::ParseError>;
+        -> std::expected<core::Money, core::LightParseError>;
 
-    [[nodiscard]] auto inferCategory(std::string_view counterparty, std::string_view description)
+    [[nodiscard]] auto inferCategory(std::string_view counterparty, std::string_view description,
+                                     std::string_view merchant)
         -> core::TransactionCategory;
 };
 
@@ -0,0 +1,81 @@
+#include "infrastructure/import/MappedFile.hpp"
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace ares::infrastructure::import {
+
+auto MappedFile::open(const std::filesystem::path& filePath)
+    -> std::expected<MappedFile, core::Error>
+{
+    int fd = ::open(filePath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return std::unexpected(core::IoError{
+            .path = filePath.string(),
+            .message = "Failed to open file"
+        });
+    }
+
+    struct stat fileInfo{};
+    if (::fstat(fd, &fileInfo) != 0) {
+        ::close(fd);
+        return std::unexpected(core::IoError{
+            .path = filePath.string(),
+            .message = "Failed to stat file"
+        });
+    }
+
+    MappedFile mapped;
+    mapped.size_ = static_cast<std::size_t>(fileInfo.st_size);
+
+    // mmap rejects zero-length mappings; an empty file is simply an empty view
+    if (mapped.size_ > 0) {
+        void* data = ::mmap(nullptr, mapped.size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            ::close(fd);
+            return std::unexpected(core::IoError{
+                .path = filePath.string(),
+                .message = "Failed to memory-map file"
+            });
+        }
+        mapped.data_ = data;
+
+        // Imports read the file front to back; let the kernel read ahead
+        ::madvise(data, mapped.size_, MADV_SEQUENTIAL);
+    }
+
+    // The mapping stays valid after the descriptor is closed
+    ::close(fd);
+    return mapped;
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data_{std::exchange(other.data_, nullptr)}
+    , size_{std::exchange(other.size_, 0)}
+{}
+
+auto MappedFile::operator=(MappedFile&& other) noexcept -> MappedFile& {
+    if (this != &other) {
+        if (data_ != nullptr) {
+            ::munmap(data_, size_);
+        }
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+    }
+    return *this;
+}
+
+MappedFile::~MappedFile() {
+    if (data_ != nullptr) {
+        ::munmap(data_, size_);
+    }
+}
+
+auto MappedFile::view() const -> std::string_view {
+    return {static_cast<const char*>(data_), size_};
+}
+
+} // namespace ares::infrastructure::import
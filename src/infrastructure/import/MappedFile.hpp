@@ -0,0 +1,38 @@
+#pragma once
+
+#include <expected>
+#include <filesystem>
+#include <string_view>
+#include "core/common/Error.hpp"
+
+namespace ares::infrastructure::import {
+
+// Read-only memory-mapped file. Importers parse directly out of the page
+// cache through view() with no read syscalls or buffer copies; the mapping
+// is released when the object goes out of scope.
+class MappedFile {
+public:
+    [[nodiscard]] static auto open(const std::filesystem::path& filePath)
+        -> std::expected<MappedFile, core::Error>;
+
+    MappedFile(const MappedFile&) = delete;
+    auto operator=(const MappedFile&) -> MappedFile& = delete;
+
+    MappedFile(MappedFile&& other) noexcept;
+    auto operator=(MappedFile&& other) noexcept -> MappedFile&;
+
+    ~MappedFile();
+
+    // View over the mapped bytes; valid for the lifetime of this object
+    [[nodiscard]] auto view() const -> std::string_view;
+
+    [[nodiscard]] auto size() const -> std::size_t { return size_; }
+
+private:
+    MappedFile() = default;
+
+    void* data_{nullptr};
+    std::size_t size_{0};
+};
+
+} // namespace ares::infrastructure::import
@@ -0,0 +1,76 @@
+#include "infrastructure/import/MerchantExtractor.hpp"
+#include <cctype>
+
+namespace ares::infrastructure::import {
+
+namespace {
+
+auto toLower(char c) -> char {
+    return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+}
+
+// Case-insensitive fixed-pattern scan; `needle` must already be lowercase.
+// One pass over the haystack, no allocation.
+auto findPattern(std::string_view haystack, std::string_view needle) -> std::size_t {
+    if (needle.size() > haystack.size()) {
+        return std::string_view::npos;
+    }
+    for (std::size_t i = 0; i + needle.size() <= haystack.size(); ++i) {
+        std::size_t j = 0;
+        while (j < needle.size() && toLower(haystack[i + j]) == needle[j]) {
+            ++j;
+        }
+        if (j == needle.size()) {
+            return i;
+        }
+    }
+    return std::string_view::npos;
+}
+
+auto trimSpaces(std::string_view text) -> std::string_view {
+    while (!text.empty() && text.front() == ' ') {
+        text.remove_prefix(1);
+    }
+    while (!text.empty() && text.back() == ' ') {
+        text.remove_suffix(1);
+    }
+    return text;
+}
+
+constexpr std::string_view kBracketOpen = "/. ";
+constexpr std::string_view kBracketClose = " ,";
+constexpr std::string_view kPurchaseMarker = "einkauf bei ";
+
+} // namespace
+
+auto extractPayPalMerchant(std::string_view counterparty, std::string_view memo)
+    -> std::optional<std::string_view>
+{
+    if (findPattern(counterparty, "paypal") == std::string_view::npos) {
+        return std::nullopt;
+    }
+
+    // Bracketed form first: it appears when the merchant name precedes
+    // the "Ihr Einkauf bei" marker, so checking the suffix form first
+    // would grab an empty remainder
+    if (auto open = memo.find(kBracketOpen); open != std::string_view::npos) {
+        auto begin = open + kBracketOpen.size();
+        if (auto close = memo.find(kBracketClose, begin); close != std::string_view::npos) {
+            auto merchant = trimSpaces(memo.substr(begin, close - begin));
+            if (!merchant.empty()) {
+                return merchant;
+            }
+        }
+    }
+
+    if (auto pos = findPattern(memo, kPurchaseMarker); pos != std::string_view::npos) {
+        auto merchant = trimSpaces(memo.substr(pos + kPurchaseMarker.size()));
+        if (!merchant.empty()) {
+            return merchant;
+        }
+    }
+
+    return std::nullopt;
+}
+
+} // namespace ares::infrastructure::import
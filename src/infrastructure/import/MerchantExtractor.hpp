@@ -0,0 +1,26 @@
+#pragma once
+
+#include <optional>
+#include <string_view>
+
+namespace ares::infrastructure::import {
+
+// PayPal merchant extraction. ING hides the real merchant behind a
+// "PayPal" counterparty; when present at all, it lives in the
+// Verwendungszweck memo in one of two fixed shapes:
+//
+//   "<ref>/. MERCHANT NAME , Ihr Einkauf bei"   (bracketed form)
+//   "... Ihr Einkauf bei MERCHANT NAME"          (suffix form)
+//
+// "Allgemeine Zahlung" memos carry no merchant and yield nullopt.
+//
+// The matcher scans the memo once per fixed pattern, case-insensitively
+// and without copying - the result is a trimmed view into `memo`, valid
+// only as long as the memo's storage. Meant to run once per transaction
+// at import; the extracted merchant is persisted so categorization and
+// recurrence grouping never re-parse the memo.
+[[nodiscard]] auto extractPayPalMerchant(std::string_view counterparty,
+                                         std::string_view memo)
+    -> std::optional<std::string_view>;
+
+} // namespace ares::infrastructure::import
@@ -1,15 +1,103 @@
 #include "infrastructure/persistence/DatabaseConnection.hpp"
+#include <fmt/format.h>
 #include "infrastructure/persistence/MigrationRunner.hpp"
 
 namespace ares::infrastructure::persistence {
 
+namespace {
+
+// Savepoint name for one nesting depth; depth 0 is the real transaction
+auto savepointName(int depth) -> std::string {
+    return fmt::format("ares_sp_{}", depth);
+}
+
+} // namespace
+
+DatabaseConnection::TransactionGuard::TransactionGuard(DatabaseConnection& db, int depth)
+    : db_{&db}
+    , depth_{depth}
+{}
+
+DatabaseConnection::TransactionGuard::TransactionGuard(TransactionGuard&& other) noexcept
+    : db_{other.db_}
+    , depth_{other.depth_}
+    , done_{other.done_}
+{
+    other.db_ = nullptr;
+}
+
+auto DatabaseConnection::TransactionGuard::operator=(TransactionGuard&& other) noexcept
+    -> TransactionGuard&
+{
+    if (this != &other) {
+        rollback();
+        db_ = other.db_;
+        depth_ = other.depth_;
+        done_ = other.done_;
+        other.db_ = nullptr;
+    }
+    return *this;
+}
+
+DatabaseConnection::TransactionGuard::~TransactionGuard() {
+    rollback();
+}
+
+auto DatabaseConnection::TransactionGuard::rollback() -> void {
+    if (!db_ || done_) {
+        return;
+    }
+    --db_->transactionDepth_;
+    if (depth_ == 0) {
+        (void)db_->execute("ROLLBACK");
+    } else {
+        // ROLLBACK TO leaves the savepoint on the stack; RELEASE pops it
+        (void)db_->execute("ROLLBACK TO " + savepointName(depth_));
+        (void)db_->execute("RELEASE " + savepointName(depth_));
+    }
+    db_ = nullptr;
+}
+
+auto DatabaseConnection::TransactionGuard::commit() -> std::expected<void, core::Error> {
+    done_ = true;
+    --db_->transactionDepth_;
+    if (depth_ == 0) {
+        if (auto result = db_->execute("COMMIT"); !result) {
+            (void)db_->execute("ROLLBACK");
+            return result;
+        }
+        return {};
+    }
+    if (auto result = db_->execute("RELEASE " + savepointName(depth_)); !result) {
+        (void)db_->execute("ROLLBACK TO " + savepointName(depth_));
+        (void)db_->execute("RELEASE " + savepointName(depth_));
+        return result;
+    }
+    return {};
+}
+
+auto DatabaseConnection::beginTransaction() -> std::expected<TransactionGuard, core::Error> {
+    auto depth = transactionDepth_;
+    auto opened = depth == 0
+        ? execute("BEGIN TRANSACTION")
+        : execute("SAVEPOINT " + savepointName(depth));
+    if (!opened) {
+        return std::unexpected(opened.error());
+    }
+    ++transactionDepth_;
+    return TransactionGuard{*this, depth};
+}
+
 DatabaseConnection::~DatabaseConnection() {
+    for (auto& [sql, stmt] : statementCache_) {
+        sqlite3_finalize(stmt);
+    }
     if (db_) {
         sqlite3_close(db_);
     }
 }
 
-auto DatabaseConnection::open(const std::filesystem::path& dbPath)
+auto DatabaseConnection::open(const std::filesystem::path& dbPath, DurabilityProfile profile)
     -> std::expected<std::unique_ptr<DatabaseConnection>, core::Error>
 {
     auto conn = std::unique_ptr<DatabaseConnection>(new DatabaseConnection());
@@ -22,6 +110,52 @@ auto DatabaseConnection::open(const std::filesystem::path& dbPath)
         });
     }
 
+    // INSERT OR REPLACE performs an implicit delete that only fires the
+    // delete triggers keeping the FTS index in sync with its content table
+    // when recursive triggers are on; without it the index drifts silently
+    if (auto result = conn->execute("PRAGMA recursive_triggers=ON;"); !result) {
+        return std::unexpected(result.error());
+    }
+
+    // Import-heavy sessions are fsync-bound with SQLite's defaults; WAL with
+    // NORMAL synchronous cuts batch write latency several-fold and allows
+    // concurrent readers. The larger page cache (8 MB) and in-memory temp
+    // store help the aggregate queries behind the reports.
+    if (profile == DurabilityProfile::Tuned) {
+        if (auto result = conn->execute(
+                "PRAGMA journal_mode=WAL;"
+                "PRAGMA synchronous=NORMAL;"
+                "PRAGMA cache_size=-8000;"
+                "PRAGMA temp_store=MEMORY;"); !result) {
+            return std::unexpected(result.error());
+        }
+    }
+
+    return conn;
+}
+
+auto DatabaseConnection::openReadOnly(const std::filesystem::path& dbPath)
+    -> std::expected<std::unique_ptr<DatabaseConnection>, core::Error>
+{
+    auto conn = std::unique_ptr<DatabaseConnection>(new DatabaseConnection());
+
+    int rc = sqlite3_open_v2(dbPath.string().c_str(), &conn->db_,
+                             SQLITE_OPEN_READONLY, nullptr);
+    if (rc != SQLITE_OK) {
+        return std::unexpected(core::DatabaseError{
+            .operation = "openReadOnly",
+            .message = sqlite3_errmsg(conn->db_)
+        });
+    }
+
+    // Same cache/temp tuning as the writer; journal_mode is a property of
+    // the database file and cannot (and need not) be set read-only
+    if (auto result = conn->execute(
+            "PRAGMA cache_size=-8000;"
+            "PRAGMA temp_store=MEMORY;"); !result) {
+        return std::unexpected(result.error());
+    }
+
     return conn;
 }
 
@@ -43,6 +177,27 @@ auto DatabaseConnection::execute(const std::string& sql)
     return {};
 }
 
+auto DatabaseConnection::prepareCached(const std::string& sql)
+    -> std::expected<sqlite3_stmt*, core::Error>
+{
+    if (auto it = statementCache_.find(sql); it != statementCache_.end()) {
+        sqlite3_reset(it->second);
+        sqlite3_clear_bindings(it->second);
+        return it->second;
+    }
+
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v2(db_, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
+        return std::unexpected(core::DatabaseError{
+            .operation = "prepare",
+            .message = sqlite3_errmsg(db_)
+        });
+    }
+
+    statementCache_.emplace(sql, stmt);
+    return stmt;
+}
+
 auto DatabaseConnection::initializeSchema() -> std::expected<void, core::Error> {
     auto runner = createMigrationRunner();
     return runner.run(*this);
@@ -4,16 +4,69 @@
 #include <filesystem>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <sqlite3.h>
 #include "core/common/Error.hpp"
 
 namespace ares::infrastructure::persistence {
 
+// How much durability to trade for write speed when opening a connection.
+// Tuned uses WAL with NORMAL synchronous - an OS crash can lose the most
+// recent transactions but never corrupts the database; Durable keeps
+// SQLite's FULL-sync defaults.
+enum class DurabilityProfile {
+    Tuned,
+    Durable
+};
+
 class DatabaseConnection {
 public:
     ~DatabaseConnection();
 
-    [[nodiscard]] static auto open(const std::filesystem::path& dbPath)
+    // RAII transaction scope. The outermost guard runs BEGIN/COMMIT; any
+    // guard opened while one is active maps to SAVEPOINT/RELEASE instead,
+    // so composite operations can wrap already-transactional building
+    // blocks (batch saves, rollup maintenance, balance updates) and the
+    // whole unit commits with a single journal sync. A guard destroyed
+    // without commit() rolls its scope back - inner scopes unwind to
+    // their savepoint, the outermost aborts the transaction.
+    class TransactionGuard {
+    public:
+        TransactionGuard(TransactionGuard&& other) noexcept;
+        auto operator=(TransactionGuard&& other) noexcept -> TransactionGuard&;
+        ~TransactionGuard();
+
+        TransactionGuard(const TransactionGuard&) = delete;
+        auto operator=(const TransactionGuard&) -> TransactionGuard& = delete;
+
+        [[nodiscard]] auto commit() -> std::expected<void, core::Error>;
+
+    private:
+        friend class DatabaseConnection;
+        TransactionGuard(DatabaseConnection& db, int depth);
+
+        // Unwinds this scope if it is still open; shared by the
+        // destructor and move-assignment
+        auto rollback() -> void;
+
+        DatabaseConnection* db_{nullptr};
+        int depth_{0};
+        bool done_{false};
+    };
+
+    // Opens a transaction scope at the current nesting depth. Scopes must
+    // be committed or destroyed in reverse order of creation, all on the
+    // connection's thread.
+    [[nodiscard]] auto beginTransaction() -> std::expected<TransactionGuard, core::Error>;
+
+    [[nodiscard]] static auto open(const std::filesystem::path& dbPath,
+                                   DurabilityProfile profile = DurabilityProfile::Tuned)
+        -> std::expected<std::unique_ptr<DatabaseConnection>, core::Error>;
+
+    // Opens an additional read-only connection to an existing database.
+    // With the WAL journal (the Tuned default) read-only connections can
+    // run concurrently with each other and with the writer.
+    [[nodiscard]] static auto openReadOnly(const std::filesystem::path& dbPath)
         -> std::expected<std::unique_ptr<DatabaseConnection>, core::Error>;
 
     [[nodiscard]] auto execute(const std::string& sql)
@@ -21,11 +74,20 @@ public:
 
     [[nodiscard]] auto handle() -> sqlite3* { return db_; }
 
+    // Returns a prepared statement for sql, compiling it on first use and
+    // reusing the compiled statement afterwards. The statement is reset with
+    // cleared bindings when handed out; callers bind and step as usual but
+    // must not finalize it - the connection owns all cached statements.
+    [[nodiscard]] auto prepareCached(const std::string& sql)
+        -> std::expected<sqlite3_stmt*, core::Error>;
+
     auto initializeSchema() -> std::expected<void, core::Error>;
 
 private:
     DatabaseConnection() = default;
     sqlite3* db_{nullptr};
+    std::unordered_map<std::string, sqlite3_stmt*> statementCache_;
+    int transactionDepth_{0};
 };
 
 } // namespace ares::infrastructure::persistence
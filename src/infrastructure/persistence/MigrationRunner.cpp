@@ -1,6 +1,9 @@
 #include "infrastructure/persistence/MigrationRunner.hpp"
 #include "infrastructure/persistence/DatabaseConnection.hpp"
+#include "infrastructure/persistence/TransactionContentHash.hpp"
+#include "infrastructure/import/MerchantExtractor.hpp"
 #include <algorithm>
+#include <unordered_set>
 #include <sqlite3.h>
 
 namespace ares::infrastructure::persistence {
@@ -53,34 +56,37 @@ auto MigrationRunner::run(DatabaseConnection& db)
         }
 
         // Each migration runs in a transaction
-        auto beginResult = db.execute("BEGIN TRANSACTION");
-        if (!beginResult) {
-            return beginResult;
+        auto scope = db.beginTransaction();
+        if (!scope) {
+            return std::unexpected(scope.error());
         }
 
         auto applyResult = migration.apply(db);
         if (!applyResult) {
-            // Rollback on failure
-            (void)db.execute("ROLLBACK");
             return applyResult;
         }
 
         auto versionSetResult = setVersion(db, migration.version);
         if (!versionSetResult) {
-            (void)db.execute("ROLLBACK");
             return versionSetResult;
         }
 
-        auto commitResult = db.execute("COMMIT");
-        if (!commitResult) {
-            (void)db.execute("ROLLBACK");
-            return commitResult;
+        if (auto committed = scope->commit(); !committed) {
+            return committed;
         }
     }
 
     return {};
 }
 
+auto MigrationRunner::latestVersion() const -> int {
+    int latest = 0;
+    for (const auto& migration : migrations_) {
+        latest = std::max(latest, migration.version);
+    }
+    return latest;
+}
+
 auto MigrationRunner::getCurrentVersion(DatabaseConnection& db)
     -> std::expected<int, core::Error>
 {
@@ -269,6 +275,549 @@ auto createMigrationRunner() -> MigrationRunner {
         }
     });
 
+    // Migration v2: import ledger for incremental directory imports
+    runner.registerMigration({
+        .version = 2,
+        .description = "Import ledger",
+        .apply = [](DatabaseConnection& db) -> std::expected<void, core::Error> {
+            const char* schema = R"(
+                CREATE TABLE IF NOT EXISTS import_ledger (
+                    path TEXT PRIMARY KEY,
+                    content_hash TEXT NOT NULL,
+                    file_size INTEGER NOT NULL,
+                    modified_at INTEGER NOT NULL,
+                    imported_at TEXT DEFAULT CURRENT_TIMESTAMP
+                );
+            )";
+
+            return db.execute(schema);
+        }
+    });
+
+    // Migration v3: secondary indexes for the transaction query patterns
+    // (findByAccount, findByDateRange, findByCategory, the exists() probe)
+    runner.registerMigration({
+        .version = 3,
+        .description = "Transaction indexes",
+        .apply = [](DatabaseConnection& db) -> std::expected<void, core::Error> {
+            const char* schema = R"(
+                CREATE INDEX IF NOT EXISTS idx_transactions_account_date
+                    ON transactions(account_id, date);
+                CREATE INDEX IF NOT EXISTS idx_transactions_category
+                    ON transactions(category);
+                CREATE INDEX IF NOT EXISTS idx_transactions_duplicate_probe
+                    ON transactions(account_id, date, amount_cents, counterparty_name);
+            )";
+
+            return db.execute(schema);
+        }
+    });
+
+    // Migration v4: store transaction dates as integer epoch days. Range
+    // predicates become integer comparisons and hydration drops per-row
+    // string parsing. SQLite cannot change a column's affinity in place, so
+    // the table is rebuilt; strftime('%s') of a date-only string is midnight
+    // UTC, so the division is exact.
+    runner.registerMigration({
+        .version = 4,
+        .description = "Epoch-day transaction dates",
+        .apply = [](DatabaseConnection& db) -> std::expected<void, core::Error> {
+            const char* schema = R"(
+                CREATE TABLE transactions_v4 (
+                    id TEXT PRIMARY KEY,
+                    account_id TEXT NOT NULL,
+                    date INTEGER NOT NULL,
+                    amount_cents INTEGER NOT NULL,
+                    currency INTEGER DEFAULT 0,
+                    type INTEGER NOT NULL,
+                    category INTEGER DEFAULT 0,
+                    description TEXT,
+                    counterparty_name TEXT,
+                    counterparty_iban TEXT,
+                    raw_description TEXT,
+                    mutation_code TEXT,
+                    is_recurring INTEGER DEFAULT 0,
+                    frequency TEXT,
+                    is_active INTEGER DEFAULT 1,
+                    user_category_override INTEGER,
+                    created_at TEXT DEFAULT CURRENT_TIMESTAMP,
+                    FOREIGN KEY (account_id) REFERENCES accounts(id)
+                );
+
+                INSERT INTO transactions_v4
+                SELECT id, account_id,
+                       CASE WHEN typeof(date) = 'text'
+                            THEN CAST(strftime('%s', date) AS INTEGER) / 86400
+                            ELSE date END,
+                       amount_cents, currency, type, category, description,
+                       counterparty_name, counterparty_iban, raw_description,
+                       mutation_code, is_recurring, frequency, is_active,
+                       user_category_override, created_at
+                FROM transactions;
+
+                DROP TABLE transactions;
+                ALTER TABLE transactions_v4 RENAME TO transactions;
+
+                CREATE INDEX IF NOT EXISTS idx_transactions_account ON transactions(account_id);
+                CREATE INDEX IF NOT EXISTS idx_transactions_date ON transactions(date);
+                CREATE INDEX IF NOT EXISTS idx_transactions_category ON transactions(category);
+                CREATE INDEX IF NOT EXISTS idx_transactions_recurring ON transactions(is_recurring);
+                CREATE INDEX IF NOT EXISTS idx_transactions_account_date
+                    ON transactions(account_id, date);
+                CREATE INDEX IF NOT EXISTS idx_transactions_duplicate_probe
+                    ON transactions(account_id, date, amount_cents, counterparty_name);
+            )";
+
+            return db.execute(schema);
+        }
+    });
+
+    // Migration v5: matched-rule tracking for incremental recategorization.
+    // Each row remembers which rule produced its category; the state table
+    // holds the rule set as of the last categorize run, so the next run can
+    // re-evaluate only the rows affected by the rules that changed.
+    runner.registerMigration({
+        .version = 5,
+        .description = "Matched-rule tracking",
+        .apply = [](DatabaseConnection& db) -> std::expected<void, core::Error> {
+            const char* schema = R"(
+                ALTER TABLE transactions ADD COLUMN matched_rule TEXT;
+
+                CREATE TABLE IF NOT EXISTS categorization_state (
+                    rule_key TEXT PRIMARY KEY,
+                    category INTEGER NOT NULL,
+                    position INTEGER NOT NULL
+                );
+
+                CREATE INDEX IF NOT EXISTS idx_transactions_matched_rule
+                    ON transactions(matched_rule);
+            )";
+
+            return db.execute(schema);
+        }
+    });
+
+    // Migration v6: grouped state for incremental recurrence detection.
+    // One row per normalized counterparty group records how many
+    // transactions it had and its newest date as of the last detection
+    // run; unchanged groups are skipped next time.
+    runner.registerMigration({
+        .version = 6,
+        .description = "Recurrence group state",
+        .apply = [](DatabaseConnection& db) -> std::expected<void, core::Error> {
+            const char* schema = R"(
+                CREATE TABLE IF NOT EXISTS recurrence_state (
+                    counterparty TEXT PRIMARY KEY,
+                    last_date INTEGER NOT NULL,
+                    txn_count INTEGER NOT NULL
+                );
+            )";
+
+            return db.execute(schema);
+        }
+    });
+
+    // Migration v7: persistent monthly rollups. One row per (month,
+    // account, category) holds pre-summed income/expense cents and counts,
+    // maintained by the repository on every write, so month-aligned
+    // aggregate reads cost O(categories) regardless of history size. The
+    // one-row state table records when a bulk mutation left the rollups
+    // stale; the next aggregate read rebuilds them. The month key is the
+    // calendar month as yyyymm, so year ranges are integer comparisons.
+    runner.registerMigration({
+        .version = 7,
+        .description = "Monthly rollups",
+        .apply = [](DatabaseConnection& db) -> std::expected<void, core::Error> {
+            const char* schema = R"(
+                CREATE TABLE IF NOT EXISTS monthly_rollups (
+                    month INTEGER NOT NULL,
+                    account_id TEXT NOT NULL,
+                    category INTEGER NOT NULL,
+                    income_cents INTEGER NOT NULL DEFAULT 0,
+                    expense_cents INTEGER NOT NULL DEFAULT 0,
+                    income_count INTEGER NOT NULL DEFAULT 0,
+                    expense_count INTEGER NOT NULL DEFAULT 0,
+                    PRIMARY KEY (month, account_id, category)
+                );
+
+                CREATE TABLE IF NOT EXISTS monthly_rollups_state (
+                    id INTEGER PRIMARY KEY CHECK (id = 1),
+                    dirty INTEGER NOT NULL
+                );
+                INSERT OR IGNORE INTO monthly_rollups_state (id, dirty) VALUES (1, 0);
+
+                INSERT INTO monthly_rollups
+                SELECT CAST(strftime('%Y%m', date * 86400, 'unixepoch') AS INTEGER),
+                       account_id, category,
+                       SUM(CASE WHEN amount_cents > 0 THEN amount_cents ELSE 0 END),
+                       SUM(CASE WHEN amount_cents < 0 THEN -amount_cents ELSE 0 END),
+                       SUM(amount_cents > 0),
+                       SUM(amount_cents <= 0)
+                FROM transactions
+                GROUP BY 1, 2, 3;
+            )";
+
+            return db.execute(schema);
+        }
+    });
+
+    // Migration v8: full-text search over transaction text. External-content
+    // FTS5 keeps the searchable text out of the index rows (the transactions
+    // table stays the single source of truth) and the triggers keep it
+    // current on every write, so a search is an index probe instead of a
+    // LIKE scan over the whole history. The backfill indexes whatever rows
+    // already exist when the migration first runs.
+    runner.registerMigration({
+        .version = 8,
+        .description = "Transaction full-text search",
+        .apply = [](DatabaseConnection& db) -> std::expected<void, core::Error> {
+            const char* schema = R"(
+                CREATE VIRTUAL TABLE IF NOT EXISTS transactions_fts USING fts5(
+                    description, counterparty_name, raw_description,
+                    content='transactions', content_rowid='rowid',
+                    tokenize='unicode61 remove_diacritics 2'
+                );
+
+                INSERT INTO transactions_fts(rowid, description, counterparty_name, raw_description)
+                    SELECT rowid, description, counterparty_name, raw_description
+                    FROM transactions;
+
+                CREATE TRIGGER IF NOT EXISTS transactions_fts_ai
+                AFTER INSERT ON transactions BEGIN
+                    INSERT INTO transactions_fts(rowid, description, counterparty_name, raw_description)
+                        VALUES (new.rowid, new.description, new.counterparty_name, new.raw_description);
+                END;
+
+                CREATE TRIGGER IF NOT EXISTS transactions_fts_ad
+                AFTER DELETE ON transactions BEGIN
+                    INSERT INTO transactions_fts(transactions_fts, rowid, description, counterparty_name, raw_description)
+                        VALUES ('delete', old.rowid, old.description, old.counterparty_name, old.raw_description);
+                END;
+
+                CREATE TRIGGER IF NOT EXISTS transactions_fts_au
+                AFTER UPDATE ON transactions BEGIN
+                    INSERT INTO transactions_fts(transactions_fts, rowid, description, counterparty_name, raw_description)
+                        VALUES ('delete', old.rowid, old.description, old.counterparty_name, old.raw_description);
+                    INSERT INTO transactions_fts(rowid, description, counterparty_name, raw_description)
+                        VALUES (new.rowid, new.description, new.counterparty_name, new.raw_description);
+                END;
+            )";
+
+            return db.execute(schema);
+        }
+    });
+
+    // Migration v9: content-hash duplicate identity. Each imported row
+    // stores a hash of (account, epoch day, cents, normalized counterparty)
+    // under a unique index, so import duplicate detection is an
+    // INSERT OR IGNORE - one indexed probe per row - instead of a
+    // projection query plus an in-memory key set. The backfill runs in C++
+    // because the counterparty normal form (case fold + space collapse)
+    // has no SQL equivalent.
+    runner.registerMigration({
+        .version = 9,
+        .description = "Transaction content hash",
+        .apply = [](DatabaseConnection& db) -> std::expected<void, core::Error> {
+            if (auto result = db.execute("ALTER TABLE transactions ADD COLUMN content_hash TEXT");
+                !result) {
+                return result;
+            }
+
+            auto fail = [&db](const char* operation) {
+                return std::unexpected(core::DatabaseError{
+                    .operation = operation,
+                    .message = sqlite3_errmsg(db.handle())
+                });
+            };
+
+            sqlite3_stmt* select = nullptr;
+            const char* selectSql =
+                "SELECT rowid, account_id, date, amount_cents, counterparty_name FROM transactions";
+            if (sqlite3_prepare_v2(db.handle(), selectSql, -1, &select, nullptr) != SQLITE_OK) {
+                return fail("content hash backfill");
+            }
+
+            sqlite3_stmt* update = nullptr;
+            const char* updateSql = "UPDATE transactions SET content_hash = ? WHERE rowid = ?";
+            if (sqlite3_prepare_v2(db.handle(), updateSql, -1, &update, nullptr) != SQLITE_OK) {
+                sqlite3_finalize(select);
+                return fail("content hash backfill");
+            }
+
+            // Rows that are already duplicates by content keep a NULL hash:
+            // NULLs never collide under a unique index, so every existing
+            // row survives, and a future import of the same content still
+            // matches the first row.
+            std::unordered_set<std::string> seen;
+            while (sqlite3_step(select) == SQLITE_ROW) {
+                auto rowid = sqlite3_column_int64(select, 0);
+                auto* accountId = reinterpret_cast<const char*>(sqlite3_column_text(select, 1));
+                auto epochDay = sqlite3_column_int64(select, 2);
+                auto cents = sqlite3_column_int64(select, 3);
+                auto* counterparty = sqlite3_column_type(select, 4) != SQLITE_NULL
+                    ? reinterpret_cast<const char*>(sqlite3_column_text(select, 4))
+                    : nullptr;
+
+                auto hash = transactionContentHash(accountId, epochDay, cents, counterparty);
+                if (!seen.insert(hash).second) {
+                    continue;
+                }
+
+                sqlite3_bind_text(update, 1, hash.c_str(), -1, SQLITE_TRANSIENT);
+                sqlite3_bind_int64(update, 2, rowid);
+                int rc = sqlite3_step(update);
+                sqlite3_reset(update);
+                if (rc != SQLITE_DONE) {
+                    sqlite3_finalize(select);
+                    sqlite3_finalize(update);
+                    return fail("content hash backfill");
+                }
+            }
+            sqlite3_finalize(select);
+            sqlite3_finalize(update);
+
+            return db.execute(
+                "CREATE UNIQUE INDEX IF NOT EXISTS idx_transactions_content_hash "
+                "ON transactions(content_hash)");
+        }
+    });
+
+    // Migration v10: epoch-day dates for credits and adjustments, matching
+    // the transactions table (migration v4). Range predicates become integer
+    // comparisons and hydration is a cast instead of an sscanf round trip.
+    // Both tables are rebuilt because TEXT affinity would coerce bound
+    // integers back to text; strftime('%s') of a date-only string is
+    // midnight UTC, so the division is exact.
+    runner.registerMigration({
+        .version = 10,
+        .description = "Epoch-day credit and adjustment dates",
+        .apply = [](DatabaseConnection& db) -> std::expected<void, core::Error> {
+            const char* schema = R"(
+                CREATE TABLE credits_v10 (
+                    id TEXT PRIMARY KEY,
+                    name TEXT NOT NULL,
+                    type INTEGER NOT NULL,
+                    original_amount_cents INTEGER NOT NULL,
+                    current_balance_cents INTEGER NOT NULL,
+                    currency INTEGER DEFAULT 0,
+                    interest_rate REAL NOT NULL,
+                    interest_type INTEGER DEFAULT 0,
+                    minimum_payment_cents INTEGER DEFAULT 0,
+                    lender TEXT,
+                    start_date INTEGER,
+                    due_day INTEGER DEFAULT 1,
+                    created_at TEXT DEFAULT CURRENT_TIMESTAMP
+                );
+
+                INSERT INTO credits_v10
+                SELECT id, name, type, original_amount_cents, current_balance_cents,
+                       currency, interest_rate, interest_type, minimum_payment_cents,
+                       lender,
+                       CASE WHEN typeof(start_date) = 'text'
+                            THEN CAST(strftime('%s', start_date) AS INTEGER) / 86400
+                            ELSE start_date END,
+                       due_day, created_at
+                FROM credits;
+
+                DROP TABLE credits;
+                ALTER TABLE credits_v10 RENAME TO credits;
+
+                CREATE TABLE adjustments_v10 (
+                    id TEXT PRIMARY KEY,
+                    pattern_id TEXT,
+                    adjustment_type TEXT NOT NULL,
+                    new_amount_cents INTEGER,
+                    effective_date INTEGER NOT NULL,
+                    notes TEXT,
+                    created_at TEXT DEFAULT CURRENT_TIMESTAMP,
+                    FOREIGN KEY (pattern_id) REFERENCES recurring_patterns(id)
+                );
+
+                INSERT INTO adjustments_v10
+                SELECT id, pattern_id, adjustment_type, new_amount_cents,
+                       CASE WHEN typeof(effective_date) = 'text'
+                            THEN CAST(strftime('%s', effective_date) AS INTEGER) / 86400
+                            ELSE effective_date END,
+                       notes, created_at
+                FROM adjustments;
+
+                DROP TABLE adjustments;
+                ALTER TABLE adjustments_v10 RENAME TO adjustments;
+
+                CREATE INDEX IF NOT EXISTS idx_adjustments_pattern ON adjustments(pattern_id);
+                CREATE INDEX IF NOT EXISTS idx_adjustments_effective_date ON adjustments(effective_date);
+            )";
+
+            return db.execute(schema);
+        }
+    });
+
+    // Migration v11: incrementally maintained net-worth snapshot. One row
+    // holds the summed account balances (total and savings-only) and the
+    // summed credit balances; triggers keep it exact on every write path -
+    // services, import, manual SQL - so position summaries read one row
+    // instead of hydrating the account and credit tables. REPLACE writes
+    // are covered because every connection runs with recursive_triggers on,
+    // which makes the implicit conflict DELETE fire the delete trigger.
+    runner.registerMigration({
+        .version = 11,
+        .description = "Net worth snapshot",
+        .apply = [](DatabaseConnection& db) -> std::expected<void, core::Error> {
+            const char* schema = R"(
+                CREATE TABLE IF NOT EXISTS net_worth_snapshot (
+                    id INTEGER PRIMARY KEY CHECK (id = 1),
+                    assets_cents INTEGER NOT NULL DEFAULT 0,
+                    savings_cents INTEGER NOT NULL DEFAULT 0,
+                    debt_cents INTEGER NOT NULL DEFAULT 0
+                );
+
+                INSERT OR IGNORE INTO net_worth_snapshot (id, assets_cents, savings_cents, debt_cents)
+                SELECT 1,
+                       COALESCE((SELECT SUM(balance_cents) FROM accounts), 0),
+                       COALESCE((SELECT SUM(balance_cents) FROM accounts WHERE type = 1), 0),
+                       COALESCE((SELECT SUM(current_balance_cents) FROM credits), 0);
+
+                CREATE TRIGGER IF NOT EXISTS net_worth_accounts_ai
+                AFTER INSERT ON accounts BEGIN
+                    UPDATE net_worth_snapshot SET
+                        assets_cents = assets_cents + new.balance_cents,
+                        savings_cents = savings_cents +
+                            (CASE WHEN new.type = 1 THEN new.balance_cents ELSE 0 END);
+                END;
+
+                CREATE TRIGGER IF NOT EXISTS net_worth_accounts_ad
+                AFTER DELETE ON accounts BEGIN
+                    UPDATE net_worth_snapshot SET
+                        assets_cents = assets_cents - old.balance_cents,
+                        savings_cents = savings_cents -
+                            (CASE WHEN old.type = 1 THEN old.balance_cents ELSE 0 END);
+                END;
+
+                CREATE TRIGGER IF NOT EXISTS net_worth_accounts_au
+                AFTER UPDATE ON accounts BEGIN
+                    UPDATE net_worth_snapshot SET
+                        assets_cents = assets_cents - old.balance_cents + new.balance_cents,
+                        savings_cents = savings_cents
+                            - (CASE WHEN old.type = 1 THEN old.balance_cents ELSE 0 END)
+                            + (CASE WHEN new.type = 1 THEN new.balance_cents ELSE 0 END);
+                END;
+
+                CREATE TRIGGER IF NOT EXISTS net_worth_credits_ai
+                AFTER INSERT ON credits BEGIN
+                    UPDATE net_worth_snapshot SET
+                        debt_cents = debt_cents + new.current_balance_cents;
+                END;
+
+                CREATE TRIGGER IF NOT EXISTS net_worth_credits_ad
+                AFTER DELETE ON credits BEGIN
+                    UPDATE net_worth_snapshot SET
+                        debt_cents = debt_cents - old.current_balance_cents;
+                END;
+
+                CREATE TRIGGER IF NOT EXISTS net_worth_credits_au
+                AFTER UPDATE ON credits BEGIN
+                    UPDATE net_worth_snapshot SET
+                        debt_cents = debt_cents
+                            - old.current_balance_cents + new.current_balance_cents;
+                END;
+            )";
+
+            return db.execute(schema);
+        }
+    });
+
+    // Migration v12: archival horizon state. One row records the first
+    // epoch day still held in the hot database; everything older lives in
+    // the attached archive database (ares_archive.db next to the hot one).
+    // The cutoff is always the first day of a calendar month, so the
+    // rollup rebuild can preserve archived months exactly. Zero means
+    // nothing has been archived yet.
+    runner.registerMigration({
+        .version = 12,
+        .description = "Archive state",
+        .apply = [](DatabaseConnection& db) -> std::expected<void, core::Error> {
+            const char* schema = R"(
+                CREATE TABLE IF NOT EXISTS archive_state (
+                    id INTEGER PRIMARY KEY CHECK (id = 1),
+                    cutoff_epoch_day INTEGER NOT NULL DEFAULT 0
+                );
+                INSERT OR IGNORE INTO archive_state (id, cutoff_epoch_day) VALUES (1, 0);
+            )";
+
+            return db.execute(schema);
+        }
+    });
+
+    // Migration v13: extracted PayPal merchant. The real merchant behind a
+    // PayPal counterparty lives (if anywhere) in the memo; parsing it out on
+    // every categorization and recurrence pass repeated the same fixed-pattern
+    // scan per read. The merchant is now extracted once at import and stored;
+    // this backfills existing PayPal rows with the same extractor. Rows whose
+    // memo carries no merchant (e.g. "Allgemeine Zahlung") stay NULL.
+    runner.registerMigration({
+        .version = 13,
+        .description = "Extracted merchant column",
+        .apply = [](DatabaseConnection& db) -> std::expected<void, core::Error> {
+            if (auto result = db.execute("ALTER TABLE transactions ADD COLUMN merchant TEXT");
+                !result) {
+                return result;
+            }
+
+            auto fail = [&db](const char* operation) {
+                return std::unexpected(core::DatabaseError{
+                    .operation = operation,
+                    .message = sqlite3_errmsg(db.handle())
+                });
+            };
+
+            sqlite3_stmt* select = nullptr;
+            const char* selectSql =
+                "SELECT rowid, counterparty_name, description FROM transactions "
+                "WHERE counterparty_name LIKE '%paypal%'";
+            if (sqlite3_prepare_v2(db.handle(), selectSql, -1, &select, nullptr) != SQLITE_OK) {
+                return fail("merchant backfill");
+            }
+
+            sqlite3_stmt* update = nullptr;
+            const char* updateSql = "UPDATE transactions SET merchant = ? WHERE rowid = ?";
+            if (sqlite3_prepare_v2(db.handle(), updateSql, -1, &update, nullptr) != SQLITE_OK) {
+                sqlite3_finalize(select);
+                return fail("merchant backfill");
+            }
+
+            while (sqlite3_step(select) == SQLITE_ROW) {
+                auto rowid = sqlite3_column_int64(select, 0);
+                auto* counterparty = reinterpret_cast<const char*>(sqlite3_column_text(select, 1));
+                auto* memo = sqlite3_column_type(select, 2) != SQLITE_NULL
+                    ? reinterpret_cast<const char*>(sqlite3_column_text(select, 2))
+                    : nullptr;
+                if (counterparty == nullptr || memo == nullptr) {
+                    continue;
+                }
+
+                auto merchant = import::extractPayPalMerchant(counterparty, memo);
+                if (!merchant) {
+                    continue;
+                }
+
+                sqlite3_bind_text(update, 1, merchant->data(),
+                                  static_cast<int>(merchant->size()), SQLITE_TRANSIENT);
+                sqlite3_bind_int64(update, 2, rowid);
+                int rc = sqlite3_step(update);
+                sqlite3_reset(update);
+                if (rc != SQLITE_DONE) {
+                    sqlite3_finalize(select);
+                    sqlite3_finalize(update);
+                    return fail("merchant backfill");
+                }
+            }
+            sqlite3_finalize(select);
+            sqlite3_finalize(update);
+
+            return {};
+        }
+    });
+
     return runner;
 }
 
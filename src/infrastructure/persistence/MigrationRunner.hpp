@@ -30,6 +30,10 @@ public:
     [[nodiscard]] auto getCurrentVersion(DatabaseConnection& db)
         -> std::expected<int, core::Error>;
 
+    /// Highest registered migration version - what a fresh database ends
+    /// up at after run(); 0 when nothing is registered
+    [[nodiscard]] auto latestVersion() const -> int;
+
 private:
     std::vector<Migration> migrations_;
 
@@ -0,0 +1,80 @@
+#include "infrastructure/persistence/ReadConnectionPool.hpp"
+
+namespace ares::infrastructure::persistence {
+
+ReadConnectionPool::Lease::Lease(ReadConnectionPool& pool,
+                                 std::unique_ptr<DatabaseConnection> connection)
+    : pool_{&pool}
+    , connection_{std::move(connection)}
+{}
+
+ReadConnectionPool::Lease::Lease(Lease&& other) noexcept
+    : pool_{other.pool_}
+    , connection_{std::move(other.connection_)}
+{
+    other.pool_ = nullptr;
+}
+
+auto ReadConnectionPool::Lease::operator=(Lease&& other) noexcept -> Lease& {
+    if (this != &other) {
+        if (pool_ && connection_) {
+            pool_->release(std::move(connection_));
+        }
+        pool_ = other.pool_;
+        connection_ = std::move(other.connection_);
+        other.pool_ = nullptr;
+    }
+    return *this;
+}
+
+ReadConnectionPool::Lease::~Lease() {
+    if (pool_ && connection_) {
+        pool_->release(std::move(connection_));
+    }
+}
+
+ReadConnectionPool::ReadConnectionPool(std::filesystem::path dbPath, std::size_t size)
+    : dbPath_{std::move(dbPath)}
+    , capacity_{size > 0 ? size : 1}
+{}
+
+auto ReadConnectionPool::acquire() -> std::expected<Lease, core::Error> {
+    std::unique_lock lock{mutex_};
+
+    if (idle_.empty() && opened_ < capacity_) {
+        // Open outside the lock so a slow open doesn't block releases
+        ++opened_;
+        lock.unlock();
+
+        auto connection = DatabaseConnection::openReadOnly(dbPath_);
+        if (!connection) {
+            std::scoped_lock relock{mutex_};
+            --opened_;
+            available_.notify_one();
+            return std::unexpected(connection.error());
+        }
+        return Lease{*this, std::move(*connection)};
+    }
+
+    available_.wait(lock, [this] { return !idle_.empty() || opened_ < capacity_; });
+
+    if (idle_.empty()) {
+        // A failed open freed capacity; retry
+        lock.unlock();
+        return acquire();
+    }
+
+    auto connection = std::move(idle_.back());
+    idle_.pop_back();
+    return Lease{*this, std::move(connection)};
+}
+
+auto ReadConnectionPool::release(std::unique_ptr<DatabaseConnection> connection) -> void {
+    {
+        std::scoped_lock lock{mutex_};
+        idle_.push_back(std::move(connection));
+    }
+    available_.notify_one();
+}
+
+} // namespace ares::infrastructure::persistence
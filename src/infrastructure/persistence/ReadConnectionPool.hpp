@@ -0,0 +1,66 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "core/common/Error.hpp"
+#include "infrastructure/persistence/DatabaseConnection.hpp"
+
+namespace ares::infrastructure::persistence {
+
+// Small pool of read-only connections to one database file. WAL mode makes
+// concurrent readers safe alongside the single writer connection, so
+// SELECT-heavy work (parallel reports, the import pipeline's duplicate
+// probes) can fan out across cores instead of serializing on one handle.
+//
+// Connections are opened lazily up to the pool size; acquire() blocks once
+// all of them are out on loan. The returned lease hands its connection back
+// on destruction, keeping each connection (and its statement cache) used by
+// one thread at a time.
+class ReadConnectionPool {
+public:
+    // RAII loan of a pooled connection
+    class Lease {
+    public:
+        Lease(Lease&& other) noexcept;
+        auto operator=(Lease&& other) noexcept -> Lease&;
+        ~Lease();
+
+        Lease(const Lease&) = delete;
+        auto operator=(const Lease&) -> Lease& = delete;
+
+        [[nodiscard]] auto connection() -> DatabaseConnection& { return *connection_; }
+        auto operator->() -> DatabaseConnection* { return connection_.get(); }
+
+    private:
+        friend class ReadConnectionPool;
+        Lease(ReadConnectionPool& pool, std::unique_ptr<DatabaseConnection> connection);
+
+        ReadConnectionPool* pool_;
+        std::unique_ptr<DatabaseConnection> connection_;
+    };
+
+    explicit ReadConnectionPool(std::filesystem::path dbPath, std::size_t size = 4);
+
+    // Borrows a read-only connection, opening one if the pool has capacity
+    // and blocking while all connections are on loan
+    [[nodiscard]] auto acquire() -> std::expected<Lease, core::Error>;
+
+    [[nodiscard]] auto size() const -> std::size_t { return capacity_; }
+
+private:
+    auto release(std::unique_ptr<DatabaseConnection> connection) -> void;
+
+    std::filesystem::path dbPath_;
+    std::size_t capacity_;
+    std::mutex mutex_;
+    std::condition_variable available_;
+    std::vector<std::unique_ptr<DatabaseConnection>> idle_;
+    std::size_t opened_{0};
+};
+
+} // namespace ares::infrastructure::persistence
@@ -13,13 +13,11 @@ auto SqliteAccountRepository::save(const core::Account& account) -> std::expecte
         VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?)
     )";
 
-    sqlite3_stmt* stmt = nullptr;
-    if (sqlite3_prepare_v2(db_->handle(), sql, -1, &stmt, nullptr) != SQLITE_OK) {
-        return std::unexpected(core::DatabaseError{
-            .operation = "prepare save account",
-            .message = sqlite3_errmsg(db_->handle())
-        });
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
     }
+    auto* stmt = *stmtResult;
 
     sqlite3_bind_text(stmt, 1, account.id().value.c_str(), -1, SQLITE_TRANSIENT);
     sqlite3_bind_text(stmt, 2, account.name().c_str(), -1, SQLITE_TRANSIENT);
@@ -38,7 +36,7 @@ auto SqliteAccountRepository::save(const core::Account& account) -> std::expecte
     sqlite3_bind_text(stmt, 9, account.description().c_str(), -1, SQLITE_TRANSIENT);
 
     int rc = sqlite3_step(stmt);
-    sqlite3_finalize(stmt);
+    sqlite3_reset(stmt);
 
     if (rc != SQLITE_DONE) {
         return std::unexpected(core::DatabaseError{
@@ -55,24 +53,22 @@ auto SqliteAccountRepository::findById(const core::AccountId& id)
 {
     const char* sql = "SELECT * FROM accounts WHERE id = ?";
 
-    sqlite3_stmt* stmt = nullptr;
-    if (sqlite3_prepare_v2(db_->handle(), sql, -1, &stmt, nullptr) != SQLITE_OK) {
-        return std::unexpected(core::DatabaseError{
-            .operation = "prepare findById account",
-            .message = sqlite3_errmsg(db_->handle())
-        });
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
     }
+    auto* stmt = *stmtResult;
 
     sqlite3_bind_text(stmt, 1, id.value.c_str(), -1, SQLITE_TRANSIENT);
 
     int rc = sqlite3_step(stmt);
     if (rc == SQLITE_ROW) {
         auto account = accountFromRow(stmt);
-        sqlite3_finalize(stmt);
+        sqlite3_reset(stmt);
         return account;
     }
 
-    sqlite3_finalize(stmt);
+    sqlite3_reset(stmt);
 
     if (rc != SQLITE_DONE) {
         return std::unexpected(core::DatabaseError{
@@ -89,24 +85,22 @@ auto SqliteAccountRepository::findByIban(const std::string& iban)
 {
     const char* sql = "SELECT * FROM accounts WHERE iban = ?";
 
-    sqlite3_stmt* stmt = nullptr;
-    if (sqlite3_prepare_v2(db_->handle(), sql, -1, &stmt, nullptr) != SQLITE_OK) {
-        return std::unexpected(core::DatabaseError{
-            .operation = "prepare findByIban",
-            .message = sqlite3_errmsg(db_->handle())
-        });
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
     }
+    auto* stmt = *stmtResult;
 
     sqlite3_bind_text(stmt, 1, iban.c_str(), -1, SQLITE_TRANSIENT);
 
     int rc = sqlite3_step(stmt);
     if (rc == SQLITE_ROW) {
         auto account = accountFromRow(stmt);
-        sqlite3_finalize(stmt);
+        sqlite3_reset(stmt);
         return account;
     }
 
-    sqlite3_finalize(stmt);
+    sqlite3_reset(stmt);
 
     if (rc != SQLITE_DONE) {
         return std::unexpected(core::DatabaseError{
@@ -121,20 +115,18 @@ auto SqliteAccountRepository::findByIban(const std::string& iban)
 auto SqliteAccountRepository::findAll() -> std::expected<std::vector<core::Account>, core::Error> {
     const char* sql = "SELECT * FROM accounts ORDER BY name";
 
-    sqlite3_stmt* stmt = nullptr;
-    if (sqlite3_prepare_v2(db_->handle(), sql, -1, &stmt, nullptr) != SQLITE_OK) {
-        return std::unexpected(core::DatabaseError{
-            .operation = "prepare findAll accounts",
-            .message = sqlite3_errmsg(db_->handle())
-        });
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
     }
+    auto* stmt = *stmtResult;
 
     std::vector<core::Account> results;
     while (sqlite3_step(stmt) == SQLITE_ROW) {
         results.push_back(accountFromRow(stmt));
     }
 
-    sqlite3_finalize(stmt);
+    sqlite3_reset(stmt);
     return results;
 }
 
@@ -143,13 +135,11 @@ auto SqliteAccountRepository::findByBank(core::BankIdentifier bank)
 {
     const char* sql = "SELECT * FROM accounts WHERE bank = ? ORDER BY name";
 
-    sqlite3_stmt* stmt = nullptr;
-    if (sqlite3_prepare_v2(db_->handle(), sql, -1, &stmt, nullptr) != SQLITE_OK) {
-        return std::unexpected(core::DatabaseError{
-            .operation = "prepare findByBank",
-            .message = sqlite3_errmsg(db_->handle())
-        });
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
     }
+    auto* stmt = *stmtResult;
 
     sqlite3_bind_int(stmt, 1, static_cast<int>(bank));
 
@@ -158,7 +148,7 @@ auto SqliteAccountRepository::findByBank(core::BankIdentifier bank)
         results.push_back(accountFromRow(stmt));
     }
 
-    sqlite3_finalize(stmt);
+    sqlite3_reset(stmt);
     return results;
 }
 
@@ -167,13 +157,11 @@ auto SqliteAccountRepository::findByType(core::AccountType type)
 {
     const char* sql = "SELECT * FROM accounts WHERE type = ? ORDER BY name";
 
-    sqlite3_stmt* stmt = nullptr;
-    if (sqlite3_prepare_v2(db_->handle(), sql, -1, &stmt, nullptr) != SQLITE_OK) {
-        return std::unexpected(core::DatabaseError{
-            .operation = "prepare findByType",
-            .message = sqlite3_errmsg(db_->handle())
-        });
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
     }
+    auto* stmt = *stmtResult;
 
     sqlite3_bind_int(stmt, 1, static_cast<int>(type));
 
@@ -182,25 +170,23 @@ auto SqliteAccountRepository::findByType(core::AccountType type)
         results.push_back(accountFromRow(stmt));
     }
 
-    sqlite3_finalize(stmt);
+    sqlite3_reset(stmt);
     return results;
 }
 
 auto SqliteAccountRepository::remove(const core::AccountId& id) -> std::expected<void, core::Error> {
     const char* sql = "DELETE FROM accounts WHERE id = ?";
 
-    sqlite3_stmt* stmt = nullptr;
-    if (sqlite3_prepare_v2(db_->handle(), sql, -1, &stmt, nullptr) != SQLITE_OK) {
-        return std::unexpected(core::DatabaseError{
-            .operation = "prepare remove account",
-            .message = sqlite3_errmsg(db_->handle())
-        });
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
     }
+    auto* stmt = *stmtResult;
 
     sqlite3_bind_text(stmt, 1, id.value.c_str(), -1, SQLITE_TRANSIENT);
 
     int rc = sqlite3_step(stmt);
-    sqlite3_finalize(stmt);
+    sqlite3_reset(stmt);
 
     if (rc != SQLITE_DONE) {
         return std::unexpected(core::DatabaseError{
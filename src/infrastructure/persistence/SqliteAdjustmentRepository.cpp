@@ -1,5 +1,6 @@
 #include "infrastructure/persistence/SqliteAdjustmentRepository.hpp"
-#include <fmt/format.h>
+#include <algorithm>
+#include "core/common/CivilDate.hpp"
 
 namespace ares::infrastructure::persistence {
 
@@ -7,21 +8,15 @@ SqliteAdjustmentRepository::SqliteAdjustmentRepository(std::shared_ptr<DatabaseC
     : db_{std::move(db)}
 {}
 
-auto SqliteAdjustmentRepository::save(const core::Adjustment& adjustment) -> std::expected<void, core::Error> {
-    const char* sql = R"(
-        INSERT OR REPLACE INTO adjustments
-        (id, pattern_id, adjustment_type, new_amount_cents, effective_date, notes)
-        VALUES (?, ?, ?, ?, ?, ?)
-    )";
+namespace {
 
-    sqlite3_stmt* stmt = nullptr;
-    if (sqlite3_prepare_v2(db_->handle(), sql, -1, &stmt, nullptr) != SQLITE_OK) {
-        return std::unexpected(core::DatabaseError{
-            .operation = "prepare save adjustment",
-            .message = sqlite3_errmsg(db_->handle())
-        });
-    }
+constexpr const char* kInsertAdjustmentSql = R"(
+    INSERT OR REPLACE INTO adjustments
+    (id, pattern_id, adjustment_type, new_amount_cents, effective_date, notes)
+    VALUES (?, ?, ?, ?, ?, ?)
+)";
 
+auto bindAdjustmentColumns(sqlite3_stmt* stmt, const core::Adjustment& adjustment) -> void {
     sqlite3_bind_text(stmt, 1, adjustment.id().value.c_str(), -1, SQLITE_TRANSIENT);
 
     if (adjustment.patternId()) {
@@ -38,8 +33,22 @@ auto SqliteAdjustmentRepository::save(const core::Adjustment& adjustment) -> std
         sqlite3_bind_null(stmt, 4);
     }
 
-    sqlite3_bind_text(stmt, 5, dateToString(adjustment.effectiveDate()).c_str(), -1, SQLITE_TRANSIENT);
+    sqlite3_bind_int64(stmt, 5, core::civil::toEpochDay(adjustment.effectiveDate()));
     sqlite3_bind_text(stmt, 6, adjustment.notes().c_str(), -1, SQLITE_TRANSIENT);
+}
+
+} // namespace
+
+auto SqliteAdjustmentRepository::save(const core::Adjustment& adjustment) -> std::expected<void, core::Error> {
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v2(db_->handle(), kInsertAdjustmentSql, -1, &stmt, nullptr) != SQLITE_OK) {
+        return std::unexpected(core::DatabaseError{
+            .operation = "prepare save adjustment",
+            .message = sqlite3_errmsg(db_->handle())
+        });
+    }
+
+    bindAdjustmentColumns(stmt, adjustment);
 
     int rc = sqlite3_step(stmt);
     sqlite3_finalize(stmt);
@@ -54,6 +63,89 @@ auto SqliteAdjustmentRepository::save(const core::Adjustment& adjustment) -> std
     return {};
 }
 
+auto SqliteAdjustmentRepository::saveBatch(const std::vector<core::Adjustment>& adjustments)
+    -> std::expected<void, core::Error>
+{
+    if (adjustments.empty()) {
+        return {};
+    }
+
+    auto scope = db_->beginTransaction();
+    if (!scope) {
+        return std::unexpected(scope.error());
+    }
+
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v2(db_->handle(), kInsertAdjustmentSql, -1, &stmt, nullptr) != SQLITE_OK) {
+        return std::unexpected(core::DatabaseError{
+            .operation = "prepare saveBatch adjustment",
+            .message = sqlite3_errmsg(db_->handle())
+        });
+    }
+
+    for (const auto& adjustment : adjustments) {
+        bindAdjustmentColumns(stmt, adjustment);
+
+        int rc = sqlite3_step(stmt);
+        sqlite3_reset(stmt);
+
+        if (rc != SQLITE_DONE) {
+            sqlite3_finalize(stmt);
+            return std::unexpected(core::DatabaseError{
+                .operation = "saveBatch adjustment",
+                .message = sqlite3_errmsg(db_->handle())
+            });
+        }
+    }
+    sqlite3_finalize(stmt);
+
+    return scope->commit();
+}
+
+auto SqliteAdjustmentRepository::findByPatterns(const std::vector<core::RecurringPatternId>& patternIds)
+    -> std::expected<std::vector<core::Adjustment>, core::Error>
+{
+    std::vector<core::Adjustment> adjustments;
+    if (patternIds.empty()) {
+        return adjustments;
+    }
+
+    // One SELECT per chunk of ids, chunked to stay well under SQLite's
+    // default bind-parameter limit
+    constexpr std::size_t kChunkSize = 500;
+
+    for (std::size_t offset = 0; offset < patternIds.size(); offset += kChunkSize) {
+        auto chunk = std::min(kChunkSize, patternIds.size() - offset);
+
+        std::string sql = "SELECT * FROM adjustments WHERE pattern_id IN (";
+        for (std::size_t i = 0; i < chunk; ++i) {
+            sql += i == 0 ? "?" : ",?";
+        }
+        sql += ") ORDER BY effective_date";
+
+        sqlite3_stmt* stmt = nullptr;
+        if (sqlite3_prepare_v2(db_->handle(), sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
+            return std::unexpected(core::DatabaseError{
+                .operation = "prepare findByPatterns adjustment",
+                .message = sqlite3_errmsg(db_->handle())
+            });
+        }
+
+        for (std::size_t i = 0; i < chunk; ++i) {
+            sqlite3_bind_text(stmt, static_cast<int>(i + 1),
+                              patternIds[offset + i].value.c_str(), -1, SQLITE_TRANSIENT);
+        }
+
+        while (sqlite3_step(stmt) == SQLITE_ROW) {
+            adjustments.push_back(adjustmentFromRow(stmt));
+        }
+
+        sqlite3_finalize(stmt);
+    }
+
+    return adjustments;
+}
+
 auto SqliteAdjustmentRepository::findById(const core::AdjustmentId& id)
     -> std::expected<std::optional<core::Adjustment>, core::Error>
 {
@@ -125,8 +217,8 @@ auto SqliteAdjustmentRepository::findByDateRange(core::Date from, core::Date to)
         });
     }
 
-    sqlite3_bind_text(stmt, 1, dateToString(from).c_str(), -1, SQLITE_TRANSIENT);
-    sqlite3_bind_text(stmt, 2, dateToString(to).c_str(), -1, SQLITE_TRANSIENT);
+    sqlite3_bind_int64(stmt, 1, core::civil::toEpochDay(from));
+    sqlite3_bind_int64(stmt, 2, core::civil::toEpochDay(to));
 
     std::vector<core::Adjustment> results;
     while (sqlite3_step(stmt) == SQLITE_ROW) {
@@ -200,7 +292,7 @@ auto SqliteAdjustmentRepository::adjustmentFromRow(sqlite3_stmt* stmt) -> core::
     std::string typeStr = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 2));
     auto type = (typeStr == "cancel") ? core::AdjustmentType::Cancel : core::AdjustmentType::AmountChange;
 
-    auto effectiveDate = stringToDate(reinterpret_cast<const char*>(sqlite3_column_text(stmt, 4)));
+    auto effectiveDate = core::civil::fromEpochDay(sqlite3_column_int64(stmt, 4));
 
     core::Adjustment adjustment{id, patternId, type, effectiveDate};
 
@@ -215,21 +307,4 @@ auto SqliteAdjustmentRepository::adjustmentFromRow(sqlite3_stmt* stmt) -> core::
     return adjustment;
 }
 
-auto SqliteAdjustmentRepository::dateToString(core::Date date) -> std::string {
-    return fmt::format("{:04d}-{:02d}-{:02d}",
-                       static_cast<int>(date.year()),
-                       static_cast<unsigned>(date.month()),
-                       static_cast<unsigned>(date.day()));
-}
-
-auto SqliteAdjustmentRepository::stringToDate(const std::string& str) -> core::Date {
-    int year, month, day;
-    std::sscanf(str.c_str(), "%d-%d-%d", &year, &month, &day);
-    return core::Date{
-        std::chrono::year{year},
-        std::chrono::month{static_cast<unsigned>(month)},
-        std::chrono::day{static_cast<unsigned>(day)}
-    };
-}
-
 } // namespace ares::infrastructure::persistence
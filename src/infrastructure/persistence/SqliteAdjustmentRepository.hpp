@@ -18,12 +18,20 @@ public:
     auto remove(const core::AdjustmentId& id) -> std::expected<void, core::Error> override;
     auto update(const core::Adjustment& adjustment) -> std::expected<void, core::Error> override;
 
+    // Bulk write: one transaction and one prepared statement for the whole
+    // set instead of a commit per adjustment
+    auto saveBatch(const std::vector<core::Adjustment>& adjustments)
+        -> std::expected<void, core::Error>;
+
+    // Adjustments for a whole pattern set in one IN query, ordered by
+    // effective date - replaces a findByPattern round trip per pattern
+    [[nodiscard]] auto findByPatterns(const std::vector<core::RecurringPatternId>& patternIds)
+        -> std::expected<std::vector<core::Adjustment>, core::Error>;
+
 private:
     std::shared_ptr<DatabaseConnection> db_;
 
     auto adjustmentFromRow(sqlite3_stmt* stmt) -> core::Adjustment;
-    auto dateToString(core::Date date) -> std::string;
-    auto stringToDate(const std::string& str) -> core::Date;
 };
 
 } // namespace ares::infrastructure::persistence
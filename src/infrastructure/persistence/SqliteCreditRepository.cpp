@@ -1,5 +1,5 @@
 #include "infrastructure/persistence/SqliteCreditRepository.hpp"
-#include <fmt/format.h>
+#include "core/common/CivilDate.hpp"
 
 namespace ares::infrastructure::persistence {
 
@@ -15,13 +15,11 @@ auto SqliteCreditRepository::save(const core::Credit& credit) -> std::expected<v
         VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)
     )";
 
-    sqlite3_stmt* stmt = nullptr;
-    if (sqlite3_prepare_v2(db_->handle(), sql, -1, &stmt, nullptr) != SQLITE_OK) {
-        return std::unexpected(core::DatabaseError{
-            .operation = "prepare save credit",
-            .message = sqlite3_errmsg(db_->handle())
-        });
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
     }
+    auto* stmt = *stmtResult;
 
     sqlite3_bind_text(stmt, 1, credit.id().value.c_str(), -1, SQLITE_TRANSIENT);
     sqlite3_bind_text(stmt, 2, credit.name().c_str(), -1, SQLITE_TRANSIENT);
@@ -35,7 +33,7 @@ auto SqliteCreditRepository::save(const core::Credit& credit) -> std::expected<v
     sqlite3_bind_text(stmt, 10, credit.lender().c_str(), -1, SQLITE_TRANSIENT);
 
     if (credit.startDate()) {
-        sqlite3_bind_text(stmt, 11, dateToString(*credit.startDate()).c_str(), -1, SQLITE_TRANSIENT);
+        sqlite3_bind_int64(stmt, 11, core::civil::toEpochDay(*credit.startDate()));
     } else {
         sqlite3_bind_null(stmt, 11);
     }
@@ -43,7 +41,7 @@ auto SqliteCreditRepository::save(const core::Credit& credit) -> std::expected<v
     sqlite3_bind_int(stmt, 12, credit.dueDay());
 
     int rc = sqlite3_step(stmt);
-    sqlite3_finalize(stmt);
+    sqlite3_reset(stmt);
 
     if (rc != SQLITE_DONE) {
         return std::unexpected(core::DatabaseError{
@@ -60,24 +58,22 @@ auto SqliteCreditRepository::findById(const core::CreditId& id)
 {
     const char* sql = "SELECT * FROM credits WHERE id = ?";
 
-    sqlite3_stmt* stmt = nullptr;
-    if (sqlite3_prepare_v2(db_->handle(), sql, -1, &stmt, nullptr) != SQLITE_OK) {
-        return std::unexpected(core::DatabaseError{
-            .operation = "prepare findById credit",
-            .message = sqlite3_errmsg(db_->handle())
-        });
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
     }
+    auto* stmt = *stmtResult;
 
     sqlite3_bind_text(stmt, 1, id.value.c_str(), -1, SQLITE_TRANSIENT);
 
     int rc = sqlite3_step(stmt);
     if (rc == SQLITE_ROW) {
         auto credit = creditFromRow(stmt);
-        sqlite3_finalize(stmt);
+        sqlite3_reset(stmt);
         return credit;
     }
 
-    sqlite3_finalize(stmt);
+    sqlite3_reset(stmt);
 
     if (rc != SQLITE_DONE) {
         return std::unexpected(core::DatabaseError{
@@ -92,20 +88,18 @@ auto SqliteCreditRepository::findById(const core::CreditId& id)
 auto SqliteCreditRepository::findAll() -> std::expected<std::vector<core::Credit>, core::Error> {
     const char* sql = "SELECT * FROM credits";
 
-    sqlite3_stmt* stmt = nullptr;
-    if (sqlite3_prepare_v2(db_->handle(), sql, -1, &stmt, nullptr) != SQLITE_OK) {
-        return std::unexpected(core::DatabaseError{
-            .operation = "prepare findAll credits",
-            .message = sqlite3_errmsg(db_->handle())
-        });
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
     }
+    auto* stmt = *stmtResult;
 
     std::vector<core::Credit> results;
     while (sqlite3_step(stmt) == SQLITE_ROW) {
         results.push_back(creditFromRow(stmt));
     }
 
-    sqlite3_finalize(stmt);
+    sqlite3_reset(stmt);
     return results;
 }
 
@@ -114,13 +108,11 @@ auto SqliteCreditRepository::findByType(core::CreditType type)
 {
     const char* sql = "SELECT * FROM credits WHERE type = ?";
 
-    sqlite3_stmt* stmt = nullptr;
-    if (sqlite3_prepare_v2(db_->handle(), sql, -1, &stmt, nullptr) != SQLITE_OK) {
-        return std::unexpected(core::DatabaseError{
-            .operation = "prepare findByType credits",
-            .message = sqlite3_errmsg(db_->handle())
-        });
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
     }
+    auto* stmt = *stmtResult;
 
     sqlite3_bind_int(stmt, 1, static_cast<int>(type));
 
@@ -129,25 +121,23 @@ auto SqliteCreditRepository::findByType(core::CreditType type)
         results.push_back(creditFromRow(stmt));
     }
 
-    sqlite3_finalize(stmt);
+    sqlite3_reset(stmt);
     return results;
 }
 
 auto SqliteCreditRepository::remove(const core::CreditId& id) -> std::expected<void, core::Error> {
     const char* sql = "DELETE FROM credits WHERE id = ?";
 
-    sqlite3_stmt* stmt = nullptr;
-    if (sqlite3_prepare_v2(db_->handle(), sql, -1, &stmt, nullptr) != SQLITE_OK) {
-        return std::unexpected(core::DatabaseError{
-            .operation = "prepare remove credit",
-            .message = sqlite3_errmsg(db_->handle())
-        });
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
     }
+    auto* stmt = *stmtResult;
 
     sqlite3_bind_text(stmt, 1, id.value.c_str(), -1, SQLITE_TRANSIENT);
 
     int rc = sqlite3_step(stmt);
-    sqlite3_finalize(stmt);
+    sqlite3_reset(stmt);
 
     if (rc != SQLITE_DONE) {
         return std::unexpected(core::DatabaseError{
@@ -187,7 +177,7 @@ auto SqliteCreditRepository::creditFromRow(sqlite3_stmt* stmt) -> core::Credit {
     }
 
     if (sqlite3_column_type(stmt, 10) != SQLITE_NULL) {
-        credit.setStartDate(stringToDate(reinterpret_cast<const char*>(sqlite3_column_text(stmt, 10))));
+        credit.setStartDate(core::civil::fromEpochDay(sqlite3_column_int64(stmt, 10)));
     }
 
     credit.setDueDay(sqlite3_column_int(stmt, 11));
@@ -195,21 +185,4 @@ auto SqliteCreditRepository::creditFromRow(sqlite3_stmt* stmt) -> core::Credit {
     return credit;
 }
 
-auto SqliteCreditRepository::dateToString(core::Date date) -> std::string {
-    return fmt::format("{:04d}-{:02d}-{:02d}",
-                       static_cast<int>(date.year()),
-                       static_cast<unsigned>(date.month()),
-                       static_cast<unsigned>(date.day()));
-}
-
-auto SqliteCreditRepository::stringToDate(const std::string& str) -> core::Date {
-    int year, month, day;
-    std::sscanf(str.c_str(), "%d-%d-%d", &year, &month, &day);
-    return core::Date{
-        std::chrono::year{year},
-        std::chrono::month{static_cast<unsigned>(month)},
-        std::chrono::day{static_cast<unsigned>(day)}
-    };
-}
-
 } // namespace ares::infrastructure::persistence
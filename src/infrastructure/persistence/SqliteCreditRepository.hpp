@@ -21,8 +21,6 @@ private:
     std::shared_ptr<DatabaseConnection> db_;
 
     auto creditFromRow(sqlite3_stmt* stmt) -> core::Credit;
-    auto dateToString(core::Date date) -> std::string;
-    auto stringToDate(const std::string& str) -> core::Date;
 };
 
 } // namespace ares::infrastructure::persistence
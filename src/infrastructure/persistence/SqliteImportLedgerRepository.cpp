@@ -0,0 +1,97 @@
+#include "infrastructure/persistence/SqliteImportLedgerRepository.hpp"
+#include <fmt/format.h>
+
+namespace ares::infrastructure::persistence {
+
+SqliteImportLedgerRepository::SqliteImportLedgerRepository(std::shared_ptr<DatabaseConnection> db)
+    : db_{std::move(db)}
+{}
+
+auto SqliteImportLedgerRepository::find(const std::string& path)
+    -> std::expected<std::optional<ImportLedgerEntry>, core::Error>
+{
+    const char* sql = "SELECT path, content_hash, file_size, modified_at FROM import_ledger WHERE path = ?";
+
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v2(db_->handle(), sql, -1, &stmt, nullptr) != SQLITE_OK) {
+        return std::unexpected(core::DatabaseError{
+            .operation = "prepare find import ledger entry",
+            .message = sqlite3_errmsg(db_->handle())
+        });
+    }
+
+    sqlite3_bind_text(stmt, 1, path.c_str(), -1, SQLITE_TRANSIENT);
+
+    int rc = sqlite3_step(stmt);
+    if (rc == SQLITE_ROW) {
+        ImportLedgerEntry entry{
+            .path = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0)),
+            .contentHash = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1)),
+            .fileSize = sqlite3_column_int64(stmt, 2),
+            .modifiedAt = sqlite3_column_int64(stmt, 3)
+        };
+        sqlite3_finalize(stmt);
+        return entry;
+    }
+
+    sqlite3_finalize(stmt);
+
+    if (rc != SQLITE_DONE) {
+        return std::unexpected(core::DatabaseError{
+            .operation = "find import ledger entry",
+            .message = sqlite3_errmsg(db_->handle())
+        });
+    }
+
+    return std::nullopt;
+}
+
+auto SqliteImportLedgerRepository::record(const ImportLedgerEntry& entry)
+    -> std::expected<void, core::Error>
+{
+    const char* sql = R"(
+        INSERT OR REPLACE INTO import_ledger
+        (path, content_hash, file_size, modified_at)
+        VALUES (?, ?, ?, ?)
+    )";
+
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v2(db_->handle(), sql, -1, &stmt, nullptr) != SQLITE_OK) {
+        return std::unexpected(core::DatabaseError{
+            .operation = "prepare record import ledger entry",
+            .message = sqlite3_errmsg(db_->handle())
+        });
+    }
+
+    sqlite3_bind_text(stmt, 1, entry.path.c_str(), -1, SQLITE_TRANSIENT);
+    sqlite3_bind_text(stmt, 2, entry.contentHash.c_str(), -1, SQLITE_TRANSIENT);
+    sqlite3_bind_int64(stmt, 3, entry.fileSize);
+    sqlite3_bind_int64(stmt, 4, entry.modifiedAt);
+
+    int rc = sqlite3_step(stmt);
+    sqlite3_finalize(stmt);
+
+    if (rc != SQLITE_DONE) {
+        return std::unexpected(core::DatabaseError{
+            .operation = "record import ledger entry",
+            .message = sqlite3_errmsg(db_->handle())
+        });
+    }
+
+    return {};
+}
+
+auto SqliteImportLedgerRepository::fingerprint(std::string_view content) -> std::string {
+    // FNV-1a: fast, dependency-free, and plenty for change detection
+    constexpr std::uint64_t kOffsetBasis = 14695981039346656037ULL;
+    constexpr std::uint64_t kPrime = 1099511628211ULL;
+
+    std::uint64_t hash = kOffsetBasis;
+    for (unsigned char c : content) {
+        hash ^= c;
+        hash *= kPrime;
+    }
+    return fmt::format("{:016x}", hash);
+}
+
+} // namespace ares::infrastructure::persistence
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstdint>
+#include <expected>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include "core/common/Error.hpp"
+#include "infrastructure/persistence/DatabaseConnection.hpp"
+
+namespace ares::infrastructure::persistence {
+
+// One row per CSV file the importer has fully processed. Size and mtime let
+// unchanged files be skipped without being opened; the content hash catches
+// files that were touched but not actually modified.
+struct ImportLedgerEntry {
+    std::string path;
+    std::string contentHash;
+    std::int64_t fileSize{0};
+    std::int64_t modifiedAt{0};  // Seconds since epoch of the file clock
+};
+
+class SqliteImportLedgerRepository {
+public:
+    explicit SqliteImportLedgerRepository(std::shared_ptr<DatabaseConnection> db);
+
+    [[nodiscard]] auto find(const std::string& path)
+        -> std::expected<std::optional<ImportLedgerEntry>, core::Error>;
+
+    auto record(const ImportLedgerEntry& entry) -> std::expected<void, core::Error>;
+
+    // FNV-1a content fingerprint, hex-encoded
+    [[nodiscard]] static auto fingerprint(std::string_view content) -> std::string;
+
+private:
+    std::shared_ptr<DatabaseConnection> db_;
+};
+
+} // namespace ares::infrastructure::persistence
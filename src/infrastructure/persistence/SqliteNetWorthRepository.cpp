@@ -0,0 +1,46 @@
+#include "infrastructure/persistence/SqliteNetWorthRepository.hpp"
+
+namespace ares::infrastructure::persistence {
+
+SqliteNetWorthRepository::SqliteNetWorthRepository(std::shared_ptr<DatabaseConnection> db)
+    : db_{std::move(db)}
+{}
+
+auto SqliteNetWorthRepository::load() -> std::expected<NetWorthSnapshot, core::Error> {
+    const char* sql =
+        "SELECT assets_cents, savings_cents, debt_cents "
+        "FROM net_worth_snapshot WHERE id = 1";
+
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
+    }
+    auto* stmt = *stmtResult;
+
+    NetWorthSnapshot snapshot;
+    if (sqlite3_step(stmt) == SQLITE_ROW) {
+        snapshot.assetsCents = sqlite3_column_int64(stmt, 0);
+        snapshot.savingsCents = sqlite3_column_int64(stmt, 1);
+        snapshot.debtCents = sqlite3_column_int64(stmt, 2);
+    }
+
+    sqlite3_reset(stmt);
+    return snapshot;
+}
+
+auto SqliteNetWorthRepository::rebuild() -> std::expected<NetWorthSnapshot, core::Error> {
+    const char* sql = R"(
+        UPDATE net_worth_snapshot SET
+            assets_cents = COALESCE((SELECT SUM(balance_cents) FROM accounts), 0),
+            savings_cents = COALESCE((SELECT SUM(balance_cents) FROM accounts WHERE type = 1), 0),
+            debt_cents = COALESCE((SELECT SUM(current_balance_cents) FROM credits), 0)
+        WHERE id = 1
+    )";
+
+    if (auto result = db_->execute(sql); !result) {
+        return std::unexpected(result.error());
+    }
+    return load();
+}
+
+} // namespace ares::infrastructure::persistence
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+#include <expected>
+#include <memory>
+#include "core/common/Error.hpp"
+#include "infrastructure/persistence/DatabaseConnection.hpp"
+
+namespace ares::infrastructure::persistence {
+
+// The incrementally maintained financial position (net_worth_snapshot,
+// migration v11): summed account balances, savings-account balances and
+// credit balances, kept exact by row-level triggers on every write
+struct NetWorthSnapshot {
+    int64_t assetsCents{0};
+    int64_t savingsCents{0};
+    int64_t debtCents{0};
+};
+
+class SqliteNetWorthRepository {
+public:
+    explicit SqliteNetWorthRepository(std::shared_ptr<DatabaseConnection> db);
+
+    // One-row read; never touches the account or credit tables
+    [[nodiscard]] auto load() -> std::expected<NetWorthSnapshot, core::Error>;
+
+    // Recomputes the snapshot from the base tables - the fallback when the
+    // snapshot is suspected stale (e.g. a restored backup predating the
+    // triggers)
+    auto rebuild() -> std::expected<NetWorthSnapshot, core::Error>;
+
+private:
+    std::shared_ptr<DatabaseConnection> db_;
+};
+
+} // namespace ares::infrastructure::persistence
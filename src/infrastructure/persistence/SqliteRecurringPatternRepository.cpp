@@ -1,4 +1,5 @@
 #include "infrastructure/persistence/SqliteRecurringPatternRepository.hpp"
+#include <algorithm>
 
 namespace ares::infrastructure::persistence {
 
@@ -6,21 +7,15 @@ SqliteRecurringPatternRepository::SqliteRecurringPatternRepository(std::shared_p
     : db_{std::move(db)}
 {}
 
-auto SqliteRecurringPatternRepository::save(const core::RecurringPattern& pattern) -> std::expected<void, core::Error> {
-    const char* sql = R"(
-        INSERT OR REPLACE INTO recurring_patterns
-        (id, counterparty_name, amount_cents, currency, frequency, category, is_active)
-        VALUES (?, ?, ?, ?, ?, ?, ?)
-    )";
+namespace {
 
-    sqlite3_stmt* stmt = nullptr;
-    if (sqlite3_prepare_v2(db_->handle(), sql, -1, &stmt, nullptr) != SQLITE_OK) {
-        return std::unexpected(core::DatabaseError{
-            .operation = "prepare save recurring_pattern",
-            .message = sqlite3_errmsg(db_->handle())
-        });
-    }
+constexpr const char* kInsertPatternSql = R"(
+    INSERT OR REPLACE INTO recurring_patterns
+    (id, counterparty_name, amount_cents, currency, frequency, category, is_active)
+    VALUES (?, ?, ?, ?, ?, ?, ?)
+)";
 
+auto bindPatternColumns(sqlite3_stmt* stmt, const core::RecurringPattern& pattern) -> void {
     sqlite3_bind_text(stmt, 1, pattern.id().value.c_str(), -1, SQLITE_TRANSIENT);
     sqlite3_bind_text(stmt, 2, pattern.counterpartyName().c_str(), -1, SQLITE_TRANSIENT);
     sqlite3_bind_int64(stmt, 3, pattern.amount().cents());
@@ -34,6 +29,20 @@ auto SqliteRecurringPatternRepository::save(const core::RecurringPattern& patter
     }
 
     sqlite3_bind_int(stmt, 7, pattern.isActive() ? 1 : 0);
+}
+
+} // namespace
+
+auto SqliteRecurringPatternRepository::save(const core::RecurringPattern& pattern) -> std::expected<void, core::Error> {
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v2(db_->handle(), kInsertPatternSql, -1, &stmt, nullptr) != SQLITE_OK) {
+        return std::unexpected(core::DatabaseError{
+            .operation = "prepare save recurring_pattern",
+            .message = sqlite3_errmsg(db_->handle())
+        });
+    }
+
+    bindPatternColumns(stmt, pattern);
 
     int rc = sqlite3_step(stmt);
     sqlite3_finalize(stmt);
@@ -48,6 +57,97 @@ auto SqliteRecurringPatternRepository::save(const core::RecurringPattern& patter
     return {};
 }
 
+auto SqliteRecurringPatternRepository::saveBatch(const std::vector<core::RecurringPattern>& patterns)
+    -> std::expected<void, core::Error>
+{
+    if (patterns.empty()) {
+        return {};
+    }
+
+    auto scope = db_->beginTransaction();
+    if (!scope) {
+        return std::unexpected(scope.error());
+    }
+
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v2(db_->handle(), kInsertPatternSql, -1, &stmt, nullptr) != SQLITE_OK) {
+        return std::unexpected(core::DatabaseError{
+            .operation = "prepare saveBatch recurring_pattern",
+            .message = sqlite3_errmsg(db_->handle())
+        });
+    }
+
+    for (const auto& pattern : patterns) {
+        bindPatternColumns(stmt, pattern);
+
+        int rc = sqlite3_step(stmt);
+        sqlite3_reset(stmt);
+
+        if (rc != SQLITE_DONE) {
+            sqlite3_finalize(stmt);
+            return std::unexpected(core::DatabaseError{
+                .operation = "saveBatch recurring_pattern",
+                .message = sqlite3_errmsg(db_->handle())
+            });
+        }
+    }
+    sqlite3_finalize(stmt);
+
+    return scope->commit();
+}
+
+auto SqliteRecurringPatternRepository::removeBatch(const std::vector<core::RecurringPatternId>& ids)
+    -> std::expected<void, core::Error>
+{
+    if (ids.empty()) {
+        return {};
+    }
+
+    // One DELETE per chunk of ids, chunked to stay well under SQLite's
+    // default bind-parameter limit
+    constexpr std::size_t kChunkSize = 500;
+
+    auto scope = db_->beginTransaction();
+    if (!scope) {
+        return std::unexpected(scope.error());
+    }
+
+    for (std::size_t offset = 0; offset < ids.size(); offset += kChunkSize) {
+        auto chunk = std::min(kChunkSize, ids.size() - offset);
+
+        std::string sql = "DELETE FROM recurring_patterns WHERE id IN (";
+        for (std::size_t i = 0; i < chunk; ++i) {
+            sql += i == 0 ? "?" : ",?";
+        }
+        sql += ")";
+
+        sqlite3_stmt* stmt = nullptr;
+        if (sqlite3_prepare_v2(db_->handle(), sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
+            return std::unexpected(core::DatabaseError{
+                .operation = "removeBatch recurring_pattern",
+                .message = sqlite3_errmsg(db_->handle())
+            });
+        }
+
+        for (std::size_t i = 0; i < chunk; ++i) {
+            sqlite3_bind_text(stmt, static_cast<int>(i + 1),
+                              ids[offset + i].value.c_str(), -1, SQLITE_TRANSIENT);
+        }
+
+        int rc = sqlite3_step(stmt);
+        sqlite3_finalize(stmt);
+
+        if (rc != SQLITE_DONE) {
+            return std::unexpected(core::DatabaseError{
+                .operation = "removeBatch recurring_pattern",
+                .message = sqlite3_errmsg(db_->handle())
+            });
+        }
+    }
+
+    return scope->commit();
+}
+
 auto SqliteRecurringPatternRepository::findById(const core::RecurringPatternId& id)
     -> std::expected<std::optional<core::RecurringPattern>, core::Error>
 {
@@ -199,6 +299,77 @@ auto SqliteRecurringPatternRepository::patternFromRow(sqlite3_stmt* stmt) -> cor
     return pattern;
 }
 
+auto SqliteRecurringPatternRepository::loadGroupState()
+    -> std::expected<std::vector<RecurrenceGroupState>, core::Error>
+{
+    const char* sql =
+        "SELECT counterparty, last_date, txn_count FROM recurrence_state ORDER BY counterparty";
+
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v2(db_->handle(), sql, -1, &stmt, nullptr) != SQLITE_OK) {
+        return std::unexpected(core::DatabaseError{
+            .operation = "prepare load recurrence state",
+            .message = sqlite3_errmsg(db_->handle())
+        });
+    }
+
+    std::vector<RecurrenceGroupState> states;
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        states.push_back(RecurrenceGroupState{
+            .counterparty = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0)),
+            .lastDate = sqlite3_column_int64(stmt, 1),
+            .txnCount = sqlite3_column_int(stmt, 2)
+        });
+    }
+
+    sqlite3_finalize(stmt);
+    return states;
+}
+
+auto SqliteRecurringPatternRepository::replaceGroupState(const std::vector<RecurrenceGroupState>& states)
+    -> std::expected<void, core::Error>
+{
+    auto scope = db_->beginTransaction();
+    if (!scope) {
+        return std::unexpected(scope.error());
+    }
+    if (auto result = db_->execute("DELETE FROM recurrence_state"); !result) {
+        return std::unexpected(result.error());
+    }
+
+    const char* sql =
+        "INSERT OR REPLACE INTO recurrence_state (counterparty, last_date, txn_count) "
+        "VALUES (?, ?, ?)";
+
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v2(db_->handle(), sql, -1, &stmt, nullptr) != SQLITE_OK) {
+        return std::unexpected(core::DatabaseError{
+            .operation = "prepare record recurrence state",
+            .message = sqlite3_errmsg(db_->handle())
+        });
+    }
+
+    for (const auto& state : states) {
+        sqlite3_bind_text(stmt, 1, state.counterparty.c_str(), -1, SQLITE_TRANSIENT);
+        sqlite3_bind_int64(stmt, 2, state.lastDate);
+        sqlite3_bind_int(stmt, 3, state.txnCount);
+
+        int rc = sqlite3_step(stmt);
+        sqlite3_reset(stmt);
+
+        if (rc != SQLITE_DONE) {
+            sqlite3_finalize(stmt);
+            return std::unexpected(core::DatabaseError{
+                .operation = "record recurrence state",
+                .message = sqlite3_errmsg(db_->handle())
+            });
+        }
+    }
+    sqlite3_finalize(stmt);
+
+    return scope->commit();
+}
+
 auto SqliteRecurringPatternRepository::stringToFrequency(const std::string& str) -> core::RecurrenceFrequency {
     if (str == "Weekly") return core::RecurrenceFrequency::Weekly;
     if (str == "Biweekly") return core::RecurrenceFrequency::Biweekly;
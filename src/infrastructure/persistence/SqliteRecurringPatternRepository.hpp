@@ -6,6 +6,16 @@
 
 namespace ares::infrastructure::persistence {
 
+// Snapshot of one counterparty group as of the last recurrence-detection
+// run. A group whose transaction count and newest date are unchanged
+// cannot produce a different pattern, so incremental detection skips its
+// re-analysis entirely.
+struct RecurrenceGroupState {
+    std::string counterparty;  // normalized name, the grouping key
+    int64_t lastDate{0};       // epoch day of the newest member
+    int txnCount{0};
+};
+
 class SqliteRecurringPatternRepository : public core::RecurringPatternRepository {
 public:
     explicit SqliteRecurringPatternRepository(std::shared_ptr<DatabaseConnection> db);
@@ -18,6 +28,19 @@ public:
     auto remove(const core::RecurringPatternId& id) -> std::expected<void, core::Error> override;
     auto update(const core::RecurringPattern& pattern) -> std::expected<void, core::Error> override;
 
+    // Bulk writes for detection runs: one transaction and one prepared
+    // statement for the whole set instead of a commit per pattern
+    auto saveBatch(const std::vector<core::RecurringPattern>& patterns)
+        -> std::expected<void, core::Error>;
+    auto removeBatch(const std::vector<core::RecurringPatternId>& ids)
+        -> std::expected<void, core::Error>;
+
+    // Grouped-state snapshot for incremental recurrence detection
+    [[nodiscard]] auto loadGroupState()
+        -> std::expected<std::vector<RecurrenceGroupState>, core::Error>;
+    auto replaceGroupState(const std::vector<RecurrenceGroupState>& states)
+        -> std::expected<void, core::Error>;
+
 private:
     std::shared_ptr<DatabaseConnection> db_;
 
@@ -0,0 +1,80 @@
+#include "infrastructure/persistence/SqliteRuleStateRepository.hpp"
+
+namespace ares::infrastructure::persistence {
+
+SqliteRuleStateRepository::SqliteRuleStateRepository(std::shared_ptr<DatabaseConnection> db)
+    : db_{std::move(db)}
+{}
+
+auto SqliteRuleStateRepository::loadAll()
+    -> std::expected<std::vector<CategorizationRuleState>, core::Error>
+{
+    const char* sql =
+        "SELECT rule_key, category, position FROM categorization_state ORDER BY position";
+
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v2(db_->handle(), sql, -1, &stmt, nullptr) != SQLITE_OK) {
+        return std::unexpected(core::DatabaseError{
+            .operation = "prepare load categorization state",
+            .message = sqlite3_errmsg(db_->handle())
+        });
+    }
+
+    std::vector<CategorizationRuleState> states;
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        states.push_back(CategorizationRuleState{
+            .ruleKey = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0)),
+            .category = sqlite3_column_int(stmt, 1),
+            .position = sqlite3_column_int(stmt, 2)
+        });
+    }
+
+    sqlite3_finalize(stmt);
+    return states;
+}
+
+auto SqliteRuleStateRepository::replaceAll(const std::vector<CategorizationRuleState>& states)
+    -> std::expected<void, core::Error>
+{
+    auto scope = db_->beginTransaction();
+    if (!scope) {
+        return std::unexpected(scope.error());
+    }
+    if (auto result = db_->execute("DELETE FROM categorization_state"); !result) {
+        return std::unexpected(result.error());
+    }
+
+    const char* sql =
+        "INSERT OR REPLACE INTO categorization_state (rule_key, category, position) "
+        "VALUES (?, ?, ?)";
+
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v2(db_->handle(), sql, -1, &stmt, nullptr) != SQLITE_OK) {
+        return std::unexpected(core::DatabaseError{
+            .operation = "prepare record categorization state",
+            .message = sqlite3_errmsg(db_->handle())
+        });
+    }
+
+    for (const auto& state : states) {
+        sqlite3_bind_text(stmt, 1, state.ruleKey.c_str(), -1, SQLITE_TRANSIENT);
+        sqlite3_bind_int(stmt, 2, state.category);
+        sqlite3_bind_int(stmt, 3, state.position);
+
+        int rc = sqlite3_step(stmt);
+        sqlite3_reset(stmt);
+
+        if (rc != SQLITE_DONE) {
+            sqlite3_finalize(stmt);
+            return std::unexpected(core::DatabaseError{
+                .operation = "record categorization state",
+                .message = sqlite3_errmsg(db_->handle())
+            });
+        }
+    }
+    sqlite3_finalize(stmt);
+
+    return scope->commit();
+}
+
+} // namespace ares::infrastructure::persistence
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <expected>
+#include <memory>
+#include <string>
+#include <vector>
+#include "core/common/Error.hpp"
+#include "infrastructure/persistence/DatabaseConnection.hpp"
+
+namespace ares::infrastructure::persistence {
+
+// Snapshot of one categorization rule as of the last categorize run. The
+// key is the rule's pattern (or "amount:<cents>" for amount rules), so a
+// rule's identity is its match condition; position records config order,
+// which is match priority.
+struct CategorizationRuleState {
+    std::string ruleKey;
+    int category{0};
+    int position{0};
+};
+
+class SqliteRuleStateRepository {
+public:
+    explicit SqliteRuleStateRepository(std::shared_ptr<DatabaseConnection> db);
+
+    [[nodiscard]] auto loadAll()
+        -> std::expected<std::vector<CategorizationRuleState>, core::Error>;
+
+    // Replaces the stored snapshot with the given rule set atomically
+    auto replaceAll(const std::vector<CategorizationRuleState>& states)
+        -> std::expected<void, core::Error>;
+
+private:
+    std::shared_ptr<DatabaseConnection> db_;
+};
+
+} // namespace ares::infrastructure::persistence
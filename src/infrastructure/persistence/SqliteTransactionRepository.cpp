@@ -1,5 +1,10 @@
 #include "infrastructure/persistence/SqliteTransactionRepository.hpp"
+#include "core/common/PerfCounters.hpp"
+#include <algorithm>
+#include <map>
 #include <fmt/format.h>
+#include "core/common/CivilDate.hpp"
+#include "infrastructure/persistence/TransactionContentHash.hpp"
 
 namespace ares::infrastructure::persistence {
 
@@ -7,26 +12,11 @@ SqliteTransactionRepository::SqliteTransactionRepository(std::shared_ptr<Databas
     : db_{std::move(db)}
 {}
 
-auto SqliteTransactionRepository::save(const core::Transaction& txn) -> std::expected<void, core::Error> {
-    const char* sql = R"(
-        INSERT OR REPLACE INTO transactions
-        (id, account_id, date, amount_cents, currency, type, category,
-         description, counterparty_name, counterparty_iban, raw_description, mutation_code,
-         is_recurring, frequency, is_active, user_category_override)
-        VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)
-    )";
-
-    sqlite3_stmt* stmt = nullptr;
-    if (sqlite3_prepare_v2(db_->handle(), sql, -1, &stmt, nullptr) != SQLITE_OK) {
-        return std::unexpected(core::DatabaseError{
-            .operation = "prepare save",
-            .message = sqlite3_errmsg(db_->handle())
-        });
-    }
-
+auto SqliteTransactionRepository::bindTransactionColumns(sqlite3_stmt* stmt,
+                                                         const core::Transaction& txn) -> void {
     sqlite3_bind_text(stmt, 1, txn.id().value.c_str(), -1, SQLITE_TRANSIENT);
     sqlite3_bind_text(stmt, 2, txn.accountId().value.c_str(), -1, SQLITE_TRANSIENT);
-    sqlite3_bind_text(stmt, 3, dateToString(txn.date()).c_str(), -1, SQLITE_TRANSIENT);
+    sqlite3_bind_int64(stmt, 3, dateToEpochDay(txn.date()));
     sqlite3_bind_int64(stmt, 4, txn.amount().cents());
     sqlite3_bind_int(stmt, 5, static_cast<int>(txn.amount().currency()));
     sqlite3_bind_int(stmt, 6, static_cast<int>(txn.type()));
@@ -53,7 +43,6 @@ auto SqliteTransactionRepository::save(const core::Transaction& txn) -> std::exp
         sqlite3_bind_null(stmt, 12);
     }
 
-    // New recurring transaction fields
     sqlite3_bind_int(stmt, 13, txn.isRecurring() ? 1 : 0);
     sqlite3_bind_text(stmt, 14, std::string(recurrenceFrequencyName(txn.frequency())).c_str(), -1, SQLITE_TRANSIENT);
     sqlite3_bind_int(stmt, 15, txn.isActive() ? 1 : 0);
@@ -64,8 +53,86 @@ auto SqliteTransactionRepository::save(const core::Transaction& txn) -> std::exp
         sqlite3_bind_null(stmt, 16);
     }
 
+    if (txn.matchedRule()) {
+        sqlite3_bind_text(stmt, 17, txn.matchedRule()->c_str(), -1, SQLITE_TRANSIENT);
+    } else {
+        sqlite3_bind_null(stmt, 17);
+    }
+
+    if (txn.merchant()) {
+        sqlite3_bind_text(stmt, 18, txn.merchant()->c_str(), -1, SQLITE_TRANSIENT);
+    } else {
+        sqlite3_bind_null(stmt, 18);
+    }
+}
+
+auto SqliteTransactionRepository::save(const core::Transaction& txn) -> std::expected<void, core::Error> {
+    // Rollup maintenance: a REPLACE of an existing row must back the old
+    // values out of monthly_rollups, so they are read (one primary-key
+    // probe) before the insert overwrites them
+    struct OldRow {
+        int64_t month;
+        std::string accountId;
+        int category;
+        int64_t cents;
+        std::optional<std::string> contentHash;
+    };
+    std::optional<OldRow> oldRow;
+    {
+        const char* probeSql =
+            "SELECT date, account_id, category, amount_cents, content_hash "
+            "FROM transactions WHERE id = ?";
+        auto probeResult = db_->prepareCached(probeSql);
+        if (!probeResult) {
+            return std::unexpected(probeResult.error());
+        }
+        auto* probe = *probeResult;
+        sqlite3_bind_text(probe, 1, txn.id().value.c_str(), -1, SQLITE_TRANSIENT);
+        if (sqlite3_step(probe) == SQLITE_ROW) {
+            oldRow = OldRow{
+                .month = monthKey(epochDayToDate(sqlite3_column_int64(probe, 0))),
+                .accountId = reinterpret_cast<const char*>(sqlite3_column_text(probe, 1)),
+                .category = sqlite3_column_int(probe, 2),
+                .cents = sqlite3_column_int64(probe, 3),
+                .contentHash = sqlite3_column_type(probe, 4) != SQLITE_NULL
+                    ? std::optional<std::string>{reinterpret_cast<const char*>(
+                          sqlite3_column_text(probe, 4))}
+                    : std::nullopt
+            };
+        }
+        sqlite3_reset(probe);
+    }
+
+    const char* sql = R"(
+        INSERT OR REPLACE INTO transactions
+        (id, account_id, date, amount_cents, currency, type, category,
+         description, counterparty_name, counterparty_iban, raw_description, mutation_code,
+         is_recurring, frequency, is_active, user_category_override, matched_rule, merchant,
+         content_hash)
+        VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)
+    )";
+
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
+    }
+    auto* stmt = *stmtResult;
+
+    bindTransactionColumns(stmt, txn);
+
+    // An edit of an imported row keeps its content hash so re-imports of
+    // the same export still collapse against it. Rows born through save()
+    // (manual add) carry no hash: computing one here would let
+    // INSERT OR REPLACE silently swallow a different row that happens to
+    // share the content.
+    if (oldRow && oldRow->contentHash) {
+        sqlite3_bind_text(stmt, 19, oldRow->contentHash->c_str(), -1, SQLITE_TRANSIENT);
+    } else {
+        sqlite3_bind_null(stmt, 19);
+    }
+
     int rc = sqlite3_step(stmt);
-    sqlite3_finalize(stmt);
+    sqlite3_reset(stmt);
 
     if (rc != SQLITE_DONE) {
         return std::unexpected(core::DatabaseError{
@@ -74,30 +141,34 @@ auto SqliteTransactionRepository::save(const core::Transaction& txn) -> std::exp
         });
     }
 
-    return {};
+    bumpGeneration();
+    if (oldRow) {
+        if (auto delta = applyRollupDelta(oldRow->month, oldRow->accountId,
+                                          oldRow->category, oldRow->cents, -1); !delta) {
+            return delta;
+        }
+    }
+    return applyRollupDelta(monthKey(txn.date()), txn.accountId().value,
+                            static_cast<int>(txn.category()), txn.amount().cents(), 1);
 }
 
 auto SqliteTransactionRepository::saveBatch(const std::vector<core::Transaction>& transactions)
     -> std::expected<void, core::Error>
 {
-    // Begin transaction for performance
-    if (auto result = db_->execute("BEGIN TRANSACTION"); !result) {
-        return std::unexpected(result.error());
+    // One transaction scope for the batch; nests as a savepoint when the
+    // caller already holds one
+    auto scope = db_->beginTransaction();
+    if (!scope) {
+        return std::unexpected(scope.error());
     }
 
     for (const auto& txn : transactions) {
         if (auto result = save(txn); !result) {
-            (void)db_->execute("ROLLBACK");
             return std::unexpected(result.error());
         }
     }
 
-    if (auto result = db_->execute("COMMIT"); !result) {
-        (void)db_->execute("ROLLBACK");
-        return std::unexpected(result.error());
-    }
-
-    return {};
+    return scope->commit();
 }
 
 auto SqliteTransactionRepository::findById(const core::TransactionId& id)
@@ -105,24 +176,22 @@ auto SqliteTransactionRepository::findById(const core::TransactionId& id)
 {
     const char* sql = "SELECT * FROM transactions WHERE id = ?";
 
-    sqlite3_stmt* stmt = nullptr;
-    if (sqlite3_prepare_v2(db_->handle(), sql, -1, &stmt, nullptr) != SQLITE_OK) {
-        return std::unexpected(core::DatabaseError{
-            .operation = "prepare findById",
-            .message = sqlite3_errmsg(db_->handle())
-        });
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
     }
+    auto* stmt = *stmtResult;
 
     sqlite3_bind_text(stmt, 1, id.value.c_str(), -1, SQLITE_TRANSIENT);
 
     int rc = sqlite3_step(stmt);
     if (rc == SQLITE_ROW) {
         auto txn = transactionFromRow(stmt);
-        sqlite3_finalize(stmt);
+        sqlite3_reset(stmt);
         return txn;
     }
 
-    sqlite3_finalize(stmt);
+    sqlite3_reset(stmt);
 
     if (rc != SQLITE_DONE) {
         return std::unexpected(core::DatabaseError{
@@ -139,22 +208,20 @@ auto SqliteTransactionRepository::findByAccount(const core::AccountId& accountId
 {
     const char* sql = "SELECT * FROM transactions WHERE account_id = ? ORDER BY date DESC";
 
-    sqlite3_stmt* stmt = nullptr;
-    if (sqlite3_prepare_v2(db_->handle(), sql, -1, &stmt, nullptr) != SQLITE_OK) {
-        return std::unexpected(core::DatabaseError{
-            .operation = "prepare findByAccount",
-            .message = sqlite3_errmsg(db_->handle())
-        });
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
     }
+    auto* stmt = *stmtResult;
 
     sqlite3_bind_text(stmt, 1, accountId.value.c_str(), -1, SQLITE_TRANSIENT);
 
     std::vector<core::Transaction> results;
     while (sqlite3_step(stmt) == SQLITE_ROW) {
-        results.push_back(transactionFromRow(stmt));
+        appendTransactionFromRow(results, stmt);
     }
 
-    sqlite3_finalize(stmt);
+    sqlite3_reset(stmt);
     return results;
 }
 
@@ -163,24 +230,22 @@ auto SqliteTransactionRepository::findByDateRange(const core::AccountId& account
 {
     const char* sql = "SELECT * FROM transactions WHERE account_id = ? AND date >= ? AND date <= ? ORDER BY date DESC";
 
-    sqlite3_stmt* stmt = nullptr;
-    if (sqlite3_prepare_v2(db_->handle(), sql, -1, &stmt, nullptr) != SQLITE_OK) {
-        return std::unexpected(core::DatabaseError{
-            .operation = "prepare findByDateRange",
-            .message = sqlite3_errmsg(db_->handle())
-        });
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
     }
+    auto* stmt = *stmtResult;
 
     sqlite3_bind_text(stmt, 1, accountId.value.c_str(), -1, SQLITE_TRANSIENT);
-    sqlite3_bind_text(stmt, 2, dateToString(from).c_str(), -1, SQLITE_TRANSIENT);
-    sqlite3_bind_text(stmt, 3, dateToString(to).c_str(), -1, SQLITE_TRANSIENT);
+    sqlite3_bind_int64(stmt, 2, dateToEpochDay(from));
+    sqlite3_bind_int64(stmt, 3, dateToEpochDay(to));
 
     std::vector<core::Transaction> results;
     while (sqlite3_step(stmt) == SQLITE_ROW) {
-        results.push_back(transactionFromRow(stmt));
+        appendTransactionFromRow(results, stmt);
     }
 
-    sqlite3_finalize(stmt);
+    sqlite3_reset(stmt);
     return results;
 }
 
@@ -189,60 +254,684 @@ auto SqliteTransactionRepository::findByCategory(core::TransactionCategory categ
 {
     const char* sql = "SELECT * FROM transactions WHERE category = ? ORDER BY date DESC";
 
-    sqlite3_stmt* stmt = nullptr;
-    if (sqlite3_prepare_v2(db_->handle(), sql, -1, &stmt, nullptr) != SQLITE_OK) {
-        return std::unexpected(core::DatabaseError{
-            .operation = "prepare findByCategory",
-            .message = sqlite3_errmsg(db_->handle())
-        });
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
     }
+    auto* stmt = *stmtResult;
 
     sqlite3_bind_int(stmt, 1, static_cast<int>(category));
 
     std::vector<core::Transaction> results;
     while (sqlite3_step(stmt) == SQLITE_ROW) {
-        results.push_back(transactionFromRow(stmt));
+        appendTransactionFromRow(results, stmt);
     }
 
-    sqlite3_finalize(stmt);
+    sqlite3_reset(stmt);
     return results;
 }
 
 auto SqliteTransactionRepository::findAll() -> std::expected<std::vector<core::Transaction>, core::Error> {
     const char* sql = "SELECT * FROM transactions ORDER BY date DESC";
 
-    sqlite3_stmt* stmt = nullptr;
-    if (sqlite3_prepare_v2(db_->handle(), sql, -1, &stmt, nullptr) != SQLITE_OK) {
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
+    }
+    auto* stmt = *stmtResult;
+
+    std::vector<core::Transaction> results;
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        appendTransactionFromRow(results, stmt);
+    }
+
+    sqlite3_reset(stmt);
+    return results;
+}
+
+auto SqliteTransactionRepository::findPage(
+    int limit,
+    const std::optional<core::TransactionRepository::PageCursor>& before,
+    const std::optional<core::TransactionRepository::PageCursor>& after)
+    -> std::expected<std::vector<core::Transaction>, core::Error>
+{
+    if (limit <= 0) {
+        return std::vector<core::Transaction>{};
+    }
+
+    // Keyset predicates ride the date index; 'after' scans ascending and is
+    // reversed below so every page comes back newest-first
+    const char* sql = "SELECT * FROM transactions ORDER BY date DESC, id DESC LIMIT ?";
+    if (before) {
+        sql = "SELECT * FROM transactions"
+              " WHERE date < ?1 OR (date = ?1 AND id < ?2)"
+              " ORDER BY date DESC, id DESC LIMIT ?3";
+    } else if (after) {
+        sql = "SELECT * FROM transactions"
+              " WHERE date > ?1 OR (date = ?1 AND id > ?2)"
+              " ORDER BY date ASC, id ASC LIMIT ?3";
+    }
+
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
+    }
+    auto* stmt = *stmtResult;
+
+    if (before || after) {
+        const auto& cursor = before ? *before : *after;
+        sqlite3_bind_int64(stmt, 1, dateToEpochDay(cursor.date));
+        sqlite3_bind_text(stmt, 2, cursor.id.value.c_str(), -1, SQLITE_TRANSIENT);
+        sqlite3_bind_int(stmt, 3, limit);
+    } else {
+        sqlite3_bind_int(stmt, 1, limit);
+    }
+
+    std::vector<core::Transaction> page;
+    page.reserve(static_cast<std::size_t>(limit));
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        appendTransactionFromRow(page, stmt);
+    }
+    sqlite3_reset(stmt);
+
+    if (after) {
+        std::reverse(page.begin(), page.end());
+    }
+    return page;
+}
+
+auto SqliteTransactionRepository::search(const std::string& query, int limit)
+    -> std::expected<std::vector<core::Transaction>, core::Error>
+{
+    if (limit <= 0) {
+        return std::vector<core::Transaction>{};
+    }
+
+    // Rewrite the raw words into FTS5 syntax: each token is quoted (so
+    // user input can never be parsed as operators) and matched as a
+    // prefix, and tokens combine with the implicit AND
+    std::string match;
+    std::string token;
+    auto flushToken = [&] {
+        if (token.empty()) {
+            return;
+        }
+        if (!match.empty()) {
+            match += ' ';
+        }
+        match += '"';
+        for (char c : token) {
+            if (c == '"') {
+                match += '"';
+            }
+            match += c;
+        }
+        match += "\"*";
+        token.clear();
+    };
+    for (char c : query) {
+        if (c == ' ' || c == '\t') {
+            flushToken();
+        } else {
+            token += c;
+        }
+    }
+    flushToken();
+
+    if (match.empty()) {
+        return std::vector<core::Transaction>{};
+    }
+
+    // The FTS probe yields rowids; the join hydrates full rows in the
+    // same newest-first order the listings use. The table is qualified
+    // because the FTS index only covers hot rows: under a full-history
+    // connection an unqualified name would resolve to the archive union
+    // view, which has no rowid to join on.
+    const char* sql =
+        "SELECT t.* FROM main.transactions t"
+        " JOIN transactions_fts f ON t.rowid = f.rowid"
+        " WHERE transactions_fts MATCH ?1"
+        " ORDER BY t.date DESC, t.id DESC LIMIT ?2";
+
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
+    }
+    auto* stmt = *stmtResult;
+
+    sqlite3_bind_text(stmt, 1, match.c_str(), -1, SQLITE_TRANSIENT);
+    sqlite3_bind_int(stmt, 2, limit);
+
+    std::vector<core::Transaction> results;
+    int rc = 0;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        appendTransactionFromRow(results, stmt);
+    }
+    sqlite3_reset(stmt);
+
+    if (rc != SQLITE_DONE) {
         return std::unexpected(core::DatabaseError{
-            .operation = "prepare findAll",
+            .operation = "search transactions",
             .message = sqlite3_errmsg(db_->handle())
         });
     }
+    return results;
+}
+
+auto SqliteTransactionRepository::forEach(const core::TransactionRepository::TransactionVisitor& visitor)
+    -> std::expected<void, core::Error>
+{
+    const char* sql = "SELECT * FROM transactions ORDER BY date DESC";
+
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
+    }
+    auto* stmt = *stmtResult;
 
-    std::vector<core::Transaction> results;
     while (sqlite3_step(stmt) == SQLITE_ROW) {
-        results.push_back(transactionFromRow(stmt));
+        visitor(transactionFromRow(stmt));
     }
 
-    sqlite3_finalize(stmt);
+    sqlite3_reset(stmt);
+    return {};
+}
+
+auto SqliteTransactionRepository::forEachFiltered(
+    const core::TransactionRepository::Filter& filter,
+    const core::TransactionRepository::TransactionVisitor& visitor)
+    -> std::expected<void, core::Error>
+{
+    // Predicates go into the WHERE clause so the scan rides the date and
+    // category indexes; only eight clause combinations exist, and each
+    // lands once in the statement cache
+    std::string sql = "SELECT * FROM transactions WHERE 1=1";
+    if (filter.from) sql += " AND date >= ?";
+    if (filter.to) sql += " AND date <= ?";
+    if (filter.category) sql += " AND category = ?";
+    sql += " ORDER BY date DESC";
+
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
+    }
+    auto* stmt = *stmtResult;
+
+    int slot = 1;
+    if (filter.from) sqlite3_bind_int64(stmt, slot++, dateToEpochDay(*filter.from));
+    if (filter.to) sqlite3_bind_int64(stmt, slot++, dateToEpochDay(*filter.to));
+    if (filter.category) sqlite3_bind_int(stmt, slot++, static_cast<int>(*filter.category));
+
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        visitor(transactionFromRow(stmt));
+    }
+
+    sqlite3_reset(stmt);
+    return {};
+}
+
+auto SqliteTransactionRepository::forEachInDateRange(core::Date from, core::Date to,
+                                                     const core::TransactionRepository::TransactionVisitor& visitor)
+    -> std::expected<void, core::Error>
+{
+    const char* sql = "SELECT * FROM transactions WHERE date >= ? AND date <= ? ORDER BY date DESC";
+
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
+    }
+    auto* stmt = *stmtResult;
+
+    sqlite3_bind_int64(stmt, 1, dateToEpochDay(from));
+    sqlite3_bind_int64(stmt, 2, dateToEpochDay(to));
+
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        visitor(transactionFromRow(stmt));
+    }
+
+    sqlite3_reset(stmt);
+    return {};
+}
+
+auto SqliteTransactionRepository::findAmountsByDateRange(core::Date from, core::Date to)
+    -> std::expected<std::vector<core::TransactionAmount>, core::Error>
+{
+    const char* sql = "SELECT date, amount_cents, category FROM transactions WHERE date >= ? AND date <= ?";
+
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
+    }
+    auto* stmt = *stmtResult;
+
+    sqlite3_bind_int64(stmt, 1, dateToEpochDay(from));
+    sqlite3_bind_int64(stmt, 2, dateToEpochDay(to));
+
+    std::vector<core::TransactionAmount> results;
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        results.push_back(core::TransactionAmount{
+            .date = epochDayToDate(sqlite3_column_int64(stmt, 0)),
+            .cents = sqlite3_column_int64(stmt, 1),
+            .category = static_cast<core::TransactionCategory>(sqlite3_column_int(stmt, 2))
+        });
+    }
+
+    sqlite3_reset(stmt);
     return results;
 }
 
-auto SqliteTransactionRepository::remove(const core::TransactionId& id) -> std::expected<void, core::Error> {
-    const char* sql = "DELETE FROM transactions WHERE id = ?";
+auto SqliteTransactionRepository::findColumnsByDateRange(core::Date from, core::Date to)
+    -> std::expected<core::TransactionColumns, core::Error>
+{
+    const char* sql = "SELECT date, amount_cents, category FROM transactions WHERE date >= ? AND date <= ?";
+
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
+    }
+    auto* stmt = *stmtResult;
+
+    sqlite3_bind_int64(stmt, 1, dateToEpochDay(from));
+    sqlite3_bind_int64(stmt, 2, dateToEpochDay(to));
+
+    core::TransactionColumns columns;
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        columns.epochDay.push_back(sqlite3_column_int64(stmt, 0));
+        columns.cents.push_back(sqlite3_column_int64(stmt, 1));
+        columns.category.push_back(
+            static_cast<core::TransactionCategory>(sqlite3_column_int(stmt, 2)));
+    }
+
+    sqlite3_reset(stmt);
+    return columns;
+}
+
+auto SqliteTransactionRepository::aggregateByCategory(core::Date from, core::Date to)
+    -> std::expected<std::vector<core::CategoryAggregate>, core::Error>
+{
+    // Month-aligned ranges (every report query) are served from the
+    // persistent rollups: O(categories) rows instead of a history scan.
+    // Partial-month ranges fall through to the raw GROUP BY below.
+    bool monthAligned = from.day() == std::chrono::day{1} &&
+        to == core::Date{std::chrono::year_month_day_last{
+                 to.year(), std::chrono::month_day_last{to.month()}}};
+    if (monthAligned) {
+        if (auto dirty = rollupsDirty(); !dirty) {
+            return std::unexpected(dirty.error());
+        } else if (*dirty) {
+            if (auto rebuilt = rebuildMonthlyRollups(); !rebuilt) {
+                return std::unexpected(rebuilt.error());
+            }
+        }
+
+        const char* rollupSql =
+            "SELECT category, SUM(income_cents), SUM(expense_cents), "
+            "       SUM(income_count), SUM(expense_count) "
+            "FROM monthly_rollups WHERE month >= ? AND month <= ? "
+            "GROUP BY category "
+            "HAVING SUM(income_count) + SUM(expense_count) > 0 "
+            "ORDER BY category";
+
+        auto stmtResult = db_->prepareCached(rollupSql);
+        if (!stmtResult) {
+            return std::unexpected(stmtResult.error());
+        }
+        auto* stmt = *stmtResult;
+
+        sqlite3_bind_int64(stmt, 1, monthKey(from));
+        sqlite3_bind_int64(stmt, 2, monthKey(to));
+
+        std::vector<core::CategoryAggregate> results;
+        while (sqlite3_step(stmt) == SQLITE_ROW) {
+            results.push_back(core::CategoryAggregate{
+                .category = static_cast<core::TransactionCategory>(sqlite3_column_int(stmt, 0)),
+                .incomeCents = sqlite3_column_int64(stmt, 1),
+                .expenseCents = sqlite3_column_int64(stmt, 2),
+                .incomeCount = sqlite3_column_int(stmt, 3),
+                .expenseCount = sqlite3_column_int(stmt, 4)
+            });
+        }
+
+        sqlite3_reset(stmt);
+        return results;
+    }
+
+    const char* sql =
+        "SELECT category, "
+        "       SUM(CASE WHEN amount_cents > 0 THEN amount_cents ELSE 0 END), "
+        "       SUM(CASE WHEN amount_cents < 0 THEN -amount_cents ELSE 0 END), "
+        "       SUM(amount_cents > 0), "
+        "       SUM(amount_cents <= 0) "
+        "FROM transactions WHERE date >= ? AND date <= ? "
+        "GROUP BY category ORDER BY category";
+
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
+    }
+    auto* stmt = *stmtResult;
+
+    sqlite3_bind_int64(stmt, 1, dateToEpochDay(from));
+    sqlite3_bind_int64(stmt, 2, dateToEpochDay(to));
+
+    std::vector<core::CategoryAggregate> results;
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        results.push_back(core::CategoryAggregate{
+            .category = static_cast<core::TransactionCategory>(sqlite3_column_int(stmt, 0)),
+            .incomeCents = sqlite3_column_int64(stmt, 1),
+            .expenseCents = sqlite3_column_int64(stmt, 2),
+            .incomeCount = sqlite3_column_int(stmt, 3),
+            .expenseCount = sqlite3_column_int(stmt, 4)
+        });
+    }
+
+    sqlite3_reset(stmt);
+    return results;
+}
+
+auto SqliteTransactionRepository::aggregateByMonthAndCategory(int year)
+    -> std::expected<std::vector<core::MonthlyCategoryAggregate>, core::Error>
+{
+    // Whole calendar years are always month-aligned, so this reads the
+    // persistent rollups directly: at most 12 * category-count rows,
+    // independent of history size
+    if (auto dirty = rollupsDirty(); !dirty) {
+        return std::unexpected(dirty.error());
+    } else if (*dirty) {
+        if (auto rebuilt = rebuildMonthlyRollups(); !rebuilt) {
+            return std::unexpected(rebuilt.error());
+        }
+    }
+
+    const char* sql =
+        "SELECT month % 100, category, "
+        "       SUM(income_cents), SUM(expense_cents), "
+        "       SUM(income_count), SUM(expense_count) "
+        "FROM monthly_rollups WHERE month >= ? AND month <= ? "
+        "GROUP BY 1, 2 "
+        "HAVING SUM(income_count) + SUM(expense_count) > 0 "
+        "ORDER BY 1, 2";
+
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
+    }
+    auto* stmt = *stmtResult;
+
+    sqlite3_bind_int64(stmt, 1, static_cast<int64_t>(year) * 100 + 1);
+    sqlite3_bind_int64(stmt, 2, static_cast<int64_t>(year) * 100 + 12);
+
+    std::vector<core::MonthlyCategoryAggregate> results;
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        results.push_back(core::MonthlyCategoryAggregate{
+            .month = sqlite3_column_int(stmt, 0),
+            .category = static_cast<core::TransactionCategory>(sqlite3_column_int(stmt, 1)),
+            .incomeCents = sqlite3_column_int64(stmt, 2),
+            .expenseCents = sqlite3_column_int64(stmt, 3),
+            .incomeCount = sqlite3_column_int(stmt, 4),
+            .expenseCount = sqlite3_column_int(stmt, 5)
+        });
+    }
+
+    sqlite3_reset(stmt);
+    return results;
+}
+
+auto SqliteTransactionRepository::ensureRollupsFresh() -> std::expected<void, core::Error> {
+    auto dirty = rollupsDirty();
+    if (!dirty) {
+        return std::unexpected(dirty.error());
+    }
+    if (*dirty) {
+        return rebuildMonthlyRollups();
+    }
+    return {};
+}
+
+auto SqliteTransactionRepository::monthlyNetFlow(const core::AccountId& accountId)
+    -> std::expected<std::vector<MonthlyNetFlow>, core::Error>
+{
+    if (auto dirty = rollupsDirty(); !dirty) {
+        return std::unexpected(dirty.error());
+    } else if (*dirty) {
+        if (auto rebuilt = rebuildMonthlyRollups(); !rebuilt) {
+            return std::unexpected(rebuilt.error());
+        }
+    }
+
+    const char* sql =
+        "SELECT month, SUM(income_cents) - SUM(expense_cents) "
+        "FROM monthly_rollups WHERE account_id = ? "
+        "GROUP BY month ORDER BY month";
+
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
+    }
+    auto* stmt = *stmtResult;
+
+    sqlite3_bind_text(stmt, 1, accountId.value.c_str(), -1, SQLITE_TRANSIENT);
+
+    std::vector<MonthlyNetFlow> flows;
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        flows.push_back(MonthlyNetFlow{
+            .month = sqlite3_column_int64(stmt, 0),
+            .netCents = sqlite3_column_int64(stmt, 1)
+        });
+    }
+
+    sqlite3_reset(stmt);
+    return flows;
+}
+
+auto SqliteTransactionRepository::netFlowBetween(const core::AccountId& accountId,
+                                                 core::Date from, core::Date to)
+    -> std::expected<int64_t, core::Error>
+{
+    const char* sql =
+        "SELECT COALESCE(SUM(amount_cents), 0) FROM transactions "
+        "WHERE account_id = ? AND date >= ? AND date <= ?";
+
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
+    }
+    auto* stmt = *stmtResult;
+
+    sqlite3_bind_text(stmt, 1, accountId.value.c_str(), -1, SQLITE_TRANSIENT);
+    sqlite3_bind_int64(stmt, 2, dateToEpochDay(from));
+    sqlite3_bind_int64(stmt, 3, dateToEpochDay(to));
+
+    int64_t net = 0;
+    if (sqlite3_step(stmt) == SQLITE_ROW) {
+        net = sqlite3_column_int64(stmt, 0);
+    }
+
+    sqlite3_reset(stmt);
+    return net;
+}
+
+auto SqliteTransactionRepository::streamAll(int limit)
+    -> std::expected<core::Generator<core::Transaction>, core::Error>
+{
+    // Plain prepare, not the cache: the statement's lifetime belongs to
+    // the generator, which finalizes it whenever the consumer stops -
+    // possibly mid-walk, which would leave a cached statement stuck on a
+    // half-stepped row
+    const char* sql = limit > 0
+        ? "SELECT * FROM transactions ORDER BY date DESC, id DESC LIMIT ?"
+        : "SELECT * FROM transactions ORDER BY date DESC, id DESC";
 
     sqlite3_stmt* stmt = nullptr;
     if (sqlite3_prepare_v2(db_->handle(), sql, -1, &stmt, nullptr) != SQLITE_OK) {
         return std::unexpected(core::DatabaseError{
-            .operation = "prepare remove",
+            .operation = "prepare streamAll",
             .message = sqlite3_errmsg(db_->handle())
         });
     }
+    if (limit > 0) {
+        sqlite3_bind_int(stmt, 1, limit);
+    }
+
+    return streamRows(OwnedStatement{stmt});
+}
+
+auto SqliteTransactionRepository::streamRows(OwnedStatement stmt)
+    -> core::Generator<core::Transaction>
+{
+    while (sqlite3_step(stmt.get()) == SQLITE_ROW) {
+        co_yield transactionFromRow(stmt.get());
+    }
+}
+
+auto SqliteTransactionRepository::applyRollupDelta(int64_t month, const std::string& accountId,
+                                                   int category, int64_t cents, int sign)
+    -> std::expected<void, core::Error>
+{
+    // Upsert keyed on (month, account, category); sign -1 backs a row's
+    // contribution out again. Income/expense split matches the aggregate
+    // queries: cents > 0 is income, everything else expense.
+    const char* sql = R"(
+        INSERT INTO monthly_rollups
+        (month, account_id, category, income_cents, expense_cents, income_count, expense_count)
+        VALUES (?, ?, ?, ?, ?, ?, ?)
+        ON CONFLICT(month, account_id, category) DO UPDATE SET
+            income_cents = income_cents + excluded.income_cents,
+            expense_cents = expense_cents + excluded.expense_cents,
+            income_count = income_count + excluded.income_count,
+            expense_count = expense_count + excluded.expense_count
+    )";
+
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
+    }
+    auto* stmt = *stmtResult;
+
+    bool income = cents > 0;
+    sqlite3_bind_int64(stmt, 1, month);
+    sqlite3_bind_text(stmt, 2, accountId.c_str(), -1, SQLITE_TRANSIENT);
+    sqlite3_bind_int(stmt, 3, category);
+    sqlite3_bind_int64(stmt, 4, income ? sign * cents : 0);
+    sqlite3_bind_int64(stmt, 5, income ? 0 : sign * -cents);
+    sqlite3_bind_int(stmt, 6, income ? sign : 0);
+    sqlite3_bind_int(stmt, 7, income ? 0 : sign);
+
+    int rc = sqlite3_step(stmt);
+    sqlite3_reset(stmt);
+
+    if (rc != SQLITE_DONE) {
+        return std::unexpected(core::DatabaseError{
+            .operation = "applyRollupDelta",
+            .message = sqlite3_errmsg(db_->handle())
+        });
+    }
+
+    return {};
+}
+
+auto SqliteTransactionRepository::markRollupsDirty() -> std::expected<void, core::Error> {
+    return db_->execute("UPDATE monthly_rollups_state SET dirty = 1");
+}
+
+auto SqliteTransactionRepository::rollupsDirty() -> std::expected<bool, core::Error> {
+    const char* sql = "SELECT dirty FROM monthly_rollups_state WHERE id = 1";
+
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
+    }
+    auto* stmt = *stmtResult;
+
+    bool dirty = false;
+    if (sqlite3_step(stmt) == SQLITE_ROW) {
+        dirty = sqlite3_column_int(stmt, 0) != 0;
+    }
+
+    sqlite3_reset(stmt);
+    return dirty;
+}
+
+auto SqliteTransactionRepository::rebuildMonthlyRollups() -> std::expected<void, core::Error> {
+    // One raw scan - the same cost a fallback aggregate would pay - but the
+    // result is persisted, so subsequent reads are O(categories) again.
+    // Months older than the archival cutoff are left untouched: their rows
+    // have moved to the archive database and can never change, so their
+    // rollups stay valid forever and full-history aggregates keep working
+    // from the hot database alone. The cutoff is month-aligned (and zero
+    // when nothing is archived), so the boundary is exact.
+    const char* sql = R"(
+        DELETE FROM monthly_rollups
+        WHERE month >= (SELECT CAST(strftime('%Y%m', cutoff_epoch_day * 86400, 'unixepoch') AS INTEGER)
+                        FROM archive_state);
+        INSERT INTO monthly_rollups
+        SELECT CAST(strftime('%Y%m', date * 86400, 'unixepoch') AS INTEGER),
+               account_id, category,
+               SUM(CASE WHEN amount_cents > 0 THEN amount_cents ELSE 0 END),
+               SUM(CASE WHEN amount_cents < 0 THEN -amount_cents ELSE 0 END),
+               SUM(amount_cents > 0),
+               SUM(amount_cents <= 0)
+        FROM transactions
+        WHERE date >= (SELECT cutoff_epoch_day FROM archive_state)
+        GROUP BY 1, 2, 3;
+        UPDATE monthly_rollups_state SET dirty = 0;
+    )";
+
+    auto scope = db_->beginTransaction();
+    if (!scope) {
+        return std::unexpected(scope.error());
+    }
+    if (auto result = db_->execute(sql); !result) {
+        return result;
+    }
+    return scope->commit();
+}
+
+auto SqliteTransactionRepository::monthKey(core::Date date) -> int64_t {
+    return core::civil::monthKey(date);
+}
+
+auto SqliteTransactionRepository::remove(const core::TransactionId& id) -> std::expected<void, core::Error> {
+    // Read the row's rollup contribution before the delete discards it
+    struct OldRow {
+        int64_t month;
+        std::string accountId;
+        int category;
+        int64_t cents;
+    };
+    std::optional<OldRow> oldRow;
+    {
+        const char* probeSql =
+            "SELECT date, account_id, category, amount_cents FROM transactions WHERE id = ?";
+        auto probeResult = db_->prepareCached(probeSql);
+        if (!probeResult) {
+            return std::unexpected(probeResult.error());
+        }
+        auto* probe = *probeResult;
+        sqlite3_bind_text(probe, 1, id.value.c_str(), -1, SQLITE_TRANSIENT);
+        if (sqlite3_step(probe) == SQLITE_ROW) {
+            oldRow = OldRow{
+                .month = monthKey(epochDayToDate(sqlite3_column_int64(probe, 0))),
+                .accountId = reinterpret_cast<const char*>(sqlite3_column_text(probe, 1)),
+                .category = sqlite3_column_int(probe, 2),
+                .cents = sqlite3_column_int64(probe, 3)
+            };
+        }
+        sqlite3_reset(probe);
+    }
+
+    const char* sql = "DELETE FROM transactions WHERE id = ?";
+
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
+    }
+    auto* stmt = *stmtResult;
 
     sqlite3_bind_text(stmt, 1, id.value.c_str(), -1, SQLITE_TRANSIENT);
 
     int rc = sqlite3_step(stmt);
-    sqlite3_finalize(stmt);
+    sqlite3_reset(stmt);
 
     if (rc != SQLITE_DONE) {
         return std::unexpected(core::DatabaseError{
@@ -251,6 +940,11 @@ auto SqliteTransactionRepository::remove(const core::TransactionId& id) -> std::
         });
     }
 
+    if (oldRow) {
+        bumpGeneration();
+        return applyRollupDelta(oldRow->month, oldRow->accountId,
+                                oldRow->category, oldRow->cents, -1);
+    }
     return {};
 }
 
@@ -260,46 +954,289 @@ auto SqliteTransactionRepository::update(const core::Transaction& txn) -> std::e
 }
 
 auto SqliteTransactionRepository::count() -> std::expected<int, core::Error> {
-    const char* sql = "SELECT COUNT(*) FROM transactions";
+    // The rollups already carry per-(month, account, category) row counts,
+    // so the total is a sum over a few hundred rollup rows - under SQLite
+    // a COUNT(*) here would walk the whole history instead
+    if (auto dirty = rollupsDirty(); !dirty) {
+        return std::unexpected(dirty.error());
+    } else if (*dirty) {
+        if (auto rebuilt = rebuildMonthlyRollups(); !rebuilt) {
+            return std::unexpected(rebuilt.error());
+        }
+    }
 
-    sqlite3_stmt* stmt = nullptr;
-    if (sqlite3_prepare_v2(db_->handle(), sql, -1, &stmt, nullptr) != SQLITE_OK) {
-        return std::unexpected(core::DatabaseError{
-            .operation = "prepare count",
-            .message = sqlite3_errmsg(db_->handle())
-        });
+    const char* sql =
+        "SELECT COALESCE(SUM(income_count + expense_count), 0) FROM monthly_rollups";
+
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
     }
+    auto* stmt = *stmtResult;
 
     int count = 0;
     if (sqlite3_step(stmt) == SQLITE_ROW) {
         count = sqlite3_column_int(stmt, 0);
     }
 
-    sqlite3_finalize(stmt);
+    sqlite3_reset(stmt);
     return count;
 }
 
+auto SqliteTransactionRepository::rowCounts()
+    -> std::expected<TransactionRowCounts, core::Error>
+{
+    if (auto dirty = rollupsDirty(); !dirty) {
+        return std::unexpected(dirty.error());
+    } else if (*dirty) {
+        if (auto rebuilt = rebuildMonthlyRollups(); !rebuilt) {
+            return std::unexpected(rebuilt.error());
+        }
+    }
+
+    // One ordered scan of the rollups feeds all three views; the month
+    // series comes out ascending for free and accounts are folded as
+    // their runs arrive
+    const char* sql =
+        "SELECT month, account_id, SUM(income_count + expense_count) "
+        "FROM monthly_rollups "
+        "GROUP BY month, account_id "
+        "ORDER BY month";
+
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
+    }
+    auto* stmt = *stmtResult;
+
+    TransactionRowCounts counts;
+    std::map<std::string, int> accountRows;
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        auto month = sqlite3_column_int64(stmt, 0);
+        const auto* accountId = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1));
+        int rows = sqlite3_column_int(stmt, 2);
+
+        counts.total += rows;
+        accountRows[accountId ? accountId : ""] += rows;
+        if (!counts.byMonth.empty() && counts.byMonth.back().first == month) {
+            counts.byMonth.back().second += rows;
+        } else {
+            counts.byMonth.emplace_back(month, rows);
+        }
+    }
+    sqlite3_reset(stmt);
+
+    counts.byAccount.assign(accountRows.begin(), accountRows.end());
+    return counts;
+}
+
 auto SqliteTransactionRepository::clear() -> std::expected<void, core::Error> {
-    return db_->execute("DELETE FROM transactions");
+    auto result = db_->execute(
+        "DELETE FROM transactions;"
+        "DELETE FROM monthly_rollups;"
+        "UPDATE monthly_rollups_state SET dirty = 0;");
+    if (result) {
+        bumpGeneration();
+    }
+    return result;
+}
+
+auto SqliteTransactionRepository::removeByDateRange(
+    const core::AccountId& accountId, core::Date from, core::Date to)
+    -> std::expected<int, core::Error>
+{
+    const char* sql = "DELETE FROM transactions WHERE account_id = ? AND date >= ? AND date <= ?";
+
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
+    }
+    auto* stmt = *stmtResult;
+
+    sqlite3_bind_text(stmt, 1, accountId.value.c_str(), -1, SQLITE_TRANSIENT);
+    sqlite3_bind_int64(stmt, 2, dateToEpochDay(from));
+    sqlite3_bind_int64(stmt, 3, dateToEpochDay(to));
+
+    int rc = sqlite3_step(stmt);
+    sqlite3_reset(stmt);
+
+    if (rc != SQLITE_DONE) {
+        return std::unexpected(core::DatabaseError{
+            .operation = "removeByDateRange",
+            .message = sqlite3_errmsg(db_->handle())
+        });
+    }
+
+    int removed = sqlite3_changes(db_->handle());
+    if (removed > 0) {
+        bumpGeneration();
+        // Per-row deltas are not worth it for a bulk delete; let the next
+        // aggregate read rebuild the rollups
+        if (auto marked = markRollupsDirty(); !marked) {
+            return std::unexpected(marked.error());
+        }
+    }
+    return removed;
+}
+
+auto SqliteTransactionRepository::updateCategory(
+    const std::vector<core::TransactionId>& ids, core::TransactionCategory category,
+    const std::string& matchedRule)
+    -> std::expected<int, core::Error>
+{
+    if (ids.empty()) {
+        return 0;
+    }
+
+    // One UPDATE per chunk of ids, chunked to stay well under SQLite's
+    // default bind-parameter limit
+    constexpr std::size_t kChunkSize = 500;
+
+    auto scope = db_->beginTransaction();
+    if (!scope) {
+        return std::unexpected(scope.error());
+    }
+
+    int updated = 0;
+    for (std::size_t offset = 0; offset < ids.size(); offset += kChunkSize) {
+        auto chunk = std::min(kChunkSize, ids.size() - offset);
+
+        std::string sql = "UPDATE transactions SET category = ?, matched_rule = ? WHERE id IN (";
+        for (std::size_t i = 0; i < chunk; ++i) {
+            sql += i == 0 ? "?" : ",?";
+        }
+        sql += ")";
+
+        // Plain prepare: the placeholder count varies with the remainder
+        // chunk, so caching would fill the statement cache with one-offs
+        sqlite3_stmt* stmt = nullptr;
+        if (sqlite3_prepare_v2(db_->handle(), sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
+            return std::unexpected(core::DatabaseError{
+                .operation = "updateCategory",
+                .message = sqlite3_errmsg(db_->handle())
+            });
+        }
+
+        sqlite3_bind_int(stmt, 1, static_cast<int>(category));
+        if (matchedRule.empty()) {
+            sqlite3_bind_null(stmt, 2);
+        } else {
+            sqlite3_bind_text(stmt, 2, matchedRule.c_str(), -1, SQLITE_TRANSIENT);
+        }
+        for (std::size_t i = 0; i < chunk; ++i) {
+            sqlite3_bind_text(stmt, static_cast<int>(i + 3),
+                              ids[offset + i].value.c_str(), -1, SQLITE_TRANSIENT);
+        }
+
+        int rc = sqlite3_step(stmt);
+        sqlite3_finalize(stmt);
+
+        if (rc != SQLITE_DONE) {
+            return std::unexpected(core::DatabaseError{
+                .operation = "updateCategory",
+                .message = sqlite3_errmsg(db_->handle())
+            });
+        }
+        updated += sqlite3_changes(db_->handle());
+    }
+
+    // Category moves shift amounts between rollup rows; mark the rollups
+    // stale instead of tracking per-row old categories
+    if (updated > 0) {
+        if (auto marked = markRollupsDirty(); !marked) {
+            return std::unexpected(marked.error());
+        }
+    }
+
+    if (auto committed = scope->commit(); !committed) {
+        return std::unexpected(committed.error());
+    }
+
+    if (updated > 0) {
+        bumpGeneration();
+    }
+    return updated;
+}
+
+auto SqliteTransactionRepository::findForRecategorization(
+    const std::vector<std::string>& staleRules)
+    -> std::expected<std::vector<core::Transaction>, core::Error>
+{
+    // Rows with a manual override are never re-categorized, so they are
+    // filtered in the query rather than hydrated and skipped
+    std::string sql =
+        "SELECT * FROM transactions WHERE user_category_override IS NULL "
+        "AND (category = ?";
+    if (!staleRules.empty()) {
+        sql += " OR matched_rule IN (";
+        for (std::size_t i = 0; i < staleRules.size(); ++i) {
+            sql += i == 0 ? "?" : ",?";
+        }
+        sql += ")";
+    }
+    sql += ") ORDER BY date DESC";
+
+    // Plain prepare: the placeholder count varies with the stale-rule set
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v2(db_->handle(), sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
+        return std::unexpected(core::DatabaseError{
+            .operation = "findForRecategorization",
+            .message = sqlite3_errmsg(db_->handle())
+        });
+    }
+
+    sqlite3_bind_int(stmt, 1, static_cast<int>(core::TransactionCategory::Uncategorized));
+    for (std::size_t i = 0; i < staleRules.size(); ++i) {
+        sqlite3_bind_text(stmt, static_cast<int>(i + 2),
+                          staleRules[i].c_str(), -1, SQLITE_TRANSIENT);
+    }
+
+    std::vector<core::Transaction> results;
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        appendTransactionFromRow(results, stmt);
+    }
+
+    sqlite3_finalize(stmt);
+    return results;
 }
 
 auto SqliteTransactionRepository::transactionFromRow(sqlite3_stmt* stmt) -> core::Transaction {
-    auto id = core::TransactionId{reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0))};
-    auto accountId = core::AccountId{reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1))};
-    auto date = stringToDate(reinterpret_cast<const char*>(sqlite3_column_text(stmt, 2)));
-    auto cents = sqlite3_column_int64(stmt, 3);
-    auto currency = static_cast<core::Currency>(sqlite3_column_int(stmt, 4));
-    auto type = static_cast<core::TransactionType>(sqlite3_column_int(stmt, 5));
-    auto category = static_cast<core::TransactionCategory>(sqlite3_column_int(stmt, 6));
+    core::Transaction txn{
+        core::TransactionId{reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0))},
+        core::AccountId{reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1))},
+        epochDayToDate(sqlite3_column_int64(stmt, 2)),
+        core::Money{sqlite3_column_int64(stmt, 3),
+                    static_cast<core::Currency>(sqlite3_column_int(stmt, 4))},
+        static_cast<core::TransactionType>(sqlite3_column_int(stmt, 5))};
+    populateTransactionFromRow(txn, stmt);
+    return txn;
+}
 
-    core::Transaction txn{id, accountId, date, core::Money{cents, currency}, type};
-    txn.setCategory(category);
+auto SqliteTransactionRepository::appendTransactionFromRow(std::vector<core::Transaction>& out,
+                                                           sqlite3_stmt* stmt) -> void {
+    // Construct in place in the destination vector - the row's strings land
+    // directly in their final home instead of passing through a temporary
+    auto& txn = out.emplace_back(
+        core::TransactionId{reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0))},
+        core::AccountId{reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1))},
+        epochDayToDate(sqlite3_column_int64(stmt, 2)),
+        core::Money{sqlite3_column_int64(stmt, 3),
+                    static_cast<core::Currency>(sqlite3_column_int(stmt, 4))},
+        static_cast<core::TransactionType>(sqlite3_column_int(stmt, 5)));
+    populateTransactionFromRow(txn, stmt);
+}
+
+auto SqliteTransactionRepository::populateTransactionFromRow(core::Transaction& txn,
+                                                             sqlite3_stmt* stmt) -> void {
+    ARES_PERF_SCOPE("transactionFromRow");
+    txn.setCategory(static_cast<core::TransactionCategory>(sqlite3_column_int(stmt, 6)));
 
     if (sqlite3_column_type(stmt, 7) != SQLITE_NULL) {
         txn.setDescription(reinterpret_cast<const char*>(sqlite3_column_text(stmt, 7)));
     }
     if (sqlite3_column_type(stmt, 8) != SQLITE_NULL) {
-        txn.setCounterpartyName(reinterpret_cast<const char*>(sqlite3_column_text(stmt, 8)));
+        txn.setCounterpartyName(
+            stringPool_.intern(reinterpret_cast<const char*>(sqlite3_column_text(stmt, 8))));
     }
     if (sqlite3_column_type(stmt, 9) != SQLITE_NULL) {
         txn.setCounterpartyIban(reinterpret_cast<const char*>(sqlite3_column_text(stmt, 9)));
@@ -308,7 +1245,8 @@ auto SqliteTransactionRepository::transactionFromRow(sqlite3_stmt* stmt) -> core
         txn.setRawDescription(reinterpret_cast<const char*>(sqlite3_column_text(stmt, 10)));
     }
     if (sqlite3_column_type(stmt, 11) != SQLITE_NULL) {
-        txn.setMutationCode(reinterpret_cast<const char*>(sqlite3_column_text(stmt, 11)));
+        txn.setMutationCode(
+            stringPool_.intern(reinterpret_cast<const char*>(sqlite3_column_text(stmt, 11))));
     }
 
     // New recurring transaction fields
@@ -325,25 +1263,26 @@ auto SqliteTransactionRepository::transactionFromRow(sqlite3_stmt* stmt) -> core
     if (sqlite3_column_type(stmt, 15) != SQLITE_NULL) {
         txn.setUserCategoryOverride(static_cast<core::TransactionCategory>(sqlite3_column_int(stmt, 15)));
     }
+    // matched_rule was appended by migration v5, after created_at
+    if (sqlite3_column_count(stmt) > 17 && sqlite3_column_type(stmt, 17) != SQLITE_NULL) {
+        txn.setMatchedRule(reinterpret_cast<const char*>(sqlite3_column_text(stmt, 17)));
+    }
+    // merchant was appended by migration v13, after content_hash (v9)
+    if (sqlite3_column_count(stmt) > 19 && sqlite3_column_type(stmt, 19) != SQLITE_NULL) {
+        txn.setMerchant(
+            stringPool_.intern(reinterpret_cast<const char*>(sqlite3_column_text(stmt, 19))));
+    }
 
-    return txn;
+    // Hydration goes through the setters; only edits after this count as dirty
+    txn.markClean();
 }
 
-auto SqliteTransactionRepository::dateToString(core::Date date) -> std::string {
-    return fmt::format("{:04d}-{:02d}-{:02d}",
-                       static_cast<int>(date.year()),
-                       static_cast<unsigned>(date.month()),
-                       static_cast<unsigned>(date.day()));
+auto SqliteTransactionRepository::dateToEpochDay(core::Date date) -> int64_t {
+    return core::civil::toEpochDay(date);
 }
 
-auto SqliteTransactionRepository::stringToDate(const std::string& str) -> core::Date {
-    int year, month, day;
-    std::sscanf(str.c_str(), "%d-%d-%d", &year, &month, &day);
-    return core::Date{
-        std::chrono::year{year},
-        std::chrono::month{static_cast<unsigned>(month)},
-        std::chrono::day{static_cast<unsigned>(day)}
-    };
+auto SqliteTransactionRepository::epochDayToDate(int64_t days) -> core::Date {
+    return core::civil::fromEpochDay(days);
 }
 
 auto SqliteTransactionRepository::stringToFrequency(const std::string& str) -> core::RecurrenceFrequency {
@@ -356,62 +1295,91 @@ auto SqliteTransactionRepository::stringToFrequency(const std::string& str) -> c
 }
 
 auto SqliteTransactionRepository::exists(const core::Transaction& txn) -> std::expected<bool, core::Error> {
-    // Check for duplicate based on date + amount + counterparty + account
-    const char* sql = R"(
-        SELECT COUNT(*) FROM transactions
-        WHERE account_id = ? AND date = ? AND amount_cents = ?
-        AND (counterparty_name = ? OR (counterparty_name IS NULL AND ? IS NULL))
-    )";
+    // One probe of the unique content-hash index
+    const char* sql = "SELECT 1 FROM transactions WHERE content_hash = ? LIMIT 1";
 
-    sqlite3_stmt* stmt = nullptr;
-    if (sqlite3_prepare_v2(db_->handle(), sql, -1, &stmt, nullptr) != SQLITE_OK) {
-        return std::unexpected(core::DatabaseError{
-            .operation = "prepare exists check",
-            .message = sqlite3_errmsg(db_->handle())
-        });
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
     }
+    auto* stmt = *stmtResult;
 
-    sqlite3_bind_text(stmt, 1, txn.accountId().value.c_str(), -1, SQLITE_TRANSIENT);
-    sqlite3_bind_text(stmt, 2, dateToString(txn.date()).c_str(), -1, SQLITE_TRANSIENT);
-    sqlite3_bind_int64(stmt, 3, txn.amount().cents());
+    auto hash = transactionContentHash(
+        txn.accountId().value, dateToEpochDay(txn.date()), txn.amount().cents(),
+        txn.counterpartyName() ? txn.counterpartyName()->c_str() : nullptr);
+    sqlite3_bind_text(stmt, 1, hash.c_str(), -1, SQLITE_TRANSIENT);
 
-    if (txn.counterpartyName()) {
-        sqlite3_bind_text(stmt, 4, txn.counterpartyName()->c_str(), -1, SQLITE_TRANSIENT);
-        sqlite3_bind_text(stmt, 5, txn.counterpartyName()->c_str(), -1, SQLITE_TRANSIENT);
-    } else {
-        sqlite3_bind_null(stmt, 4);
-        sqlite3_bind_null(stmt, 5);
-    }
+    bool found = sqlite3_step(stmt) == SQLITE_ROW;
+    sqlite3_reset(stmt);
 
-    int count = 0;
-    if (sqlite3_step(stmt) == SQLITE_ROW) {
-        count = sqlite3_column_int(stmt, 0);
-    }
-    sqlite3_finalize(stmt);
-
-    return count > 0;
+    return found;
 }
 
 auto SqliteTransactionRepository::saveBatchSkipDuplicates(const std::vector<core::Transaction>& transactions)
     -> std::expected<int, core::Error>
 {
-    int savedCount = 0;
+    if (transactions.empty()) {
+        return 0;
+    }
+
+    // Duplicate detection rides the unique index on content_hash: each row
+    // is an INSERT OR IGNORE, so a duplicate - against stored rows or an
+    // earlier row of the same batch - costs one indexed probe, and
+    // sqlite3_changes() says whether the row actually landed
+    const char* sql = R"(
+        INSERT OR IGNORE INTO transactions
+        (id, account_id, date, amount_cents, currency, type, category,
+         description, counterparty_name, counterparty_iban, raw_description, mutation_code,
+         is_recurring, frequency, is_active, user_category_override, matched_rule, merchant,
+         content_hash)
+        VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)
+    )";
+
+    auto stmtResult = db_->prepareCached(sql);
+    if (!stmtResult) {
+        return std::unexpected(stmtResult.error());
+    }
+    auto* stmt = *stmtResult;
+
+    auto scope = db_->beginTransaction();
+    if (!scope) {
+        return std::unexpected(scope.error());
+    }
 
+    int savedCount = 0;
     for (const auto& txn : transactions) {
-        auto existsResult = exists(txn);
-        if (!existsResult) {
-            return std::unexpected(existsResult.error());
+        bindTransactionColumns(stmt, txn);
+        auto hash = transactionContentHash(
+            txn.accountId().value, dateToEpochDay(txn.date()), txn.amount().cents(),
+            txn.counterpartyName() ? txn.counterpartyName()->c_str() : nullptr);
+        sqlite3_bind_text(stmt, 19, hash.c_str(), -1, SQLITE_TRANSIENT);
+
+        int rc = sqlite3_step(stmt);
+        sqlite3_reset(stmt);
+        if (rc != SQLITE_DONE) {
+            return std::unexpected(core::DatabaseError{
+                .operation = "save batch skip duplicates",
+                .message = sqlite3_errmsg(db_->handle())
+            });
         }
 
-        if (!*existsResult) {
-            auto saveResult = save(txn);
-            if (!saveResult) {
-                return std::unexpected(saveResult.error());
-            }
-            savedCount++;
+        if (sqlite3_changes(db_->handle()) == 0) {
+            continue;  // Collided with an existing row's content hash
+        }
+
+        savedCount++;
+        if (auto delta = applyRollupDelta(monthKey(txn.date()), txn.accountId().value,
+                                          static_cast<int>(txn.category()),
+                                          txn.amount().cents(), 1); !delta) {
+            return std::unexpected(delta.error());
         }
     }
 
+    if (auto committed = scope->commit(); !committed) {
+        return std::unexpected(committed.error());
+    }
+
+    bumpGeneration();
     return savedCount;
 }
 
@@ -1,11 +1,28 @@
 #pragma once
 
 #include <memory>
+#include "core/common/Generator.hpp"
+#include "core/common/InternedString.hpp"
 #include "core/transaction/Transaction.hpp"
 #include "infrastructure/persistence/DatabaseConnection.hpp"
 
 namespace ares::infrastructure::persistence {
 
+// Net transaction flow of one account in one calendar month (yyyymm),
+// served from the persistent monthly rollups
+struct MonthlyNetFlow {
+    int64_t month;
+    int64_t netCents;
+};
+
+// Row counts served from the persistent monthly rollups: one scan over a
+// few hundred rollup rows instead of a COUNT(*) over the whole history
+struct TransactionRowCounts {
+    int total{0};
+    std::vector<std::pair<std::string, int>> byAccount;  // account_id, rows
+    std::vector<std::pair<int64_t, int>> byMonth;        // yyyymm ascending, rows
+};
+
 class SqliteTransactionRepository : public core::TransactionRepository {
 public:
     explicit SqliteTransactionRepository(std::shared_ptr<DatabaseConnection> db);
@@ -19,27 +36,141 @@ public:
     auto findByCategory(core::TransactionCategory category)
         -> std::expected<std::vector<core::Transaction>, core::Error> override;
     auto findAll() -> std::expected<std::vector<core::Transaction>, core::Error> override;
+    auto findPage(int limit, const std::optional<core::TransactionRepository::PageCursor>& before,
+                  const std::optional<core::TransactionRepository::PageCursor>& after)
+        -> std::expected<std::vector<core::Transaction>, core::Error> override;
+    auto search(const std::string& query, int limit)
+        -> std::expected<std::vector<core::Transaction>, core::Error> override;
     auto remove(const core::TransactionId& id) -> std::expected<void, core::Error> override;
     auto update(const core::Transaction& transaction) -> std::expected<void, core::Error> override;
+    auto forEach(const core::TransactionRepository::TransactionVisitor& visitor)
+        -> std::expected<void, core::Error> override;
+    auto forEachFiltered(const core::TransactionRepository::Filter& filter,
+                         const core::TransactionRepository::TransactionVisitor& visitor)
+        -> std::expected<void, core::Error> override;
+    auto forEachInDateRange(core::Date from, core::Date to,
+                            const core::TransactionRepository::TransactionVisitor& visitor)
+        -> std::expected<void, core::Error> override;
+    auto findAmountsByDateRange(core::Date from, core::Date to)
+        -> std::expected<std::vector<core::TransactionAmount>, core::Error> override;
+    auto findColumnsByDateRange(core::Date from, core::Date to)
+        -> std::expected<core::TransactionColumns, core::Error> override;
+    auto aggregateByCategory(core::Date from, core::Date to)
+        -> std::expected<std::vector<core::CategoryAggregate>, core::Error> override;
+    auto aggregateByMonthAndCategory(int year)
+        -> std::expected<std::vector<core::MonthlyCategoryAggregate>, core::Error> override;
 
-    // Additional utility methods
+    // Additional utility methods.
+    // count() is served from the rollups (rebuilding them first when
+    // dirty), so the progress-estimation and pagination callers pay
+    // O(rollup rows), not a COUNT(*) scan. Because archived months keep
+    // their rollups, the count covers the full history - hot plus
+    // archived rows.
     auto count() -> std::expected<int, core::Error>;
+    // Per-account and per-month row counts for the stats surface, from
+    // the same single rollup scan
+    auto rowCounts() -> std::expected<TransactionRowCounts, core::Error>;
     auto clear() -> std::expected<void, core::Error>;
 
-    // Check if a transaction already exists (for duplicate detection)
-    // Matches on: date + amount + counterparty + account
+    // Bulk mutations - one statement instead of one per row.
+    // Returns the number of affected rows.
+    auto removeByDateRange(const core::AccountId& accountId, core::Date from, core::Date to)
+        -> std::expected<int, core::Error>;
+    auto updateCategory(const std::vector<core::TransactionId>& ids,
+                        core::TransactionCategory category,
+                        const std::string& matchedRule = {})
+        -> std::expected<int, core::Error>;
+
+    // Candidate rows for an incremental recategorize: Uncategorized rows
+    // plus rows whose stored matched_rule is in staleRules, excluding rows
+    // with a manual override
+    auto findForRecategorization(const std::vector<std::string>& staleRules)
+        -> std::expected<std::vector<core::Transaction>, core::Error>;
+
+    // Check if a transaction already exists (for duplicate detection):
+    // one probe of the unique content-hash index. Rows added manually
+    // after migration v9 carry no hash and are not seen here.
     auto exists(const core::Transaction& transaction) -> std::expected<bool, core::Error>;
 
-    // Save batch with duplicate detection - returns number of new transactions saved
+    // Save batch with duplicate detection - returns number of new
+    // transactions saved. Rides the unique content-hash index: each row is
+    // an INSERT OR IGNORE, so a duplicate costs one indexed probe with no
+    // separate SELECT and no session state, and duplicates within the
+    // batch (or across batches of the same session) collapse the same way
     auto saveBatchSkipDuplicates(const std::vector<core::Transaction>& transactions)
         -> std::expected<int, core::Error>;
 
+    // Per-month net flow for one account, ascending by month - the
+    // checkpoint series behind balance-over-time queries. Reads the
+    // persistent rollups (rebuilding them first if a bulk mutation left
+    // them dirty), so the cost is O(months of history), not O(rows).
+    auto monthlyNetFlow(const core::AccountId& accountId)
+        -> std::expected<std::vector<MonthlyNetFlow>, core::Error>;
+
+    // Rebuild the rollups now if a bulk mutation left them dirty. Call on
+    // the writable connection before fanning rollup-backed reads out over
+    // pooled read-only connections, which cannot run the rebuild themselves.
+    auto ensureRollupsFresh() -> std::expected<void, core::Error>;
+
+    // Net flow for one account over an inclusive date range - the
+    // partial-month replay behind balance-at-date. One indexed range scan
+    // over (account_id, date).
+    auto netFlowBetween(const core::AccountId& accountId, core::Date from, core::Date to)
+        -> std::expected<int64_t, core::Error>;
+
+    // Streaming listing: each row flows straight from sqlite3_step to
+    // the consumer with no intermediate vector, so memory stays constant
+    // for any limit and the first row renders before the second is even
+    // hydrated. Newest first, same order as findPage; limit <= 0 streams
+    // the whole history. The repository and its connection must outlive
+    // the generator.
+    auto streamAll(int limit = 0)
+        -> std::expected<core::Generator<core::Transaction>, core::Error>;
+
 private:
     std::shared_ptr<DatabaseConnection> db_;
 
+    // Hydration dedupe: a history has a few hundred distinct counterparties
+    // and a handful of mutation codes, so rows share their storage
+    core::StringPool stringPool_;
+
+    // Owning cursor handed into the stream coroutine: abandoning the
+    // generator mid-walk finalizes the statement during frame unwind
+    struct StatementFinalizer {
+        auto operator()(sqlite3_stmt* stmt) const -> void { sqlite3_finalize(stmt); }
+    };
+    using OwnedStatement = std::unique_ptr<sqlite3_stmt, StatementFinalizer>;
+
+    auto streamRows(OwnedStatement stmt) -> core::Generator<core::Transaction>;
+
     auto transactionFromRow(sqlite3_stmt* stmt) -> core::Transaction;
-    auto dateToString(core::Date date) -> std::string;
-    auto stringToDate(const std::string& str) -> core::Date;
+
+    // Emplace hydration: the row's Transaction is constructed in place at
+    // the back of `out` and filled there, so nothing is moved or copied in
+    auto appendTransactionFromRow(std::vector<core::Transaction>& out, sqlite3_stmt* stmt) -> void;
+
+    // Shared setter pass for both hydration entry points
+    auto populateTransactionFromRow(core::Transaction& txn, sqlite3_stmt* stmt) -> void;
+
+    // Bind the 17 shared row columns (everything except content_hash,
+    // which save and import populate differently)
+    static auto bindTransactionColumns(sqlite3_stmt* stmt, const core::Transaction& txn) -> void;
+
+    // Monthly rollup maintenance (monthly_rollups, migration v7). Row-level
+    // writes apply per-row deltas in the same transaction; bulk mutations
+    // just mark the rollups dirty, and the next month-aligned aggregate
+    // read rebuilds them before serving.
+    auto applyRollupDelta(int64_t month, const std::string& accountId, int category,
+                          int64_t cents, int sign) -> std::expected<void, core::Error>;
+    auto markRollupsDirty() -> std::expected<void, core::Error>;
+    auto rollupsDirty() -> std::expected<bool, core::Error>;
+    auto rebuildMonthlyRollups() -> std::expected<void, core::Error>;
+    // Calendar month as yyyymm - the monthly_rollups key
+    static auto monthKey(core::Date date) -> int64_t;
+    // Dates are stored as integer epoch days (days since 1970-01-01), so
+    // range predicates are integer comparisons and hydration is a cast
+    static auto dateToEpochDay(core::Date date) -> int64_t;
+    static auto epochDayToDate(int64_t days) -> core::Date;
     static auto stringToFrequency(const std::string& str) -> core::RecurrenceFrequency;
 };
 
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <fmt/format.h>
+#include "core/common/TextNormalize.hpp"
+
+namespace ares::infrastructure::persistence {
+
+// Content identity of a transaction for import duplicate detection:
+// (account, epoch day, cents, normalized counterparty) hashed with 64-bit
+// FNV-1a and stored hex in transactions.content_hash, which carries a
+// unique index (migration v9). Import dedup then rides that index - an
+// INSERT OR IGNORE costs one indexed probe per row - with no projection
+// query and no in-memory key set. The counterparty goes through the
+// duplicate-detection normal form (case fold, space collapse) so
+// re-exports that only differ in formatting still collapse; a missing
+// counterparty hashes as an empty field.
+[[nodiscard]] inline auto transactionContentHash(std::string_view accountId, int64_t epochDay,
+                                                 int64_t cents, const char* counterparty)
+    -> std::string
+{
+    std::string normalized;
+    if (counterparty) {
+        core::text::lowercaseCollapseSpacesInto(counterparty, normalized);
+    }
+
+    auto key = fmt::format("{}\x1f{}\x1f{}\x1f{}", accountId, epochDay, cents, normalized);
+
+    uint64_t hash = 14695981039346656037ull;
+    for (unsigned char byte : key) {
+        hash ^= byte;
+        hash *= 1099511628211ull;
+    }
+    return fmt::format("{:016x}", hash);
+}
+
+} // namespace ares::infrastructure::persistence
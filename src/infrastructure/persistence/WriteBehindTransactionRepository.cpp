@@ -0,0 +1,236 @@
+#include "infrastructure/persistence/WriteBehindTransactionRepository.hpp"
+
+namespace ares::infrastructure::persistence {
+
+WriteBehindTransactionRepository::WriteBehindTransactionRepository(
+    std::shared_ptr<SqliteTransactionRepository> inner,
+    std::size_t queueCapacity)
+    : inner_{std::move(inner)}
+    , queue_{queueCapacity}
+{
+    worker_ = std::jthread{[this] {
+        while (auto task = queue_.pop()) {
+            auto result = (*task)(*inner_);
+
+            std::scoped_lock lock{stateMutex_};
+            if (!result && !deferredError_) {
+                deferredError_ = result.error();
+            }
+            if (--pending_ == 0) {
+                idle_.notify_all();
+            }
+        }
+    }};
+}
+
+WriteBehindTransactionRepository::~WriteBehindTransactionRepository() {
+    (void)flush();
+    queue_.close();
+}
+
+auto WriteBehindTransactionRepository::enqueue(WriteTask task) -> void {
+    // The write is acknowledged as soon as it is queued, so caches must
+    // treat the data as changed now, not when the worker applies it
+    bumpGeneration();
+    {
+        std::scoped_lock lock{stateMutex_};
+        ++pending_;
+    }
+    queue_.push(std::move(task));
+}
+
+auto WriteBehindTransactionRepository::flush() -> std::expected<void, core::Error> {
+    std::unique_lock lock{stateMutex_};
+    idle_.wait(lock, [this] { return pending_ == 0; });
+
+    if (deferredError_) {
+        auto error = std::move(*deferredError_);
+        deferredError_.reset();
+        return std::unexpected(std::move(error));
+    }
+    return {};
+}
+
+auto WriteBehindTransactionRepository::save(const core::Transaction& transaction)
+    -> std::expected<void, core::Error>
+{
+    enqueue([txn = transaction](SqliteTransactionRepository& repo) {
+        return repo.save(txn);
+    });
+    return {};
+}
+
+auto WriteBehindTransactionRepository::saveBatch(const std::vector<core::Transaction>& transactions)
+    -> std::expected<void, core::Error>
+{
+    enqueue([txns = transactions](SqliteTransactionRepository& repo) {
+        return repo.saveBatch(txns);
+    });
+    return {};
+}
+
+auto WriteBehindTransactionRepository::remove(const core::TransactionId& id)
+    -> std::expected<void, core::Error>
+{
+    enqueue([id](SqliteTransactionRepository& repo) {
+        return repo.remove(id);
+    });
+    return {};
+}
+
+auto WriteBehindTransactionRepository::update(const core::Transaction& transaction)
+    -> std::expected<void, core::Error>
+{
+    enqueue([txn = transaction](SqliteTransactionRepository& repo) {
+        return repo.update(txn);
+    });
+    return {};
+}
+
+auto WriteBehindTransactionRepository::findById(const core::TransactionId& id)
+    -> std::expected<std::optional<core::Transaction>, core::Error>
+{
+    if (auto flushed = flush(); !flushed) {
+        return std::unexpected(flushed.error());
+    }
+    return inner_->findById(id);
+}
+
+auto WriteBehindTransactionRepository::findByAccount(const core::AccountId& accountId)
+    -> std::expected<std::vector<core::Transaction>, core::Error>
+{
+    if (auto flushed = flush(); !flushed) {
+        return std::unexpected(flushed.error());
+    }
+    return inner_->findByAccount(accountId);
+}
+
+auto WriteBehindTransactionRepository::findByDateRange(
+    const core::AccountId& accountId, core::Date from, core::Date to)
+    -> std::expected<std::vector<core::Transaction>, core::Error>
+{
+    if (auto flushed = flush(); !flushed) {
+        return std::unexpected(flushed.error());
+    }
+    return inner_->findByDateRange(accountId, from, to);
+}
+
+auto WriteBehindTransactionRepository::findByCategory(core::TransactionCategory category)
+    -> std::expected<std::vector<core::Transaction>, core::Error>
+{
+    if (auto flushed = flush(); !flushed) {
+        return std::unexpected(flushed.error());
+    }
+    return inner_->findByCategory(category);
+}
+
+auto WriteBehindTransactionRepository::findAll()
+    -> std::expected<std::vector<core::Transaction>, core::Error>
+{
+    if (auto flushed = flush(); !flushed) {
+        return std::unexpected(flushed.error());
+    }
+    return inner_->findAll();
+}
+
+auto WriteBehindTransactionRepository::findPage(
+    int limit,
+    const std::optional<core::TransactionRepository::PageCursor>& before,
+    const std::optional<core::TransactionRepository::PageCursor>& after)
+    -> std::expected<std::vector<core::Transaction>, core::Error>
+{
+    if (auto flushed = flush(); !flushed) {
+        return std::unexpected(flushed.error());
+    }
+    return inner_->findPage(limit, before, after);
+}
+
+auto WriteBehindTransactionRepository::search(const std::string& query, int limit)
+    -> std::expected<std::vector<core::Transaction>, core::Error>
+{
+    if (auto flushed = flush(); !flushed) {
+        return std::unexpected(flushed.error());
+    }
+    return inner_->search(query, limit);
+}
+
+auto WriteBehindTransactionRepository::forEach(
+    const core::TransactionRepository::TransactionVisitor& visitor)
+    -> std::expected<void, core::Error>
+{
+    if (auto flushed = flush(); !flushed) {
+        return std::unexpected(flushed.error());
+    }
+    return inner_->forEach(visitor);
+}
+
+auto WriteBehindTransactionRepository::forEachFiltered(
+    const core::TransactionRepository::Filter& filter,
+    const core::TransactionRepository::TransactionVisitor& visitor)
+    -> std::expected<void, core::Error>
+{
+    if (auto flushed = flush(); !flushed) {
+        return std::unexpected(flushed.error());
+    }
+    return inner_->forEachFiltered(filter, visitor);
+}
+
+auto WriteBehindTransactionRepository::forEachInDateRange(
+    core::Date from, core::Date to,
+    const core::TransactionRepository::TransactionVisitor& visitor)
+    -> std::expected<void, core::Error>
+{
+    if (auto flushed = flush(); !flushed) {
+        return std::unexpected(flushed.error());
+    }
+    return inner_->forEachInDateRange(from, to, visitor);
+}
+
+auto WriteBehindTransactionRepository::findAmountsByDateRange(core::Date from, core::Date to)
+    -> std::expected<std::vector<core::TransactionAmount>, core::Error>
+{
+    if (auto flushed = flush(); !flushed) {
+        return std::unexpected(flushed.error());
+    }
+    return inner_->findAmountsByDateRange(from, to);
+}
+
+auto WriteBehindTransactionRepository::findColumnsByDateRange(core::Date from, core::Date to)
+    -> std::expected<core::TransactionColumns, core::Error>
+{
+    if (auto flushed = flush(); !flushed) {
+        return std::unexpected(flushed.error());
+    }
+    return inner_->findColumnsByDateRange(from, to);
+}
+
+auto WriteBehindTransactionRepository::aggregateByCategory(core::Date from, core::Date to)
+    -> std::expected<std::vector<core::CategoryAggregate>, core::Error>
+{
+    if (auto flushed = flush(); !flushed) {
+        return std::unexpected(flushed.error());
+    }
+    return inner_->aggregateByCategory(from, to);
+}
+
+auto WriteBehindTransactionRepository::aggregateByMonthAndCategory(int year)
+    -> std::expected<std::vector<core::MonthlyCategoryAggregate>, core::Error>
+{
+    if (auto flushed = flush(); !flushed) {
+        return std::unexpected(flushed.error());
+    }
+    return inner_->aggregateByMonthAndCategory(year);
+}
+
+auto WriteBehindTransactionRepository::saveBatchSkipDuplicates(
+    const std::vector<core::Transaction>& transactions)
+    -> std::expected<int, core::Error>
+{
+    if (auto flushed = flush(); !flushed) {
+        return std::unexpected(flushed.error());
+    }
+    bumpGeneration();
+    return inner_->saveBatchSkipDuplicates(transactions);
+}
+
+} // namespace ares::infrastructure::persistence
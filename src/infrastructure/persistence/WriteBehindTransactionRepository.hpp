@@ -0,0 +1,91 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include "core/common/BoundedQueue.hpp"
+#include "core/transaction/Transaction.hpp"
+#include "infrastructure/persistence/SqliteTransactionRepository.hpp"
+
+namespace ares::infrastructure::persistence {
+
+// Opt-in write-behind decorator for the transaction repository. Writes are
+// enqueued and applied in order by a background thread that alone touches the
+// underlying connection while the queue drains, so callers return before the
+// COMMIT hits disk. Reads flush the queue first, which keeps read-your-writes
+// semantics; deferred write errors surface on the next flush() (implicit or
+// explicit). The destructor flushes, so dropping the wrapper never loses
+// acknowledged writes.
+class WriteBehindTransactionRepository : public core::TransactionRepository {
+public:
+    explicit WriteBehindTransactionRepository(
+        std::shared_ptr<SqliteTransactionRepository> inner,
+        std::size_t queueCapacity = 256);
+    ~WriteBehindTransactionRepository() override;
+
+    WriteBehindTransactionRepository(const WriteBehindTransactionRepository&) = delete;
+    auto operator=(const WriteBehindTransactionRepository&) -> WriteBehindTransactionRepository& = delete;
+
+    // Writes: enqueued, always succeed immediately
+    auto save(const core::Transaction& transaction) -> std::expected<void, core::Error> override;
+    auto saveBatch(const std::vector<core::Transaction>& transactions) -> std::expected<void, core::Error> override;
+    auto remove(const core::TransactionId& id) -> std::expected<void, core::Error> override;
+    auto update(const core::Transaction& transaction) -> std::expected<void, core::Error> override;
+
+    // Reads: drain the queue, then delegate
+    auto findById(const core::TransactionId& id) -> std::expected<std::optional<core::Transaction>, core::Error> override;
+    auto findByAccount(const core::AccountId& accountId) -> std::expected<std::vector<core::Transaction>, core::Error> override;
+    auto findByDateRange(const core::AccountId& accountId, core::Date from, core::Date to)
+        -> std::expected<std::vector<core::Transaction>, core::Error> override;
+    auto findByCategory(core::TransactionCategory category)
+        -> std::expected<std::vector<core::Transaction>, core::Error> override;
+    auto findAll() -> std::expected<std::vector<core::Transaction>, core::Error> override;
+    auto findPage(int limit, const std::optional<core::TransactionRepository::PageCursor>& before,
+                  const std::optional<core::TransactionRepository::PageCursor>& after)
+        -> std::expected<std::vector<core::Transaction>, core::Error> override;
+    auto search(const std::string& query, int limit)
+        -> std::expected<std::vector<core::Transaction>, core::Error> override;
+    auto forEach(const core::TransactionRepository::TransactionVisitor& visitor)
+        -> std::expected<void, core::Error> override;
+    auto forEachFiltered(const core::TransactionRepository::Filter& filter,
+                         const core::TransactionRepository::TransactionVisitor& visitor)
+        -> std::expected<void, core::Error> override;
+    auto forEachInDateRange(core::Date from, core::Date to,
+                            const core::TransactionRepository::TransactionVisitor& visitor)
+        -> std::expected<void, core::Error> override;
+    auto findAmountsByDateRange(core::Date from, core::Date to)
+        -> std::expected<std::vector<core::TransactionAmount>, core::Error> override;
+    auto findColumnsByDateRange(core::Date from, core::Date to)
+        -> std::expected<core::TransactionColumns, core::Error> override;
+    auto aggregateByCategory(core::Date from, core::Date to)
+        -> std::expected<std::vector<core::CategoryAggregate>, core::Error> override;
+    auto aggregateByMonthAndCategory(int year)
+        -> std::expected<std::vector<core::MonthlyCategoryAggregate>, core::Error> override;
+
+    // Needs its insert count synchronously, so it flushes and delegates
+    auto saveBatchSkipDuplicates(const std::vector<core::Transaction>& transactions)
+        -> std::expected<int, core::Error>;
+
+    // Blocks until every enqueued write has been applied; returns the first
+    // write error deferred since the previous flush
+    auto flush() -> std::expected<void, core::Error>;
+
+private:
+    using WriteTask =
+        std::function<std::expected<void, core::Error>(SqliteTransactionRepository&)>;
+
+    auto enqueue(WriteTask task) -> void;
+
+    std::shared_ptr<SqliteTransactionRepository> inner_;
+    core::BoundedQueue<WriteTask> queue_;
+    std::mutex stateMutex_;
+    std::condition_variable idle_;
+    std::size_t pending_{0};
+    std::optional<core::Error> deferredError_;
+    std::jthread worker_;
+};
+
+} // namespace ares::infrastructure::persistence
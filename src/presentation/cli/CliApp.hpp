@@ -10,6 +10,10 @@ public:
     auto run(int argc, char* argv[]) -> int;
 
 private:
+    // Parses and executes in this process; run() forwards to a resident
+    // daemon first when one is listening
+    auto runLocal(int argc, char* argv[]) -> int;
+
     auto printHelp() -> void;
     auto printVersion() -> void;
 };
@@ -0,0 +1,254 @@
+#include "presentation/cli/Daemon.hpp"
+
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fmt/format.h>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace ares::presentation::cli {
+
+namespace {
+
+// A stop request is a command line consisting of this single pseudo-arg;
+// it never collides with real usage because CLI11 would reject it anyway
+constexpr const char* kStopRequest = "__stop__";
+
+auto connectTo(const std::filesystem::path& path) -> int {
+    int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return -1;
+    }
+
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    auto pathStr = path.string();
+    if (pathStr.size() >= sizeof(addr.sun_path)) {
+        ::close(fd);
+        return -1;
+    }
+    std::strncpy(addr.sun_path, pathStr.c_str(), sizeof(addr.sun_path) - 1);
+
+    if (::connect(fd, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0) {
+        ::close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+auto sendAll(int fd, const char* data, std::size_t size) -> bool {
+    while (size > 0) {
+        auto sent = ::send(fd, data, size, MSG_NOSIGNAL);
+        if (sent <= 0) {
+            return false;
+        }
+        data += sent;
+        size -= static_cast<std::size_t>(sent);
+    }
+    return true;
+}
+
+auto sendExitCode(int fd, int code) -> void {
+    auto value = static_cast<std::uint32_t>(code);
+    unsigned char trailer[4] = {
+        static_cast<unsigned char>(value >> 24), static_cast<unsigned char>(value >> 16),
+        static_cast<unsigned char>(value >> 8), static_cast<unsigned char>(value)};
+    (void)sendAll(fd, reinterpret_cast<const char*>(trailer), sizeof(trailer));
+}
+
+// Read NUL-separated args until the client shuts its write side down
+auto readRequest(int fd) -> std::vector<std::string> {
+    std::string raw;
+    char buffer[4096];
+    ssize_t got = 0;
+    while ((got = ::recv(fd, buffer, sizeof(buffer), 0)) > 0) {
+        raw.append(buffer, static_cast<std::size_t>(got));
+    }
+
+    std::vector<std::string> args;
+    std::size_t start = 0;
+    while (start < raw.size()) {
+        auto end = raw.find('\0', start);
+        if (end == std::string::npos) {
+            break;
+        }
+        args.emplace_back(raw.substr(start, end - start));
+        start = end + 1;
+    }
+    return args;
+}
+
+} // namespace
+
+auto daemonSocketPath() -> std::expected<std::filesystem::path, core::Error> {
+    auto homeDir = std::getenv("HOME");
+    if (!homeDir) {
+        return std::unexpected(core::IoError{"HOME", "environment variable not set"});
+    }
+    return std::filesystem::path{homeDir} / ".ares" / "daemon.sock";
+}
+
+auto serveDaemon(const CommandRunner& runCommand) -> int {
+    auto pathResult = daemonSocketPath();
+    if (!pathResult) {
+        fmt::print("Error: {}\n", core::errorMessage(pathResult.error()));
+        return 1;
+    }
+    auto path = *pathResult;
+    std::filesystem::create_directories(path.parent_path());
+
+    // A live daemon answers on the socket; a stale file from a crashed
+    // one does not and is safe to replace
+    if (int probe = connectTo(path); probe >= 0) {
+        ::close(probe);
+        fmt::print("A daemon is already running on {}\n", path.string());
+        return 1;
+    }
+    std::filesystem::remove(path);
+
+    int listenFd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenFd < 0) {
+        fmt::print("Error: cannot create daemon socket\n");
+        return 1;
+    }
+
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    auto pathStr = path.string();
+    if (pathStr.size() >= sizeof(addr.sun_path)) {
+        fmt::print("Error: socket path too long: {}\n", pathStr);
+        ::close(listenFd);
+        return 1;
+    }
+    std::strncpy(addr.sun_path, pathStr.c_str(), sizeof(addr.sun_path) - 1);
+
+    if (::bind(listenFd, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0 ||
+        ::listen(listenFd, 8) != 0) {
+        fmt::print("Error: cannot listen on {}\n", pathStr);
+        ::close(listenFd);
+        return 1;
+    }
+
+    // A client vanishing mid-response must not kill the daemon
+    std::signal(SIGPIPE, SIG_IGN);
+
+    fmt::print("Daemon listening on {} (stop with: ares daemon --stop)\n", pathStr);
+
+    bool stopping = false;
+    while (!stopping) {
+        int client = ::accept(listenFd, nullptr, nullptr);
+        if (client < 0) {
+            continue;
+        }
+
+        auto args = readRequest(client);
+        if (args.size() == 1 && args[0] == kStopRequest) {
+            sendExitCode(client, 0);
+            ::close(client);
+            stopping = true;
+            continue;
+        }
+
+        // Stream the command's output straight to the client: stdout is
+        // swapped for the socket while the command runs, then restored
+        std::fflush(stdout);
+        int savedStdout = ::dup(STDOUT_FILENO);
+        ::dup2(client, STDOUT_FILENO);
+
+        int code = runCommand(args);
+
+        std::fflush(stdout);
+        ::dup2(savedStdout, STDOUT_FILENO);
+        ::close(savedStdout);
+
+        sendExitCode(client, code);
+        ::close(client);
+    }
+
+    ::close(listenFd);
+    std::filesystem::remove(path);
+    fmt::print("Daemon stopped.\n");
+    return 0;
+}
+
+auto stopDaemon() -> int {
+    auto pathResult = daemonSocketPath();
+    if (!pathResult) {
+        fmt::print("Error: {}\n", core::errorMessage(pathResult.error()));
+        return 1;
+    }
+
+    int fd = connectTo(*pathResult);
+    if (fd < 0) {
+        fmt::print("No daemon is running.\n");
+        return 1;
+    }
+
+    std::string request = std::string{kStopRequest} + '\0';
+    bool sent = sendAll(fd, request.data(), request.size());
+    ::shutdown(fd, SHUT_WR);
+    char drain[64];
+    while (::recv(fd, drain, sizeof(drain), 0) > 0) {}
+    ::close(fd);
+
+    if (!sent) {
+        fmt::print("No daemon is running.\n");
+        return 1;
+    }
+    fmt::print("Daemon stopped.\n");
+    return 0;
+}
+
+auto forwardToDaemon(int argc, char* argv[]) -> std::optional<int> {
+    auto pathResult = daemonSocketPath();
+    if (!pathResult) {
+        return std::nullopt;
+    }
+
+    int fd = connectTo(*pathResult);
+    if (fd < 0) {
+        return std::nullopt;
+    }
+
+    std::string request;
+    for (int i = 1; i < argc; ++i) {
+        request += argv[i];
+        request += '\0';
+    }
+    if (!sendAll(fd, request.data(), request.size())) {
+        ::close(fd);
+        return std::nullopt;
+    }
+    ::shutdown(fd, SHUT_WR);
+
+    // Stream the response as it arrives, holding back the last four
+    // bytes: once the daemon closes the socket they are the exit code
+    std::string pending;
+    char buffer[4096];
+    ssize_t got = 0;
+    while ((got = ::recv(fd, buffer, sizeof(buffer), 0)) > 0) {
+        pending.append(buffer, static_cast<std::size_t>(got));
+        if (pending.size() > 4) {
+            std::fwrite(pending.data(), 1, pending.size() - 4, stdout);
+            pending.erase(0, pending.size() - 4);
+        }
+    }
+    ::close(fd);
+    std::fflush(stdout);
+
+    if (pending.size() != 4) {
+        // Truncated response: the daemon died mid-command
+        return 1;
+    }
+    auto code = (static_cast<std::uint32_t>(static_cast<unsigned char>(pending[0])) << 24) |
+                (static_cast<std::uint32_t>(static_cast<unsigned char>(pending[1])) << 16) |
+                (static_cast<std::uint32_t>(static_cast<unsigned char>(pending[2])) << 8) |
+                static_cast<std::uint32_t>(static_cast<unsigned char>(pending[3]));
+    return static_cast<int>(code);
+}
+
+} // namespace ares::presentation::cli
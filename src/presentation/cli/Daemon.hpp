@@ -0,0 +1,39 @@
+#pragma once
+
+#include <expected>
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+#include "core/common/Error.hpp"
+
+namespace ares::presentation::cli {
+
+// Daemon mode keeps one ares process resident so scripted usage stops
+// paying process start, database open and migration checks on every
+// command. The daemon listens on a unix socket under ~/.ares; clients
+// send their argv (NUL-separated, write side shut down when done) and
+// the daemon streams the command's output straight back over the
+// socket, followed by a 4-byte big-endian exit code trailer.
+
+/// Runs one already-parsed command line (without argv[0]) and returns
+/// its exit code. The daemon invokes this with stdout redirected to the
+/// requesting client.
+using CommandRunner = std::function<int(const std::vector<std::string>& args)>;
+
+/// Where the daemon socket lives (~/.ares/daemon.sock)
+[[nodiscard]] auto daemonSocketPath() -> std::expected<std::filesystem::path, core::Error>;
+
+/// Serve requests until a stop request arrives. Returns the process
+/// exit code; refuses to start when another daemon already listens.
+[[nodiscard]] auto serveDaemon(const CommandRunner& runCommand) -> int;
+
+/// Ask a running daemon to exit
+[[nodiscard]] auto stopDaemon() -> int;
+
+/// Forward this invocation to a running daemon. nullopt means no daemon
+/// is listening and the caller should run the command locally.
+[[nodiscard]] auto forwardToDaemon(int argc, char* argv[]) -> std::optional<int>;
+
+} // namespace ares::presentation::cli
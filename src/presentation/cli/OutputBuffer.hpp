@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdio>
+#include <iterator>
+#include <fmt/format.h>
+
+namespace ares::presentation::cli {
+
+// Row-iterating render paths format into this buffer and flush to stdout
+// in a few large writes instead of one write() per row; printing a few
+// thousand transactions otherwise spends more time in the terminal (or
+// pager pipe) than in the query that produced them. Interleaves safely
+// with direct fmt::print as long as flush() runs first, which the
+// destructor guarantees at the end of the render block.
+class OutputBuffer {
+public:
+    OutputBuffer() = default;
+    OutputBuffer(const OutputBuffer&) = delete;
+    auto operator=(const OutputBuffer&) -> OutputBuffer& = delete;
+    ~OutputBuffer() { flush(); }
+
+    template <typename... Args>
+    auto print(fmt::format_string<Args...> format, Args&&... args) -> void {
+        fmt::format_to(std::back_inserter(buffer_), format, std::forward<Args>(args)...);
+        if (buffer_.size() >= kFlushBytes) {
+            flush();
+        }
+    }
+
+    auto flush() -> void {
+        if (buffer_.size() > 0) {
+            std::fwrite(buffer_.data(), 1, buffer_.size(), stdout);
+            buffer_.clear();
+        }
+    }
+
+private:
+    static constexpr std::size_t kFlushBytes = 64 * 1024;
+    fmt::memory_buffer buffer_;
+};
+
+} // namespace ares::presentation::cli
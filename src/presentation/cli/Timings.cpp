@@ -0,0 +1,157 @@
+#include "presentation/cli/Timings.hpp"
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include <fmt/format.h>
+#include "core/common/PerfCounters.hpp"
+
+namespace ares::presentation::cli::timings {
+
+namespace {
+
+struct Entry {
+    std::string name;
+    std::chrono::nanoseconds total{0};
+    int calls{0};
+    std::uint64_t bytes{0};
+};
+
+bool enabled = false;
+std::string jsonPath;
+std::vector<Entry> entries;
+
+// Allocation-accounting builds attribute bytes to phases: now() marks
+// the running total and record() charges the delta to the phase. Phases
+// are linear within a command, so the mark set at phase start is the
+// right baseline; allocations from worker threads during the phase are
+// charged to it, which is the number a command-level budget wants.
+std::uint64_t bytesMark = 0;
+
+// Machine-readable twin of the printed table, consumed by
+// scripts/perf_scenario.py. Phase names are string literals from the
+// command callbacks, so no JSON escaping is needed.
+auto writeJson() -> void {
+    std::ofstream file{jsonPath, std::ios::trunc};
+    if (!file) {
+        return;
+    }
+
+    auto ms = [](std::chrono::nanoseconds d) {
+        return std::chrono::duration<double, std::milli>(d).count();
+    };
+
+    std::chrono::nanoseconds total{0};
+    std::string out = "{\"phases\":[";
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+        const auto& entry = entries[i];
+        total += entry.total;
+        out += fmt::format("{}{{\"name\":\"{}\",\"ms\":{:.3f},\"calls\":{},\"allocBytes\":{}}}",
+                           i == 0 ? "" : ",", entry.name, ms(entry.total), entry.calls,
+                           entry.bytes);
+    }
+    out += fmt::format("],\"totalMs\":{:.3f}", ms(total));
+    if constexpr (core::perf::allocAccountingCompiledIn()) {
+        auto totals = core::perf::allocTotals();
+        out += fmt::format(",\"alloc\":{{\"bytes\":{},\"allocations\":{},\"peakLiveBytes\":{}}}",
+                           totals.bytesAllocated, totals.allocations, totals.peakLiveBytes);
+    }
+    out += "}\n";
+    file.write(out.data(), static_cast<std::streamsize>(out.size()));
+}
+
+} // namespace
+
+auto setEnabled(bool value) -> void {
+    enabled = value;
+}
+
+auto isEnabled() -> bool {
+    return enabled;
+}
+
+auto setJsonPath(std::string_view path) -> void {
+    jsonPath = path;
+}
+
+auto now() -> TimePoint {
+    if constexpr (core::perf::allocAccountingCompiledIn()) {
+        bytesMark = core::perf::allocTotals().bytesAllocated;
+    }
+    return std::chrono::steady_clock::now();
+}
+
+auto record(std::string_view name, TimePoint start) -> void {
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    std::uint64_t bytes = 0;
+    if constexpr (core::perf::allocAccountingCompiledIn()) {
+        auto total = core::perf::allocTotals().bytesAllocated;
+        bytes = total - bytesMark;
+        bytesMark = total;
+    }
+    for (auto& entry : entries) {
+        if (entry.name == name) {
+            entry.total += elapsed;
+            ++entry.calls;
+            entry.bytes += bytes;
+            return;
+        }
+    }
+    entries.push_back({std::string{name}, elapsed, 1, bytes});
+}
+
+auto report() -> void {
+    if (!jsonPath.empty() && !entries.empty()) {
+        writeJson();
+    }
+    if (!enabled || entries.empty()) {
+        entries.clear();
+        return;
+    }
+
+    std::chrono::nanoseconds total{0};
+    for (const auto& entry : entries) {
+        total += entry.total;
+    }
+
+    auto ms = [](std::chrono::nanoseconds d) {
+        return std::chrono::duration<double, std::milli>(d).count();
+    };
+    auto mib = [](std::uint64_t bytes) {
+        return static_cast<double>(bytes) / (1024.0 * 1024.0);
+    };
+
+    constexpr bool withAlloc = core::perf::allocAccountingCompiledIn();
+
+    fmt::print("\nTimings\n");
+    if constexpr (withAlloc) {
+        fmt::print("  {:<28} {:>10} {:>7} {:>13}\n", "Phase", "Total", "Calls", "Alloc");
+        fmt::print("  {}\n", std::string(61, '-'));
+    } else {
+        fmt::print("  {:<28} {:>10} {:>7}\n", "Phase", "Total", "Calls");
+        fmt::print("  {}\n", std::string(47, '-'));
+    }
+    for (const auto& entry : entries) {
+        if constexpr (withAlloc) {
+            fmt::print("  {:<28} {:>7.2f} ms {:>7} {:>9.2f} MiB\n",
+                       entry.name, ms(entry.total), entry.calls, mib(entry.bytes));
+        } else {
+            fmt::print("  {:<28} {:>7.2f} ms {:>7}\n", entry.name, ms(entry.total), entry.calls);
+        }
+    }
+    if constexpr (withAlloc) {
+        auto totals = core::perf::allocTotals();
+        fmt::print("  {}\n", std::string(61, '-'));
+        fmt::print("  {:<28} {:>7.2f} ms\n", "instrumented total", ms(total));
+        fmt::print("  {:<28} {:>9.2f} MiB in {} allocations, peak live {:.2f} MiB\n",
+                   "allocated", mib(totals.bytesAllocated), totals.allocations,
+                   mib(totals.peakLiveBytes));
+    } else {
+        fmt::print("  {}\n", std::string(47, '-'));
+        fmt::print("  {:<28} {:>7.2f} ms\n", "instrumented total", ms(total));
+    }
+
+    entries.clear();
+}
+
+} // namespace ares::presentation::cli::timings
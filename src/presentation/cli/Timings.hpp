@@ -0,0 +1,47 @@
+#pragma once
+
+#include <chrono>
+#include <string_view>
+
+namespace ares::presentation::cli::timings {
+
+// Phase instrumentation behind the global --timings flag: commands mark
+// their phases (config parse, db open, migration check, queries,
+// computation, rendering) and a breakdown prints after the command runs.
+// Recording is always on - a handful of clock reads per command - and
+// the flag only decides whether the report prints, so phases recorded
+// before flag parsing finishes are never lost.
+
+auto setEnabled(bool enabled) -> void;
+[[nodiscard]] auto isEnabled() -> bool;
+
+/// Also dump the breakdown as JSON to this file when the command ends
+/// (--timings-json). Independent of the printed report - the perf
+/// harness reads the file while keeping stdout clean. Empty disables.
+auto setJsonPath(std::string_view path) -> void;
+
+using TimePoint = std::chrono::steady_clock::time_point;
+
+/// Start-of-phase marker for linear code: capture now(), do the work,
+/// then record(name, start). Repeated names aggregate.
+[[nodiscard]] auto now() -> TimePoint;
+auto record(std::string_view name, TimePoint start) -> void;
+
+/// RAII variant for block-shaped phases
+class Scope {
+public:
+    explicit Scope(std::string_view name) : name_{name}, start_{now()} {}
+    ~Scope() { record(name_, start_); }
+    Scope(const Scope&) = delete;
+    auto operator=(const Scope&) -> Scope& = delete;
+
+private:
+    std::string_view name_;
+    TimePoint start_;
+};
+
+/// Print the recorded breakdown in first-seen order and clear it;
+/// prints nothing unless enabled
+auto report() -> void;
+
+} // namespace ares::presentation::cli::timings
@@ -0,0 +1,173 @@
+#include "support/SyntheticLedger.hpp"
+#include <algorithm>
+#include <cctype>
+#include <random>
+#include <fmt/format.h>
+#include "core/common/CivilDate.hpp"
+#include "core/common/Money.hpp"
+
+namespace ares::test {
+
+namespace {
+
+struct RowShape {
+    const char* counterparty;
+    const char* memo;
+    int64_t cents;
+};
+
+// ING-shaped row population: German merchants, PayPal rows whose real
+// merchant hides in the Verwendungszweck (including the column-break
+// artifact and the merchant-less "Allgemeine Zahlung"), salary, loan
+// rate, and plain noise
+constexpr RowShape kShapes[] = {
+    {"REWE Markt GmbH", "REWE SAGT DANKE. 44301355", -2350},
+    {"EDEKA CENTER", "Kartenzahlung girocard", -4512},
+    {"ALDI SUED SAGT DANKE", "Kartenzahlung 19.22 Uhr", -1893},
+    {"Netflix International B.V.", "Netflix Abonnement 123-456", -1299},
+    {"PayPal Europe S.a.r.l. et Cie S.C.A",
+     "1037016866096/. Sony Int eractive Entertainment Netw ork Europe Limited , Ihr Einkauf bei",
+     -5999},
+    {"PayPal Europe S.a.r.l. et Cie S.C.A", "PP.4488.PP Ihr Einkauf bei Spotify AB", -999},
+    {"PayPal Europe S.a.r.l. et Cie S.C.A", "PP.2711.PP . Allgemeine Zahlung, Ihre Zahlung",
+     -2500},
+    {"Deutsche Bahn AG", "Fahrkarte BahnCard 25", -7990},
+    {"STADTWERKE MUENSTER", "Abschlag Strom 07/2026", -8900},
+    {"Arbeitgeber Software GmbH", "Gehalt Lohn/Gehalt", 345000},
+    {"KfW Bankengruppe", "Darlehen 1234567 Rate Studienkredit", -16500},
+    {"TK Techniker Krankenkasse", "Beitrag Versicherung", -21000},
+    {"Sparda-Bank West eG", "Miete Musterstrasse 12", -95000},
+    {"Amazon Payments Europe S.C.A.", "AMZNMktp DE 302-5577", -3499},
+    {"Wolt", "Bestellung 8811", -2340},
+    {"Unbekannter Haendler XY", "Rechnung 2026-07-991", -1234},
+};
+
+// German display format: 1.234,56 with a leading minus for debits
+auto formatGermanAmount(int64_t cents) -> std::string {
+    auto absCents = cents < 0 ? -cents : cents;
+    auto euros = absCents / 100;
+    auto rest = absCents % 100;
+
+    std::string digits = fmt::format("{}", euros);
+    std::string grouped;
+    grouped.reserve(digits.size() + digits.size() / 3);
+    for (std::size_t i = 0; i < digits.size(); ++i) {
+        if (i != 0 && (digits.size() - i) % 3 == 0) {
+            grouped += '.';
+        }
+        grouped += digits[i];
+    }
+    return fmt::format("{}{},{:02}", cents < 0 ? "-" : "", grouped, rest);
+}
+
+// A "same purchase seen twice" variant: identical date and amount, the
+// counterparty reformatted the way a second export often renders it
+auto nearDuplicateName(const std::string& name) -> std::string {
+    std::string variant;
+    variant.reserve(name.size() + 4);
+    for (char c : name) {
+        variant += static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+        if (c == ' ') variant += ' ';  // doubled separators survive exports
+    }
+    return variant;
+}
+
+struct SyntheticRow {
+    core::Date date;
+    int64_t cents;
+    std::string counterparty;
+    std::string memo;
+    int accountIndex;
+};
+
+// Single source of rows for both the hydrated and the CSV form, so a
+// ledger and its export always agree
+auto buildRows(const SyntheticLedgerOptions& options) -> std::vector<SyntheticRow> {
+    std::vector<SyntheticRow> rows;
+    rows.reserve(options.rows);
+
+    std::mt19937 rng{options.seed};
+    std::uniform_int_distribution<std::size_t> pickShape{0, std::size(kShapes) - 1};
+    std::uniform_int_distribution<int> pickAccount{0, options.accounts - 1};
+    std::uniform_int_distribution<int64_t> jitter{0, 976};
+    std::uniform_real_distribution<double> chance{0.0, 1.0};
+
+    // Dates advance linearly: ~40 rows per day at 100k over seven years
+    auto startEpochDay = core::civil::toEpochDay(options.startDate);
+    auto spanDays = std::max<int64_t>(static_cast<int64_t>(options.rows) / 40, 365);
+
+    for (std::size_t i = 0; i < options.rows; ++i) {
+        if (!rows.empty() && chance(rng) < options.nearDuplicateFraction) {
+            const auto& prev = rows.back();
+            rows.push_back({prev.date, prev.cents, nearDuplicateName(prev.counterparty),
+                            prev.memo, prev.accountIndex});
+            continue;
+        }
+
+        const auto& shape = kShapes[pickShape(rng)];
+        auto epochDay = startEpochDay +
+            static_cast<int64_t>(i) * spanDays / static_cast<int64_t>(options.rows);
+        // Jitter keeps (date, amount, counterparty) triples distinct so
+        // the content-hash dedupe does not collapse the ledger
+        auto cents = shape.cents - (shape.cents < 0 ? jitter(rng) : -jitter(rng));
+        rows.push_back({core::civil::fromEpochDay(epochDay), cents, shape.counterparty,
+                        fmt::format("{} {}", shape.memo, i), pickAccount(rng)});
+    }
+    return rows;
+}
+
+} // namespace
+
+auto syntheticTransactions(const SyntheticLedgerOptions& options)
+    -> std::vector<core::Transaction>
+{
+    auto rows = buildRows(options);
+
+    std::vector<core::Transaction> transactions;
+    transactions.reserve(rows.size());
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        const auto& row = rows[i];
+        core::Transaction txn{
+            core::TransactionId{fmt::format("syn-{}", i)},
+            core::AccountId{fmt::format("DE0042{:018}", row.accountIndex)},
+            row.date,
+            core::Money{row.cents, core::Currency::EUR},
+            row.cents > 0 ? core::TransactionType::Income : core::TransactionType::Expense};
+        txn.setCounterpartyName(row.counterparty);
+        txn.setDescription(row.memo);
+        transactions.push_back(std::move(txn));
+    }
+    return transactions;
+}
+
+auto syntheticIngDeCsv(const SyntheticLedgerOptions& options) -> std::string {
+    auto rows = buildRows(options);
+
+    std::string csv;
+    csv.reserve(rows.size() * 110 + 512);
+    csv +=
+        "Umsatzanzeige\n"
+        "\n"
+        "Kunde;Synthetic User\n"
+        "IBAN;DE00420000000000000000\n"
+        "Kontoname;Girokonto\n"
+        "Bank;ING\n"
+        "Saldo;1.234,56\n"
+        "\n"
+        "Buchung;Valuta;Auftraggeber/Empfänger;Buchungstext;Verwendungszweck;"
+        "Saldo;Währung;Betrag;Währung\n";
+
+    for (const auto& row : rows) {
+        auto date = fmt::format("{:02}.{:02}.{:04}",
+                                static_cast<unsigned>(row.date.day()),
+                                static_cast<unsigned>(row.date.month()),
+                                static_cast<int>(row.date.year()));
+        csv += fmt::format("{};{};{};{};{};1.234,56;EUR;{};EUR\n",
+                           date, date, row.counterparty,
+                           row.cents > 0 ? "Gehalt/Rente" : "Lastschrift",
+                           row.memo, formatGermanAmount(row.cents));
+    }
+    return csv;
+}
+
+} // namespace ares::test
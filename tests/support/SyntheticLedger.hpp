@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "core/common/Types.hpp"
+#include "core/transaction/Transaction.hpp"
+
+namespace ares::test {
+
+// Seeded generator for large, realistic ING DE ledgers. Hand-written
+// fixtures top out at a handful of rows, which is enough for
+// correctness but blind to complexity regressions - an O(n^2) pass
+// looks identical at n=5. The same seed always produces the same
+// ledger, so perf envelopes measured against it are comparable across
+// runs and machines.
+struct SyntheticLedgerOptions {
+    std::size_t rows{100'000};
+    std::uint32_t seed{42};
+    int accounts{3};
+    // First booking date; dates advance through the calendar so the
+    // ledger spans years at a realistic per-day density
+    core::Date startDate{std::chrono::year{2019}, std::chrono::month{1}, std::chrono::day{1}};
+    // Fraction of rows emitted as near-duplicates of their predecessor
+    // (same day and amount, reformatted counterparty) to give duplicate
+    // detection something to find
+    double nearDuplicateFraction{0.01};
+};
+
+// Hydrated transactions, dates ascending. Categories are left
+// Uncategorized so categorization passes start from a clean slate.
+[[nodiscard]] auto syntheticTransactions(const SyntheticLedgerOptions& options = {})
+    -> std::vector<core::Transaction>;
+
+// A complete ING DE export for the same ledger: metadata block, column
+// header, then one semicolon-separated row per transaction in German
+// number and date format - what the import pipeline actually parses.
+[[nodiscard]] auto syntheticIngDeCsv(const SyntheticLedgerOptions& options = {})
+    -> std::string;
+
+} // namespace ares::test
@@ -0,0 +1,115 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <string>
+#include <vector>
+#include <fmt/format.h>
+#include "application/services/DuplicateDetector.hpp"
+#include "core/common/CivilDate.hpp"
+#include "core/common/Money.hpp"
+#include "infrastructure/import/CsvParser.hpp"
+
+// Micro-benchmarks for the primitives every hot path is built from.
+// Hidden behind the [.benchmark] tag so regular test runs skip them;
+// `make bench` runs them in Release and writes the XML report that the
+// regression tooling can diff. A regression here compounds: Money and
+// date conversion run once per row of every import and report.
+
+using namespace ares;
+
+namespace {
+
+auto makeBenchTransaction(const std::string& id, int day, int64_t cents,
+                          const std::string& counterparty) -> core::Transaction {
+    core::Transaction txn{
+        core::TransactionId{id}, core::AccountId{"acc-1"},
+        core::Date{std::chrono::year{2026}, std::chrono::month{5},
+                   std::chrono::day{static_cast<unsigned>(day)}},
+        core::Money{cents, core::Currency::EUR},
+        cents > 0 ? core::TransactionType::Income : core::TransactionType::Expense};
+    txn.setCounterpartyName(counterparty);
+    return txn;
+}
+
+} // namespace
+
+TEST_CASE("Money primitives", "[.benchmark]") {
+    BENCHMARK("fromString German thousands") {
+        return core::Money::fromString("1.234,56");
+    };
+    BENCHMARK("fromString small amount") {
+        return core::Money::fromString("-13,99");
+    };
+    BENCHMARK("fromDouble") {
+        return core::Money::fromDouble(1234.56);
+    };
+
+    core::Money a{123456, core::Currency::EUR};
+    core::Money b{-7890, core::Currency::EUR};
+    BENCHMARK("checked addition") {
+        return a + b;
+    };
+    BENCHMARK("format toStringDutch") {
+        return a.toStringDutch();
+    };
+}
+
+TEST_CASE("Date conversion", "[.benchmark]") {
+    core::Date date{std::chrono::year{2026}, std::chrono::month{8}, std::chrono::day{28}};
+    auto epochDay = core::civil::toEpochDay(date);
+
+    BENCHMARK("toEpochDay") {
+        return core::civil::toEpochDay(date);
+    };
+    BENCHMARK("fromEpochDay") {
+        return core::civil::fromEpochDay(epochDay);
+    };
+    BENCHMARK("round trip") {
+        return core::civil::toEpochDay(core::civil::fromEpochDay(epochDay));
+    };
+}
+
+TEST_CASE("CsvParser line scanning", "[.benchmark]") {
+    // One hundred ING DE style rows - representative field widths, one
+    // quoted field with an embedded delimiter
+    std::string content =
+        "Buchung;Valuta;Empfaenger;Buchungstext;Verwendungszweck;Saldo;Waehrung;Betrag\n";
+    for (int i = 0; i < 100; ++i) {
+        content += fmt::format(
+            "15.06.2026;15.06.2026;\"Merchant; GmbH {}\";Lastschrift;"
+            "Einkauf Nr {};1.234,56;EUR;-{},99\n", i, i, 10 + i % 80);
+    }
+
+    infrastructure::import::CsvParserOptions options;
+    options.delimiter = ';';
+    infrastructure::import::CsvParser parser{options};
+
+    BENCHMARK("parse 100 rows (owning)") {
+        return parser.parse(std::string_view{content});
+    };
+    BENCHMARK("parseViews 100 rows (zero-copy)") {
+        return parser.parseViews(content);
+    };
+}
+
+TEST_CASE("DuplicateDetector probe", "[.benchmark]") {
+    // A one-row probe against a 200-row history - the shape every
+    // interactive "is this a duplicate" check has
+    std::vector<core::Transaction> existing;
+    existing.reserve(200);
+    for (int i = 0; i < 200; ++i) {
+        existing.push_back(makeBenchTransaction(
+            fmt::format("t{}", i), (i % 28) + 1, -1000 - i,
+            fmt::format("REWE SAGT DANKE {}", i % 40)));
+    }
+    auto probe = makeBenchTransaction("probe", 14, -1050, "REWE sagt Danke 10");
+
+    application::services::DuplicateDetector detector;
+    BENCHMARK("isDuplicate against 200 rows") {
+        return detector.isDuplicate(probe, existing);
+    };
+
+    BENCHMARK("normalizeCounterpartyName") {
+        return application::services::DuplicateDetector::normalizeCounterpartyName(
+            "REWE   Sagt DANKE Fil. 1234");
+    };
+}
@@ -0,0 +1,155 @@
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <fmt/format.h>
+#include "application/services/CategoryMatcher.hpp"
+#include "application/services/DuplicateDetector.hpp"
+#include "application/services/ReportService.hpp"
+#include "core/common/PerfCounters.hpp"
+#include "infrastructure/import/IngDeCsvImporter.hpp"
+#include "infrastructure/persistence/DatabaseConnection.hpp"
+#include "infrastructure/persistence/SqliteTransactionRepository.hpp"
+#include "support/SyntheticLedger.hpp"
+
+// Performance envelopes over the 100k-row synthetic ledger. Hidden
+// behind [.perf] - run via `make perf` (Release; Debug numbers would
+// trip the envelopes). Each envelope is several times looser than the
+// measured Release cost so scheduler noise does not flake the suite,
+// while complexity regressions blow through it: the scaling checks
+// compare an 8x larger input and fail anything that grows much faster
+// than linearly, long before wall-clock limits matter.
+
+using namespace ares;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+constexpr std::size_t kRows = 100'000;
+
+auto seconds(Clock::time_point start) -> double {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+} // namespace
+
+TEST_CASE("Perf envelope: ING DE parse of 100k rows", "[.perf]") {
+    auto smallCsv = test::syntheticIngDeCsv({.rows = kRows / 8});
+    auto fullCsv = test::syntheticIngDeCsv({.rows = kRows});
+
+    infrastructure::import::IngDeCsvImporter importer;
+
+    auto start = Clock::now();
+    auto small = importer.import(std::string_view{smallCsv});
+    auto smallSeconds = seconds(start);
+    REQUIRE(small.has_value());
+
+    start = Clock::now();
+    auto full = importer.import(std::string_view{fullCsv});
+    auto fullSeconds = seconds(start);
+    REQUIRE(full.has_value());
+    REQUIRE(full->successfulRows == static_cast<int>(kRows));
+
+    fmt::print("parse: {} rows in {:.2f}s ({:.0f} rows/s)\n",
+               kRows, fullSeconds, kRows / fullSeconds);
+    CHECK(fullSeconds < 15.0);
+    // 8x the rows may cost at most ~3x linear; O(n^2) would cost 64x
+    CHECK(fullSeconds < smallSeconds * 24.0 + 0.5);
+}
+
+TEST_CASE("Perf envelope: categorize 100k rows", "[.perf]") {
+    auto small = test::syntheticTransactions({.rows = kRows / 8});
+    auto full = test::syntheticTransactions({.rows = kRows});
+
+    application::services::CategoryMatcher matcher;
+    auto runPass = [&matcher](const std::vector<core::Transaction>& txns) {
+        std::size_t matched = 0;
+        for (const auto& txn : txns) {
+            auto result = matcher.categorize(
+                txn.counterpartyName() ? txn.counterpartyName()->view() : std::string_view{},
+                txn.description(), txn.amount().cents());
+            matched += result.category != core::TransactionCategory::Uncategorized;
+        }
+        return matched;
+    };
+
+    (void)runPass(small);  // Warmup settles scratch buffers
+
+    auto allocsBefore = core::perf::allocTotals();
+    auto start = Clock::now();
+    auto smallMatched = runPass(small);
+    auto smallSeconds = seconds(start);
+
+    start = Clock::now();
+    auto fullMatched = runPass(full);
+    auto fullSeconds = seconds(start);
+
+    CHECK(smallMatched > 0);
+    CHECK(fullMatched > 0);
+    fmt::print("categorize: {} rows in {:.2f}s ({:.0f} rows/s)\n",
+               kRows, fullSeconds, kRows / fullSeconds);
+    CHECK(fullSeconds < 10.0);
+    CHECK(fullSeconds < smallSeconds * 24.0 + 0.5);
+
+    if (core::perf::allocAccountingCompiledIn()) {
+        // The matcher reuses its scratch buffers; a steady-state pass
+        // should stay well under a few hundred bytes per row
+        auto allocsAfter = core::perf::allocTotals();
+        auto bytesPerRow = static_cast<double>(
+            allocsAfter.bytesAllocated - allocsBefore.bytesAllocated) /
+            static_cast<double>(small.size() + full.size());
+        fmt::print("categorize: {:.0f} allocated bytes/row\n", bytesPerRow);
+        CHECK(bytesPerRow < 512.0);
+    }
+}
+
+TEST_CASE("Perf envelope: duplicate detection at 100k rows", "[.perf]") {
+    auto small = test::syntheticTransactions({.rows = kRows / 8});
+    auto full = test::syntheticTransactions({.rows = kRows});
+
+    application::services::DuplicateDetector detector;
+
+    auto start = Clock::now();
+    auto smallCandidates = detector.findDuplicates(small);
+    auto smallSeconds = seconds(start);
+
+    start = Clock::now();
+    auto fullCandidates = detector.findDuplicates(full);
+    auto fullSeconds = seconds(start);
+
+    // The ledger plants ~1% near-duplicates; the detector must see them
+    CHECK(fullCandidates.size() > smallCandidates.size());
+    CHECK(fullCandidates.size() > kRows / 500);
+    fmt::print("duplicates: {} rows in {:.2f}s, {} candidates\n",
+               kRows, fullSeconds, fullCandidates.size());
+    CHECK(fullSeconds < 20.0);
+    CHECK(fullSeconds < smallSeconds * 24.0 + 0.5);
+}
+
+TEST_CASE("Perf envelope: yearly report over 100k stored rows", "[.perf]") {
+    auto db = infrastructure::persistence::DatabaseConnection::open(":memory:");
+    REQUIRE(db.has_value());
+    std::shared_ptr<infrastructure::persistence::DatabaseConnection> connection =
+        std::move(*db);
+    REQUIRE(connection->initializeSchema().has_value());
+    infrastructure::persistence::SqliteTransactionRepository repo{connection};
+
+    auto ledger = test::syntheticTransactions({.rows = kRows});
+    REQUIRE(repo.saveBatch(ledger).has_value());
+
+    application::services::ReportService reports;
+    auto start = Clock::now();
+    auto summary = reports.yearlySummary(repo, 2020);
+    auto firstSeconds = seconds(start);
+    REQUIRE(summary.has_value());
+    CHECK(summary->totalExpenses.cents() > 0);
+
+    // Second read is served from the now-fresh rollups
+    start = Clock::now();
+    auto again = reports.yearlySummary(repo, 2020);
+    auto cachedSeconds = seconds(start);
+    REQUIRE(again.has_value());
+
+    fmt::print("report: first {:.3f}s, rollup-served {:.3f}s\n",
+               firstSeconds, cachedSeconds);
+    CHECK(firstSeconds < 10.0);
+    CHECK(cachedSeconds < 1.0);
+}
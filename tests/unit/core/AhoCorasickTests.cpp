@@ -0,0 +1,70 @@
+#include <catch2/catch_test_macros.hpp>
+#include <set>
+#include <vector>
+#include "core/common/AhoCorasick.hpp"
+
+using namespace ares::core;
+
+namespace {
+
+auto matchIds(const AhoCorasick& ac, std::string_view text) -> std::set<int> {
+    std::set<int> ids;
+    ac.forEachMatch(text, [&](int id) { ids.insert(id); });
+    return ids;
+}
+
+} // namespace
+
+TEST_CASE("AhoCorasick finds all patterns in one pass", "[ahocorasick]") {
+    AhoCorasick ac;
+    ac.addPattern("rewe", 0);
+    ac.addPattern("edeka", 1);
+    ac.addPattern("aldi", 2);
+    ac.build();
+
+    CHECK(matchIds(ac, "rewemarktgmbh") == std::set<int>{0});
+    CHECK(matchIds(ac, "edekaundaldi") == std::set<int>{1, 2});
+    CHECK(matchIds(ac, "dm-drogerie").empty());
+}
+
+TEST_CASE("AhoCorasick reports overlapping and nested patterns", "[ahocorasick]") {
+    AhoCorasick ac;
+    ac.addPattern("he", 0);
+    ac.addPattern("she", 1);
+    ac.addPattern("hers", 2);
+    ac.build();
+
+    // "she" ends at the same position as its suffix "he"
+    CHECK(matchIds(ac, "she") == std::set<int>{0, 1});
+    CHECK(matchIds(ac, "hers") == std::set<int>{0, 2});
+}
+
+TEST_CASE("AhoCorasick allows duplicate patterns under different ids", "[ahocorasick]") {
+    AhoCorasick ac;
+    ac.addPattern("kino", 10);
+    ac.addPattern("kino", 20);
+    ac.build();
+
+    CHECK(matchIds(ac, "cinemaxxkino") == std::set<int>{10, 20});
+    CHECK(ac.patternCount() == 2);
+}
+
+TEST_CASE("AhoCorasick reports one callback per occurrence", "[ahocorasick]") {
+    AhoCorasick ac;
+    ac.addPattern("ab", 0);
+    ac.build();
+
+    std::vector<int> hits;
+    ac.forEachMatch("abxab", [&](int id) { hits.push_back(id); });
+    CHECK(hits == std::vector<int>{0, 0});
+}
+
+TEST_CASE("AhoCorasick ignores empty patterns and matches empty text", "[ahocorasick]") {
+    AhoCorasick ac;
+    ac.addPattern("", 0);
+    ac.addPattern("x", 1);
+    ac.build();
+
+    CHECK(ac.patternCount() == 1);
+    CHECK(matchIds(ac, "").empty());
+}
@@ -0,0 +1,68 @@
+#include <catch2/catch_test_macros.hpp>
+#include <numeric>
+#include <thread>
+#include <vector>
+#include "core/common/BoundedQueue.hpp"
+
+using namespace ares::core;
+
+TEST_CASE("BoundedQueue - single producer, single consumer", "[BoundedQueue]") {
+    BoundedQueue<int> queue{4};
+
+    std::thread producer{[&queue] {
+        for (int i = 0; i < 100; ++i) {
+            queue.push(i);
+        }
+        queue.close();
+    }};
+
+    std::vector<int> received;
+    while (auto item = queue.pop()) {
+        received.push_back(*item);
+    }
+    producer.join();
+
+    REQUIRE(received.size() == 100);
+    // FIFO order is preserved
+    for (int i = 0; i < 100; ++i) {
+        CHECK(received[static_cast<size_t>(i)] == i);
+    }
+}
+
+TEST_CASE("BoundedQueue - pop after close drains remaining items", "[BoundedQueue]") {
+    BoundedQueue<int> queue{8};
+    queue.push(1);
+    queue.push(2);
+    queue.close();
+
+    auto first = queue.pop();
+    auto second = queue.pop();
+    auto third = queue.pop();
+
+    REQUIRE(first.has_value());
+    CHECK(*first == 1);
+    REQUIRE(second.has_value());
+    CHECK(*second == 2);
+    CHECK_FALSE(third.has_value());
+}
+
+TEST_CASE("BoundedQueue - capacity bounds the producer", "[BoundedQueue]") {
+    BoundedQueue<int> queue{2};
+    queue.push(1);
+    queue.push(2);
+
+    // A third push would block; consume one first from another thread
+    std::thread consumer{[&queue] {
+        auto item = queue.pop();
+        REQUIRE(item.has_value());
+    }};
+    queue.push(3);
+    consumer.join();
+    queue.close();
+
+    auto a = queue.pop();
+    auto b = queue.pop();
+    REQUIRE(a.has_value());
+    REQUIRE(b.has_value());
+    CHECK(*a + *b == 5);  // 2 and 3 remain
+}
@@ -0,0 +1,32 @@
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include "core/common/CivilDate.hpp"
+
+using namespace ares::core;
+
+TEST_CASE("Civil date conversions agree with std::chrono", "[civil-date]") {
+    // Walk a span covering leap years, century rules and both epoch sides
+    for (int64_t day = -40000; day <= 40000; day += 17) {
+        auto date = civil::fromEpochDay(day);
+        CHECK(civil::toEpochDay(date) == day);
+        CHECK(std::chrono::sys_days{date}.time_since_epoch().count() == day);
+    }
+}
+
+TEST_CASE("Civil date conversions handle calendar edges", "[civil-date]") {
+    auto leapDay = Date{std::chrono::year{2024}, std::chrono::month{2}, std::chrono::day{29}};
+    CHECK(civil::fromEpochDay(civil::toEpochDay(leapDay)) == leapDay);
+
+    auto epoch = Date{std::chrono::year{1970}, std::chrono::month{1}, std::chrono::day{1}};
+    CHECK(civil::toEpochDay(epoch) == 0);
+
+    auto beforeEpoch = Date{std::chrono::year{1969}, std::chrono::month{12}, std::chrono::day{31}};
+    CHECK(civil::toEpochDay(beforeEpoch) == -1);
+}
+
+TEST_CASE("Month key is the calendar month as yyyymm", "[civil-date]") {
+    CHECK(civil::monthKey(Date{std::chrono::year{2026}, std::chrono::month{8},
+                               std::chrono::day{28}}) == 202608);
+    CHECK(civil::monthKey(Date{std::chrono::year{1999}, std::chrono::month{12},
+                               std::chrono::day{1}}) == 199912);
+}
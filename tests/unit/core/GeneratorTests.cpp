@@ -0,0 +1,78 @@
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <vector>
+#include "core/common/Generator.hpp"
+
+using ares::core::Generator;
+
+namespace {
+
+auto count(int from, int to) -> Generator<int> {
+    for (int i = from; i <= to; ++i) {
+        co_yield i;
+    }
+}
+
+auto nothing() -> Generator<int> {
+    co_return;
+}
+
+// Tracks whether the producer's locals were unwound, to prove an
+// abandoned stream still runs its RAII cleanup
+auto yieldWithCleanup(bool& cleanedUp) -> Generator<int> {
+    struct Cleanup {
+        bool& flag;
+        ~Cleanup() { flag = true; }
+    } cleanup{cleanedUp};
+
+    for (int i = 0;; ++i) {
+        co_yield i;
+    }
+}
+
+} // namespace
+
+TEST_CASE("Generator yields values in order", "[Generator]") {
+    std::vector<int> seen;
+    for (int value : count(1, 5)) {
+        seen.push_back(value);
+    }
+    CHECK(seen == std::vector<int>{1, 2, 3, 4, 5});
+}
+
+TEST_CASE("Generator empty stream produces no iterations", "[Generator]") {
+    int iterations = 0;
+    for ([[maybe_unused]] int value : nothing()) {
+        ++iterations;
+    }
+    CHECK(iterations == 0);
+}
+
+TEST_CASE("Generator is lazily evaluated one element at a time", "[Generator]") {
+    // An infinite producer is fine as long as the consumer stops
+    bool cleanedUp = false;
+    int sum = 0;
+    {
+        auto gen = yieldWithCleanup(cleanedUp);
+        int taken = 0;
+        for (int value : gen) {
+            sum += value;
+            if (++taken == 3) break;
+        }
+        CHECK_FALSE(cleanedUp);
+    }
+    CHECK(sum == 0 + 1 + 2);
+    // Abandoning the stream mid-walk unwound the producer's locals
+    CHECK(cleanedUp);
+}
+
+TEST_CASE("Generator is movable and the moved-from handle is released", "[Generator]") {
+    auto gen = count(10, 12);
+    auto other = std::move(gen);
+
+    std::vector<int> seen;
+    for (int value : other) {
+        seen.push_back(value);
+    }
+    CHECK(seen == std::vector<int>{10, 11, 12});
+}
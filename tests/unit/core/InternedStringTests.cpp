@@ -0,0 +1,46 @@
+#include <catch2/catch_test_macros.hpp>
+#include "core/common/InternedString.hpp"
+
+using namespace ares;
+
+TEST_CASE("StringPool returns shared storage for repeated values", "[interned]") {
+    core::StringPool pool;
+
+    auto first = pool.intern("REWE Markt GmbH");
+    auto second = pool.intern("REWE Markt GmbH");
+    auto other = pool.intern("PayPal");
+
+    CHECK(first.sharesStorageWith(second));
+    CHECK_FALSE(first.sharesStorageWith(other));
+    CHECK(pool.size() == 2);
+    CHECK(first == second);
+    CHECK(first.str() == "REWE Markt GmbH");
+}
+
+TEST_CASE("InternedString compares by value across pools", "[interned]") {
+    core::StringPool poolA;
+    core::StringPool poolB;
+
+    auto a = poolA.intern("Stadtwerke");
+    auto b = poolB.intern("Stadtwerke");
+
+    CHECK_FALSE(a.sharesStorageWith(b));
+    CHECK(a == b);
+    CHECK(a == std::string{"Stadtwerke"});
+    CHECK(a == "Stadtwerke");
+    CHECK_FALSE(a == "Netflix");
+}
+
+TEST_CASE("InternedString converts into existing string call sites", "[interned]") {
+    core::InternedString value{"PayPal"};
+
+    const std::string& ref = value;
+    CHECK(ref == "PayPal");
+
+    std::string_view view = value;
+    CHECK(view == "PayPal");
+
+    core::InternedString empty;
+    CHECK(empty.empty());
+    CHECK(empty.size() == 0);
+}
@@ -1,5 +1,6 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <vector>
 #include "core/common/Money.hpp"
 
 using namespace ares::core;
@@ -113,6 +114,61 @@ TEST_CASE("Money::fromString", "[Money]") {
     }
 }
 
+TEST_CASE("Money::parseCents", "[Money]") {
+    SECTION("European format") {
+        CHECK(Money::parseCents("1.234,56", AmountFormat::European) == 123456);
+        CHECK(Money::parseCents("-9,99", AmountFormat::European) == -999);
+        CHECK(Money::parseCents("+100,00", AmountFormat::European) == 10000);
+        CHECK(Money::parseCents("12.345.678,90", AmountFormat::European) == 1234567890);
+        CHECK(Money::parseCents("1000", AmountFormat::European) == 100000);
+        CHECK(Money::parseCents("0,5", AmountFormat::European) == 50);
+    }
+
+    SECTION("Standard format") {
+        CHECK(Money::parseCents("1,234.56", AmountFormat::Standard) == 123456);
+        CHECK(Money::parseCents("-25.99", AmountFormat::Standard) == -2599);
+        CHECK(Money::parseCents("500.00", AmountFormat::Standard) == 50000);
+    }
+
+    SECTION("Surrounding whitespace is trimmed") {
+        CHECK(Money::parseCents("  -1.234,56\t", AmountFormat::European) == -123456);
+    }
+
+    SECTION("Malformed input is rejected") {
+        CHECK_FALSE(Money::parseCents("", AmountFormat::European).has_value());
+        CHECK_FALSE(Money::parseCents("-", AmountFormat::European).has_value());
+        CHECK_FALSE(Money::parseCents("12,345", AmountFormat::European).has_value());
+        CHECK_FALSE(Money::parseCents("12,34abc", AmountFormat::European).has_value());
+        CHECK_FALSE(Money::parseCents("1..2", AmountFormat::European).has_value());
+        CHECK_FALSE(Money::parseCents("1.234,", AmountFormat::European).has_value());
+    }
+}
+
+TEST_CASE("Money::parseColumn", "[Money]") {
+    SECTION("Parses a whole column in one call") {
+        std::vector<std::string_view> column{"1.234,56", "-9,99", "0,00", "100"};
+        std::vector<int64_t> cents(column.size());
+        auto parsed = Money::parseColumn(column, AmountFormat::European, cents);
+        REQUIRE(parsed.has_value());
+        CHECK(*parsed == 4);
+        CHECK(cents == std::vector<int64_t>{123456, -999, 0, 10000});
+    }
+
+    SECTION("Reports the first malformed entry") {
+        std::vector<std::string_view> column{"1,00", "oops", "2,00"};
+        std::vector<int64_t> cents(column.size());
+        auto parsed = Money::parseColumn(column, AmountFormat::European, cents);
+        REQUIRE_FALSE(parsed.has_value());
+    }
+
+    SECTION("Rejects an undersized output span") {
+        std::vector<std::string_view> column{"1,00", "2,00"};
+        std::vector<int64_t> cents(1);
+        auto parsed = Money::parseColumn(column, AmountFormat::European, cents);
+        REQUIRE_FALSE(parsed.has_value());
+    }
+}
+
 TEST_CASE("Money arithmetic", "[Money]") {
     Money a{1000, Currency::EUR};  // €10.00
     Money b{500, Currency::EUR};   // €5.00
@@ -255,3 +311,36 @@ TEST_CASE("Currency helpers", "[Money]") {
         CHECK(currencyCode(Currency::GBP) == "GBP");
     }
 }
+
+TEST_CASE("MoneyAccumulator", "[Money]") {
+    SECTION("Sums raw cents and validates once") {
+        MoneyAccumulator acc;
+        acc.add(Money{1050});
+        acc.add(Money{-325});
+        acc.addCents(75);
+
+        CHECK(acc.cents() == 800);
+
+        auto total = acc.total();
+        REQUIRE(total.has_value());
+        CHECK(total->cents() == 800);
+        CHECK(total->currency() == Currency::EUR);
+    }
+
+    SECTION("Empty accumulator totals to zero") {
+        MoneyAccumulator acc;
+        auto total = acc.total();
+        REQUIRE(total.has_value());
+        CHECK(total->isZero());
+    }
+
+    SECTION("Currency mismatch surfaces at total()") {
+        MoneyAccumulator acc{Currency::EUR};
+        acc.add(Money{100, Currency::EUR});
+        acc.add(Money{200, Currency::USD});
+
+        auto total = acc.total();
+        REQUIRE(!total.has_value());
+        CHECK(std::holds_alternative<CurrencyMismatchError>(total.error()));
+    }
+}
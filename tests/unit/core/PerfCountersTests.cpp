@@ -0,0 +1,69 @@
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <string>
+#include "core/common/PerfCounters.hpp"
+
+using namespace ares::core;
+
+TEST_CASE("Perf counters are callable in every build", "[PerfCounters]") {
+    // snapshot and reset must be safe whether or not the instrumentation
+    // is compiled in; default builds simply report nothing
+    perf::reset();
+    auto stats = perf::snapshot();
+    if (!perf::compiledIn()) {
+        CHECK(stats.empty());
+    }
+}
+
+#ifdef ARES_PERF_COUNTERS
+TEST_CASE("Perf scopes aggregate per site", "[PerfCounters]") {
+    perf::reset();
+
+    for (int i = 0; i < 3; ++i) {
+        ARES_PERF_SCOPE("PerfCountersTests::site");
+        // A guaranteed heap allocation inside the scope
+        auto padding = std::string(128, 'x');
+        CHECK(padding.size() == 128);
+    }
+
+    auto stats = perf::snapshot();
+    auto it = std::find_if(stats.begin(), stats.end(), [](const auto& site) {
+        return site.name == "PerfCountersTests::site";
+    });
+    REQUIRE(it != stats.end());
+    CHECK(it->calls == 3);
+    CHECK(it->allocations >= 3);
+
+    perf::reset();
+    stats = perf::snapshot();
+    it = std::find_if(stats.begin(), stats.end(), [](const auto& site) {
+        return site.name == "PerfCountersTests::site";
+    });
+    REQUIRE(it != stats.end());
+    CHECK(it->calls == 0);
+}
+#endif
+
+TEST_CASE("Allocation totals are callable in every build", "[PerfCounters]") {
+    auto totals = perf::allocTotals();
+    if (!perf::allocAccountingCompiledIn()) {
+        CHECK(totals.allocations == 0);
+        CHECK(totals.peakLiveBytes == 0);
+    }
+}
+
+#ifdef ARES_ALLOC_ACCOUNTING
+TEST_CASE("Allocation accounting tracks live and peak bytes", "[PerfCounters]") {
+    auto before = perf::allocTotals();
+    {
+        auto block = std::string(1 << 20, 'x');
+        auto during = perf::allocTotals();
+        CHECK(during.allocations > before.allocations);
+        CHECK(during.liveBytes >= before.liveBytes + (1 << 20));
+        CHECK(during.peakLiveBytes >= during.liveBytes);
+    }
+    auto after = perf::allocTotals();
+    CHECK(after.liveBytes < after.peakLiveBytes + (1 << 20));
+    CHECK(after.bytesAllocated >= before.bytesAllocated + (1 << 20));
+}
+#endif
@@ -0,0 +1,52 @@
+#include <catch2/catch_test_macros.hpp>
+#include "core/common/TextNormalize.hpp"
+
+using namespace ares::core;
+
+TEST_CASE("lowercaseInto lowercases ASCII and keeps length", "[textnormalize]") {
+    std::string out;
+    text::lowercaseInto("Sony Int ERACTIVE", out);
+    CHECK(out == "sony int eractive");
+
+    text::lowercaseInto("", out);
+    CHECK(out.empty());
+}
+
+TEST_CASE("lowercaseStripSpacesInto drops spaces", "[textnormalize]") {
+    std::string out;
+    text::lowercaseStripSpacesInto("Sony Int eractive", out);
+    CHECK(out == "sonyinteractive");
+
+    // Tabs are not spaces in this normal form
+    text::lowercaseStripSpacesInto("A\tB", out);
+    CHECK(out == "a\tb");
+}
+
+TEST_CASE("lowercaseCollapseSpacesInto collapses runs and trims", "[textnormalize]") {
+    std::string out;
+    text::lowercaseCollapseSpacesInto("  REWE   Markt\tGmbH  ", out);
+    CHECK(out == "rewe markt gmbh");
+
+    text::lowercaseCollapseSpacesInto("   ", out);
+    CHECK(out.empty());
+}
+
+TEST_CASE("lowercaseAlnumWordsInto keeps only alphanumeric words", "[textnormalize]") {
+    std::string out;
+    text::lowercaseAlnumWordsInto("REWE-Markt GmbH & Co. 42", out);
+    CHECK(out == "rewemarkt gmbh co 42");
+
+    // Separators other than space never introduce a space
+    text::lowercaseAlnumWordsInto("..!!", out);
+    CHECK(out.empty());
+}
+
+TEST_CASE("normalization buffers keep their capacity across calls", "[textnormalize]") {
+    std::string out;
+    text::lowercaseStripSpacesInto("a long counterparty name with many words", out);
+    auto capacity = out.capacity();
+
+    text::lowercaseStripSpacesInto("short", out);
+    CHECK(out == "short");
+    CHECK(out.capacity() == capacity);
+}
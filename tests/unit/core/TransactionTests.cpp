@@ -1,4 +1,5 @@
 #include <catch2/catch_test_macros.hpp>
+#include <unordered_set>
 #include "core/transaction/Transaction.hpp"
 
 using namespace ares::core;
@@ -131,3 +132,74 @@ TEST_CASE("TransactionCategory names", "[Transaction]") {
     CHECK(categoryName(TransactionCategory::DebtPayment) == "Debt Payment");
     CHECK(categoryName(TransactionCategory::Uncategorized) == "Uncategorized");
 }
+
+TEST_CASE("Transaction dirty tracking", "[Transaction]") {
+    auto date = Date{std::chrono::year{2024}, std::chrono::month{1}, std::chrono::day{15}};
+    Transaction txn{
+        TransactionId{"txn-1"},
+        AccountId{"acc-1"},
+        date,
+        Money{-2550, Currency::EUR},
+        TransactionType::Expense
+    };
+
+    SECTION("Fresh transaction is clean") {
+        CHECK_FALSE(txn.isDirty());
+    }
+
+    SECTION("Re-applying the same value stays clean") {
+        txn.setCategory(TransactionCategory::Uncategorized);
+        txn.setDescription("");
+        txn.setActive(true);
+        CHECK_FALSE(txn.isDirty());
+    }
+
+    SECTION("Changing a value marks dirty") {
+        txn.setCategory(TransactionCategory::Groceries);
+        CHECK(txn.isDirty());
+    }
+
+    SECTION("markClean resets; later edits dirty again") {
+        txn.setCategory(TransactionCategory::Groceries);
+        txn.markClean();
+        CHECK_FALSE(txn.isDirty());
+
+        txn.setCategory(TransactionCategory::Groceries);
+        CHECK_FALSE(txn.isDirty());
+
+        txn.setDescription("REWE SAGT DANKE");
+        CHECK(txn.isDirty());
+    }
+
+    SECTION("Clearing an absent override stays clean") {
+        txn.clearUserCategoryOverride();
+        CHECK_FALSE(txn.isDirty());
+
+        txn.setUserCategoryOverride(TransactionCategory::Refund);
+        CHECK(txn.isDirty());
+        txn.markClean();
+        txn.clearUserCategoryOverride();
+        CHECK(txn.isDirty());
+    }
+}
+
+TEST_CASE("Transaction ids copy without heap allocation and hash directly", "[transaction]") {
+    // Generated ids are fixed-width and short enough for the small-string
+    // buffer, so copies never allocate
+    TransactionId manual{"txn-manual-0001"};
+    TransactionId imported{"txn-de-00000001"};
+    CHECK(manual.value.size() <= std::string{}.capacity());
+    CHECK(imported.value.size() <= std::string{}.capacity());
+
+    std::unordered_set<TransactionId> seen;
+    seen.insert(manual);
+    seen.insert(imported);
+    seen.insert(TransactionId{"txn-manual-0001"});
+    CHECK(seen.size() == 2);
+    CHECK(seen.contains(manual));
+    CHECK_FALSE(seen.contains(TransactionId{"txn-de-00000002"}));
+
+    std::unordered_set<AccountId> accounts;
+    accounts.insert(AccountId{"acc-1"});
+    CHECK(accounts.contains(AccountId{"acc-1"}));
+}
@@ -0,0 +1,69 @@
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <fmt/format.h>
+#include "infrastructure/persistence/DatabaseConnection.hpp"
+#include "infrastructure/persistence/SqliteAdjustmentRepository.hpp"
+
+using namespace ares;
+using infrastructure::persistence::SqliteAdjustmentRepository;
+
+namespace {
+
+auto openMemoryDb() -> std::shared_ptr<infrastructure::persistence::DatabaseConnection> {
+    auto result = infrastructure::persistence::DatabaseConnection::open(":memory:");
+    REQUIRE(result.has_value());
+    auto db = std::shared_ptr<infrastructure::persistence::DatabaseConnection>{std::move(*result)};
+    REQUIRE(db->initializeSchema().has_value());
+    return db;
+}
+
+auto makeAdjustment(const std::string& id, const std::string& patternId, unsigned day)
+    -> core::Adjustment {
+    core::Date date{std::chrono::year{2026}, std::chrono::month{5}, std::chrono::day{day}};
+    return core::Adjustment{core::AdjustmentId{id}, core::RecurringPatternId{patternId},
+                            core::AdjustmentType::Cancel, date};
+}
+
+} // namespace
+
+TEST_CASE("SqliteAdjustmentRepository saveBatch persists the whole set",
+          "[Persistence][Adjustment]") {
+    auto db = openMemoryDb();
+    SqliteAdjustmentRepository repo{db};
+
+    std::vector<core::Adjustment> adjustments;
+    for (unsigned i = 1; i <= 20; ++i) {
+        adjustments.push_back(makeAdjustment(fmt::format("adj{}", i), "p1", i));
+    }
+    REQUIRE(repo.saveBatch(adjustments).has_value());
+
+    auto stored = repo.findAll();
+    REQUIRE(stored.has_value());
+    CHECK(stored->size() == 20);
+
+    CHECK(repo.saveBatch({}).has_value());
+}
+
+TEST_CASE("SqliteAdjustmentRepository findByPatterns reads a pattern set in one query",
+          "[Persistence][Adjustment]") {
+    auto db = openMemoryDb();
+    SqliteAdjustmentRepository repo{db};
+
+    REQUIRE(repo.saveBatch({makeAdjustment("a1", "p1", 20),
+                            makeAdjustment("a2", "p2", 5),
+                            makeAdjustment("a3", "p3", 10),
+                            makeAdjustment("a4", "p1", 1)}).has_value());
+
+    auto found = repo.findByPatterns({core::RecurringPatternId{"p1"},
+                                      core::RecurringPatternId{"p3"}});
+    REQUIRE(found.has_value());
+    REQUIRE(found->size() == 3);
+    // Ordered by effective date
+    CHECK((*found)[0].id().value == "a4");
+    CHECK((*found)[1].id().value == "a3");
+    CHECK((*found)[2].id().value == "a1");
+
+    auto none = repo.findByPatterns({});
+    REQUIRE(none.has_value());
+    CHECK(none->empty());
+}
@@ -0,0 +1,122 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include "infrastructure/config/ConfigCache.hpp"
+
+using namespace ares::infrastructure::config;
+using ares::core::Money;
+using ares::core::TransactionCategory;
+
+namespace {
+
+// Point the cache at a private directory so tests never touch (or are
+// confused by) a real ~/.cache/ares
+struct CacheDirGuard {
+    std::filesystem::path dir;
+
+    CacheDirGuard() {
+        dir = std::filesystem::temp_directory_path() / "ares-test-config-cache";
+        std::filesystem::remove_all(dir);
+        std::filesystem::create_directories(dir);
+        setenv("XDG_CACHE_HOME", dir.c_str(), 1);
+    }
+
+    ~CacheDirGuard() {
+        unsetenv("XDG_CACHE_HOME");
+        std::filesystem::remove_all(dir);
+    }
+};
+
+auto writeConfigFile(const std::filesystem::path& path, std::string_view content)
+    -> void
+{
+    std::ofstream file{path, std::ios::binary | std::ios::trunc};
+    file << content;
+}
+
+auto sampleConfig() -> UserConfig {
+    UserConfig config;
+    config.categorizationRules.push_back(
+        CategorizationRule{"rewe", TransactionCategory::Groceries, std::nullopt});
+    config.categorizationRules.push_back(
+        CategorizationRule{"", TransactionCategory::SavingsTransfer, 5000});
+    config.budgets.push_back(CategoryBudget{TransactionCategory::Groceries, Money{40000}});
+    ConfiguredIncome income;
+    income.name = "Salary";
+    income.amount = Money{500000};
+    income.frequency = ares::core::RecurrenceFrequency::Monthly;
+    config.income.push_back(std::move(income));
+    return config;
+}
+
+} // anonymous namespace
+
+TEST_CASE("ConfigCache misses without a stored cache", "[config][cache]") {
+    CacheDirGuard guard;
+    auto configPath = guard.dir / "config.yaml";
+    writeConfigFile(configPath, "categorization: []\n");
+
+    CHECK_FALSE(ConfigCache::load(configPath).has_value());
+}
+
+TEST_CASE("ConfigCache round-trips a parsed config", "[config][cache]") {
+    CacheDirGuard guard;
+    auto configPath = guard.dir / "config.yaml";
+    writeConfigFile(configPath, "categorization:\n  - pattern: rewe\n");
+
+    ConfigCache::store(configPath, sampleConfig());
+
+    auto loaded = ConfigCache::load(configPath);
+    REQUIRE(loaded.has_value());
+    REQUIRE(loaded->categorizationRules.size() == 2);
+    CHECK(loaded->categorizationRules[0].pattern == "rewe");
+    CHECK(loaded->categorizationRules[0].category == TransactionCategory::Groceries);
+    CHECK_FALSE(loaded->categorizationRules[0].amountCents.has_value());
+    CHECK(loaded->categorizationRules[1].amountCents == 5000);
+    REQUIRE(loaded->budgets.size() == 1);
+    CHECK(loaded->budgets[0].limit == Money{40000});
+    REQUIRE(loaded->income.size() == 1);
+    CHECK(loaded->income[0].name == "Salary");
+    CHECK(loaded->income[0].amount == Money{500000});
+}
+
+TEST_CASE("ConfigCache invalidates when the config changes", "[config][cache]") {
+    CacheDirGuard guard;
+    auto configPath = guard.dir / "config.yaml";
+    writeConfigFile(configPath, "categorization:\n  - pattern: rewe\n");
+
+    ConfigCache::store(configPath, sampleConfig());
+    REQUIRE(ConfigCache::load(configPath).has_value());
+
+    // Same length, different bytes: even if the mtime granularity hides
+    // the rewrite, the content hash must not
+    writeConfigFile(configPath, "categorization:\n  - pattern: aldi\n");
+    CHECK_FALSE(ConfigCache::load(configPath).has_value());
+}
+
+TEST_CASE("ConfigCache is keyed to the config path", "[config][cache]") {
+    CacheDirGuard guard;
+    auto configPath = guard.dir / "config.yaml";
+    auto otherPath = guard.dir / "other.yaml";
+    writeConfigFile(configPath, "categorization: []\n");
+    writeConfigFile(otherPath, "categorization: []\n");
+
+    ConfigCache::store(configPath, sampleConfig());
+
+    CHECK(ConfigCache::load(configPath).has_value());
+    CHECK_FALSE(ConfigCache::load(otherPath).has_value());
+}
+
+TEST_CASE("ConfigCache treats a truncated cache as a miss", "[config][cache]") {
+    CacheDirGuard guard;
+    auto configPath = guard.dir / "config.yaml";
+    writeConfigFile(configPath, "categorization: []\n");
+
+    ConfigCache::store(configPath, sampleConfig());
+    auto cacheFile = ConfigCache::cachePath();
+    auto size = std::filesystem::file_size(cacheFile);
+    std::filesystem::resize_file(cacheFile, size / 2);
+
+    CHECK_FALSE(ConfigCache::load(configPath).has_value());
+}
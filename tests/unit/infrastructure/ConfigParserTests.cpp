@@ -300,6 +300,58 @@ TEST_CASE("ConfigParser matchCategory", "[config]") {
     }
 }
 
+TEST_CASE("ConfigParser compiled rules match like matchCategory", "[config]") {
+    std::vector<CategorizationRule> rules = {
+        {"sony interactive", TransactionCategory::Entertainment},
+        {"spar*bank", TransactionCategory::Fee},
+        {"", TransactionCategory::SavingsTransfer, 1234},
+    };
+    auto compiled = ConfigParser::compileRules(rules);
+    REQUIRE(compiled.size() == rules.size());
+
+    SECTION("patterns are normalized once") {
+        CHECK(compiled.rules[0].normalizedPattern == "sonyinteractive");
+        CHECK_FALSE(compiled.rules[0].hasWildcard);
+        CHECK(compiled.rules[1].hasWildcard);
+    }
+
+    SECTION("amount rules are indexed by absolute cents") {
+        REQUIRE(compiled.amountIndex.size() == 1);
+        CHECK(compiled.amountIndex.at(1234) == 2);
+    }
+
+    SECTION("space-stripped substring match reports the rule") {
+        const auto* match = ConfigParser::matchCompiled(
+            compiled, "", "Sony Int eractive Entertainment");
+        REQUIRE(match != nullptr);
+        CHECK(match->rule.category == TransactionCategory::Entertainment);
+        CHECK(match->rule.pattern == "sony interactive");
+    }
+
+    SECTION("wildcard match") {
+        const auto* match = ConfigParser::matchCompiled(compiled, "Sparkassen Bank", "");
+        REQUIRE(match != nullptr);
+        CHECK(match->rule.category == TransactionCategory::Fee);
+    }
+
+    SECTION("amount rule matches on absolute value") {
+        const auto* match = ConfigParser::matchCompiled(compiled, "Unknown", "", -1234);
+        REQUIRE(match != nullptr);
+        CHECK(match->rule.category == TransactionCategory::SavingsTransfer);
+    }
+
+    SECTION("earlier pattern rule wins over later amount rule") {
+        const auto* match = ConfigParser::matchCompiled(
+            compiled, "Sony Interactive", "", 1234);
+        REQUIRE(match != nullptr);
+        CHECK(match->rule.category == TransactionCategory::Entertainment);
+    }
+
+    SECTION("no match returns nullptr") {
+        CHECK(ConfigParser::matchCompiled(compiled, "Unknown", "Random") == nullptr);
+    }
+}
+
 TEST_CASE("ConfigParser parses full config file", "[config]") {
     ConfigParser parser;
     std::string content = R"(
@@ -190,3 +190,31 @@ TEST_CASE("ConfigWriter removes out-of-range index returns error", "[config-writ
 
     std::filesystem::remove(path);
 }
+
+TEST_CASE("ConfigWriter splices without touching surrounding bytes", "[config-writer]") {
+    std::string original = R"(# hand-written header
+categorization:
+  - pattern: rewe
+    category: groceries
+
+# budgets are reviewed quarterly
+budgets:
+  - category: groceries
+    limit: 400.00
+)";
+    auto path = createTempConfig(original);
+
+    ConfigWriter writer;
+    auto result = writer.addRule(path, "aldi", TransactionCategory::Groceries);
+    REQUIRE(result.has_value());
+
+    // The new entry lands at the end of its section; every other byte of
+    // the file, comments and blank lines included, is unchanged
+    auto splicePoint = original.find("budgets:");
+    auto expected = original.substr(0, splicePoint) +
+                    "  - pattern: aldi\n    category: groceries\n" +
+                    original.substr(splicePoint);
+    CHECK(readFile(path) == expected);
+
+    std::filesystem::remove(path);
+}
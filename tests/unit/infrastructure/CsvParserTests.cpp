@@ -0,0 +1,195 @@
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <fstream>
+#include "infrastructure/import/CsvParser.hpp"
+
+using namespace ares::infrastructure::import;
+
+namespace {
+// Writes content to a unique temp file and removes it on destruction
+struct TempCsvFile {
+    std::filesystem::path path;
+
+    explicit TempCsvFile(const std::string& content) {
+        path = std::filesystem::temp_directory_path() / "ares_csv_parser_test.csv";
+        std::ofstream file{path, std::ios::binary};
+        file << content;
+    }
+
+    ~TempCsvFile() {
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+    }
+};
+}
+
+TEST_CASE("CsvParser - parse string content", "[Import][CsvParser]") {
+    CsvParser parser;
+
+    auto result = parser.parse(std::string_view{"a,b,c\n1,2,3\n4,5,6\n"});
+
+    REQUIRE(result.has_value());
+    REQUIRE(result->headers.size() == 3);
+    CHECK(result->headers[0] == "a");
+    REQUIRE(result->rows.size() == 2);
+    CHECK(result->rows[0][1] == "2");
+    CHECK(result->rows[1][2] == "6");
+}
+
+TEST_CASE("CsvParser - streaming parse yields rows incrementally", "[Import][CsvParser]") {
+    CsvParser parser;
+
+    SECTION("Rows and headers from a small file") {
+        TempCsvFile file{"Date,Amount\n2025-01-15,10.00\n2025-01-16,-5.50\n"};
+
+        std::vector<CsvRow> rows;
+        auto result = parser.parseStream(file.path, [&rows](CsvRow&& row) {
+            rows.push_back(std::move(row));
+        });
+
+        REQUIRE(result.has_value());
+        REQUIRE(result->headers.size() == 2);
+        CHECK(result->headers[0] == "Date");
+        CHECK(result->rowCount == 2);
+        REQUIRE(rows.size() == 2);
+        CHECK(rows[0][0] == "2025-01-15");
+        CHECK(rows[1][1] == "-5.50");
+    }
+
+    SECTION("Lines spanning chunk boundaries are reassembled") {
+        // Build a file larger than one 64 KiB read chunk
+        std::string content = "col1,col2\n";
+        for (int i = 0; i < 5000; ++i) {
+            content += "field-with-some-padding-" + std::to_string(i) + ",value\n";
+        }
+        TempCsvFile file{content};
+
+        std::size_t rowCount = 0;
+        auto result = parser.parseStream(file.path, [&rowCount](CsvRow&& row) {
+            REQUIRE(row.size() == 2);
+            ++rowCount;
+        });
+
+        REQUIRE(result.has_value());
+        CHECK(rowCount == 5000);
+        CHECK(result->rowCount == 5000);
+    }
+
+    SECTION("Windows line endings are stripped") {
+        TempCsvFile file{"a,b\r\n1,2\r\n"};
+
+        std::vector<CsvRow> rows;
+        auto result = parser.parseStream(file.path, [&rows](CsvRow&& row) {
+            rows.push_back(std::move(row));
+        });
+
+        REQUIRE(result.has_value());
+        CHECK(result->headers[1] == "b");
+        REQUIRE(rows.size() == 1);
+        CHECK(rows[0][1] == "2");
+    }
+
+    SECTION("Missing file reports an I/O error") {
+        auto result = parser.parseStream("/nonexistent/ares-test.csv", [](CsvRow&&) {});
+
+        REQUIRE_FALSE(result.has_value());
+    }
+}
+
+TEST_CASE("CsvParser - zero-copy view parse", "[Import][CsvParser]") {
+    CsvParser parser;
+
+    SECTION("Unquoted fields are slices into the content buffer") {
+        std::string content = "h1,h2\nalpha,beta\n";
+
+        auto doc = parser.parseViews(std::string_view{content});
+
+        REQUIRE(doc.has_value());
+        REQUIRE(doc->rows.size() == 1);
+        const auto& row = doc->rows[0];
+        REQUIRE(row.fields.size() == 2);
+        CHECK(row.fields[0] == "alpha");
+        CHECK(row.fields[1] == "beta");
+        // Views point into the original buffer, not into per-row storage
+        CHECK(row.storage.empty());
+        CHECK(row.fields[0].data() >= content.data());
+        CHECK(row.fields[0].data() < content.data() + content.size());
+    }
+
+    SECTION("Quoted field without escapes stays zero-copy") {
+        std::string content = "h\n\"hello, world\"\n";
+
+        auto doc = parser.parseViews(std::string_view{content});
+
+        REQUIRE(doc.has_value());
+        REQUIRE(doc->rows.size() == 1);
+        CHECK(doc->rows[0].fields[0] == "hello, world");
+        CHECK(doc->rows[0].storage.empty());
+    }
+
+    SECTION("Escaped quotes fall back to owned storage") {
+        std::string content = "h\n\"say \"\"hi\"\"\",x\n";
+
+        auto doc = parser.parseViews(std::string_view{content});
+
+        REQUIRE(doc.has_value());
+        REQUIRE(doc->rows.size() == 1);
+        const auto& row = doc->rows[0];
+        REQUIRE(row.fields.size() == 2);
+        CHECK(row.fields[0] == "say \"hi\"");
+        CHECK(row.fields[1] == "x");
+        CHECK_FALSE(row.storage.empty());
+    }
+
+    SECTION("View rows match the owned-string parser") {
+        std::string content = "a;b;c\n1;;3\n;x;\n";
+        CsvParser semicolonParser{CsvParserOptions{.delimiter = ';'}};
+
+        auto owned = semicolonParser.parse(std::string_view{content});
+        auto views = semicolonParser.parseViews(std::string_view{content});
+
+        REQUIRE(owned.has_value());
+        REQUIRE(views.has_value());
+        REQUIRE(owned->rows.size() == views->rows.size());
+        for (size_t i = 0; i < owned->rows.size(); ++i) {
+            REQUIRE(owned->rows[i].size() == views->rows[i].fields.size());
+            for (size_t j = 0; j < owned->rows[i].size(); ++j) {
+                CHECK(owned->rows[i][j] == views->rows[i].fields[j]);
+            }
+        }
+    }
+}
+
+TEST_CASE("CsvParser - arena-backed parse", "[Import][CsvParser]") {
+    CsvParser parser;
+    std::pmr::monotonic_buffer_resource arena;
+
+    std::string content = "h1,h2\n\"a,b\",c\nlong-field-that-exceeds-sso-capacity-by-plenty,d\n";
+
+    auto doc = parser.parseArena(std::string_view{content}, arena);
+
+    REQUIRE(doc.has_value());
+    REQUIRE(doc->headers.size() == 2);
+    CHECK(doc->headers[1] == "h2");
+    REQUIRE(doc->rows.size() == 2);
+    CHECK(doc->rows[0][0] == "a,b");
+    CHECK(doc->rows[0][1] == "c");
+    CHECK(doc->rows[1][0] == "long-field-that-exceeds-sso-capacity-by-plenty");
+
+    // Rows draw their storage from the caller's arena
+    CHECK(doc->rows.get_allocator().resource() == &arena);
+    CHECK(doc->rows[1][0].get_allocator().resource() == &arena);
+}
+
+TEST_CASE("CsvParser - file parse matches streaming parse", "[Import][CsvParser]") {
+    CsvParser parser;
+    TempCsvFile file{"h1,h2,h3\nx,y,z\n\nq,r,s\n"};
+
+    auto doc = parser.parse(file.path);
+
+    REQUIRE(doc.has_value());
+    CHECK(doc->headers.size() == 3);
+    REQUIRE(doc->rows.size() == 2);  // Empty lines are skipped
+    CHECK(doc->rows[0][0] == "x");
+    CHECK(doc->rows[1][2] == "s");
+}
@@ -0,0 +1,80 @@
+#include <catch2/catch_test_macros.hpp>
+#include "infrastructure/persistence/DatabaseConnection.hpp"
+#include "infrastructure/persistence/SqliteImportLedgerRepository.hpp"
+
+using namespace ares;
+using infrastructure::persistence::ImportLedgerEntry;
+using infrastructure::persistence::SqliteImportLedgerRepository;
+
+namespace {
+
+auto openMemoryDb() -> std::shared_ptr<infrastructure::persistence::DatabaseConnection> {
+    auto result = infrastructure::persistence::DatabaseConnection::open(":memory:");
+    REQUIRE(result.has_value());
+    auto db = std::shared_ptr<infrastructure::persistence::DatabaseConnection>{std::move(*result)};
+    REQUIRE(db->initializeSchema().has_value());
+    return db;
+}
+
+} // namespace
+
+TEST_CASE("SqliteImportLedgerRepository - record and find", "[Persistence][ImportLedger]") {
+    auto db = openMemoryDb();
+    SqliteImportLedgerRepository repo{db};
+
+    SECTION("Unknown path yields no entry") {
+        auto found = repo.find("/imports/unknown.csv");
+
+        REQUIRE(found.has_value());
+        CHECK_FALSE(found->has_value());
+    }
+
+    SECTION("Recorded entry round-trips") {
+        ImportLedgerEntry entry{
+            .path = "/imports/january.csv",
+            .contentHash = "deadbeef01234567",
+            .fileSize = 4096,
+            .modifiedAt = 1700000000
+        };
+        REQUIRE(repo.record(entry).has_value());
+
+        auto found = repo.find(entry.path);
+
+        REQUIRE(found.has_value());
+        REQUIRE(found->has_value());
+        CHECK((*found)->contentHash == entry.contentHash);
+        CHECK((*found)->fileSize == entry.fileSize);
+        CHECK((*found)->modifiedAt == entry.modifiedAt);
+    }
+
+    SECTION("Re-recording a path replaces the entry") {
+        ImportLedgerEntry entry{
+            .path = "/imports/january.csv",
+            .contentHash = "aaaa",
+            .fileSize = 100,
+            .modifiedAt = 1
+        };
+        REQUIRE(repo.record(entry).has_value());
+
+        entry.contentHash = "bbbb";
+        entry.fileSize = 200;
+        entry.modifiedAt = 2;
+        REQUIRE(repo.record(entry).has_value());
+
+        auto found = repo.find(entry.path);
+        REQUIRE(found.has_value());
+        REQUIRE(found->has_value());
+        CHECK((*found)->contentHash == "bbbb");
+        CHECK((*found)->fileSize == 200);
+    }
+}
+
+TEST_CASE("SqliteImportLedgerRepository - content fingerprint", "[Persistence][ImportLedger]") {
+    auto hashA = SqliteImportLedgerRepository::fingerprint("Buchung;Betrag\n");
+    auto hashB = SqliteImportLedgerRepository::fingerprint("Buchung;Betrag\n");
+    auto hashC = SqliteImportLedgerRepository::fingerprint("Buchung;Betrag;Saldo\n");
+
+    CHECK(hashA == hashB);
+    CHECK(hashA != hashC);
+    CHECK(hashA.size() == 16);  // 64-bit hash, hex-encoded
+}
@@ -101,3 +101,26 @@ Buchung;Wertstellungsdatum;Auftraggeber/Empfänger;Buchungstext;Verwendungszweck
         CHECK(income.category() == TransactionCategory::Salary);
     }
 }
+
+TEST_CASE("ING Germany malformed rows expand to rich parse errors", "[Import][IngDe]") {
+    IngDeCsvImporter importer;
+
+    std::string sample =
+        "IBAN;DE75 5001 0517 5426 3838 06\n"
+        "Buchung;Wertstellungsdatum;Auftraggeber/Empfänger;Buchungstext;Verwendungszweck;Saldo;Währung;Betrag;Währung\n"
+        "banana;22.01.2026;REWE Markt;Lastschrift;Einkauf;-100,00;EUR;-25,50;EUR\n"
+        "21.01.2026;21.01.2026;REWE Markt;Lastschrift;Einkauf;-100,00;EUR;nope;EUR\n";
+
+    auto result = importer.import(std::string_view{sample});
+
+    REQUIRE(result.has_value());
+    CHECK(result->successfulRows == 0);
+    REQUIRE(result->errors.size() == 2);
+
+    // The light per-row errors were expanded at the import boundary with the
+    // source line attached
+    CHECK(result->errors[0].line == 3);
+    CHECK(result->errors[0].sourceLine.starts_with("banana;"));
+    CHECK(result->errors[1].line == 4);
+    CHECK(result->errors[1].what().find("amount") != std::string::npos);
+}
@@ -0,0 +1,61 @@
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <fstream>
+#include "infrastructure/import/MappedFile.hpp"
+
+using namespace ares::infrastructure::import;
+
+namespace {
+struct TempFile {
+    std::filesystem::path path;
+
+    explicit TempFile(const std::string& content) {
+        path = std::filesystem::temp_directory_path() / "ares_mapped_file_test.txt";
+        std::ofstream file{path, std::ios::binary};
+        file << content;
+    }
+
+    ~TempFile() {
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+    }
+};
+}
+
+TEST_CASE("MappedFile - maps file contents", "[Import][MappedFile]") {
+    SECTION("View matches the file bytes") {
+        TempFile file{"Buchung;Betrag\n01.02.2025;-12,34\n"};
+
+        auto mapped = MappedFile::open(file.path);
+
+        REQUIRE(mapped.has_value());
+        CHECK(mapped->size() == 33);
+        CHECK(mapped->view() == "Buchung;Betrag\n01.02.2025;-12,34\n");
+    }
+
+    SECTION("Empty file yields an empty view") {
+        TempFile file{""};
+
+        auto mapped = MappedFile::open(file.path);
+
+        REQUIRE(mapped.has_value());
+        CHECK(mapped->size() == 0);
+        CHECK(mapped->view().empty());
+    }
+
+    SECTION("Missing file reports an I/O error") {
+        auto mapped = MappedFile::open("/nonexistent/ares-mapped.txt");
+
+        REQUIRE_FALSE(mapped.has_value());
+    }
+
+    SECTION("Moved-from mapping hands over the view") {
+        TempFile file{"payload"};
+
+        auto mapped = MappedFile::open(file.path);
+        REQUIRE(mapped.has_value());
+
+        MappedFile moved = std::move(*mapped);
+        CHECK(moved.view() == "payload");
+    }
+}
@@ -0,0 +1,75 @@
+#include <catch2/catch_test_macros.hpp>
+#include "infrastructure/import/MerchantExtractor.hpp"
+#include "infrastructure/persistence/DatabaseConnection.hpp"
+#include "infrastructure/persistence/SqliteTransactionRepository.hpp"
+
+using ares::infrastructure::import::extractPayPalMerchant;
+
+TEST_CASE("MerchantExtractor finds the suffix-form merchant", "[import]") {
+    auto merchant = extractPayPalMerchant(
+        "PayPal Europe S.a.r.l. et Cie S.C.A",
+        "1037016354910 PP.2551.PP Ihr Einkauf bei Spotify");
+    REQUIRE(merchant.has_value());
+    CHECK(*merchant == "Spotify");
+}
+
+TEST_CASE("MerchantExtractor prefers the bracketed form", "[import]") {
+    // The real merchant sits between "/. " and " ," before the marker;
+    // taking the suffix form first would grab an empty remainder
+    auto merchant = extractPayPalMerchant(
+        "PayPal (Europe) S.a.r.l. et Cie, S.C.A.",
+        "PP.2551.PP . SONY INT ERACTIVE ENT, Ihr Einkauf bei/. Sony Int eractive Enterta , inment Network Europe");
+    REQUIRE(merchant.has_value());
+    CHECK(*merchant == "Sony Int eractive Enterta");
+}
+
+TEST_CASE("MerchantExtractor matches PayPal case-insensitively", "[import]") {
+    auto merchant = extractPayPalMerchant("PAYPAL", "Ihr EINKAUF BEI Netflix");
+    REQUIRE(merchant.has_value());
+    CHECK(*merchant == "Netflix");
+}
+
+TEST_CASE("MerchantExtractor yields nothing for merchant-free memos", "[import]") {
+    CHECK_FALSE(extractPayPalMerchant("PayPal", "Allgemeine Zahlung").has_value());
+    CHECK_FALSE(extractPayPalMerchant("PayPal", "").has_value());
+    CHECK_FALSE(extractPayPalMerchant("PayPal", "Ihr Einkauf bei ").has_value());
+}
+
+TEST_CASE("MerchantExtractor ignores non-PayPal counterparties", "[import]") {
+    CHECK_FALSE(
+        extractPayPalMerchant("REWE Markt GmbH", "Ihr Einkauf bei REWE").has_value());
+}
+
+TEST_CASE("MerchantExtractor result is a view into the memo", "[import]") {
+    std::string memo = "Ihr Einkauf bei   Spotify  ";
+    auto merchant = extractPayPalMerchant("PayPal", memo);
+    REQUIRE(merchant.has_value());
+    CHECK(*merchant == "Spotify");
+    CHECK(merchant->data() >= memo.data());
+    CHECK(merchant->data() + merchant->size() <= memo.data() + memo.size());
+}
+
+TEST_CASE("Stored merchant round-trips through the repository", "[import][persistence]") {
+    namespace persistence = ares::infrastructure::persistence;
+    auto opened = persistence::DatabaseConnection::open(":memory:");
+    REQUIRE(opened.has_value());
+    auto db = std::shared_ptr<persistence::DatabaseConnection>{std::move(*opened)};
+    REQUIRE(db->initializeSchema().has_value());
+    persistence::SqliteTransactionRepository repo{db};
+
+    ares::core::Date date{std::chrono::year{2026}, std::chrono::month{3}, std::chrono::day{14}};
+    ares::core::Transaction txn{
+        ares::core::TransactionId{"t1"}, ares::core::AccountId{"acc-1"}, date,
+        ares::core::Money{-999, ares::core::Currency::EUR},
+        ares::core::TransactionType::Expense};
+    txn.setCounterpartyName("PayPal Europe S.a.r.l.");
+    txn.setDescription("Ihr Einkauf bei Spotify");
+    txn.setMerchant("Spotify");
+    REQUIRE(repo.save(txn).has_value());
+
+    auto loaded = repo.findById(ares::core::TransactionId{"t1"});
+    REQUIRE(loaded.has_value());
+    REQUIRE(loaded->has_value());
+    REQUIRE((*loaded)->merchant().has_value());
+    CHECK((*loaded)->merchant()->view() == "Spotify");
+}
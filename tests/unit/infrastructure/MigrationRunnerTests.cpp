@@ -1,6 +1,7 @@
 #include <catch2/catch_test_macros.hpp>
 #include "infrastructure/persistence/DatabaseConnection.hpp"
 #include "infrastructure/persistence/MigrationRunner.hpp"
+#include <sqlite3.h>
 
 using namespace ares;
 
@@ -181,7 +182,10 @@ TEST_CASE("createMigrationRunner produces working full schema", "[migration]") {
 
     auto version = runner.getCurrentVersion(*db);
     REQUIRE(version.has_value());
-    CHECK(*version == 1);
+    // Derived, not hard-coded, so adding a migration cannot silently
+    // leave this stale
+    CHECK(*version == runner.latestVersion());
+    CHECK(runner.latestVersion() >= 13);
 
     // Verify tables exist by inserting data
     auto insertResult = db->execute(
@@ -189,12 +193,70 @@ TEST_CASE("createMigrationRunner produces working full schema", "[migration]") {
     CHECK(insertResult.has_value());
 
     insertResult = db->execute(
-        "INSERT INTO transactions (id, account_id, date, amount_cents, type) "
-        "VALUES ('t1', 'a1', '2024-01-01', 1000, 0)");
+        "INSERT INTO transactions (id, account_id, date, amount_cents, type, matched_rule) "
+        "VALUES ('t1', 'a1', 19723, 1000, 0, 'rewe')");
+    CHECK(insertResult.has_value());
+
+    insertResult = db->execute(
+        "INSERT INTO categorization_state (rule_key, category, position) "
+        "VALUES ('rewe', 7, 0)");
+    CHECK(insertResult.has_value());
+
+    insertResult = db->execute(
+        "INSERT INTO recurrence_state (counterparty, last_date, txn_count) "
+        "VALUES ('netflix', 19723, 12)");
+    CHECK(insertResult.has_value());
+
+    insertResult = db->execute(
+        "INSERT INTO monthly_rollups (month, account_id, category) "
+        "VALUES (202401, 'a1', 7)");
     CHECK(insertResult.has_value());
 
     insertResult = db->execute(
         "INSERT INTO credits (id, name, type, original_amount_cents, current_balance_cents, interest_rate) "
         "VALUES ('c1', 'Test', 0, 10000, 8000, 0.05)");
     CHECK(insertResult.has_value());
+
+    insertResult = db->execute(
+        "INSERT INTO import_ledger (path, content_hash, file_size, modified_at) "
+        "VALUES ('/tmp/export.csv', 'abc123', 1024, 1700000000)");
+    CHECK(insertResult.has_value());
+
+    // Indexes from migration v3 are present (REINDEX fails on a missing index)
+    CHECK(db->execute("REINDEX idx_transactions_account_date").has_value());
+    CHECK(db->execute("REINDEX idx_transactions_category").has_value());
+    CHECK(db->execute("REINDEX idx_transactions_duplicate_probe").has_value());
+}
+
+TEST_CASE("Migration v4 converts text dates to epoch days", "[migration]") {
+    auto db = openMemoryDb();
+
+    // Simulate a pre-v4 database: transactions table with ISO text dates.
+    // The runner stamps it as v1, then applies v2-v4.
+    auto createResult = db->execute(
+        "CREATE TABLE transactions (id TEXT PRIMARY KEY, account_id TEXT NOT NULL, "
+        "date TEXT NOT NULL, amount_cents INTEGER NOT NULL, currency INTEGER DEFAULT 0, "
+        "type INTEGER NOT NULL, category INTEGER DEFAULT 0, description TEXT, "
+        "counterparty_name TEXT, counterparty_iban TEXT, raw_description TEXT, "
+        "mutation_code TEXT, is_recurring INTEGER DEFAULT 0, frequency TEXT, "
+        "is_active INTEGER DEFAULT 1, user_category_override INTEGER, "
+        "created_at TEXT DEFAULT CURRENT_TIMESTAMP)");
+    REQUIRE(createResult.has_value());
+    REQUIRE(db->execute(
+        "INSERT INTO transactions (id, account_id, date, amount_cents, type) "
+        "VALUES ('t1', 'a1', '2024-01-01', 1000, 0)").has_value());
+
+    auto runner = infrastructure::persistence::createMigrationRunner();
+    auto result = runner.run(*db);
+    REQUIRE(result.has_value());
+
+    // 2024-01-01 is 19723 days after the epoch
+    sqlite3_stmt* stmt = nullptr;
+    REQUIRE(sqlite3_prepare_v2(db->handle(),
+        "SELECT typeof(date), date FROM transactions WHERE id = 't1'",
+        -1, &stmt, nullptr) == SQLITE_OK);
+    REQUIRE(sqlite3_step(stmt) == SQLITE_ROW);
+    CHECK(std::string{reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0))} == "integer");
+    CHECK(sqlite3_column_int64(stmt, 1) == 19723);
+    sqlite3_finalize(stmt);
 }
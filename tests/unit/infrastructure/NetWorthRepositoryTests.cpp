@@ -0,0 +1,112 @@
+#include <catch2/catch_test_macros.hpp>
+#include "infrastructure/persistence/DatabaseConnection.hpp"
+#include "infrastructure/persistence/SqliteAccountRepository.hpp"
+#include "infrastructure/persistence/SqliteCreditRepository.hpp"
+#include "infrastructure/persistence/SqliteNetWorthRepository.hpp"
+
+using namespace ares;
+using infrastructure::persistence::SqliteNetWorthRepository;
+
+namespace {
+
+auto openMemoryDb() -> std::shared_ptr<infrastructure::persistence::DatabaseConnection> {
+    auto result = infrastructure::persistence::DatabaseConnection::open(":memory:");
+    REQUIRE(result.has_value());
+    auto db = std::shared_ptr<infrastructure::persistence::DatabaseConnection>{std::move(*result)};
+    REQUIRE(db->initializeSchema().has_value());
+    return db;
+}
+
+auto makeAccount(const std::string& id, core::AccountType type, int64_t balanceCents)
+    -> core::Account {
+    core::Account account{core::AccountId{id}, "Account " + id, "IBAN-" + id,
+                          type, core::BankIdentifier::ING};
+    account.setBalance(core::Money{balanceCents, core::Currency::EUR});
+    return account;
+}
+
+auto makeCredit(const std::string& id, int64_t balanceCents) -> core::Credit {
+    return core::Credit{core::CreditId{id}, "Credit " + id, core::CreditType::PersonalLoan,
+                        core::Money{balanceCents, core::Currency::EUR},
+                        core::Money{balanceCents, core::Currency::EUR},
+                        4.5, core::InterestType::Fixed};
+}
+
+} // namespace
+
+TEST_CASE("Net worth snapshot starts empty and tracks account writes",
+          "[Persistence][NetWorth]") {
+    auto db = openMemoryDb();
+    SqliteNetWorthRepository netWorthRepo{db};
+
+    auto initial = netWorthRepo.load();
+    REQUIRE(initial.has_value());
+    CHECK(initial->assetsCents == 0);
+    CHECK(initial->savingsCents == 0);
+    CHECK(initial->debtCents == 0);
+
+    infrastructure::persistence::SqliteAccountRepository accountRepo{db};
+    REQUIRE(accountRepo.save(makeAccount("a1", core::AccountType::Checking, 10000)).has_value());
+    REQUIRE(accountRepo.save(makeAccount("a2", core::AccountType::Savings, 50000)).has_value());
+
+    auto snapshot = netWorthRepo.load();
+    REQUIRE(snapshot.has_value());
+    CHECK(snapshot->assetsCents == 60000);
+    CHECK(snapshot->savingsCents == 50000);
+
+    // A balance update applies the delta, a re-save (REPLACE) does not
+    // double-count
+    auto updated = makeAccount("a2", core::AccountType::Savings, 55000);
+    REQUIRE(accountRepo.update(updated).has_value());
+    snapshot = netWorthRepo.load();
+    REQUIRE(snapshot.has_value());
+    CHECK(snapshot->assetsCents == 65000);
+    CHECK(snapshot->savingsCents == 55000);
+
+    REQUIRE(accountRepo.remove(core::AccountId{"a1"}).has_value());
+    snapshot = netWorthRepo.load();
+    REQUIRE(snapshot.has_value());
+    CHECK(snapshot->assetsCents == 55000);
+}
+
+TEST_CASE("Net worth snapshot tracks credit writes", "[Persistence][NetWorth]") {
+    auto db = openMemoryDb();
+    SqliteNetWorthRepository netWorthRepo{db};
+    infrastructure::persistence::SqliteCreditRepository creditRepo{db};
+
+    REQUIRE(creditRepo.save(makeCredit("c1", 250000)).has_value());
+    REQUIRE(creditRepo.save(makeCredit("c2", 80000)).has_value());
+
+    auto snapshot = netWorthRepo.load();
+    REQUIRE(snapshot.has_value());
+    CHECK(snapshot->debtCents == 330000);
+
+    // A payment shrinks the balance; the snapshot follows the delta
+    auto paid = makeCredit("c1", 240000);
+    REQUIRE(creditRepo.update(paid).has_value());
+    snapshot = netWorthRepo.load();
+    REQUIRE(snapshot.has_value());
+    CHECK(snapshot->debtCents == 320000);
+
+    REQUIRE(creditRepo.remove(core::CreditId{"c2"}).has_value());
+    snapshot = netWorthRepo.load();
+    REQUIRE(snapshot.has_value());
+    CHECK(snapshot->debtCents == 240000);
+}
+
+TEST_CASE("Net worth snapshot rebuild recovers from a stale row",
+          "[Persistence][NetWorth]") {
+    auto db = openMemoryDb();
+    SqliteNetWorthRepository netWorthRepo{db};
+    infrastructure::persistence::SqliteAccountRepository accountRepo{db};
+
+    REQUIRE(accountRepo.save(makeAccount("a1", core::AccountType::Checking, 12345)).has_value());
+
+    // Corrupt the snapshot behind the triggers' back
+    REQUIRE(db->execute("UPDATE net_worth_snapshot SET assets_cents = 999").has_value());
+
+    auto rebuilt = netWorthRepo.rebuild();
+    REQUIRE(rebuilt.has_value());
+    CHECK(rebuilt->assetsCents == 12345);
+    CHECK(rebuilt->savingsCents == 0);
+}
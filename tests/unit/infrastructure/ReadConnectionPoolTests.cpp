@@ -0,0 +1,118 @@
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <thread>
+#include "infrastructure/persistence/ReadConnectionPool.hpp"
+#include "infrastructure/persistence/SqliteTransactionRepository.hpp"
+
+using namespace ares;
+
+namespace {
+
+struct TempDatabase {
+    std::filesystem::path path;
+    std::shared_ptr<infrastructure::persistence::DatabaseConnection> writer;
+
+    TempDatabase() {
+        path = std::filesystem::temp_directory_path() / "ares_pool_test.db";
+        std::filesystem::remove(path);
+        auto result = infrastructure::persistence::DatabaseConnection::open(path);
+        REQUIRE(result.has_value());
+        writer = std::move(*result);
+        REQUIRE(writer->initializeSchema().has_value());
+    }
+
+    ~TempDatabase() {
+        writer.reset();
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+        std::filesystem::remove(path.string() + "-wal", ec);
+        std::filesystem::remove(path.string() + "-shm", ec);
+    }
+};
+
+auto saveTransaction(infrastructure::persistence::SqliteTransactionRepository& repo,
+                     const std::string& id, int64_t cents) -> void {
+    core::Date date{std::chrono::year{2026}, std::chrono::month{3}, std::chrono::day{14}};
+    core::Transaction txn{core::TransactionId{id}, core::AccountId{"acc-1"}, date,
+                          core::Money{cents, core::Currency::EUR},
+                          core::TransactionType::Expense};
+    REQUIRE(repo.save(txn).has_value());
+}
+
+} // namespace
+
+TEST_CASE("ReadConnectionPool serves reads of committed writes", "[persistence]") {
+    TempDatabase db;
+    infrastructure::persistence::SqliteTransactionRepository writerRepo{db.writer};
+    saveTransaction(writerRepo, "t1", -4250);
+
+    infrastructure::persistence::ReadConnectionPool pool{db.path, 2};
+
+    auto lease = pool.acquire();
+    REQUIRE(lease.has_value());
+
+    // A repository works over a leased read-only connection
+    auto leased = std::shared_ptr<infrastructure::persistence::DatabaseConnection>(
+        &lease->connection(), [](auto*) {});
+    infrastructure::persistence::SqliteTransactionRepository readerRepo{leased};
+
+    auto found = readerRepo.findById(core::TransactionId{"t1"});
+    REQUIRE(found.has_value());
+    REQUIRE(found->has_value());
+    CHECK((*found)->amount().cents() == -4250);
+}
+
+TEST_CASE("ReadConnectionPool rejects writes on leased connections", "[persistence]") {
+    TempDatabase db;
+    infrastructure::persistence::ReadConnectionPool pool{db.path, 1};
+
+    auto lease = pool.acquire();
+    REQUIRE(lease.has_value());
+    CHECK_FALSE((*lease)->execute("INSERT INTO accounts (id, name, type, bank) "
+                                  "VALUES ('a1', 'Test', 0, 0)").has_value());
+}
+
+TEST_CASE("ReadConnectionPool reuses returned connections", "[persistence]") {
+    TempDatabase db;
+    infrastructure::persistence::ReadConnectionPool pool{db.path, 1};
+
+    sqlite3* first = nullptr;
+    {
+        auto lease = pool.acquire();
+        REQUIRE(lease.has_value());
+        first = lease->connection().handle();
+    }
+
+    auto lease = pool.acquire();
+    REQUIRE(lease.has_value());
+    CHECK(lease->connection().handle() == first);
+}
+
+TEST_CASE("ReadConnectionPool supports concurrent readers", "[persistence]") {
+    TempDatabase db;
+    infrastructure::persistence::SqliteTransactionRepository writerRepo{db.writer};
+    for (int i = 0; i < 50; ++i) {
+        saveTransaction(writerRepo, "t" + std::to_string(i), -100 - i);
+    }
+
+    infrastructure::persistence::ReadConnectionPool pool{db.path, 4};
+
+    std::atomic<int> successes{0};
+    std::vector<std::jthread> readers;
+    for (int i = 0; i < 8; ++i) {
+        readers.emplace_back([&] {
+            auto lease = pool.acquire();
+            if (!lease) return;
+            auto leased = std::shared_ptr<infrastructure::persistence::DatabaseConnection>(
+                &lease->connection(), [](auto*) {});
+            infrastructure::persistence::SqliteTransactionRepository repo{leased};
+            auto all = repo.findAll();
+            if (all.has_value() && all->size() == 50) {
+                ++successes;
+            }
+        });
+    }
+    readers.clear();
+
+    CHECK(successes == 8);
+}
@@ -0,0 +1,71 @@
+#include <catch2/catch_test_macros.hpp>
+#include <fmt/format.h>
+#include "infrastructure/persistence/DatabaseConnection.hpp"
+#include "infrastructure/persistence/SqliteRecurringPatternRepository.hpp"
+
+using namespace ares;
+using infrastructure::persistence::SqliteRecurringPatternRepository;
+
+namespace {
+
+auto openMemoryDb() -> std::shared_ptr<infrastructure::persistence::DatabaseConnection> {
+    auto result = infrastructure::persistence::DatabaseConnection::open(":memory:");
+    REQUIRE(result.has_value());
+    auto db = std::shared_ptr<infrastructure::persistence::DatabaseConnection>{std::move(*result)};
+    REQUIRE(db->initializeSchema().has_value());
+    return db;
+}
+
+auto makePattern(const std::string& id, const std::string& counterparty, int64_t cents)
+    -> core::RecurringPattern {
+    return core::RecurringPattern{core::RecurringPatternId{id}, counterparty,
+                                  core::Money{cents, core::Currency::EUR},
+                                  core::RecurrenceFrequency::Monthly};
+}
+
+} // namespace
+
+TEST_CASE("SqliteRecurringPatternRepository saveBatch persists the whole set",
+          "[Persistence][RecurringPattern]") {
+    auto db = openMemoryDb();
+    SqliteRecurringPatternRepository repo{db};
+
+    std::vector<core::RecurringPattern> patterns;
+    for (int i = 0; i < 25; ++i) {
+        patterns.push_back(makePattern(fmt::format("p{}", i),
+                                       fmt::format("Counterparty {}", i), -1000 - i));
+    }
+    REQUIRE(repo.saveBatch(patterns).has_value());
+
+    auto stored = repo.findAll();
+    REQUIRE(stored.has_value());
+    CHECK(stored->size() == 25);
+
+    // Batched re-save replaces instead of duplicating
+    REQUIRE(repo.saveBatch(patterns).has_value());
+    stored = repo.findAll();
+    REQUIRE(stored.has_value());
+    CHECK(stored->size() == 25);
+}
+
+TEST_CASE("SqliteRecurringPatternRepository removeBatch deletes only the given ids",
+          "[Persistence][RecurringPattern]") {
+    auto db = openMemoryDb();
+    SqliteRecurringPatternRepository repo{db};
+
+    REQUIRE(repo.saveBatch({makePattern("p1", "Netflix", -1299),
+                            makePattern("p2", "Spotify", -999),
+                            makePattern("p3", "Rent", -85000)}).has_value());
+
+    REQUIRE(repo.removeBatch({core::RecurringPatternId{"p1"},
+                              core::RecurringPatternId{"p3"}}).has_value());
+
+    auto remaining = repo.findAll();
+    REQUIRE(remaining.has_value());
+    REQUIRE(remaining->size() == 1);
+    CHECK((*remaining)[0].id().value == "p2");
+
+    // Empty sets are no-ops, not errors
+    CHECK(repo.saveBatch({}).has_value());
+    CHECK(repo.removeBatch({}).has_value());
+}
@@ -0,0 +1,104 @@
+#include <catch2/catch_test_macros.hpp>
+#include "infrastructure/persistence/DatabaseConnection.hpp"
+#include "infrastructure/persistence/SqliteTransactionRepository.hpp"
+
+using namespace ares;
+
+namespace {
+
+auto openDatabase() -> std::shared_ptr<infrastructure::persistence::DatabaseConnection> {
+    auto result = infrastructure::persistence::DatabaseConnection::open(":memory:");
+    REQUIRE(result.has_value());
+    auto db = std::shared_ptr<infrastructure::persistence::DatabaseConnection>{std::move(*result)};
+    REQUIRE(db->initializeSchema().has_value());
+    return db;
+}
+
+auto makeTransaction(const std::string& id) -> core::Transaction {
+    core::Date date{std::chrono::year{2026}, std::chrono::month{4}, std::chrono::day{7}};
+    return core::Transaction{core::TransactionId{id}, core::AccountId{"acc-1"}, date,
+                             core::Money{-1250, core::Currency::EUR},
+                             core::TransactionType::Expense};
+}
+
+auto rowCount(infrastructure::persistence::SqliteTransactionRepository& repo) -> std::size_t {
+    auto all = repo.findAll();
+    REQUIRE(all.has_value());
+    return all->size();
+}
+
+} // namespace
+
+TEST_CASE("TransactionGuard commits the outermost scope", "[persistence]") {
+    auto db = openDatabase();
+    infrastructure::persistence::SqliteTransactionRepository repo{db};
+
+    auto scope = db->beginTransaction();
+    REQUIRE(scope.has_value());
+    REQUIRE(repo.save(makeTransaction("t1")).has_value());
+    REQUIRE(scope->commit().has_value());
+
+    CHECK(rowCount(repo) == 1);
+}
+
+TEST_CASE("TransactionGuard rolls back when destroyed uncommitted", "[persistence]") {
+    auto db = openDatabase();
+    infrastructure::persistence::SqliteTransactionRepository repo{db};
+
+    {
+        auto scope = db->beginTransaction();
+        REQUIRE(scope.has_value());
+        REQUIRE(repo.save(makeTransaction("t1")).has_value());
+        // No commit - the guard unwinds the scope
+    }
+
+    CHECK(rowCount(repo) == 0);
+
+    // The connection is usable again afterwards
+    auto scope = db->beginTransaction();
+    REQUIRE(scope.has_value());
+    REQUIRE(scope->commit().has_value());
+}
+
+TEST_CASE("TransactionGuard nests as savepoints", "[persistence]") {
+    auto db = openDatabase();
+    infrastructure::persistence::SqliteTransactionRepository repo{db};
+
+    auto outer = db->beginTransaction();
+    REQUIRE(outer.has_value());
+    REQUIRE(repo.save(makeTransaction("kept")).has_value());
+
+    {
+        auto inner = db->beginTransaction();
+        REQUIRE(inner.has_value());
+        REQUIRE(repo.save(makeTransaction("discarded")).has_value());
+        // Inner scope unwinds to its savepoint only
+    }
+
+    REQUIRE(outer->commit().has_value());
+
+    auto kept = repo.findById(core::TransactionId{"kept"});
+    REQUIRE(kept.has_value());
+    CHECK(kept->has_value());
+    auto discarded = repo.findById(core::TransactionId{"discarded"});
+    REQUIRE(discarded.has_value());
+    CHECK_FALSE(discarded->has_value());
+}
+
+TEST_CASE("TransactionGuard discards committed savepoints with the outer scope",
+          "[persistence]") {
+    auto db = openDatabase();
+    infrastructure::persistence::SqliteTransactionRepository repo{db};
+
+    {
+        auto outer = db->beginTransaction();
+        REQUIRE(outer.has_value());
+
+        // A batch save opens (and releases) its own nested scope
+        REQUIRE(repo.saveBatch({makeTransaction("t1"), makeTransaction("t2")}).has_value());
+        CHECK(rowCount(repo) == 2);
+        // The outer scope unwinds, taking the released savepoint with it
+    }
+
+    CHECK(rowCount(repo) == 0);
+}
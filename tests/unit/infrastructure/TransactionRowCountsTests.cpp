@@ -0,0 +1,77 @@
+#include <catch2/catch_test_macros.hpp>
+#include <fmt/format.h>
+#include "infrastructure/persistence/DatabaseConnection.hpp"
+#include "infrastructure/persistence/SqliteTransactionRepository.hpp"
+
+using namespace ares;
+
+namespace {
+
+auto openRepository() -> std::shared_ptr<infrastructure::persistence::SqliteTransactionRepository> {
+    auto db = infrastructure::persistence::DatabaseConnection::open(":memory:");
+    REQUIRE(db.has_value());
+    std::shared_ptr<infrastructure::persistence::DatabaseConnection> connection = std::move(*db);
+    REQUIRE(connection->initializeSchema().has_value());
+    return std::make_shared<infrastructure::persistence::SqliteTransactionRepository>(connection);
+}
+
+auto makeTransaction(const std::string& id, const std::string& accountId,
+                     core::Date date, int64_t cents) -> core::Transaction {
+    return core::Transaction{
+        core::TransactionId{id}, core::AccountId{accountId}, date,
+        core::Money{cents, core::Currency::EUR},
+        cents > 0 ? core::TransactionType::Income : core::TransactionType::Expense};
+}
+
+} // namespace
+
+TEST_CASE("SqliteTransactionRepository count serves from the rollups", "[persistence]") {
+    auto repo = openRepository();
+
+    auto count = repo->count();
+    REQUIRE(count.has_value());
+    CHECK(*count == 0);
+
+    core::Date march{std::chrono::year{2026}, std::chrono::month{3}, std::chrono::day{10}};
+    std::vector<core::Transaction> batch;
+    for (int i = 0; i < 5; ++i) {
+        batch.push_back(makeTransaction(fmt::format("t{}", i), "acc-1", march, -1000 - i));
+    }
+    REQUIRE(repo->saveBatch(batch).has_value());
+
+    count = repo->count();
+    REQUIRE(count.has_value());
+    CHECK(*count == 5);
+
+    // A bulk delete only marks the rollups dirty; count must rebuild them
+    // before serving
+    REQUIRE(repo->removeByDateRange(core::AccountId{"acc-1"}, march, march).has_value());
+    count = repo->count();
+    REQUIRE(count.has_value());
+    CHECK(*count == 0);
+}
+
+TEST_CASE("SqliteTransactionRepository rowCounts breaks down by account and month", "[persistence]") {
+    auto repo = openRepository();
+
+    core::Date february{std::chrono::year{2026}, std::chrono::month{2}, std::chrono::day{5}};
+    core::Date march{std::chrono::year{2026}, std::chrono::month{3}, std::chrono::day{10}};
+    REQUIRE(repo->saveBatch({
+        makeTransaction("t1", "acc-1", february, -1000),
+        makeTransaction("t2", "acc-1", march, -2000),
+        makeTransaction("t3", "acc-1", march, 300000),
+        makeTransaction("t4", "acc-2", march, -4000),
+    }).has_value());
+
+    auto counts = repo->rowCounts();
+    REQUIRE(counts.has_value());
+    CHECK(counts->total == 4);
+
+    REQUIRE(counts->byAccount.size() == 2);
+    CHECK(counts->byAccount[0] == std::pair{std::string{"acc-1"}, 3});
+    CHECK(counts->byAccount[1] == std::pair{std::string{"acc-2"}, 1});
+
+    REQUIRE(counts->byMonth.size() == 2);
+    CHECK(counts->byMonth[0] == std::pair{int64_t{202602}, 1});
+    CHECK(counts->byMonth[1] == std::pair{int64_t{202603}, 3});
+}
@@ -0,0 +1,303 @@
+#include <catch2/catch_test_macros.hpp>
+#include <fmt/format.h>
+#include "infrastructure/persistence/DatabaseConnection.hpp"
+#include "infrastructure/persistence/WriteBehindTransactionRepository.hpp"
+
+using namespace ares;
+
+namespace {
+
+auto openRepository() -> std::shared_ptr<infrastructure::persistence::SqliteTransactionRepository> {
+    auto db = infrastructure::persistence::DatabaseConnection::open(":memory:");
+    REQUIRE(db.has_value());
+    std::shared_ptr<infrastructure::persistence::DatabaseConnection> connection = std::move(*db);
+    REQUIRE(connection->initializeSchema().has_value());
+    return std::make_shared<infrastructure::persistence::SqliteTransactionRepository>(connection);
+}
+
+auto makeTransaction(const std::string& id, int64_t cents) -> core::Transaction {
+    core::Date date{std::chrono::year{2026}, std::chrono::month{3}, std::chrono::day{14}};
+    return core::Transaction{
+        core::TransactionId{id}, core::AccountId{"acc-1"}, date,
+        core::Money{cents, core::Currency::EUR},
+        cents > 0 ? core::TransactionType::Income : core::TransactionType::Expense};
+}
+
+} // namespace
+
+TEST_CASE("WriteBehindTransactionRepository applies writes after flush", "[persistence]") {
+    infrastructure::persistence::WriteBehindTransactionRepository repo{openRepository()};
+
+    REQUIRE(repo.save(makeTransaction("t1", -4250)).has_value());
+    REQUIRE(repo.saveBatch({makeTransaction("t2", 1500), makeTransaction("t3", -899)}).has_value());
+    REQUIRE(repo.flush().has_value());
+
+    auto all = repo.findAll();
+    REQUIRE(all.has_value());
+    CHECK(all->size() == 3);
+}
+
+TEST_CASE("WriteBehindTransactionRepository reads see queued writes", "[persistence]") {
+    infrastructure::persistence::WriteBehindTransactionRepository repo{openRepository()};
+
+    REQUIRE(repo.save(makeTransaction("t1", -4250)).has_value());
+
+    // No explicit flush: the read drains the queue first
+    auto found = repo.findById(core::TransactionId{"t1"});
+    REQUIRE(found.has_value());
+    REQUIRE(found->has_value());
+    CHECK((*found)->amount().cents() == -4250);
+}
+
+TEST_CASE("WriteBehindTransactionRepository search drains queued writes first", "[persistence]") {
+    infrastructure::persistence::WriteBehindTransactionRepository repo{openRepository()};
+
+    auto txn = makeTransaction("t1", -1500);
+    txn.setCounterpartyName("REWE Markt GmbH");
+    REQUIRE(repo.save(txn).has_value());
+
+    // No explicit flush: search flushes before delegating, so the queued
+    // row is already in the FTS index
+    auto hits = repo.search("rewe", 10);
+    REQUIRE(hits.has_value());
+    REQUIRE(hits->size() == 1);
+    CHECK((*hits)[0].id().value == "t1");
+}
+
+TEST_CASE("WriteBehindTransactionRepository preserves write order", "[persistence]") {
+    infrastructure::persistence::WriteBehindTransactionRepository repo{openRepository()};
+
+    REQUIRE(repo.save(makeTransaction("t1", -4250)).has_value());
+
+    auto updated = makeTransaction("t1", -4250);
+    updated.setCategory(core::TransactionCategory::Groceries);
+    REQUIRE(repo.update(updated).has_value());
+    REQUIRE(repo.remove(core::TransactionId{"t1"}).has_value());
+
+    auto found = repo.findById(core::TransactionId{"t1"});
+    REQUIRE(found.has_value());
+    CHECK_FALSE(found->has_value());
+}
+
+TEST_CASE("WriteBehindTransactionRepository defers write errors to flush", "[persistence]") {
+    auto db = infrastructure::persistence::DatabaseConnection::open(":memory:");
+    REQUIRE(db.has_value());
+    std::shared_ptr<infrastructure::persistence::DatabaseConnection> connection = std::move(*db);
+    REQUIRE(connection->initializeSchema().has_value());
+    auto inner = std::make_shared<infrastructure::persistence::SqliteTransactionRepository>(connection);
+
+    infrastructure::persistence::WriteBehindTransactionRepository repo{inner};
+    REQUIRE(repo.flush().has_value());
+
+    // Make the queued insert fail; the enqueue itself still succeeds
+    REQUIRE(connection->execute("DROP TABLE transactions").has_value());
+    REQUIRE(repo.save(makeTransaction("t1", -4250)).has_value());
+
+    auto flushed = repo.flush();
+    REQUIRE_FALSE(flushed.has_value());
+    CHECK(std::holds_alternative<core::DatabaseError>(flushed.error()));
+
+    // The error is consumed; the next flush is clean
+    CHECK(repo.flush().has_value());
+}
+
+TEST_CASE("WriteBehindTransactionRepository destructor flushes pending writes", "[persistence]") {
+    auto inner = openRepository();
+    {
+        infrastructure::persistence::WriteBehindTransactionRepository repo{inner};
+        REQUIRE(repo.save(makeTransaction("t1", -4250)).has_value());
+    }
+
+    auto count = inner->count();
+    REQUIRE(count.has_value());
+    CHECK(*count == 1);
+}
+
+TEST_CASE("WriteBehindTransactionRepository pages with a keyset cursor", "[persistence]") {
+    infrastructure::persistence::WriteBehindTransactionRepository repo{openRepository()};
+
+    // Three rows share one date so the id tiebreak matters
+    for (int day = 1; day <= 3; ++day) {
+        for (int n = 0; n < 3; ++n) {
+            auto txn = core::Transaction{
+                core::TransactionId{fmt::format("d{}-{}", day, n)}, core::AccountId{"acc-1"},
+                core::Date{std::chrono::year{2026}, std::chrono::month{3},
+                           std::chrono::day{static_cast<unsigned>(day)}},
+                core::Money{-100, core::Currency::EUR}, core::TransactionType::Expense};
+            REQUIRE(repo.save(txn).has_value());
+        }
+    }
+
+    SECTION("first page is newest-first with the id tiebreak") {
+        auto page = repo.findPage(4, std::nullopt, std::nullopt);
+        REQUIRE(page.has_value());
+        REQUIRE(page->size() == 4);
+        CHECK((*page)[0].id().value == "d3-2");
+        CHECK((*page)[1].id().value == "d3-1");
+        CHECK((*page)[2].id().value == "d3-0");
+        CHECK((*page)[3].id().value == "d2-2");
+    }
+
+    SECTION("before continues where the previous page ended") {
+        auto first = repo.findPage(4, std::nullopt, std::nullopt);
+        REQUIRE(first.has_value());
+        auto cursor = core::TransactionRepository::PageCursor{first->back().date(),
+                                                             first->back().id()};
+        auto next = repo.findPage(4, cursor, std::nullopt);
+        REQUIRE(next.has_value());
+        REQUIRE(next->size() == 4);
+        CHECK((*next)[0].id().value == "d2-1");
+        CHECK((*next)[3].id().value == "d1-2");
+    }
+
+    SECTION("after pages back toward the present") {
+        auto all = repo.findPage(9, std::nullopt, std::nullopt);
+        REQUIRE(all.has_value());
+        auto cursor = core::TransactionRepository::PageCursor{(*all)[6].date(), (*all)[6].id()};
+        auto newer = repo.findPage(3, std::nullopt, cursor);
+        REQUIRE(newer.has_value());
+        REQUIRE(newer->size() == 3);
+        CHECK((*newer)[0].id().value == (*all)[3].id().value);
+        CHECK((*newer)[2].id().value == (*all)[5].id().value);
+    }
+
+    SECTION("non-positive limit yields an empty page") {
+        auto page = repo.findPage(0, std::nullopt, std::nullopt);
+        REQUIRE(page.has_value());
+        CHECK(page->empty());
+    }
+}
+
+TEST_CASE("Transaction full-text search finds rows by any text field", "[persistence]") {
+    infrastructure::persistence::WriteBehindTransactionRepository repo{openRepository()};
+
+    auto makeDescribed = [](const std::string& id, unsigned day, const std::string& counterparty,
+                            const std::string& memo) {
+        auto txn = core::Transaction{
+            core::TransactionId{id}, core::AccountId{"acc-1"},
+            core::Date{std::chrono::year{2026}, std::chrono::month{5},
+                       std::chrono::day{day}},
+            core::Money{-1500, core::Currency::EUR}, core::TransactionType::Expense};
+        txn.setCounterpartyName(counterparty);
+        txn.setRawDescription(memo);
+        return txn;
+    };
+
+    REQUIRE(repo.save(makeDescribed("t1", 5, "REWE Markt GmbH", "REWE SAGT DANKE 4411")).has_value());
+    REQUIRE(repo.save(makeDescribed("t2", 6, "PayPal", "PP.1234 Spotify AB")).has_value());
+    REQUIRE(repo.save(makeDescribed("t3", 7, "Stadtwerke Koeln", "Abschlag Strom")).has_value());
+
+    SECTION("words match as prefixes across counterparty and memo") {
+        auto hits = repo.search("spoti", 10);
+        REQUIRE(hits.has_value());
+        REQUIRE(hits->size() == 1);
+        CHECK((*hits)[0].id().value == "t2");
+    }
+
+    SECTION("multiple words all have to match") {
+        auto hits = repo.search("rewe 4411", 10);
+        REQUIRE(hits.has_value());
+        REQUIRE(hits->size() == 1);
+        CHECK((*hits)[0].id().value == "t1");
+    }
+
+    SECTION("FTS operators in the query are treated as plain text") {
+        auto hits = repo.search("rewe AND \"danke", 10);
+        REQUIRE(hits.has_value());
+    }
+
+    SECTION("updates and deletes keep the index current") {
+        auto replacement = makeDescribed("t3", 7, "Netflix International", "Abo Mai");
+        REQUIRE(repo.update(replacement).has_value());
+        auto stale = repo.search("stadtwerke", 10);
+        REQUIRE(stale.has_value());
+        CHECK(stale->empty());
+        auto fresh = repo.search("netflix", 10);
+        REQUIRE(fresh.has_value());
+        CHECK(fresh->size() == 1);
+
+        REQUIRE(repo.remove(core::TransactionId{"t1"}).has_value());
+        auto removed = repo.search("4411", 10);
+        REQUIRE(removed.has_value());
+        CHECK(removed->empty());
+    }
+
+    SECTION("blank query matches nothing") {
+        auto hits = repo.search("   ", 10);
+        REQUIRE(hits.has_value());
+        CHECK(hits->empty());
+    }
+}
+
+TEST_CASE("Import duplicate detection rides the content-hash index", "[persistence]") {
+    auto repo = openRepository();
+
+    auto withCounterparty = [](core::Transaction txn, const std::string& name) {
+        txn.setCounterpartyName(name);
+        return txn;
+    };
+
+    SECTION("duplicates within one batch collapse") {
+        auto saved = repo->saveBatchSkipDuplicates(
+            {withCounterparty(makeTransaction("t1", -500), "REWE Markt"),
+             withCounterparty(makeTransaction("t2", -500), "REWE Markt"),
+             withCounterparty(makeTransaction("t3", 1200), "Employer")});
+        REQUIRE(saved.has_value());
+        CHECK(*saved == 2);
+    }
+
+    SECTION("a re-export with fresh ids and formatting noise inserts nothing") {
+        REQUIRE(repo->saveBatchSkipDuplicates(
+            {withCounterparty(makeTransaction("t1", -500), "REWE Markt")}).has_value());
+
+        auto again = repo->saveBatchSkipDuplicates(
+            {withCounterparty(makeTransaction("r1", -500), "  rewe   MARKT ")});
+        REQUIRE(again.has_value());
+        CHECK(*again == 0);
+
+        auto novel = repo->saveBatchSkipDuplicates(
+            {withCounterparty(makeTransaction("r2", -501), "REWE Markt")});
+        REQUIRE(novel.has_value());
+        CHECK(*novel == 1);
+    }
+
+    SECTION("exists is a single hash probe") {
+        REQUIRE(repo->saveBatchSkipDuplicates(
+            {withCounterparty(makeTransaction("t1", -500), "REWE Markt")}).has_value());
+
+        auto match = repo->exists(withCounterparty(makeTransaction("x", -500), "rewe markt"));
+        REQUIRE(match.has_value());
+        CHECK(*match);
+
+        auto miss = repo->exists(withCounterparty(makeTransaction("x", -999), "rewe markt"));
+        REQUIRE(miss.has_value());
+        CHECK_FALSE(*miss);
+    }
+
+    SECTION("an edited row keeps its hash, so re-imports still collapse") {
+        REQUIRE(repo->saveBatchSkipDuplicates(
+            {withCounterparty(makeTransaction("t1", -500), "REWE Markt")}).has_value());
+
+        auto found = repo->findById(core::TransactionId{"t1"});
+        REQUIRE(found.has_value());
+        REQUIRE(found->has_value());
+        auto edited = **found;
+        edited.setCategory(core::TransactionCategory::Groceries);
+        REQUIRE(repo->save(edited).has_value());
+
+        auto again = repo->saveBatchSkipDuplicates(
+            {withCounterparty(makeTransaction("r1", -500), "REWE Markt")});
+        REQUIRE(again.has_value());
+        CHECK(*again == 0);
+    }
+
+    SECTION("a manual save never replaces a stored row with the same content") {
+        REQUIRE(repo->saveBatchSkipDuplicates(
+            {withCounterparty(makeTransaction("t1", -500), "REWE Markt")}).has_value());
+        REQUIRE(repo->save(withCounterparty(makeTransaction("m1", -500), "REWE Markt")).has_value());
+
+        auto original = repo->findById(core::TransactionId{"t1"});
+        REQUIRE(original.has_value());
+        CHECK(original->has_value());
+    }
+}
@@ -0,0 +1,92 @@
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include "application/services/AmortizationEngine.hpp"
+
+using namespace ares;
+using application::services::AmortizationEngine;
+
+namespace {
+
+auto makeCredit(int64_t balanceCents, int64_t paymentCents, double annualRate) -> core::Credit {
+    core::Credit credit{core::CreditId{"cr-1"}, "Test Loan", core::CreditType::PersonalLoan,
+                        core::Money{balanceCents}, core::Money{balanceCents}, annualRate};
+    credit.setMinimumPayment(core::Money{paymentCents});
+    return credit;
+}
+
+constexpr core::Date kAsOf{std::chrono::year{2026}, std::chrono::month{8}, std::chrono::day{28}};
+
+} // namespace
+
+TEST_CASE("AmortizationEngine zero-rate payoff is a plain division", "[Amortization]") {
+    auto credit = makeCredit(100000, 30000, 0.0);
+    auto schedule = AmortizationEngine::computeSchedule(credit, kAsOf);
+
+    REQUIRE(schedule.payoffReachable);
+    CHECK(schedule.monthsToPayoff == 4);  // 3 full payments + 100 remainder
+    CHECK(schedule.totalInterestCents == 0);
+    REQUIRE(schedule.balanceTrajectoryCents.size() == 4);
+    CHECK(schedule.balanceTrajectoryCents[0] == 70000);
+    CHECK(schedule.balanceTrajectoryCents.back() == 0);
+    CHECK(schedule.payoffDate == core::Date{std::chrono::year{2026},
+                                            std::chrono::month{12}, std::chrono::day{1}});
+}
+
+TEST_CASE("AmortizationEngine matches the annuity formula with interest", "[Amortization]") {
+    // 1.000 EUR at 12% annual (1% monthly), 100 EUR payments:
+    // closed form gives 10.6 months, so 11 payments with a small final one
+    auto credit = makeCredit(100000, 10000, 0.12);
+    auto schedule = AmortizationEngine::computeSchedule(credit, kAsOf);
+
+    REQUIRE(schedule.payoffReachable);
+    CHECK(schedule.monthsToPayoff == 11);
+    // The integer recurrence is deterministic, so the interest total is exact
+    CHECK(schedule.totalInterestCents == 5898);
+    CHECK(schedule.balanceTrajectoryCents.back() == 0);
+
+    // Balances strictly decrease
+    for (std::size_t i = 1; i < schedule.balanceTrajectoryCents.size(); ++i) {
+        CHECK(schedule.balanceTrajectoryCents[i] < schedule.balanceTrajectoryCents[i - 1]);
+    }
+}
+
+TEST_CASE("AmortizationEngine flags payments that never outrun the interest", "[Amortization]") {
+    // 10.000 EUR at 24% annual accrues 200 EUR/month; a 150 EUR payment loses
+    auto credit = makeCredit(1000000, 15000, 0.24);
+    auto schedule = AmortizationEngine::computeSchedule(credit, kAsOf);
+
+    CHECK_FALSE(schedule.payoffReachable);
+    CHECK(schedule.balanceTrajectoryCents.empty());
+}
+
+TEST_CASE("AmortizationEngine paid-off and zero-payment credits", "[Amortization]") {
+    auto paidOff = makeCredit(0, 10000, 0.05);
+    auto schedule = AmortizationEngine::computeSchedule(paidOff, kAsOf);
+    CHECK(schedule.payoffReachable);
+    CHECK(schedule.monthsToPayoff == 0);
+
+    auto noPayment = makeCredit(50000, 0, 0.05);
+    schedule = AmortizationEngine::computeSchedule(noPayment, kAsOf);
+    CHECK_FALSE(schedule.payoffReachable);
+}
+
+TEST_CASE("AmortizationEngine memo reflects balance and payment changes", "[Amortization]") {
+    AmortizationEngine engine;
+    auto credit = makeCredit(100000, 10000, 0.12);
+
+    auto first = engine.scheduleFor(credit, kAsOf);
+    auto cached = engine.scheduleFor(credit, kAsOf);
+    CHECK(first.monthsToPayoff == cached.monthsToPayoff);
+    CHECK(first.totalInterestCents == cached.totalInterestCents);
+
+    // A recorded payment halves the balance; the memo key no longer
+    // matches, so the schedule recomputes
+    credit.setCurrentBalance(core::Money{50000});
+    auto afterPayment = engine.scheduleFor(credit, kAsOf);
+    CHECK(afterPayment.monthsToPayoff < first.monthsToPayoff);
+
+    // A higher payment shortens the schedule the same way
+    credit.setMinimumPayment(core::Money{25000});
+    auto higherPayment = engine.scheduleFor(credit, kAsOf);
+    CHECK(higherPayment.monthsToPayoff < afterPayment.monthsToPayoff);
+}
@@ -0,0 +1,165 @@
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <filesystem>
+#include <fmt/format.h>
+#include "application/services/ArchiveService.hpp"
+#include "infrastructure/persistence/DatabaseConnection.hpp"
+#include "infrastructure/persistence/SqliteAccountRepository.hpp"
+#include "infrastructure/persistence/SqliteTransactionRepository.hpp"
+
+using namespace ares;
+using application::services::ArchiveService;
+
+namespace {
+
+// ATTACH needs real files, so the fixture databases live in a temp
+// directory that each test creates fresh and removes afterwards
+struct ArchiveDirGuard {
+    std::filesystem::path dir;
+
+    ArchiveDirGuard() : dir{std::filesystem::temp_directory_path() / "ares-test-archive"} {
+        std::filesystem::remove_all(dir);
+        std::filesystem::create_directories(dir);
+    }
+    ~ArchiveDirGuard() { std::filesystem::remove_all(dir); }
+
+    [[nodiscard]] auto dbPath() const -> std::filesystem::path { return dir / "ares.db"; }
+    [[nodiscard]] auto archivePath() const -> std::filesystem::path {
+        return dir / "ares_archive.db";
+    }
+};
+
+auto openDb(const std::filesystem::path& path)
+    -> std::shared_ptr<infrastructure::persistence::DatabaseConnection> {
+    auto result = infrastructure::persistence::DatabaseConnection::open(path);
+    REQUIRE(result.has_value());
+    auto db = std::shared_ptr<infrastructure::persistence::DatabaseConnection>{std::move(*result)};
+    REQUIRE(db->initializeSchema().has_value());
+    return db;
+}
+
+auto makeTransaction(const std::string& id, core::Date date, int64_t cents) -> core::Transaction {
+    return core::Transaction{core::TransactionId{id}, core::AccountId{"acc-1"}, date,
+                             core::Money{cents, core::Currency::EUR},
+                             cents < 0 ? core::TransactionType::Expense
+                                       : core::TransactionType::Income};
+}
+
+auto seedAccount(const std::shared_ptr<infrastructure::persistence::DatabaseConnection>& db)
+    -> void {
+    infrastructure::persistence::SqliteAccountRepository accounts{db};
+    core::Account account{core::AccountId{"acc-1"}, "Checking", "NL01INGB0001234567",
+                          core::AccountType::Checking, core::BankIdentifier::ING};
+    REQUIRE(accounts.save(account).has_value());
+}
+
+constexpr core::Date kAsOf{std::chrono::year{2026}, std::chrono::month{8}, std::chrono::day{28}};
+
+} // namespace
+
+TEST_CASE("ArchiveService moves rows older than the horizon", "[Archive]") {
+    ArchiveDirGuard guard;
+    auto db = openDb(guard.dbPath());
+    seedAccount(db);
+
+    infrastructure::persistence::SqliteTransactionRepository repo{db};
+    std::vector<core::Transaction> txns;
+    // Two old years plus the current month
+    for (unsigned m = 1; m <= 12; ++m) {
+        txns.push_back(makeTransaction(fmt::format("old-{}", m),
+            core::Date{std::chrono::year{2019}, std::chrono::month{m}, std::chrono::day{15}},
+            -1000));
+    }
+    txns.push_back(makeTransaction("hot-1", kAsOf, -2500));
+    REQUIRE(repo.saveBatch(txns).has_value());
+
+    ArchiveService service;
+    auto result = service.archiveOlderThan(*db, guard.archivePath(), 13, kAsOf);
+    REQUIRE(result.has_value());
+    CHECK(result->archivedRows == 12);
+    CHECK(result->cutoff == core::Date{std::chrono::year{2025},
+                                       std::chrono::month{7}, std::chrono::day{1}});
+
+    auto hot = repo.findAll();
+    REQUIRE(hot.has_value());
+    REQUIRE(hot->size() == 1);
+    CHECK((*hot)[0].id().value == "hot-1");
+
+    auto status = service.status(*db, guard.archivePath());
+    REQUIRE(status.has_value());
+    CHECK(status->hotRows == 1);
+    CHECK(status->archivedRows == 12);
+    REQUIRE(status->cutoff.has_value());
+    CHECK(*status->cutoff == result->cutoff);
+
+    // Re-running is a no-op and the horizon never moves backwards
+    auto again = service.archiveOlderThan(*db, guard.archivePath(), 24, kAsOf);
+    REQUIRE(again.has_value());
+    CHECK(again->archivedRows == 0);
+}
+
+TEST_CASE("ArchiveService full-history view unions hot and archived rows", "[Archive]") {
+    ArchiveDirGuard guard;
+    auto db = openDb(guard.dbPath());
+    seedAccount(db);
+
+    infrastructure::persistence::SqliteTransactionRepository repo{db};
+    REQUIRE(repo.saveBatch({
+        makeTransaction("old-1",
+            core::Date{std::chrono::year{2019}, std::chrono::month{3}, std::chrono::day{5}}, -700),
+        makeTransaction("hot-1", kAsOf, -2500)
+    }).has_value());
+
+    ArchiveService service;
+    REQUIRE(service.archiveOlderThan(*db, guard.archivePath(), 13, kAsOf).has_value());
+
+    // Without the view only the hot row is visible
+    auto hotOnly = repo.findAll();
+    REQUIRE(hotOnly.has_value());
+    CHECK(hotOnly->size() == 1);
+
+    auto attached = ArchiveService::attachFullHistory(*db, guard.archivePath());
+    REQUIRE(attached.has_value());
+    CHECK(*attached);
+
+    auto full = repo.findAll();
+    REQUIRE(full.has_value());
+    CHECK(full->size() == 2);
+}
+
+TEST_CASE("ArchiveService rollup rebuild preserves archived months", "[Archive]") {
+    ArchiveDirGuard guard;
+    auto db = openDb(guard.dbPath());
+    seedAccount(db);
+
+    infrastructure::persistence::SqliteTransactionRepository repo{db};
+    REQUIRE(repo.saveBatch({
+        makeTransaction("old-1",
+            core::Date{std::chrono::year{2019}, std::chrono::month{3}, std::chrono::day{5}}, -700),
+        makeTransaction("hot-1", kAsOf, -2500)
+    }).has_value());
+
+    ArchiveService service;
+    REQUIRE(service.archiveOlderThan(*db, guard.archivePath(), 13, kAsOf).has_value());
+
+    // A bulk mutation marks the rollups dirty; the rebuild the next
+    // aggregate read triggers must not drop the archived 2019 months
+    auto removed = repo.removeByDateRange(core::AccountId{"acc-1"}, kAsOf, kAsOf);
+    REQUIRE(removed.has_value());
+    CHECK(*removed == 1);
+
+    auto oldYear = repo.aggregateByMonthAndCategory(2019);
+    REQUIRE(oldYear.has_value());
+    REQUIRE(oldYear->size() == 1);
+    CHECK((*oldYear)[0].month == 3);
+    CHECK((*oldYear)[0].expenseCents == 700);
+}
+
+TEST_CASE("ArchiveService attachFullHistory without an archive reports false", "[Archive]") {
+    ArchiveDirGuard guard;
+    auto db = openDb(guard.dbPath());
+
+    auto attached = ArchiveService::attachFullHistory(*db, guard.archivePath());
+    REQUIRE(attached.has_value());
+    CHECK_FALSE(*attached);
+}
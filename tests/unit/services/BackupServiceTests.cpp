@@ -2,9 +2,24 @@
 #include <filesystem>
 #include <fstream>
 #include "application/services/BackupService.hpp"
+#include "infrastructure/compression/Gzip.hpp"
+#include "infrastructure/persistence/DatabaseConnection.hpp"
 
 using namespace ares;
 
+namespace {
+
+// The backup path goes through the SQLite online backup API, so the
+// fixture database has to be a real one, not just a file with the header
+auto createRealDatabase(const std::filesystem::path& dbPath) -> void {
+    auto db = infrastructure::persistence::DatabaseConnection::open(dbPath);
+    REQUIRE(db.has_value());
+    REQUIRE((*db)->execute("CREATE TABLE notes (id INTEGER PRIMARY KEY, body TEXT)").has_value());
+    REQUIRE((*db)->execute("INSERT INTO notes (body) VALUES ('backup me')").has_value());
+}
+
+} // namespace
+
 TEST_CASE("BackupService getDatabasePath returns path ending in ares.db", "[backup]") {
     application::services::BackupService service;
     auto dbPath = service.getDatabasePath();
@@ -90,12 +105,8 @@ TEST_CASE("BackupService full backup and restore cycle", "[backup]") {
     auto originalHome = std::getenv("HOME");
     setenv("HOME", tmpDir.c_str(), 1);
 
-    // Create a fake SQLite database
     auto dbPath = tmpDir / ".ares" / "ares.db";
-    {
-        std::ofstream out(dbPath, std::ios::binary);
-        out << "SQLite format 3" << std::string(85, '\0') << "test data";
-    }
+    createRealDatabase(dbPath);
 
     application::services::BackupService service;
 
@@ -105,6 +116,7 @@ TEST_CASE("BackupService full backup and restore cycle", "[backup]") {
     REQUIRE(createResult->filename.starts_with("ares-"));
     REQUIRE(createResult->filename.ends_with(".db"));
     REQUIRE(createResult->sizeBytes > 0);
+    REQUIRE(!createResult->unchanged);
     REQUIRE(std::filesystem::exists(createResult->path));
 
     // List backups
@@ -125,3 +137,98 @@ TEST_CASE("BackupService full backup and restore cycle", "[backup]") {
     // Cleanup
     std::filesystem::remove_all(tmpDir);
 }
+
+TEST_CASE("BackupService skips backup when database is unchanged", "[backup]") {
+    auto tmpDir = std::filesystem::temp_directory_path() / "ares-test-backup-skip";
+    std::filesystem::remove_all(tmpDir);
+    std::filesystem::create_directories(tmpDir / ".ares");
+
+    auto originalHome = std::getenv("HOME");
+    setenv("HOME", tmpDir.c_str(), 1);
+
+    auto dbPath = tmpDir / ".ares" / "ares.db";
+    createRealDatabase(dbPath);
+
+    application::services::BackupService service;
+
+    auto first = service.createBackup();
+    REQUIRE(first.has_value());
+    REQUIRE(!first->unchanged);
+
+    // Nothing changed: the second call reports the existing backup instead
+    // of writing a duplicate file
+    auto second = service.createBackup();
+    REQUIRE(second.has_value());
+    CHECK(second->unchanged);
+    CHECK(second->filename == first->filename);
+
+    auto listResult = service.listBackups();
+    REQUIRE(listResult.has_value());
+    CHECK(listResult->size() == 1);
+
+    // After a write the next backup is a real copy again
+    {
+        auto db = infrastructure::persistence::DatabaseConnection::open(dbPath);
+        REQUIRE(db.has_value());
+        REQUIRE((*db)->execute("INSERT INTO notes (body) VALUES ('changed')").has_value());
+    }
+
+    auto third = service.createBackup();
+    REQUIRE(third.has_value());
+    CHECK(!third->unchanged);
+
+    // Restore HOME
+    if (originalHome) {
+        setenv("HOME", originalHome, 1);
+    }
+
+    // Cleanup
+    std::filesystem::remove_all(tmpDir);
+}
+
+TEST_CASE("BackupService compressed backup and restore cycle", "[backup]") {
+    auto tmpDir = std::filesystem::temp_directory_path() / "ares-test-backup-gzip";
+    std::filesystem::remove_all(tmpDir);
+    std::filesystem::create_directories(tmpDir / ".ares");
+
+    auto originalHome = std::getenv("HOME");
+    setenv("HOME", tmpDir.c_str(), 1);
+
+    auto dbPath = tmpDir / ".ares" / "ares.db";
+    createRealDatabase(dbPath);
+
+    application::services::BackupService service;
+
+    auto createResult = service.createBackup(true);
+    REQUIRE(createResult.has_value());
+    REQUIRE(createResult->filename.ends_with(".db.gz"));
+    REQUIRE(!createResult->unchanged);
+    REQUIRE(infrastructure::compression::isGzipFile(createResult->path));
+
+    // Unchanged detection works across formats - a plain backup of the
+    // same content is skipped because fingerprints hash decompressed bytes
+    auto plainResult = service.createBackup(false);
+    REQUIRE(plainResult.has_value());
+    REQUIRE(plainResult->unchanged);
+
+    auto listResult = service.listBackups();
+    REQUIRE(listResult.has_value());
+    REQUIRE(listResult->size() == 1);
+
+    // Restore decompresses transparently
+    std::filesystem::remove(dbPath);
+    auto restoreResult = service.restore(createResult->path);
+    REQUIRE(restoreResult.has_value());
+    REQUIRE(std::filesystem::exists(dbPath));
+
+    // The restored file is a plain SQLite database again
+    std::ifstream restored(dbPath, std::ios::binary);
+    std::string header(15, '\0');
+    restored.read(header.data(), 15);
+    REQUIRE(header == "SQLite format 3");
+
+    if (originalHome) {
+        setenv("HOME", originalHome, 1);
+    }
+    std::filesystem::remove_all(tmpDir);
+}
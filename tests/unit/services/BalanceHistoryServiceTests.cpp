@@ -0,0 +1,171 @@
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <filesystem>
+#include <fmt/format.h>
+#include "application/services/BalanceHistoryService.hpp"
+#include "infrastructure/persistence/DatabaseConnection.hpp"
+#include "infrastructure/persistence/SqliteTransactionRepository.hpp"
+
+using namespace ares;
+
+namespace {
+
+auto openMemoryDb() -> std::shared_ptr<infrastructure::persistence::DatabaseConnection> {
+    auto result = infrastructure::persistence::DatabaseConnection::open(":memory:");
+    REQUIRE(result.has_value());
+    auto db = std::shared_ptr<infrastructure::persistence::DatabaseConnection>{std::move(*result)};
+    REQUIRE(db->initializeSchema().has_value());
+    return db;
+}
+
+auto makeAccount(int64_t balanceCents) -> core::Account {
+    core::Account account{core::AccountId{"acc-1"}, "Checking",
+                          "NL01INGB0000000001", core::AccountType::Checking,
+                          core::BankIdentifier::ING};
+    account.setBalance(core::Money{balanceCents, core::Currency::EUR});
+    return account;
+}
+
+auto makeTransaction(const std::string& id, int year, unsigned month, unsigned day,
+                     int64_t cents) -> core::Transaction {
+    core::Date date{std::chrono::year{year}, std::chrono::month{month},
+                    std::chrono::day{day}};
+    core::Transaction txn{core::TransactionId{id}, core::AccountId{"acc-1"}, date,
+                          core::Money{cents, core::Currency::EUR},
+                          cents < 0 ? core::TransactionType::Expense
+                                    : core::TransactionType::Income};
+    return txn;
+}
+
+} // namespace
+
+TEST_CASE("BalanceHistoryService walks month-end balances back from the anchor",
+          "[balance][history]") {
+    auto db = openMemoryDb();
+    infrastructure::persistence::SqliteTransactionRepository txnRepo{db};
+    REQUIRE(txnRepo.save(makeTransaction("t0", 2026, 6, 10, 5000)).has_value());
+    REQUIRE(txnRepo.save(makeTransaction("t1", 2026, 7, 5, -2000)).has_value());
+
+    // Live balance after both transactions
+    auto account = makeAccount(10000);
+    application::services::BalanceHistoryService service;
+    core::Date asOf{std::chrono::year{2026}, std::chrono::month{8}, std::chrono::day{28}};
+
+    auto series = service.monthEndBalances(txnRepo, account, 4, asOf);
+    REQUIRE(series.has_value());
+    REQUIRE(series->size() == 4);
+
+    // End of May predates both flows: 100.00 - (50.00 - 20.00) = 70.00
+    CHECK((*series)[0].month == 202605);
+    CHECK((*series)[0].balance.cents() == 7000);
+    // June's +50.00 has landed, July's -20.00 has not
+    CHECK((*series)[1].month == 202606);
+    CHECK((*series)[1].balance.cents() == 12000);
+    CHECK((*series)[2].month == 202607);
+    CHECK((*series)[2].balance.cents() == 10000);
+    // A month without transactions carries the balance forward
+    CHECK((*series)[3].month == 202608);
+    CHECK((*series)[3].balance.cents() == 10000);
+}
+
+TEST_CASE("BalanceHistoryService replays at most the rest of one month for a date query",
+          "[balance][history]") {
+    auto db = openMemoryDb();
+    infrastructure::persistence::SqliteTransactionRepository txnRepo{db};
+    REQUIRE(txnRepo.save(makeTransaction("t0", 2026, 7, 10, -2000)).has_value());
+    REQUIRE(txnRepo.save(makeTransaction("t1", 2026, 7, 20, -3000)).has_value());
+    REQUIRE(txnRepo.save(makeTransaction("t2", 2026, 8, 3, 1000)).has_value());
+
+    auto account = makeAccount(10000);
+    application::services::BalanceHistoryService service;
+
+    // Mid-July: t1 (July 20) and t2 (August) have not happened yet
+    core::Date midJuly{std::chrono::year{2026}, std::chrono::month{7}, std::chrono::day{15}};
+    auto balance = service.balanceAt(txnRepo, account, midJuly);
+    REQUIRE(balance.has_value());
+    CHECK(balance->cents() == 10000 - 1000 + 3000);
+
+    // On the month's last day only whole-month checkpoints apply
+    core::Date endJuly{std::chrono::year{2026}, std::chrono::month{7}, std::chrono::day{31}};
+    balance = service.balanceAt(txnRepo, account, endJuly);
+    REQUIRE(balance.has_value());
+    CHECK(balance->cents() == 10000 - 1000);
+}
+
+TEST_CASE("BalanceHistoryService month-end series spans year boundaries",
+          "[balance][history]") {
+    auto db = openMemoryDb();
+    infrastructure::persistence::SqliteTransactionRepository txnRepo{db};
+    REQUIRE(txnRepo.save(makeTransaction("t0", 2026, 1, 15, -500)).has_value());
+
+    auto account = makeAccount(2000);
+    application::services::BalanceHistoryService service;
+    core::Date asOf{std::chrono::year{2026}, std::chrono::month{2}, std::chrono::day{1}};
+
+    auto series = service.monthEndBalances(txnRepo, account, 3, asOf);
+    REQUIRE(series.has_value());
+    REQUIRE(series->size() == 3);
+    CHECK((*series)[0].month == 202512);
+    CHECK((*series)[0].balance.cents() == 2500);
+    CHECK((*series)[1].month == 202601);
+    CHECK((*series)[1].balance.cents() == 2000);
+    CHECK((*series)[2].month == 202602);
+    CHECK((*series)[2].balance.cents() == 2000);
+}
+
+TEST_CASE("BalanceHistoryService gathers multi-account series over the read pool",
+          "[balance][history]") {
+    auto path = std::filesystem::temp_directory_path() / "ares_balance_history_test.db";
+    std::filesystem::remove(path);
+    auto opened = infrastructure::persistence::DatabaseConnection::open(path);
+    REQUIRE(opened.has_value());
+    auto db = std::shared_ptr<infrastructure::persistence::DatabaseConnection>{std::move(*opened)};
+    REQUIRE(db->initializeSchema().has_value());
+    infrastructure::persistence::SqliteTransactionRepository txnRepo{db};
+
+    std::vector<core::Account> accounts;
+    for (int i = 0; i < 4; ++i) {
+        core::Account account{core::AccountId{fmt::format("acc-{}", i)},
+                              fmt::format("Account {}", i),
+                              fmt::format("NL01INGB000000000{}", i),
+                              core::AccountType::Checking,
+                              core::BankIdentifier::ING};
+        account.setBalance(core::Money{10000 * (i + 1), core::Currency::EUR});
+        accounts.push_back(account);
+
+        core::Date june{std::chrono::year{2026}, std::chrono::month{6}, std::chrono::day{10}};
+        core::Transaction txn{core::TransactionId{fmt::format("t-{}", i)},
+                              account.id(), june,
+                              core::Money{-1000 * (i + 1), core::Currency::EUR},
+                              core::TransactionType::Expense};
+        REQUIRE(txnRepo.save(txn).has_value());
+    }
+
+    infrastructure::persistence::ReadConnectionPool pool{path, 2};
+    application::services::BalanceHistoryService service;
+    core::Date asOf{std::chrono::year{2026}, std::chrono::month{7}, std::chrono::day{1}};
+
+    auto histories = service.monthEndBalancesForAccounts(txnRepo, pool, accounts, 2, asOf);
+    REQUIRE(histories.has_value());
+    REQUIRE(histories->size() == accounts.size());
+
+    for (std::size_t i = 0; i < histories->size(); ++i) {
+        const auto& history = (*histories)[i];
+        // Input order is preserved across the parallel shards
+        CHECK(history.account.id().value == accounts[i].id().value);
+        REQUIRE(history.series.size() == 2);
+        // End of May predates the June expense
+        auto anchor = accounts[i].balance().cents();
+        auto flow = -1000 * static_cast<int64_t>(i + 1);
+        CHECK(history.series[0].month == 202605);
+        CHECK(history.series[0].balance.cents() == anchor - flow);
+        CHECK(history.series[1].month == 202606);
+        CHECK(history.series[1].balance.cents() == anchor);
+    }
+
+    db.reset();
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+    std::filesystem::remove(path.string() + "-wal", ec);
+    std::filesystem::remove(path.string() + "-shm", ec);
+}
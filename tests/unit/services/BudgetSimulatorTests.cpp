@@ -0,0 +1,140 @@
+#include <catch2/catch_test_macros.hpp>
+#include "application/services/BudgetSimulator.hpp"
+#include "infrastructure/persistence/DatabaseConnection.hpp"
+#include "infrastructure/persistence/SqliteTransactionRepository.hpp"
+
+using namespace ares;
+using namespace ares::application::services;
+using namespace ares::infrastructure::persistence;
+
+namespace {
+
+auto createInMemoryDb() -> std::shared_ptr<DatabaseConnection> {
+    auto result = DatabaseConnection::open(":memory:");
+    REQUIRE(result.has_value());
+    auto db = std::shared_ptr<DatabaseConnection>(std::move(*result));
+    auto schema = db->initializeSchema();
+    REQUIRE(schema.has_value());
+    return db;
+}
+
+auto makePattern(std::string id, std::string counterparty, int64_t cents,
+                 core::TransactionCategory category) -> core::RecurringPattern {
+    core::RecurringPattern pattern{core::RecurringPatternId{std::move(id)},
+                                   std::move(counterparty),
+                                   core::Money{cents, core::Currency::EUR},
+                                   core::RecurrenceFrequency::Monthly};
+    pattern.setCategory(category);
+    return pattern;
+}
+
+auto makeLoan(int64_t balanceCents, int64_t paymentCents, double rate) -> core::Credit {
+    core::Credit credit{core::CreditId{"loan-1"}, "KfW Student Loan",
+                        core::CreditType::StudentLoan,
+                        core::Money{balanceCents}, core::Money{balanceCents}, rate};
+    credit.setMinimumPayment(core::Money{paymentCents});
+    return credit;
+}
+
+constexpr core::Date kAsOf{std::chrono::year{2026}, std::chrono::month{8}, std::chrono::day{28}};
+
+auto primeSimulator(std::vector<core::Credit> credits = {makeLoan(500000, 10000, 0.04)})
+    -> BudgetSimulator
+{
+    auto db = createInMemoryDb();
+    SqliteTransactionRepository repo{db};
+
+    std::vector<core::RecurringPattern> patterns;
+    patterns.push_back(makePattern("p-salary", "Employer", 300000,
+                                   core::TransactionCategory::Salary));
+    patterns.push_back(makePattern("p-rent", "Landlord", -100000,
+                                   core::TransactionCategory::Housing));
+    patterns.push_back(makePattern("p-netflix", "Netflix", -1299,
+                                   core::TransactionCategory::Subscriptions));
+    patterns.push_back(makePattern("p-spotify", "Spotify AB", -999,
+                                   core::TransactionCategory::Subscriptions));
+
+    auto simulator = BudgetSimulator::prime(repo, std::move(patterns), std::move(credits), kAsOf);
+    REQUIRE(simulator.has_value());
+    return std::move(*simulator);
+}
+
+} // namespace
+
+TEST_CASE("BudgetSimulator empty scenario reproduces the baseline", "[simulator]") {
+    auto simulator = primeSimulator();
+    auto result = simulator.evaluate(Scenario{});
+
+    CHECK(result.netCashFlow.cents() == simulator.baseline().netCashFlow.cents());
+    CHECK(result.availableForSavings.cents() ==
+          simulator.baseline().availableForSavings.cents());
+    CHECK(result.savingsDelta.cents() == 0);
+    CHECK(result.creditOutcomes.empty());
+    CHECK(result.warnings.empty());
+}
+
+TEST_CASE("BudgetSimulator cancelling subscriptions frees their monthly cost", "[simulator]") {
+    auto simulator = primeSimulator();
+
+    Scenario scenario;
+    scenario.changes.push_back({ScenarioChange::Kind::CancelPattern, "netflix", {}});
+    scenario.changes.push_back({ScenarioChange::Kind::CancelPattern, "SPOTIFY", {}});
+    auto result = simulator.evaluate(scenario);
+
+    CHECK(result.savingsDelta.cents() == 1299 + 999);
+    CHECK(result.warnings.empty());
+
+    // An unknown counterparty warns instead of failing
+    scenario.changes.push_back({ScenarioChange::Kind::CancelPattern, "Gym", {}});
+    result = simulator.evaluate(scenario);
+    REQUIRE(result.warnings.size() == 1);
+}
+
+TEST_CASE("BudgetSimulator extra debt payment shortens the payoff", "[simulator]") {
+    auto simulator = primeSimulator();
+
+    Scenario scenario;
+    scenario.changes.push_back({ScenarioChange::Kind::ExtraDebtPayment, "kfw",
+                                core::Money{20000, core::Currency::EUR}});
+    auto result = simulator.evaluate(scenario);
+
+    // The extra 200 EUR comes out of monthly savings...
+    CHECK(result.savingsDelta.cents() == -20000);
+
+    // ...and shortens the loan with interest to match
+    REQUIRE(result.creditOutcomes.size() == 1);
+    const auto& outcome = result.creditOutcomes[0];
+    CHECK(outcome.creditName == "KfW Student Loan");
+    CHECK(outcome.monthlyPayment.cents() == 30000);
+    CHECK(outcome.payoffReachable);
+    CHECK(outcome.monthsToPayoff < outcome.baselineMonths);
+    CHECK(outcome.interestSavedCents > 0);
+}
+
+TEST_CASE("BudgetSimulator added income and expenses shift the cash flow", "[simulator]") {
+    auto simulator = primeSimulator();
+
+    Scenario scenario;
+    scenario.changes.push_back({ScenarioChange::Kind::AddMonthlyIncome, "Side gig",
+                                core::Money{50000, core::Currency::EUR}});
+    scenario.changes.push_back({ScenarioChange::Kind::AddMonthlyExpense, "Gym",
+                                core::Money{2999, core::Currency::EUR}});
+    auto result = simulator.evaluate(scenario);
+
+    CHECK(result.savingsDelta.cents() == 50000 - 2999);
+}
+
+TEST_CASE("BudgetSimulator ignores paid-off credits", "[simulator]") {
+    auto paidOff = makeLoan(0, 10000, 0.04);
+    auto simulator = primeSimulator({paidOff});
+
+    Scenario scenario;
+    scenario.changes.push_back({ScenarioChange::Kind::ExtraDebtPayment, "kfw",
+                                core::Money{10000, core::Currency::EUR}});
+    auto result = simulator.evaluate(scenario);
+
+    // No active balance to pay down - the change warns and costs nothing
+    CHECK(result.savingsDelta.cents() == 0);
+    CHECK(result.creditOutcomes.empty());
+    REQUIRE(result.warnings.size() == 1);
+}
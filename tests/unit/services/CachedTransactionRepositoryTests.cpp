@@ -0,0 +1,270 @@
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include "application/services/CachedTransactionRepository.hpp"
+
+using namespace ares;
+
+namespace {
+
+// In-memory repository that counts the queries reaching it
+class CountingRepository : public core::TransactionRepository {
+public:
+    int rangeQueries{0};
+    int findAllQueries{0};
+    int searchQueries{0};
+    std::string lastSearchQuery;
+    int lastSearchLimit{0};
+
+    auto save(const core::Transaction& transaction) -> std::expected<void, core::Error> override {
+        rows_.push_back(transaction);
+        return {};
+    }
+    auto saveBatch(const std::vector<core::Transaction>& transactions)
+        -> std::expected<void, core::Error> override {
+        rows_.insert(rows_.end(), transactions.begin(), transactions.end());
+        return {};
+    }
+    auto findById(const core::TransactionId& id)
+        -> std::expected<std::optional<core::Transaction>, core::Error> override {
+        auto it = std::find_if(rows_.begin(), rows_.end(),
+            [&](const auto& txn) { return txn.id() == id; });
+        if (it == rows_.end()) return std::optional<core::Transaction>{};
+        return std::optional<core::Transaction>{*it};
+    }
+    auto findByAccount(const core::AccountId& accountId)
+        -> std::expected<std::vector<core::Transaction>, core::Error> override {
+        std::vector<core::Transaction> result;
+        for (const auto& txn : rows_) {
+            if (txn.accountId() == accountId) result.push_back(txn);
+        }
+        return result;
+    }
+    auto findByDateRange(const core::AccountId& accountId, core::Date from, core::Date to)
+        -> std::expected<std::vector<core::Transaction>, core::Error> override {
+        ++rangeQueries;
+        std::vector<core::Transaction> result;
+        for (const auto& txn : rows_) {
+            if (txn.accountId() == accountId && txn.date() >= from && txn.date() <= to) {
+                result.push_back(txn);
+            }
+        }
+        return result;
+    }
+    auto findByCategory(core::TransactionCategory)
+        -> std::expected<std::vector<core::Transaction>, core::Error> override {
+        return std::vector<core::Transaction>{};
+    }
+    auto findAll() -> std::expected<std::vector<core::Transaction>, core::Error> override {
+        ++findAllQueries;
+        return rows_;
+    }
+    auto remove(const core::TransactionId& id) -> std::expected<void, core::Error> override {
+        std::erase_if(rows_, [&](const auto& txn) { return txn.id() == id; });
+        return {};
+    }
+    auto update(const core::Transaction& transaction) -> std::expected<void, core::Error> override {
+        for (auto& txn : rows_) {
+            if (txn.id() == transaction.id()) txn = transaction;
+        }
+        return {};
+    }
+    auto forEach(const core::TransactionRepository::TransactionVisitor& visitor)
+        -> std::expected<void, core::Error> override {
+        for (const auto& txn : rows_) visitor(txn);
+        return {};
+    }
+    auto forEachInDateRange(core::Date from, core::Date to,
+                            const core::TransactionRepository::TransactionVisitor& visitor)
+        -> std::expected<void, core::Error> override {
+        for (const auto& txn : rows_) {
+            if (txn.date() >= from && txn.date() <= to) visitor(txn);
+        }
+        return {};
+    }
+    auto forEachFiltered(const core::TransactionRepository::Filter& filter,
+                         const core::TransactionRepository::TransactionVisitor& visitor)
+        -> std::expected<void, core::Error> override {
+        for (const auto& txn : rows_) {
+            if (filter.from && txn.date() < *filter.from) continue;
+            if (filter.to && txn.date() > *filter.to) continue;
+            if (filter.category && txn.category() != *filter.category) continue;
+            visitor(txn);
+        }
+        return {};
+    }
+    auto findPage(int, const std::optional<core::TransactionRepository::PageCursor>&,
+                  const std::optional<core::TransactionRepository::PageCursor>&)
+        -> std::expected<std::vector<core::Transaction>, core::Error> override {
+        return std::vector<core::Transaction>{};
+    }
+    auto search(const std::string& query, int limit)
+        -> std::expected<std::vector<core::Transaction>, core::Error> override {
+        ++searchQueries;
+        lastSearchQuery = query;
+        lastSearchLimit = limit;
+        return rows_;
+    }
+    auto findColumnsByDateRange(core::Date, core::Date)
+        -> std::expected<core::TransactionColumns, core::Error> override {
+        return core::TransactionColumns{};
+    }
+    auto findAmountsByDateRange(core::Date, core::Date)
+        -> std::expected<std::vector<core::TransactionAmount>, core::Error> override {
+        return std::vector<core::TransactionAmount>{};
+    }
+    auto aggregateByCategory(core::Date, core::Date)
+        -> std::expected<std::vector<core::CategoryAggregate>, core::Error> override {
+        return std::vector<core::CategoryAggregate>{};
+    }
+    auto aggregateByMonthAndCategory(int)
+        -> std::expected<std::vector<core::MonthlyCategoryAggregate>, core::Error> override {
+        return std::vector<core::MonthlyCategoryAggregate>{};
+    }
+
+private:
+    std::vector<core::Transaction> rows_;
+};
+
+auto makeTransaction(const std::string& id, int year, unsigned month, unsigned day,
+                     int64_t cents) -> core::Transaction {
+    core::Date date{std::chrono::year{year}, std::chrono::month{month}, std::chrono::day{day}};
+    return core::Transaction{core::TransactionId{id}, core::AccountId{"acc-1"}, date,
+                             core::Money{cents, core::Currency::EUR},
+                             core::TransactionType::Expense};
+}
+
+} // namespace
+
+TEST_CASE("CachedTransactionRepository serves repeated month reads from cache", "[cache]") {
+    CountingRepository inner;
+    REQUIRE(inner.save(makeTransaction("t1", 2026, 3, 10, -4250)).has_value());
+    REQUIRE(inner.save(makeTransaction("t2", 2026, 3, 20, -899)).has_value());
+
+    application::services::CachedTransactionRepository cached{inner};
+
+    core::Date from{std::chrono::year{2026}, std::chrono::month{3}, std::chrono::day{1}};
+    core::Date to{std::chrono::year{2026}, std::chrono::month{3}, std::chrono::day{31}};
+
+    auto first = cached.findByDateRange(core::AccountId{"acc-1"}, from, to);
+    REQUIRE(first.has_value());
+    CHECK(first->size() == 2);
+    CHECK(inner.rangeQueries == 1);
+
+    auto second = cached.findByDateRange(core::AccountId{"acc-1"}, from, to);
+    REQUIRE(second.has_value());
+    CHECK(second->size() == 2);
+    CHECK(inner.rangeQueries == 1);
+}
+
+TEST_CASE("CachedTransactionRepository filters sub-month ranges from month slices", "[cache]") {
+    CountingRepository inner;
+    REQUIRE(inner.save(makeTransaction("t1", 2026, 3, 5, -100)).has_value());
+    REQUIRE(inner.save(makeTransaction("t2", 2026, 3, 25, -200)).has_value());
+
+    application::services::CachedTransactionRepository cached{inner};
+
+    core::Date from{std::chrono::year{2026}, std::chrono::month{3}, std::chrono::day{1}};
+    core::Date mid{std::chrono::year{2026}, std::chrono::month{3}, std::chrono::day{15}};
+
+    auto firstHalf = cached.findByDateRange(core::AccountId{"acc-1"}, from, mid);
+    REQUIRE(firstHalf.has_value());
+    REQUIRE(firstHalf->size() == 1);
+    CHECK((*firstHalf)[0].id().value == "t1");
+}
+
+TEST_CASE("CachedTransactionRepository spans month boundaries", "[cache]") {
+    CountingRepository inner;
+    REQUIRE(inner.save(makeTransaction("t1", 2026, 2, 28, -100)).has_value());
+    REQUIRE(inner.save(makeTransaction("t2", 2026, 3, 1, -200)).has_value());
+
+    application::services::CachedTransactionRepository cached{inner};
+
+    core::Date from{std::chrono::year{2026}, std::chrono::month{2}, std::chrono::day{1}};
+    core::Date to{std::chrono::year{2026}, std::chrono::month{3}, std::chrono::day{31}};
+
+    auto both = cached.findByDateRange(core::AccountId{"acc-1"}, from, to);
+    REQUIRE(both.has_value());
+    CHECK(both->size() == 2);
+    CHECK(inner.rangeQueries == 2);  // one fetch per month slice
+}
+
+TEST_CASE("CachedTransactionRepository invalidates the written month", "[cache]") {
+    CountingRepository inner;
+    REQUIRE(inner.save(makeTransaction("t1", 2026, 3, 10, -100)).has_value());
+
+    application::services::CachedTransactionRepository cached{inner};
+
+    core::Date marchFrom{std::chrono::year{2026}, std::chrono::month{3}, std::chrono::day{1}};
+    core::Date marchTo{std::chrono::year{2026}, std::chrono::month{3}, std::chrono::day{31}};
+    core::Date aprilFrom{std::chrono::year{2026}, std::chrono::month{4}, std::chrono::day{1}};
+    core::Date aprilTo{std::chrono::year{2026}, std::chrono::month{4}, std::chrono::day{30}};
+
+    REQUIRE(cached.findByDateRange(core::AccountId{"acc-1"}, marchFrom, marchTo).has_value());
+    REQUIRE(cached.findByDateRange(core::AccountId{"acc-1"}, aprilFrom, aprilTo).has_value());
+    CHECK(inner.rangeQueries == 2);
+
+    // Write into March: March is refetched, April stays cached
+    REQUIRE(cached.save(makeTransaction("t2", 2026, 3, 12, -200)).has_value());
+
+    auto march = cached.findByDateRange(core::AccountId{"acc-1"}, marchFrom, marchTo);
+    REQUIRE(march.has_value());
+    CHECK(march->size() == 2);
+    CHECK(inner.rangeQueries == 3);
+
+    REQUIRE(cached.findByDateRange(core::AccountId{"acc-1"}, aprilFrom, aprilTo).has_value());
+    CHECK(inner.rangeQueries == 3);
+}
+
+TEST_CASE("CachedTransactionRepository caches findAll and invalidates on writes", "[cache]") {
+    CountingRepository inner;
+    REQUIRE(inner.save(makeTransaction("t1", 2026, 3, 10, -100)).has_value());
+
+    application::services::CachedTransactionRepository cached{inner};
+
+    REQUIRE(cached.findAll().has_value());
+    REQUIRE(cached.findAll().has_value());
+    CHECK(inner.findAllQueries == 1);
+
+    REQUIRE(cached.save(makeTransaction("t2", 2026, 4, 1, -200)).has_value());
+
+    auto all = cached.findAll();
+    REQUIRE(all.has_value());
+    CHECK(all->size() == 2);
+    CHECK(inner.findAllQueries == 2);
+}
+
+TEST_CASE("CachedTransactionRepository passes search straight through", "[cache]") {
+    CountingRepository inner;
+    REQUIRE(inner.save(makeTransaction("t1", 2026, 3, 10, -100)).has_value());
+
+    application::services::CachedTransactionRepository cached{inner};
+
+    auto hits = cached.search("rewe", 5);
+    REQUIRE(hits.has_value());
+    CHECK(hits->size() == 1);
+    CHECK(inner.lastSearchQuery == "rewe");
+    CHECK(inner.lastSearchLimit == 5);
+
+    // FTS results are not month-sliceable, so repeats hit the inner
+    // repository every time
+    REQUIRE(cached.search("rewe", 5).has_value());
+    CHECK(inner.searchQueries == 2);
+}
+
+TEST_CASE("CachedTransactionRepository clears everything on remove", "[cache]") {
+    CountingRepository inner;
+    REQUIRE(inner.save(makeTransaction("t1", 2026, 3, 10, -100)).has_value());
+
+    application::services::CachedTransactionRepository cached{inner};
+
+    core::Date from{std::chrono::year{2026}, std::chrono::month{3}, std::chrono::day{1}};
+    core::Date to{std::chrono::year{2026}, std::chrono::month{3}, std::chrono::day{31}};
+    REQUIRE(cached.findByDateRange(core::AccountId{"acc-1"}, from, to).has_value());
+
+    REQUIRE(cached.remove(core::TransactionId{"t1"}).has_value());
+
+    auto after = cached.findByDateRange(core::AccountId{"acc-1"}, from, to);
+    REQUIRE(after.has_value());
+    CHECK(after->empty());
+    CHECK(inner.rangeQueries == 2);
+}
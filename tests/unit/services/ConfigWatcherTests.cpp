@@ -0,0 +1,102 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include "application/services/ConfigWatcher.hpp"
+
+using namespace ares::application::services;
+
+namespace {
+
+// Point both the config resolution (HOME) and the binary config cache
+// (XDG_CACHE_HOME) at a private directory, and reset the process-global
+// watcher so tests observe fresh generations
+struct WatcherEnvGuard {
+    std::filesystem::path dir;
+
+    WatcherEnvGuard() {
+        dir = std::filesystem::temp_directory_path() / "ares-test-config-watcher";
+        std::filesystem::remove_all(dir);
+        std::filesystem::create_directories(dir / ".ares");
+        setenv("HOME", dir.c_str(), 1);
+        setenv("XDG_CACHE_HOME", (dir / "cache").c_str(), 1);
+        ConfigWatcher::shared().invalidate();
+    }
+
+    ~WatcherEnvGuard() {
+        unsetenv("HOME");
+        unsetenv("XDG_CACHE_HOME");
+        ConfigWatcher::shared().invalidate();
+        std::filesystem::remove_all(dir);
+    }
+
+    [[nodiscard]] auto configPath() const -> std::filesystem::path {
+        return dir / ".ares" / "config.yaml";
+    }
+
+    auto writeConfig(std::string_view content) const -> void {
+        std::ofstream file{configPath(), std::ios::trunc};
+        file << content;
+    }
+};
+
+} // anonymous namespace
+
+TEST_CASE("ConfigWatcher serves the same snapshot while the file is unchanged",
+          "[config][watcher]") {
+    WatcherEnvGuard env;
+    env.writeConfig("categorization:\n  - pattern: rewe\n    category: groceries\n");
+
+    auto first = ConfigWatcher::shared().snapshot();
+    auto second = ConfigWatcher::shared().snapshot();
+
+    REQUIRE(first != nullptr);
+    CHECK(first == second);
+    CHECK(first->generation == second->generation);
+    REQUIRE(first->compiledRules != nullptr);
+    CHECK(first->compiledRules->size() == 1);
+}
+
+TEST_CASE("ConfigWatcher reloads when the config changes", "[config][watcher]") {
+    WatcherEnvGuard env;
+    env.writeConfig("categorization:\n  - pattern: rewe\n    category: groceries\n");
+
+    auto before = ConfigWatcher::shared().snapshot();
+    // Different size so the fingerprint changes even within the mtime
+    // granularity of the filesystem
+    env.writeConfig("categorization:\n"
+                    "  - pattern: rewe\n    category: groceries\n"
+                    "  - pattern: aldi\n    category: groceries\n");
+    auto after = ConfigWatcher::shared().snapshot();
+
+    CHECK(after->generation > before->generation);
+    CHECK(after->compiledRules->size() == 2);
+    // The earlier snapshot stays valid and untouched
+    CHECK(before->compiledRules->size() == 1);
+}
+
+TEST_CASE("ConfigWatcher keeps the warm rule set across rule-neutral edits",
+          "[config][watcher]") {
+    WatcherEnvGuard env;
+    env.writeConfig("categorization:\n  - pattern: rewe\n    category: groceries\n");
+
+    auto before = ConfigWatcher::shared().snapshot();
+    env.writeConfig("# a comment the rules do not care about\n"
+                    "categorization:\n  - pattern: rewe\n    category: groceries\n");
+    auto after = ConfigWatcher::shared().snapshot();
+
+    CHECK(after->generation > before->generation);
+    // Identical rules -> the compiled set is shared, not rebuilt
+    CHECK(after->compiledRules == before->compiledRules);
+}
+
+TEST_CASE("ConfigWatcher yields an empty snapshot without a config",
+          "[config][watcher]") {
+    WatcherEnvGuard env;
+
+    auto snapshot = ConfigWatcher::shared().snapshot();
+    REQUIRE(snapshot != nullptr);
+    CHECK(snapshot->config.isEmpty());
+    REQUIRE(snapshot->compiledRules != nullptr);
+    CHECK(snapshot->compiledRules->empty());
+}
@@ -1,4 +1,5 @@
 #include <catch2/catch_test_macros.hpp>
+#include <fmt/format.h>
 #include "application/services/DuplicateDetector.hpp"
 
 using namespace ares;
@@ -68,6 +69,57 @@ TEST_CASE("DuplicateDetector isDuplicate checks single transaction", "[duplicate
     CHECK(result.has_value());
 }
 
+TEST_CASE("DuplicateDetector finds pairs across bucket boundaries", "[duplicates]") {
+    // The bucketed scan groups by (amount window, date window); pairs at
+    // exactly the tolerance sit in adjacent buckets and must still be found
+    DuplicateDetector detector({.dateWindowDays = 2, .amountToleranceCents = 100});
+    std::vector<core::Transaction> txns = {
+        makeTxn("t1", "2024-01-15", -5000, "REWE"),
+        makeTxn("t2", "2024-01-17", -5100, "REWE"),  // exactly at both tolerances
+        makeTxn("t3", "2024-01-18", -5000, "REWE"),  // one day too far from t1
+        makeTxn("t4", "2024-01-15", -4899, "REWE"),  // one cent too far from t1
+    };
+
+    auto duplicates = detector.findDuplicates(txns);
+    REQUIRE(duplicates.size() == 2);  // t1-t2 and t2-t3
+    for (const auto& candidate : duplicates) {
+        CHECK(candidate.confidence >= 0.5);
+    }
+}
+
+TEST_CASE("DuplicateDetector handles negative and positive amounts near zero", "[duplicates]") {
+    // Amounts either side of zero land in different floor buckets but are
+    // within tolerance of each other
+    DuplicateDetector detector({.amountToleranceCents = 100});
+    std::vector<core::Transaction> txns = {
+        makeTxn("t1", "2024-01-15", -50, "REWE"),
+        makeTxn("t2", "2024-01-15", 50, "REWE"),
+    };
+
+    auto duplicates = detector.findDuplicates(txns);
+    REQUIRE(duplicates.size() == 1);
+}
+
+TEST_CASE("DuplicateDetector parallel scan matches sequential results", "[duplicates]") {
+    std::vector<core::Transaction> txns;
+    for (int i = 0; i < 40; ++i) {
+        txns.push_back(makeTxn(fmt::format("t{}", i),
+                               fmt::format("2024-01-{:02d}", 1 + i % 28),
+                               -1000 - (i % 5), "REWE"));
+    }
+
+    DuplicateDetector sequential({.amountToleranceCents = 2, .workerCount = 1});
+    DuplicateDetector parallel({.amountToleranceCents = 2, .workerCount = 4});
+
+    auto expected = sequential.findDuplicates(txns);
+    auto actual = parallel.findDuplicates(txns);
+
+    REQUIRE(actual.size() == expected.size());
+    for (std::size_t i = 0; i < actual.size(); ++i) {
+        CHECK(actual[i].confidence == expected[i].confidence);
+    }
+}
+
 TEST_CASE("DuplicateDetector handles empty input", "[duplicates]") {
     DuplicateDetector detector;
     std::vector<core::Transaction> txns;
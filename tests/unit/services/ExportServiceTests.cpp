@@ -1,5 +1,10 @@
 #include <catch2/catch_test_macros.hpp>
+#include <fstream>
+#include <sstream>
 #include "application/services/ExportService.hpp"
+#include "infrastructure/compression/Gzip.hpp"
+#include "infrastructure/persistence/DatabaseConnection.hpp"
+#include "infrastructure/persistence/SqliteTransactionRepository.hpp"
 
 using namespace ares;
 using namespace ares::application::services;
@@ -83,3 +88,128 @@ TEST_CASE("ExportService empty transactions", "[export]") {
     auto json = service.toJsonString(txns);
     CHECK(json.find("\"count\":0") != std::string::npos);
 }
+
+TEST_CASE("ExportService streaming writers match the string builders", "[export]") {
+    auto dbResult = infrastructure::persistence::DatabaseConnection::open(":memory:");
+    REQUIRE(dbResult.has_value());
+    auto db = std::shared_ptr<infrastructure::persistence::DatabaseConnection>(std::move(*dbResult));
+    REQUIRE(db->initializeSchema().has_value());
+    infrastructure::persistence::SqliteTransactionRepository repo{db};
+
+    for (int i = 0; i < 40; ++i) {
+        auto txn = makeTransaction(i % 2 ? "2024-02-10" : "2024-01-05",
+                                   i % 2 ? -1250 : 300000,
+                                   i % 2 ? core::TransactionCategory::Groceries
+                                         : core::TransactionCategory::Salary,
+                                   "Markt, \"GmbH\"");
+        core::Transaction stored{core::TransactionId{"t" + std::to_string(i)}, txn.accountId(),
+                                 txn.date(), txn.amount(), txn.type()};
+        stored.setCategory(txn.category());
+        stored.setCounterpartyName(txn.counterpartyName().value_or(""));
+        REQUIRE(repo.save(stored).has_value());
+    }
+
+    ExportService service;
+    auto tmpDir = std::filesystem::temp_directory_path();
+
+    SECTION("CSV output is identical to toCsvString") {
+        auto path = tmpDir / "ares_export_stream_test.csv";
+        auto written = service.exportCsv(repo, {}, path);
+        REQUIRE(written.has_value());
+        CHECK(*written == 40);
+
+        auto all = repo.findAll();
+        REQUIRE(all.has_value());
+        std::ifstream in{path};
+        std::stringstream content;
+        content << in.rdbuf();
+        CHECK(content.str() == service.toCsvString(*all));
+        std::filesystem::remove(path);
+    }
+
+    SECTION("JSON rows match toJsonString, count trails the array") {
+        auto path = tmpDir / "ares_export_stream_test.json";
+        auto written = service.exportJson(repo, {}, path);
+        REQUIRE(written.has_value());
+        CHECK(*written == 40);
+
+        std::ifstream in{path};
+        std::stringstream content;
+        content << in.rdbuf();
+        auto json = content.str();
+        CHECK(json.find("\"count\":40}") != std::string::npos);
+
+        auto all = repo.findAll();
+        REQUIRE(all.has_value());
+        auto expected = service.toJsonString(*all);
+        auto arrayOf = [](const std::string& s) {
+            auto begin = s.find('[');
+            auto end = s.rfind(']');
+            return s.substr(begin, end - begin + 1);
+        };
+        CHECK(arrayOf(json) == arrayOf(expected));
+        std::filesystem::remove(path);
+    }
+
+    SECTION("A .gz output path compresses the stream") {
+        auto path = tmpDir / "ares_export_stream_test.csv.gz";
+        auto written = service.exportCsv(repo, {}, path);
+        REQUIRE(written.has_value());
+        CHECK(*written == 40);
+        CHECK(infrastructure::compression::isGzipFile(path));
+
+        auto plainPath = tmpDir / "ares_export_stream_roundtrip.csv";
+        REQUIRE(infrastructure::compression::decompressFile(path, plainPath).has_value());
+        auto all = repo.findAll();
+        REQUIRE(all.has_value());
+        std::ifstream in{plainPath};
+        std::stringstream content;
+        content << in.rdbuf();
+        CHECK(content.str() == service.toCsvString(*all));
+        std::filesystem::remove(path);
+        std::filesystem::remove(plainPath);
+    }
+
+    SECTION("exportAll writes both formats from one pass") {
+        auto csvPath = tmpDir / "ares_export_all_test.csv";
+        auto jsonPath = tmpDir / "ares_export_all_test.json";
+        ExportService::ExportTargets targets;
+        targets.csvPath = csvPath;
+        targets.jsonPath = jsonPath;
+
+        auto written = service.exportAll(repo, {}, targets);
+        REQUIRE(written.has_value());
+        CHECK(*written == 40);
+
+        auto slurp = [](const std::filesystem::path& p) {
+            std::ifstream in{p};
+            std::stringstream content;
+            content << in.rdbuf();
+            return content.str();
+        };
+
+        auto all = repo.findAll();
+        REQUIRE(all.has_value());
+        CHECK(slurp(csvPath) == service.toCsvString(*all));
+        CHECK(slurp(jsonPath).find("\"count\":40}") != std::string::npos);
+        std::filesystem::remove(csvPath);
+        std::filesystem::remove(jsonPath);
+    }
+
+    SECTION("Filter predicates push down into the query") {
+        auto path = tmpDir / "ares_export_stream_filter.csv";
+        ExportFilter filter;
+        filter.category = core::TransactionCategory::Salary;
+        auto written = service.exportCsv(repo, filter, path);
+        REQUIRE(written.has_value());
+        CHECK(*written == 20);
+
+        filter.fromDate = core::Date{std::chrono::year{2024}, std::chrono::month{2},
+                                     std::chrono::day{1}};
+        filter.category.reset();
+        written = service.exportCsv(repo, filter, path);
+        REQUIRE(written.has_value());
+        CHECK(*written == 20);  // only the February rows
+        std::filesystem::remove(path);
+    }
+}
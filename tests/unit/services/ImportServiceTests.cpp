@@ -185,3 +185,28 @@ TEST_CASE("ImportService importFromFile with single transaction CSV", "[import-s
 
     cleanupTempFiles();
 }
+
+TEST_CASE("ImportService importFromFile reports progress per chunk", "[import-service]") {
+    auto db = createInMemoryDb();
+    auto filePath = writeTempCsv(sampleIngDeCsv);
+
+    std::vector<ImportProgress> updates;
+    ImportService service;
+    auto result = service.importFromFile(filePath, db, std::nullopt,
+        [&updates](const ImportProgress& progress) { updates.push_back(progress); });
+
+    REQUIRE(result.has_value());
+    REQUIRE_FALSE(updates.empty());
+
+    // Rows parsed grows monotonically and ends at the import total
+    for (std::size_t i = 1; i < updates.size(); ++i) {
+        CHECK(updates[i].rowsParsed >= updates[i - 1].rowsParsed);
+    }
+    CHECK(updates.back().rowsParsed == result->totalRows);
+    CHECK(updates.back().newTransactions == result->newTransactions);
+
+    // The newline count bounds the data rows from above
+    CHECK(updates.back().estimatedTotalRows >= result->totalRows);
+
+    cleanupTempFiles();
+}
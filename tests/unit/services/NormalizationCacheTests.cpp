@@ -0,0 +1,64 @@
+#include <catch2/catch_test_macros.hpp>
+#include <fmt/format.h>
+#include "application/services/NormalizationCache.hpp"
+#include "core/common/TextNormalize.hpp"
+
+using namespace ares;
+using application::services::NormalizationCache;
+
+TEST_CASE("NormalizationCache matches the kernels it memoizes", "[normcache]") {
+    NormalizationCache cache;
+
+    std::string expected;
+    core::text::lowercaseCollapseSpacesInto("  REWE   Markt GmbH ", expected);
+    CHECK(cache.collapsedSpaces("  REWE   Markt GmbH ") == expected);
+
+    core::text::lowercaseStripSpacesInto("Sony Int eractive", expected);
+    CHECK(cache.strippedSpaces("Sony Int eractive") == expected);
+
+    core::text::lowercaseAlnumWordsInto("REWE-Markt GmbH & Co.", expected);
+    CHECK(cache.alnumWords("REWE-Markt GmbH & Co.") == expected);
+}
+
+TEST_CASE("NormalizationCache stores one entry per distinct input", "[normcache]") {
+    NormalizationCache cache;
+
+    for (int i = 0; i < 100; ++i) {
+        (void)cache.collapsedSpaces("REWE Markt");
+        (void)cache.collapsedSpaces("EDEKA Center");
+    }
+
+    CHECK(cache.size() == 2);
+}
+
+TEST_CASE("NormalizationCache returns stable references", "[normcache]") {
+    NormalizationCache cache;
+
+    const auto& first = cache.collapsedSpaces("Netflix International B.V.");
+    // Force growth well past the initial bucket count
+    for (int i = 0; i < 200; ++i) {
+        (void)cache.collapsedSpaces(fmt::format("counterparty-{}", i));
+    }
+
+    CHECK(first == "netflix international b.v.");
+}
+
+TEST_CASE("Token signatures bridge ING column-break spellings", "[normcache]") {
+    using application::services::computeTokenSignature;
+    using application::services::tokenSignaturesMatch;
+
+    auto broken = computeTokenSignature("Sony Int eractive");
+    auto abbreviated = computeTokenSignature("SONY INTERACTIVE ENT.");
+    CHECK(tokenSignaturesMatch(broken, abbreviated));
+
+    // Different merchants stay apart
+    CHECK_FALSE(tokenSignaturesMatch(computeTokenSignature("REWE Markt"),
+                                     computeTokenSignature("EDEKA Center")));
+
+    // Short names only match exactly - "ing" is a substring of far too
+    // many words to fuzzy-merge
+    CHECK_FALSE(tokenSignaturesMatch(computeTokenSignature("ING"),
+                                     computeTokenSignature("interactive")));
+    CHECK(tokenSignaturesMatch(computeTokenSignature("ING"),
+                               computeTokenSignature("ing")));
+}
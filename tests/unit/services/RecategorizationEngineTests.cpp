@@ -0,0 +1,186 @@
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <fmt/format.h>
+#include "application/services/CategoryMatcher.hpp"
+#include "application/services/RecategorizationEngine.hpp"
+
+using namespace ares;
+
+namespace {
+
+auto makeTransaction(const std::string& id, const std::string& counterparty,
+                     const std::string& description, int64_t cents) -> core::Transaction {
+    core::Date date{std::chrono::year{2026}, std::chrono::month{6}, std::chrono::day{15}};
+    core::Transaction txn{core::TransactionId{id}, core::AccountId{"acc-1"}, date,
+                          core::Money{cents, core::Currency::EUR},
+                          core::TransactionType::Expense};
+    txn.setCounterpartyName(counterparty);
+    txn.setDescription(description);
+    txn.markClean();
+    return txn;
+}
+
+} // namespace
+
+TEST_CASE("RecategorizationEngine matches the sequential pass", "[recategorize]") {
+    std::vector<infrastructure::config::CategorizationRule> rules = {
+        {.pattern = "bergsport", .category = core::TransactionCategory::Shopping, .amountCents = {}},
+    };
+
+    // A mixed batch, larger than the worker count so every shard has rows
+    std::vector<core::Transaction> transactions;
+    for (int i = 0; i < 40; ++i) {
+        auto id = fmt::format("t{}", i);
+        switch (i % 4) {
+            case 0: transactions.push_back(makeTransaction(id, "REWE Markt", "", -2350)); break;
+            case 1: transactions.push_back(makeTransaction(id, "Netflix", "", -1299)); break;
+            case 2: transactions.push_back(makeTransaction(id, "Bergsport Online", "", -8990)); break;
+            default: transactions.push_back(makeTransaction(id, "Unbekannt", "nichts", -100)); break;
+        }
+    }
+    auto sequential = transactions;
+
+    application::services::RecategorizationEngine engine{rules, 4};
+    auto result = engine.run(transactions);
+
+    application::services::CategoryMatcher matcher;
+    matcher.setCustomRules(rules);
+    for (auto& txn : sequential) {
+        auto match = matcher.categorize(txn.counterpartyName().value_or(""),
+                                        txn.description(), txn.amount().cents());
+        txn.setCategory(match.category);
+    }
+
+    for (std::size_t i = 0; i < transactions.size(); ++i) {
+        CHECK(transactions[i].category() == sequential[i].category());
+    }
+    CHECK(result.pending.at({core::TransactionCategory::Groceries, "built-in"}).size() == 10);
+    CHECK(result.pending.at({core::TransactionCategory::Shopping, "bergsport"}).size() == 10);
+}
+
+TEST_CASE("RecategorizationEngine merges rule stats across shards", "[recategorize]") {
+    std::vector<infrastructure::config::CategorizationRule> rules = {
+        {.pattern = "bergsport", .category = core::TransactionCategory::Shopping, .amountCents = {}},
+    };
+
+    std::vector<core::Transaction> transactions;
+    for (int i = 0; i < 12; ++i) {
+        transactions.push_back(makeTransaction(fmt::format("t{}", i), "Bergsport Online", "", -100));
+    }
+
+    application::services::RecategorizationEngine engine{rules, 3};
+    auto result = engine.run(transactions);
+
+    REQUIRE(result.ruleStats.size() == 1);
+    CHECK(result.ruleStats[0].first == "bergsport");
+    CHECK(result.ruleStats[0].second == 12);
+}
+
+TEST_CASE("RecategorizationEngine preserves manual overrides", "[recategorize]") {
+    std::vector<core::Transaction> transactions;
+    transactions.push_back(makeTransaction("t0", "REWE", "", -100));
+    auto overridden = makeTransaction("t1", "REWE", "", -100);
+    overridden.setUserCategoryOverride(core::TransactionCategory::Gift);
+    overridden.setCategory(core::TransactionCategory::Gift);
+    overridden.markClean();
+    transactions.push_back(overridden);
+
+    application::services::RecategorizationEngine engine{
+        std::vector<infrastructure::config::CategorizationRule>{}, 2};
+    auto result = engine.run(transactions);
+
+    CHECK(result.skipped == 1);
+    CHECK(transactions[1].category() == core::TransactionCategory::Gift);
+    REQUIRE(result.pending.size() == 1);
+    CHECK(result.pending.begin()->second.size() == 1);
+}
+
+TEST_CASE("RecategorizationEngine only reports rows that changed", "[recategorize]") {
+    std::vector<core::Transaction> transactions;
+    auto alreadyCorrect = makeTransaction("t0", "REWE", "", -100);
+    alreadyCorrect.setCategory(core::TransactionCategory::Groceries);
+    alreadyCorrect.setMatchedRule("built-in");
+    alreadyCorrect.markClean();
+    transactions.push_back(alreadyCorrect);
+    transactions.push_back(makeTransaction("t1", "REWE", "", -100));
+
+    application::services::RecategorizationEngine engine{
+        std::vector<infrastructure::config::CategorizationRule>{}, 1};
+    auto result = engine.run(transactions);
+
+    REQUIRE(result.pending.size() == 1);
+    const auto& ids = result.pending.at({core::TransactionCategory::Groceries, "built-in"});
+    REQUIRE(ids.size() == 1);
+    CHECK(ids[0].value == "t1");
+}
+
+TEST_CASE("RecategorizationEngine rule state keys rules by match condition", "[recategorize]") {
+    std::vector<infrastructure::config::CategorizationRule> rules = {
+        {.pattern = "bergsport", .category = core::TransactionCategory::Shopping, .amountCents = {}},
+        {.pattern = "", .category = core::TransactionCategory::SavingsTransfer, .amountCents = 1234},
+    };
+
+    auto state = application::services::RecategorizationEngine::ruleState(rules);
+
+    REQUIRE(state.size() == 2);
+    CHECK(state[0].ruleKey == "bergsport");
+    CHECK(state[0].position == 0);
+    CHECK(state[1].ruleKey == "amount:1234");
+    CHECK(state[1].position == 1);
+}
+
+TEST_CASE("RecategorizationEngine incremental plan", "[recategorize]") {
+    using Engine = application::services::RecategorizationEngine;
+
+    std::vector<infrastructure::config::CategorizationRule> rules = {
+        {.pattern = "bergsport", .category = core::TransactionCategory::Shopping, .amountCents = {}},
+        {.pattern = "rewe", .category = core::TransactionCategory::Groceries, .amountCents = {}},
+        {.pattern = "", .category = core::TransactionCategory::SavingsTransfer, .amountCents = 1234},
+    };
+    auto snapshot = Engine::ruleState(rules);
+
+    SECTION("first run has no snapshot and scans everything") {
+        auto plan = Engine::planIncremental({}, snapshot);
+        CHECK(plan.fullScan);
+    }
+
+    SECTION("unchanged rules touch only uncategorized rows") {
+        auto plan = Engine::planIncremental(snapshot, snapshot);
+        CHECK_FALSE(plan.fullScan);
+        CHECK(plan.staleRules.empty());
+    }
+
+    SECTION("a category edit marks only that rule stale") {
+        auto edited = rules;
+        edited[1].category = core::TransactionCategory::Restaurants;
+        auto plan = Engine::planIncremental(snapshot, Engine::ruleState(edited));
+        CHECK_FALSE(plan.fullScan);
+        REQUIRE(plan.staleRules.size() == 1);
+        CHECK(plan.staleRules[0] == "rewe");
+    }
+
+    SECTION("a removed amount rule maps to the shared custom label") {
+        auto reduced = rules;
+        reduced.pop_back();
+        auto plan = Engine::planIncremental(snapshot, Engine::ruleState(reduced));
+        CHECK_FALSE(plan.fullScan);
+        REQUIRE(plan.staleRules.size() == 1);
+        CHECK(plan.staleRules[0] == "custom");
+    }
+
+    SECTION("an added rule forces a full scan") {
+        auto extended = rules;
+        extended.push_back({.pattern = "aldi",
+                            .category = core::TransactionCategory::Groceries,
+                            .amountCents = {}});
+        auto plan = Engine::planIncremental(snapshot, Engine::ruleState(extended));
+        CHECK(plan.fullScan);
+    }
+
+    SECTION("a reorder forces a full scan") {
+        auto reordered = rules;
+        std::swap(reordered[0], reordered[1]);
+        auto plan = Engine::planIncremental(snapshot, Engine::ruleState(reordered));
+        CHECK(plan.fullScan);
+    }
+}
@@ -121,3 +121,89 @@ TEST_CASE("RecurringPattern monthly cost calculation", "[recurrence]") {
         CHECK(monthly.cents() > -4500);
     }
 }
+
+TEST_CASE("RecurrenceDetector incremental mode skips untouched groups", "[recurrence]") {
+    application::services::RecurrenceDetector detector;
+
+    auto makeMonthly = [](const std::string& name, int months, int64_t cents) {
+        std::vector<core::Transaction> txns;
+        for (int i = 0; i < months; ++i) {
+            core::Date date{std::chrono::year{2024},
+                            std::chrono::month{static_cast<unsigned>(i + 1)},
+                            std::chrono::day{15}};
+            core::Transaction txn{
+                core::TransactionId{fmt::format("{}-{}", name, i)},
+                core::AccountId{"acc-1"},
+                date,
+                core::Money{cents, core::Currency::EUR},
+                core::TransactionType::Expense
+            };
+            txn.setCounterpartyName(name);
+            txns.push_back(std::move(txn));
+        }
+        return txns;
+    };
+
+    auto transactions = makeMonthly("Netflix", 3, -1799);
+    auto spotify = makeMonthly("Spotify", 3, -999);
+    transactions.insert(transactions.end(), spotify.begin(), spotify.end());
+
+    SECTION("first run with empty snapshot analyzes everything") {
+        auto detection = detector.detectPatternsIncremental(transactions, {});
+
+        CHECK(detection.patterns.size() == 2);
+        CHECK(detection.unchangedCounterparties.empty());
+        REQUIRE(detection.groupState.size() == 2);
+        CHECK(detection.groupState[0].counterparty == "netflix");
+        CHECK(detection.groupState[0].txnCount == 3);
+    }
+
+    SECTION("second run with no delta skips every group") {
+        auto first = detector.detectPatternsIncremental(transactions, {});
+        auto second = detector.detectPatternsIncremental(transactions, first.groupState);
+
+        CHECK(second.patterns.empty());
+        CHECK(second.unchangedCounterparties.size() == 2);
+    }
+
+    SECTION("a new transaction re-analyzes only its group") {
+        auto first = detector.detectPatternsIncremental(transactions, {});
+
+        auto extra = makeMonthly("Netflix", 4, -1799).back();
+        transactions.push_back(std::move(extra));
+
+        auto second = detector.detectPatternsIncremental(transactions, first.groupState);
+
+        REQUIRE(second.patterns.size() == 1);
+        CHECK(second.patterns[0].counterpartyName == "netflix");
+        CHECK(second.patterns[0].occurrences.size() == 4);
+        REQUIRE(second.unchangedCounterparties.size() == 1);
+        CHECK(second.unchangedCounterparties[0] == "spotify");
+    }
+}
+
+TEST_CASE("RecurrenceDetector folds fuzzy counterparty spellings into one group", "[recurrence]") {
+    application::services::RecurrenceDetector detector;
+
+    const char* spellings[] = {"Sony Int eractive", "SONY INTERACTIVE ENT.",
+                               "Sony Interactive Entertainment"};
+    std::vector<core::Transaction> transactions;
+    for (unsigned m = 1; m <= 3; ++m) {
+        core::Date date{std::chrono::year{2024}, std::chrono::month{m}, std::chrono::day{15}};
+        core::Transaction txn{
+            core::TransactionId{fmt::format("sony-{}", m)},
+            core::AccountId{"acc-1"},
+            date,
+            core::Money{-5999, core::Currency::EUR},
+            core::TransactionType::Expense
+        };
+        txn.setCounterpartyName(spellings[m - 1]);
+        transactions.push_back(std::move(txn));
+    }
+
+    auto patterns = detector.detectPatterns(transactions);
+
+    REQUIRE(patterns.size() == 1);
+    CHECK(patterns[0].frequency == core::RecurrenceFrequency::Monthly);
+    CHECK(patterns[0].occurrences.size() == 3);
+}
@@ -1,5 +1,7 @@
 #include <catch2/catch_test_macros.hpp>
 #include "application/services/ReportService.hpp"
+#include "infrastructure/persistence/DatabaseConnection.hpp"
+#include "infrastructure/persistence/SqliteTransactionRepository.hpp"
 
 using namespace ares;
 using namespace ares::application::services;
@@ -75,3 +77,158 @@ TEST_CASE("ReportService handles empty transactions", "[report]") {
     CHECK(summary.transactionCount == 0);
     CHECK(summary.savingsRate == 0.0);
 }
+
+TEST_CASE("ReportService streaming summaries match vector summaries", "[report]") {
+    auto dbResult = infrastructure::persistence::DatabaseConnection::open(":memory:");
+    REQUIRE(dbResult.has_value());
+    auto db = std::shared_ptr<infrastructure::persistence::DatabaseConnection>(std::move(*dbResult));
+    REQUIRE(db->initializeSchema().has_value());
+    infrastructure::persistence::SqliteTransactionRepository repo{db};
+
+    std::vector<core::Transaction> txns = {
+        makeTxn(2024, 1, 5, 500000, core::TransactionCategory::Salary),
+        makeTxn(2024, 1, 10, -120000, core::TransactionCategory::Housing),
+        makeTxn(2024, 3, 15, -5000, core::TransactionCategory::Groceries),
+        makeTxn(2024, 7, 5, 500000, core::TransactionCategory::Salary),
+    };
+    for (size_t i = 0; i < txns.size(); ++i) {
+        core::Transaction stored{core::TransactionId{"s" + std::to_string(i)},
+                                 txns[i].accountId(), txns[i].date(), txns[i].amount(), txns[i].type()};
+        stored.setCategory(txns[i].category());
+        REQUIRE(repo.save(stored).has_value());
+    }
+
+    ReportService service;
+    core::Date jan{std::chrono::year{2024}, std::chrono::month{1}, std::chrono::day{1}};
+
+    auto vecMonthly = service.monthlySummary(txns, jan);
+    auto streamMonthly = service.monthlySummary(repo, jan);
+    REQUIRE(streamMonthly.has_value());
+    CHECK(streamMonthly->totalIncome.cents() == vecMonthly.totalIncome.cents());
+    CHECK(streamMonthly->totalExpenses.cents() == vecMonthly.totalExpenses.cents());
+    CHECK(streamMonthly->transactionCount == vecMonthly.transactionCount);
+
+    auto vecYearly = service.yearlySummary(txns, 2024);
+    auto streamYearly = service.yearlySummary(repo, 2024);
+    REQUIRE(streamYearly.has_value());
+    CHECK(streamYearly->totalIncome.cents() == vecYearly.totalIncome.cents());
+    CHECK(streamYearly->totalExpenses.cents() == vecYearly.totalExpenses.cents());
+    REQUIRE(streamYearly->months.size() == 12);
+    for (size_t m = 0; m < 12; ++m) {
+        CHECK(streamYearly->months[m].netAmount.cents() == vecYearly.months[m].netAmount.cents());
+    }
+}
+
+TEST_CASE("ReportService cache follows the repository's data generation", "[report]") {
+    auto dbResult = infrastructure::persistence::DatabaseConnection::open(":memory:");
+    REQUIRE(dbResult.has_value());
+    auto db = std::shared_ptr<infrastructure::persistence::DatabaseConnection>(std::move(*dbResult));
+    REQUIRE(db->initializeSchema().has_value());
+    infrastructure::persistence::SqliteTransactionRepository repo{db};
+
+    auto generationBefore = repo.generation();
+    core::Transaction first{core::TransactionId{"g1"}, core::AccountId{"a"},
+                            core::Date{std::chrono::year{2024}, std::chrono::month{1}, std::chrono::day{5}},
+                            core::Money{500000, core::Currency::EUR}, core::TransactionType::Income};
+    REQUIRE(repo.save(first).has_value());
+    CHECK(repo.generation() > generationBefore);
+
+    ReportService service;
+    core::Date jan{std::chrono::year{2024}, std::chrono::month{1}, std::chrono::day{1}};
+
+    auto summary = service.monthlySummary(repo, jan);
+    REQUIRE(summary.has_value());
+    CHECK(summary->totalIncome.cents() == 500000);
+
+    // Unchanged generation: the cached summary is returned as-is
+    auto cached = service.monthlySummary(repo, jan);
+    REQUIRE(cached.has_value());
+    CHECK(cached->totalIncome.cents() == 500000);
+
+    // A write bumps the generation; the next read must see the new row
+    core::Transaction second{core::TransactionId{"g2"}, core::AccountId{"a"},
+                             core::Date{std::chrono::year{2024}, std::chrono::month{1}, std::chrono::day{20}},
+                             core::Money{-120000, core::Currency::EUR}, core::TransactionType::Expense};
+    REQUIRE(repo.save(second).has_value());
+
+    auto refreshed = service.monthlySummary(repo, jan);
+    REQUIRE(refreshed.has_value());
+    CHECK(refreshed->totalExpenses.cents() == 120000);
+    CHECK(refreshed->transactionCount == 2);
+}
+
+TEST_CASE("ReportService columnar trends match the vector overload", "[report]") {
+    auto dbResult = infrastructure::persistence::DatabaseConnection::open(":memory:");
+    REQUIRE(dbResult.has_value());
+    auto db = std::shared_ptr<infrastructure::persistence::DatabaseConnection>(std::move(*dbResult));
+    REQUIRE(db->initializeSchema().has_value());
+    infrastructure::persistence::SqliteTransactionRepository repo{db};
+
+    std::vector<core::Transaction> txns;
+    for (unsigned m = 1; m <= 6; ++m) {
+        txns.push_back(makeTxn(2024, m, 10, -10000 - static_cast<int>(m) * 500,
+                               core::TransactionCategory::Groceries));
+        txns.push_back(makeTxn(2024, m, 12, -4500, core::TransactionCategory::Entertainment));
+    }
+    for (size_t i = 0; i < txns.size(); ++i) {
+        core::Transaction stored{core::TransactionId{"c" + std::to_string(i)},
+                                 txns[i].accountId(), txns[i].date(), txns[i].amount(), txns[i].type()};
+        stored.setCategory(txns[i].category());
+        REQUIRE(repo.save(stored).has_value());
+    }
+
+    ReportService service;
+    core::Date endMonth{std::chrono::year{2024}, std::chrono::month{6}, std::chrono::day{1}};
+
+    auto fromVectors = service.spendingTrends(txns, endMonth, 6);
+    auto fromColumns = service.spendingTrends(repo, endMonth, 6);
+    REQUIRE(fromColumns.has_value());
+
+    REQUIRE(fromColumns->size() == fromVectors.size());
+    for (size_t i = 0; i < fromVectors.size(); ++i) {
+        CHECK((*fromColumns)[i].category == fromVectors[i].category);
+        CHECK((*fromColumns)[i].averageMonthly.cents() == fromVectors[i].averageMonthly.cents());
+        CHECK((*fromColumns)[i].changePercent == fromVectors[i].changePercent);
+        REQUIRE((*fromColumns)[i].monthlyAmounts.size() == fromVectors[i].monthlyAmounts.size());
+        for (size_t m = 0; m < fromVectors[i].monthlyAmounts.size(); ++m) {
+            CHECK((*fromColumns)[i].monthlyAmounts[m].second.cents() ==
+                  fromVectors[i].monthlyAmounts[m].second.cents());
+        }
+    }
+}
+
+TEST_CASE("ReportService parallel yearly summary matches sequential", "[report]") {
+    std::vector<core::Transaction> txns;
+    for (unsigned m = 1; m <= 12; ++m) {
+        txns.push_back(makeTxn(2024, m, 5, 500000, core::TransactionCategory::Salary));
+        txns.push_back(makeTxn(2024, m, 10, -120000 - static_cast<int>(m) * 100,
+                               core::TransactionCategory::Housing));
+        txns.push_back(makeTxn(2024, m, 15, -5000, core::TransactionCategory::Groceries));
+    }
+    txns.push_back(makeTxn(2023, 12, 30, -99999, core::TransactionCategory::Other));
+
+    ReportService sequential{1};
+    ReportService parallel{4};
+
+    auto expected = sequential.yearlySummary(txns, 2024);
+    auto actual = parallel.yearlySummary(txns, 2024);
+
+    CHECK(actual.totalIncome.cents() == expected.totalIncome.cents());
+    CHECK(actual.totalExpenses.cents() == expected.totalExpenses.cents());
+    CHECK(actual.netAmount.cents() == expected.netAmount.cents());
+    REQUIRE(actual.months.size() == expected.months.size());
+    for (size_t m = 0; m < expected.months.size(); ++m) {
+        CHECK(actual.months[m].transactionCount == expected.months[m].transactionCount);
+        CHECK(actual.months[m].totalIncome.cents() == expected.months[m].totalIncome.cents());
+        CHECK(actual.months[m].totalExpenses.cents() == expected.months[m].totalExpenses.cents());
+        REQUIRE(actual.months[m].expensesByCategory.size() ==
+                expected.months[m].expensesByCategory.size());
+        for (size_t c = 0; c < expected.months[m].expensesByCategory.size(); ++c) {
+            CHECK(actual.months[m].expensesByCategory[c].category ==
+                  expected.months[m].expensesByCategory[c].category);
+            CHECK(actual.months[m].expensesByCategory[c].amount.cents() ==
+                  expected.months[m].expensesByCategory[c].amount.cents());
+        }
+    }
+    REQUIRE(actual.expensesByCategory.size() == expected.expensesByCategory.size());
+}
@@ -0,0 +1,124 @@
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include "application/services/RuleAnalyzer.hpp"
+
+using namespace ares;
+
+namespace {
+
+auto makeTransaction(const std::string& id, const std::string& counterparty,
+                     const std::string& description, int64_t cents) -> core::Transaction {
+    core::Date date{std::chrono::year{2026}, std::chrono::month{6}, std::chrono::day{15}};
+    core::Transaction txn{core::TransactionId{id}, core::AccountId{"acc-1"}, date,
+                          core::Money{cents, core::Currency::EUR},
+                          core::TransactionType::Expense};
+    txn.setCounterpartyName(counterparty);
+    txn.setDescription(description);
+    txn.markClean();
+    return txn;
+}
+
+} // namespace
+
+TEST_CASE("RuleAnalyzer counts hits and probes per rule", "[analyze]") {
+    std::vector<infrastructure::config::CategorizationRule> rules = {
+        {.pattern = "rewe", .category = core::TransactionCategory::Groceries, .amountCents = {}},
+        {.pattern = "netflix", .category = core::TransactionCategory::Subscriptions, .amountCents = {}},
+    };
+
+    std::vector<core::Transaction> transactions;
+    transactions.push_back(makeTransaction("t0", "REWE Markt", "", -2350));
+    transactions.push_back(makeTransaction("t1", "Netflix", "", -1299));
+    transactions.push_back(makeTransaction("t2", "Unbekannt", "", -100));
+
+    application::services::RuleAnalyzer analyzer{rules};
+    auto analysis = analyzer.analyze(transactions);
+
+    REQUIRE(analysis.rules.size() == 2);
+    CHECK(analysis.transactionsScanned == 3);
+    CHECK(analysis.rules[0].hits == 1);
+    // First-match-wins: every row probes rule 0, only rows rule 0 misses
+    // reach rule 1
+    CHECK(analysis.rules[0].probes == 3);
+    CHECK(analysis.rules[1].hits == 1);
+    CHECK(analysis.rules[1].probes == 2);
+    CHECK(analysis.totalScannedBytes > 0);
+}
+
+TEST_CASE("RuleAnalyzer flags rules shadowed by an earlier substring", "[analyze]") {
+    std::vector<infrastructure::config::CategorizationRule> rules = {
+        {.pattern = "rewe", .category = core::TransactionCategory::Groceries, .amountCents = {}},
+        {.pattern = "rewe markt", .category = core::TransactionCategory::Shopping, .amountCents = {}},
+        {.pattern = "netflix", .category = core::TransactionCategory::Subscriptions, .amountCents = {}},
+    };
+
+    application::services::RuleAnalyzer analyzer{rules};
+    auto analysis = analyzer.analyze({});
+
+    // Any text containing "rewemarkt" (space-normalized) contains "rewe"
+    REQUIRE(analysis.rules[1].shadowedBy.has_value());
+    CHECK(*analysis.rules[1].shadowedBy == 0);
+    CHECK_FALSE(analysis.rules[0].shadowedBy.has_value());
+    CHECK_FALSE(analysis.rules[2].shadowedBy.has_value());
+}
+
+TEST_CASE("RuleAnalyzer flags duplicate amount rules as shadowed", "[analyze]") {
+    std::vector<infrastructure::config::CategorizationRule> rules = {
+        {.pattern = "amount:50.00", .category = core::TransactionCategory::SavingsTransfer,
+         .amountCents = 5000},
+        {.pattern = "amount:50.00", .category = core::TransactionCategory::Gift,
+         .amountCents = -5000},
+    };
+
+    application::services::RuleAnalyzer analyzer{rules};
+    auto analysis = analyzer.analyze({});
+
+    // The amount index keeps the earliest rule per absolute amount, so the
+    // second rule can never fire
+    REQUIRE(analysis.rules[1].shadowedBy.has_value());
+    CHECK(*analysis.rules[1].shadowedBy == 0);
+}
+
+TEST_CASE("RuleAnalyzer reports dead rules and skips override rows", "[analyze]") {
+    std::vector<infrastructure::config::CategorizationRule> rules = {
+        {.pattern = "defunct merchant", .category = core::TransactionCategory::Shopping,
+         .amountCents = {}},
+        {.pattern = "rewe", .category = core::TransactionCategory::Groceries, .amountCents = {}},
+    };
+
+    std::vector<core::Transaction> transactions;
+    transactions.push_back(makeTransaction("t0", "REWE Markt", "", -2350));
+    auto overridden = makeTransaction("t1", "REWE Markt", "", -2350);
+    overridden.setUserCategoryOverride(core::TransactionCategory::Gift);
+    transactions.push_back(overridden);
+
+    application::services::RuleAnalyzer analyzer{rules};
+    auto analysis = analyzer.analyze(transactions);
+
+    CHECK(analysis.transactionsScanned == 1);
+    CHECK(analysis.rules[0].hits == 0);
+    CHECK(analysis.rules[0].probes == 1);
+    CHECK_FALSE(analysis.rules[0].shadowedBy.has_value());
+    CHECK(analysis.rules[1].hits == 1);
+}
+
+TEST_CASE("RuleAnalyzer amount rules match via the index without scan cost", "[analyze]") {
+    std::vector<infrastructure::config::CategorizationRule> rules = {
+        {.pattern = "amount:12.99", .category = core::TransactionCategory::Subscriptions,
+         .amountCents = 1299},
+        {.pattern = "rewe", .category = core::TransactionCategory::Groceries, .amountCents = {}},
+    };
+
+    std::vector<core::Transaction> transactions;
+    transactions.push_back(makeTransaction("t0", "Netflix", "", -1299));
+    transactions.push_back(makeTransaction("t1", "REWE Markt", "", -2350));
+
+    application::services::RuleAnalyzer analyzer{rules};
+    auto analysis = analyzer.analyze(transactions);
+
+    CHECK(analysis.rules[0].hits == 1);
+    CHECK(analysis.rules[0].scannedBytes == 0);
+    CHECK(analysis.rules[1].hits == 1);
+    // Only the row the amount rule did not claim probes the pattern rule
+    CHECK(analysis.rules[1].probes == 1);
+}
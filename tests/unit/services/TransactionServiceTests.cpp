@@ -163,6 +163,61 @@ TEST_CASE("TransactionService listAll", "[transaction-service]") {
     }
 }
 
+TEST_CASE("TransactionService streamAll", "[transaction-service]") {
+    auto db = createInMemoryDb();
+    auto accountId = createTestAccount(db);
+    SqliteTransactionRepository repo{db};
+    TransactionService service;
+
+    for (int i = 0; i < 5; ++i) {
+        core::Date date{std::chrono::year{2024}, std::chrono::month{5},
+                        std::chrono::day{static_cast<unsigned>(i + 1)}};
+        auto t = service.createTransaction(
+            accountId, date, core::Money{-1000 * (i + 1)},
+            core::TransactionType::Expense, std::nullopt, std::nullopt, repo);
+        REQUIRE(t.has_value());
+    }
+
+    SECTION("streams newest-first with the limit pushed down") {
+        auto stream = service.streamAll(repo, 3);
+        REQUIRE(stream.has_value());
+
+        std::vector<core::Date> dates;
+        for (const auto& txn : *stream) {
+            dates.push_back(txn.date());
+        }
+        REQUIRE(dates.size() == 3);
+        CHECK(dates[0] == core::Date{std::chrono::year{2024}, std::chrono::month{5},
+                                     std::chrono::day{5}});
+        CHECK(dates[2] == core::Date{std::chrono::year{2024}, std::chrono::month{5},
+                                     std::chrono::day{3}});
+    }
+
+    SECTION("limit of zero streams the whole history") {
+        auto stream = service.streamAll(repo);
+        REQUIRE(stream.has_value());
+
+        int count = 0;
+        for ([[maybe_unused]] const auto& txn : *stream) {
+            ++count;
+        }
+        CHECK(count == 5);
+    }
+
+    SECTION("abandoning the stream mid-walk leaves the connection usable") {
+        {
+            auto stream = service.streamAll(repo);
+            REQUIRE(stream.has_value());
+            auto it = stream->begin();  // first row hydrated, then dropped
+            REQUIRE(it != stream->end());
+        }
+
+        auto all = repo.findAll();
+        REQUIRE(all.has_value());
+        CHECK(all->size() == 5);
+    }
+}
+
 TEST_CASE("TransactionService parseTransactionCategory", "[transaction-service]") {
     CHECK(TransactionService::parseTransactionCategory("salary") == core::TransactionCategory::Salary);
     CHECK(TransactionService::parseTransactionCategory("freelance") == core::TransactionCategory::Freelance);
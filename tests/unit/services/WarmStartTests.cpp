@@ -0,0 +1,109 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstdlib>
+#include <filesystem>
+#include "application/services/WarmStart.hpp"
+#include "infrastructure/persistence/DatabaseConnection.hpp"
+#include "infrastructure/persistence/SqliteTransactionRepository.hpp"
+
+using namespace ares;
+using application::services::WarmStart;
+
+namespace {
+
+// Point the snapshot at a private directory so tests never touch (or are
+// confused by) a real ~/.cache/ares
+struct CacheDirGuard {
+    std::filesystem::path dir;
+
+    CacheDirGuard() {
+        dir = std::filesystem::temp_directory_path() / "ares-test-warmstart";
+        std::filesystem::remove_all(dir);
+        std::filesystem::create_directories(dir);
+        setenv("XDG_CACHE_HOME", dir.c_str(), 1);
+    }
+
+    ~CacheDirGuard() {
+        unsetenv("XDG_CACHE_HOME");
+        std::filesystem::remove_all(dir);
+    }
+};
+
+struct TestDatabase {
+    std::filesystem::path path;
+    std::shared_ptr<infrastructure::persistence::DatabaseConnection> db;
+
+    TestDatabase() {
+        path = std::filesystem::temp_directory_path() / "ares_warmstart_test.db";
+        std::filesystem::remove(path);
+        auto opened = infrastructure::persistence::DatabaseConnection::open(path);
+        REQUIRE(opened.has_value());
+        db = std::shared_ptr<infrastructure::persistence::DatabaseConnection>{std::move(*opened)};
+        REQUIRE(db->initializeSchema().has_value());
+    }
+
+    ~TestDatabase() {
+        db.reset();
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+        auto wal = path;
+        wal += "-wal";
+        std::filesystem::remove(wal, ec);
+        auto shm = path;
+        shm += "-shm";
+        std::filesystem::remove(shm, ec);
+    }
+};
+
+auto saveOne(TestDatabase& database, const std::string& id) -> void {
+    infrastructure::persistence::SqliteTransactionRepository repo{database.db};
+    core::Date date{std::chrono::year{2026}, std::chrono::month{6}, std::chrono::day{1}};
+    core::Transaction txn{core::TransactionId{id}, core::AccountId{"acc-1"}, date,
+                          core::Money{-500, core::Currency::EUR},
+                          core::TransactionType::Expense};
+    REQUIRE(repo.save(txn).has_value());
+}
+
+} // namespace
+
+TEST_CASE("WarmStart snapshot round-trips against an unchanged database", "[warmstart]") {
+    CacheDirGuard cacheDir;
+    TestDatabase database;
+
+    WarmStart::write(*database.db, database.path);
+    REQUIRE(std::filesystem::exists(WarmStart::snapshotPath()));
+
+    CHECK(WarmStart::apply(*database.db, database.path));
+    // Applying does not consume the snapshot
+    CHECK(WarmStart::apply(*database.db, database.path));
+}
+
+TEST_CASE("WarmStart rejects a snapshot after the database changes", "[warmstart]") {
+    CacheDirGuard cacheDir;
+    TestDatabase database;
+
+    WarmStart::write(*database.db, database.path);
+    saveOne(database, "t1");
+
+    // Row counts no longer match what the snapshot recorded
+    CHECK_FALSE(WarmStart::apply(*database.db, database.path));
+    // The stale snapshot was dropped
+    CHECK_FALSE(std::filesystem::exists(WarmStart::snapshotPath()));
+}
+
+TEST_CASE("WarmStart misses cleanly without a snapshot", "[warmstart]") {
+    CacheDirGuard cacheDir;
+    TestDatabase database;
+
+    CHECK_FALSE(WarmStart::apply(*database.db, database.path));
+}
+
+TEST_CASE("WarmStart rejects a truncated snapshot", "[warmstart]") {
+    CacheDirGuard cacheDir;
+    TestDatabase database;
+
+    WarmStart::write(*database.db, database.path);
+    std::filesystem::resize_file(WarmStart::snapshotPath(), 8);
+
+    CHECK_FALSE(WarmStart::apply(*database.db, database.path));
+    CHECK_FALSE(std::filesystem::exists(WarmStart::snapshotPath()));
+}
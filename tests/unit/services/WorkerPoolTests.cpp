@@ -0,0 +1,80 @@
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <latch>
+#include <numeric>
+#include <vector>
+#include "application/WorkerPool.hpp"
+
+using namespace ares::application;
+
+TEST_CASE("WorkerPool parallelFor covers the range exactly once", "[WorkerPool]") {
+    WorkerPool pool{4};
+    constexpr std::size_t kCount = 10'000;
+    std::vector<std::atomic<int>> visits(kCount);
+
+    pool.parallelFor(kCount, 4, [&](std::size_t, std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            visits[i].fetch_add(1);
+        }
+    });
+
+    for (const auto& visit : visits) {
+        REQUIRE(visit.load() == 1);
+    }
+}
+
+TEST_CASE("WorkerPool clamps shard counts to the range", "[WorkerPool]") {
+    WorkerPool pool{4};
+
+    SECTION("More shards than elements") {
+        std::vector<std::atomic<int>> visits(3);
+        pool.parallelFor(3, 16, [&](std::size_t, std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                visits[i].fetch_add(1);
+            }
+        });
+        CHECK(visits[0].load() == 1);
+        CHECK(visits[1].load() == 1);
+        CHECK(visits[2].load() == 1);
+    }
+
+    SECTION("Empty range never invokes the body") {
+        bool invoked = false;
+        pool.parallelFor(0, 4, [&](std::size_t, std::size_t, std::size_t) {
+            invoked = true;
+        });
+        CHECK_FALSE(invoked);
+    }
+
+    SECTION("Single shard runs inline") {
+        std::size_t seenCount = 0;
+        pool.parallelFor(5, 1, [&](std::size_t shard, std::size_t begin, std::size_t end) {
+            CHECK(shard == 0);
+            CHECK(begin == 0);
+            seenCount = end;
+        });
+        CHECK(seenCount == 5);
+    }
+}
+
+TEST_CASE("WorkerPool runs submitted tasks", "[WorkerPool]") {
+    WorkerPool pool{2};
+    std::atomic<int> ran{0};
+    std::latch done{8};
+
+    for (int i = 0; i < 8; ++i) {
+        pool.submit([&] {
+            ran.fetch_add(1);
+            done.count_down();
+        });
+    }
+
+    done.wait();
+    CHECK(ran.load() == 8);
+}
+
+TEST_CASE("WorkerPool shared instance matches hardware concurrency", "[WorkerPool]") {
+    auto& pool = WorkerPool::shared();
+    CHECK(pool.workerCount() >= 1);
+    CHECK(&pool == &WorkerPool::shared());
+}